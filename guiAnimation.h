@@ -0,0 +1,82 @@
+#ifndef GUIANIMATION_H
+#define GUIANIMATION_H
+
+#include <stdint.h>
+#include "mathUtils.h"
+
+// Animated positions of the gui objects that move, kept apart from their
+// textures and tiles in one array per field so a frame steps them with one
+// kernel pass per spring. Objects sharing a spring take a contiguous range of
+// slots. The kernel has no branches and no calls, so the host vectorizes it;
+// the overlay runs it as a plain loop.
+
+#ifndef GUI_ANIMATION_SLOTS
+#define GUI_ANIMATION_SLOTS 64
+#endif
+
+#define GUI_SLEEP_DISTANCE 1 // Pixels from its target a coordinate may rest at
+#define GUI_SLEEP_SPEED 8 // Pixels per second below which it has stopped
+
+typedef struct {
+	scalar_t x[GUI_ANIMATION_SLOTS];
+	scalar_t y[GUI_ANIMATION_SLOTS];
+	scalar_t targetX[GUI_ANIMATION_SLOTS];
+	scalar_t targetY[GUI_ANIMATION_SLOTS];
+	scalar_t velocityX[GUI_ANIMATION_SLOTS];
+	scalar_t velocityY[GUI_ANIMATION_SLOTS];
+} guiAnimation_t;
+
+guiAnimation_t guiAnimation;
+
+void construct_guiAnimation_t(guiAnimation_t* anim) {
+	for (int i = 0; i < GUI_ANIMATION_SLOTS; i++) {
+		anim->x[i] = 0;
+		anim->y[i] = 0;
+		anim->targetX[i] = 0;
+		anim->targetY[i] = 0;
+		anim->velocityX[i] = 0;
+		anim->velocityY[i] = 0;
+	}
+}
+
+// Step one coordinate of count slots. A coordinate that comes to rest snaps
+// onto its target; returns how many are still moving.
+static inline uint32_t guiAnimationStepAxis(spring_t* spring, scalar_t* restrict position, scalar_t* restrict velocity, const scalar_t* restrict target, int count) {
+	scalar_t pp = spring->pp, pv = spring->pv, vp = spring->vp, vv = spring->vv;
+	scalar_t distance = SCALAR(GUI_SLEEP_DISTANCE), speed = SCALAR(GUI_SLEEP_SPEED);
+	uint32_t moving = 0;
+
+	for (int i = 0; i < count; i++) {
+		scalar_t offset = position[i] - target[i];
+		scalar_t p = scalarMul(pp, offset) + scalarMul(pv, velocity[i]);
+		scalar_t v = scalarMul(vp, offset) + scalarMul(vv, velocity[i]);
+		// Snapping scales by 0 or 1 rather than branching, so the loop vectorizes
+		int rest = (p <= distance) & (p >= -distance) & (v < speed) & (v > -speed);
+		scalar_t keep = 1 - rest; // A plain 1, not SCALAR_ONE
+
+		position[i] = target[i] + p * keep;
+		velocity[i] = v * keep;
+		moving += 1 - rest;
+	}
+	return moving;
+}
+
+// Step slots first to first + count - 1 on spring by deltaTime; returns how
+// many of their coordinates are still moving
+uint32_t update_guiAnimation_t(guiAnimation_t* anim, int first, int count, spring_t* spring, scalar_t deltaTime) {
+	springStep(spring, deltaTime);
+	return guiAnimationStepAxis(spring, anim->x + first, anim->velocityX + first, anim->targetX + first, count)
+		+ guiAnimationStepAxis(spring, anim->y + first, anim->velocityY + first, anim->targetY + first, count);
+}
+
+// Put count slots from first straight onto their targets
+void guiAnimationSnap(guiAnimation_t* anim, int first, int count) {
+	for (int i = first; i < first + count; i++) {
+		anim->x[i] = anim->targetX[i];
+		anim->y[i] = anim->targetY[i];
+		anim->velocityX[i] = 0;
+		anim->velocityY[i] = 0;
+	}
+}
+
+#endif
@@ -0,0 +1,154 @@
+// Host benchmark for guiAnimation.h: steps synthetic menu objects with the old
+// per-object loop over guiObject_t and with the batched guiAnimation_t
+// kernel, 48 objects as in the menu and a large synthetic set, and reports
+// the cost per object per frame and how far the two end up apart.
+//
+// Build: cc -O3 -std=gnu99 -fgnu89-inline -I. -Ihost host/anim_bench.c -o anim_bench
+// Usage: anim_bench [objects] [frames]
+//
+// objects defaults to 1024, frames to 2000. -O3 lets the compiler vectorize
+// the kernel; adding -fno-tree-vectorize gives the scalar loop the overlay
+// runs. Every object is sent somewhere new once a second, so at any time some
+// are moving and some have come to rest.
+
+#define GUI_ANIMATION_SLOTS 4096
+
+#include "hostHarness.h"
+#include "guiAnimation.h"
+
+#define BENCH_SETTLE_TIME SCALAR(0.9)
+#define BENCH_RETARGET_FRAMES 20
+#define BENCH_FRAMETIME SCALAR(0.05)
+
+// guiObject_t as it was before its animation moved into guiAnimation_t, and
+// its update, kept as the baseline
+typedef struct {
+	gfx_screen_tile_t tile;
+	gfx_texture_t texture;
+	uint16_t textureId;
+	spring_t spring;
+	scalar_t lastUpdate;
+	scalar_t targetX;
+	scalar_t targetY;
+	scalar_t velocityX;
+	scalar_t velocityY;
+	scalar_t x;
+	scalar_t y;
+	uint8_t asleep;
+} benchGuiObject_t;
+
+static uint8_t updateBenchGuiObject(benchGuiObject_t* guiObject, scalar_t currentTime) {
+	if (guiObject->asleep) {
+		if (guiObject->tile.x == scalarToInt(guiObject->targetX) && guiObject->tile.y == scalarToInt(guiObject->targetY)) {
+			guiObject->lastUpdate = currentTime;
+			return 1;
+		}
+		guiObject->asleep = 0;
+	}
+
+	scalar_t deltaTime = timeSince(currentTime, guiObject->lastUpdate);
+	interpolateFloat(deltaTime, &guiObject->spring, &guiObject->velocityX, &guiObject->x, guiObject->targetX);
+	interpolateFloat(deltaTime, &guiObject->spring, &guiObject->velocityY, &guiObject->y, guiObject->targetY);
+
+	scalar_t dx = guiObject->x - guiObject->targetX;
+	scalar_t dy = guiObject->y - guiObject->targetY;
+	scalar_t distance = SCALAR(GUI_SLEEP_DISTANCE), speed = SCALAR(GUI_SLEEP_SPEED);
+	if (dx <= distance && dx >= -distance && dy <= distance && dy >= -distance
+		&& guiObject->velocityX < speed && guiObject->velocityX > -speed
+		&& guiObject->velocityY < speed && guiObject->velocityY > -speed) {
+		guiObject->x = guiObject->targetX;
+		guiObject->y = guiObject->targetY;
+		guiObject->velocityX = 0;
+		guiObject->velocityY = 0;
+		guiObject->asleep = 1;
+	}
+	guiObject->tile.x = scalarToInt(guiObject->x);
+	guiObject->tile.y = scalarToInt(guiObject->y);
+
+	guiObject->lastUpdate = currentTime;
+	return guiObject->asleep;
+}
+
+// Target of object i after retarget number round, on screen
+static void benchTarget(uint32_t i, uint32_t round, scalar_t* x, scalar_t* y) {
+	uint32_t hash = (i * 0x9E3779B1u) ^ (round * 0x85EBCA77u);
+	hash ^= hash >> 15;
+	hash *= 0x2C1B3C6Du;
+	hash ^= hash >> 12;
+	*x = scalarFromInt(hash % 320);
+	*y = scalarFromInt((hash >> 16) % 240);
+}
+
+typedef struct {
+	uint64_t objectNs;
+	uint64_t batchNs;
+	int maxApart; // Pixels between the two after the last frame
+} benchResult_t;
+
+static benchResult_t runBench(uint32_t count, uint32_t frames) {
+	static benchGuiObject_t objects[GUI_ANIMATION_SLOTS];
+	static gfx_screen_tile_t tiles[GUI_ANIMATION_SLOTS];
+	benchResult_t result = { 0, 0, 0 };
+
+	spring_t spring;
+	construct_spring_t(&spring, BENCH_SETTLE_TIME);
+	construct_guiAnimation_t(&guiAnimation);
+	for (uint32_t i = 0; i < count; i++) {
+		memset(&objects[i], 0, sizeof(objects[i]));
+		construct_spring_t(&objects[i].spring, BENCH_SETTLE_TIME);
+	}
+
+	scalar_t currentTime = 0;
+	for (uint32_t frame = 0; frame < frames; frame++) {
+		if (frame % BENCH_RETARGET_FRAMES == 0) {
+			for (uint32_t i = 0; i < count; i++) {
+				benchTarget(i, frame / BENCH_RETARGET_FRAMES, &objects[i].targetX, &objects[i].targetY);
+				guiAnimation.targetX[i] = objects[i].targetX;
+				guiAnimation.targetY[i] = objects[i].targetY;
+			}
+		}
+		currentTime = timeAdd(currentTime, BENCH_FRAMETIME);
+
+		uint64_t start = hostClock_ns();
+		for (uint32_t i = 0; i < count; i++) updateBenchGuiObject(&objects[i], currentTime);
+		uint64_t middle = hostClock_ns();
+		update_guiAnimation_t(&guiAnimation, 0, count, &spring, BENCH_FRAMETIME);
+		for (uint32_t i = 0; i < count; i++) {
+			tiles[i].x = scalarToInt(guiAnimation.x[i]);
+			tiles[i].y = scalarToInt(guiAnimation.y[i]);
+		}
+		uint64_t end = hostClock_ns();
+
+		result.objectNs += middle - start;
+		result.batchNs += end - middle;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		int dx = abs(objects[i].tile.x - tiles[i].x);
+		int dy = abs(objects[i].tile.y - tiles[i].y);
+		if (dx > result.maxApart) result.maxApart = dx;
+		if (dy > result.maxApart) result.maxApart = dy;
+	}
+	return result;
+}
+
+static void report(uint32_t count, uint32_t frames, benchResult_t* result) {
+	double scale = (double)count * frames;
+	printf("%5u objects  per-object %6.2f ns  batched %6.2f ns  %5.2fx  %d px apart\n", count,
+		result->objectNs / scale, result->batchNs / scale, (double)result->objectNs / result->batchNs, result->maxApart);
+}
+
+int main(int argc, char** argv) {
+	uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], 0, 0) : 1024;
+	uint32_t frames = argc > 2 ? (uint32_t)strtoul(argv[2], 0, 0) : 2000;
+	if (count > GUI_ANIMATION_SLOTS) count = GUI_ANIMATION_SLOTS;
+	if (!count) count = 1;
+	if (!frames) frames = 1;
+
+	// The menu's own count runs longer so its timings are not all clock overhead
+	benchResult_t menu = runBench(48, frames * 20);
+	benchResult_t synthetic = runBench(count, frames);
+	report(48, frames * 20, &menu);
+	report(count, frames, &synthetic);
+	return menu.maxApart > 1 || synthetic.maxApart > 1;
+}
@@ -0,0 +1,102 @@
+// Host benchmark for menuArena.h: churns an arena the size of the texture
+// cache's budget with allocations of texture sizes, checks after every one
+// that its counts match its blocks, and reports the cost of each call, the
+// high water and fragmentation.
+//
+// Build: cc -O2 -std=gnu99 -fgnu89-inline -I. -Ihost host/arena_bench.c -o arena_bench
+// Usage: arena_bench [size] [operations]
+//
+// size defaults to 0x8000 bytes, operations to 200000. Sizes are drawn from
+// the ones textures come in plus a few odd ones, and the arena is kept close
+// to full so allocations fail and blocks have to merge.
+
+#include "hostHarness.h"
+#include "menuArena.h"
+
+#define BENCH_LIVE 64 // Blocks held at once at most
+
+static const uint32_t benchSizes[] = { 0, 1, 32, 128, 512, 1000, 2048, 4096, 8 };
+
+static uint32_t benchRandom(uint32_t* state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+// Bytes a block for size takes, header included
+static inline uint32_t benchBlock(uint32_t size) {
+	return (size + ARENA_HEADER + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+// Walk the blocks; returns 0 when they do not tile the arena, disagree with
+// its counts or hold more than the requested bytes, which callers budgeting
+// by request size (textureCache_t) rely on
+static int benchCheck(arena_t* arena, uint32_t requested) {
+	uint32_t used = 0, blocks = 0, offset = 0;
+	while (offset < arena->size) {
+		uint32_t header = *arenaHeader(arena, offset);
+		uint32_t blockSize = header & ~ARENA_USED;
+		if (blockSize < ARENA_HEADER || blockSize % ARENA_ALIGN) return 0;
+		if (header & ARENA_USED) {
+			used += blockSize;
+			blocks++;
+		}
+		offset += blockSize;
+	}
+	return offset == arena->size && used == arena->used && used == requested && blocks == arena->blocks && arena->highWater <= arena->size;
+}
+
+int main(int argc, char** argv) {
+	uint32_t size = argc > 1 ? (uint32_t)strtoul(argv[1], 0, 0) : 0x8000;
+	uint32_t operations = argc > 2 ? (uint32_t)strtoul(argv[2], 0, 0) : 200000;
+	if (size < 0x1000) size = 0x1000;
+
+	uint8_t* base = malloc(size);
+	arena_t arena;
+	construct_arena_t(&arena, base, size);
+
+	void* live[BENCH_LIVE] = { 0 };
+	uint32_t liveBytes[BENCH_LIVE] = { 0 };
+	uint32_t requested = 0, state = 0x2545F491, allocs = 0, frees = 0, fragmentation = 0;
+	uint64_t allocNs = 0, freeNs = 0;
+	int ok = 1;
+
+	for (uint32_t i = 0; i < operations && ok; i++) {
+		uint32_t slot = benchRandom(&state) % BENCH_LIVE;
+		uint64_t start = hostClock_ns();
+		if (live[slot]) {
+			arenaFree(&arena, live[slot]);
+			live[slot] = 0;
+			requested -= benchBlock(liveBytes[slot]);
+			freeNs += hostClock_ns() - start;
+			frees++;
+		}
+		else {
+			uint32_t bytes = benchSizes[benchRandom(&state) % (sizeof(benchSizes) / sizeof(benchSizes[0]))];
+			live[slot] = arenaAlloc(&arena, bytes);
+			allocNs += hostClock_ns() - start;
+			allocs++;
+			if (live[slot]) {
+				memset(live[slot], 0xA5, bytes);
+				liveBytes[slot] = bytes;
+				requested += benchBlock(bytes);
+			}
+		}
+		fragmentation += arenaFragmentation(&arena);
+		ok = benchCheck(&arena, requested);
+	}
+
+	for (int i = 0; i < BENCH_LIVE; i++) arenaFree(&arena, live[i]);
+	// Everything freed merges back into the one block it started as
+	ok &= benchCheck(&arena, 0) && !arena.used && arenaLargestFree(&arena) == arena.size;
+
+	printf("arena        %u bytes, %u allocs, %u frees, %u failed\n", arena.size, allocs, frees, arena.failures);
+	printf("alloc        %.1f ns\n", allocs ? (double)allocNs / allocs : 0.0);
+	printf("free         %.1f ns\n", frees ? (double)freeNs / frees : 0.0);
+	printf("high water   %u bytes, %.1f%% fragmented on average\n", arena.highWater, operations ? (double)fragmentation / operations : 0.0);
+	printf("check        %s\n", ok ? "ok" : "FAILED");
+
+	free(base);
+	return !ok;
+}
@@ -0,0 +1,142 @@
+#ifndef HOST_HARNESS_H
+#define HOST_HARNESS_H
+
+// Shared host-side setup: a stub global context with an overlay display buffer,
+// a save context image with a full inventory, a scripted controller stream and
+// a monotonic clock.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <z64ovl/oot/u10.h>
+#include <z64ovl/z64ovl_helpers.h>
+#include "z64_inputHandler.h"
+
+#define HOST_DISP_BUF_SIZE 0x10000
+
+typedef struct {
+	uint16_t buttons;
+	uint16_t frames;
+} scriptStep_t;
+
+// One pass through a typical session: idle with the HUD up, open the menu,
+// tap and hold through categories and items, equip, close, let it settle.
+static const scriptStep_t hostScript[] = {
+	{ 0, 40 },
+	{ BUTTON_DL, 2 }, { 0, 20 },
+	{ BUTTON_DD, 2 }, { 0, 6 },
+	{ BUTTON_DD, 2 }, { 0, 6 },
+	{ BUTTON_DU, 2 }, { 0, 6 },
+	{ BUTTON_DD, 60 }, { 0, 10 },
+	{ BUTTON_DU, 45 }, { 0, 10 },
+	{ BUTTON_DR, 2 }, { 0, 4 },
+	{ BUTTON_DR, 2 }, { 0, 4 },
+	{ BUTTON_DR, 30 }, { 0, 4 },
+	{ BUTTON_DL, 2 }, { 0, 4 },
+	{ BUTTON_A, 2 }, { 0, 10 },
+	{ BUTTON_L, 2 }, { 0, 60 },
+	{ BUTTON_DR, 2 }, { 0, 10 },
+	{ BUTTON_DD, 2 }, { BUTTON_A, 2 }, { 0, 4 },
+	{ BUTTON_L, 2 }, { 0, 120 },
+};
+
+static inline uint16_t hostScript_buttons(uint32_t frame) {
+	uint32_t length = 0;
+	for (uint32_t i = 0; i < sizeof(hostScript) / sizeof(hostScript[0]); i++) length += hostScript[i].frames;
+
+	frame %= length;
+	for (uint32_t i = 0; i < sizeof(hostScript) / sizeof(hostScript[0]); i++) {
+		if (frame < hostScript[i].frames) return hostScript[i].buttons;
+		frame -= hostScript[i].frames;
+	}
+	return 0;
+}
+
+///
+/// CONTEXT
+///
+
+typedef struct {
+	z64_global_t gl;
+	z64_gfx_t gfx;
+	Gfx overlay[HOST_DISP_BUF_SIZE / sizeof(Gfx)];
+} hostContext_t;
+
+// Everything owned: sticks through bottles in the inventory, all swords,
+// shields, tunics and boots in the equipment word
+static inline void hostSave_fill(void) {
+	memset(hostSaveContext, 0, sizeof(hostSaveContext));
+	uint8_t* inventory = hostSaveContext + 0x74;
+	for (int i = 0; i < 24; i++) inventory[i] = (uint8_t)i;
+	*(uint16_t*)(hostSaveContext + 0x9C) = 0x7777;
+}
+
+static inline void construct_hostContext_t(hostContext_t* ctx) {
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->gl.common.gfx_ctxt = &ctx->gfx;
+	ctx->gfx.overlay.size = sizeof(ctx->overlay);
+	ctx->gfx.overlay.buf = ctx->overlay;
+	ctx->gfx.overlay.p = ctx->overlay;
+	hostSave_fill();
+}
+
+static inline void hostContext_setButtons(hostContext_t* ctx, uint16_t buttons) {
+	ctx->gl.common.input[0].raw.pad = buttons;
+}
+
+static inline uint32_t hostContext_dlBytes(hostContext_t* ctx) {
+	return (uint32_t)((ctx->gfx.overlay.p - ctx->gfx.overlay.buf) * sizeof(Gfx));
+}
+
+///
+/// ICONS
+///
+
+// Stand-in for icon_item_static (iconProvider.h), a file written by
+// texpack --icon-segment; reads past its end or with none open give zeros
+static FILE* hostIconSegment;
+
+static inline void hostIconRead(void* dst, uint32_t offset, uint32_t size) {
+	memset(dst, 0, size);
+	if (!hostIconSegment || fseek(hostIconSegment, offset, SEEK_SET)) return;
+	fread(dst, 1, size, hostIconSegment);
+}
+#define iconRomRead(dst, offset, size) hostIconRead((dst), (offset), (size))
+
+///
+/// TIMING
+///
+
+static inline uint64_t hostClock_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Startup stages (menuInit.h) are timed in nanoseconds on the host
+#define MENU_INIT_CLOCK() ((uint32_t)hostClock_ns())
+#define MENU_INIT_CLOCK_HZ 1000000000
+
+static inline int hostCompareU64(const void* a, const void* b) {
+	uint64_t x = *(const uint64_t*)a;
+	uint64_t y = *(const uint64_t*)b;
+	return x < y ? -1 : x > y;
+}
+
+// Sorts samples in place and prints mean and percentiles in nanoseconds
+static inline void hostPrintPercentiles(const char* label, uint64_t* samples, uint32_t count) {
+	if (!count) return;
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < count; i++) total += samples[i];
+	qsort(samples, count, sizeof(uint64_t), hostCompareU64);
+
+	printf("%-12s mean %8.0f  p50 %8llu  p90 %8llu  p99 %8llu  max %8llu ns\n", label,
+		(double)total / count,
+		(unsigned long long)samples[count * 50 / 100],
+		(unsigned long long)samples[count * 90 / 100],
+		(unsigned long long)samples[count * 99 / 100],
+		(unsigned long long)samples[count - 1]);
+}
+
+#endif
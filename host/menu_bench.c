@@ -0,0 +1,229 @@
+// Host replay harness for the menu's per-frame path.
+// Runs the scripted controller stream through update_z64_inputHandler_t and
+// update_menu_t and reports the staged startup, per-frame cost and draw
+// counters, overall and for the frames the menu is closed.
+//
+// Build: cc -O2 -std=gnu99 -fgnu89-inline -I. -Ihost host/menu_bench.c -o menu_bench
+// Usage: menu_bench [frames] [--record out.lmrc] [--icons icons.bin] [--cache-budget bytes]
+//
+// --record saves the scripted session in the menuRecord.h format for menu_replay.
+// --cache-budget replaces TEXTURE_CACHE_BUDGET, for builds with MENU_TEXTURE_CACHE.
+// --icons reads icon_item_static from a file written by texpack --icon-segment,
+// for textures.h built with --rom-icons.
+
+#include "hostHarness.h"
+#include "menuRecord.h"
+#include "menuInit.h"
+
+static hostContext_t ctx;
+static z64_inputHandler_t inputHandler;
+static menu_t menu;
+static menuRecorder_t recorder;
+static menuInit_t menuInit;
+
+// DRAW_CHANGE_ pieces the queued sprites would need drawn in submission
+// order, as immediate drawing did
+static int drawQueueUnsortedChanges(drawQueue_t* queue) {
+	drawState_t state;
+	construct_drawState_t(&state);
+	int count = 0;
+	for (int i = 0; i < queue->length; i++) count += drawChangeCount(drawStateChanges(&state, &queue->entries[i]));
+	return count;
+}
+
+// Screen rectangle a queued sprite covers
+static void drawEntryRect(drawQueueEntry_t* entry, int* x, int* y) {
+	*x = entry->tile.x;
+	*y = entry->tile.y;
+	if (entry->tile.origin_anchor == G_TX_ANCHOR_C) {
+		*x -= entry->tile.width / 2;
+		*y -= entry->tile.height / 2;
+	}
+}
+
+// Pairs of queued sprites that share a layer and depth and overlap. The sort
+// is free to reorder those, so there must be none.
+static int drawQueueOverlaps(drawQueue_t* queue) {
+	int count = 0;
+	for (int i = 0; i < queue->length; i++) {
+		drawQueueEntry_t* a = &queue->entries[i];
+		int ax, ay;
+		drawEntryRect(a, &ax, &ay);
+		for (int k = i + 1; k < queue->length; k++) {
+			drawQueueEntry_t* b = &queue->entries[k];
+			if (a->key >> 26 != b->key >> 26) continue;
+			int bx, by;
+			drawEntryRect(b, &bx, &by);
+			count += ax < bx + b->tile.width && bx < ax + a->tile.width && ay < by + b->tile.height && by < ay + a->tile.height;
+		}
+	}
+	return count;
+}
+
+// Draw a CI sprite, then a texture whose load overwrites the TLUT, then the
+// CI sprite again, the way a category background, a page built from game
+// icons and the selection box are ordered. Returns the rectangles drawn
+// through an overwritten TLUT, or -1 if no texture is that large. It runs
+// after the session so its loads stay out of the cache counts.
+static int drawTlutReloadCheck(void) {
+	int ci = -1, large = -1;
+	for (int id = 0; id < NUM_TEXTURES; id++) {
+		if (ci < 0 && id < NUM_RESIDENT_TEXTURES && textureInfo[id].tlut < NUM_RESIDENT_TEXTURES) ci = id;
+		if (large < 0 && drawLoadClobbersTlut(id)) large = id;
+	}
+	if (ci < 0 || large < 0) return -1;
+
+	drawQueue_t queue;
+	construct_drawQueue_t(&queue);
+	gfx_screen_tile_t tile = { 160, 120, 16, 16, G_TX_ANCHOR_C };
+	drawSprite(&queue, DRAW_LAYER_BACKGROUND, 0, ci, &tile, 0xFF);
+	drawSprite(&queue, DRAW_LAYER_ITEMS, 0, large, &tile, 0xFF);
+	drawSprite(&queue, DRAW_LAYER_SELECTION, 0, ci, &tile, 0xFF);
+
+	hostGfx_beginFrame(&ctx.gfx.overlay);
+	drawQueueFlush(&queue, &ctx.gfx.overlay);
+	return hostGfx.staleTlutDraws;
+}
+
+int main(int argc, char** argv) {
+	uint32_t frames = 10000;
+	const char* recordPath = 0;
+	uint32_t cacheBudget = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--record") && i + 1 < argc) recordPath = argv[++i];
+		else if (!strcmp(argv[i], "--cache-budget") && i + 1 < argc) cacheBudget = (uint32_t)strtoul(argv[++i], 0, 0);
+		else if (!strcmp(argv[i], "--icons") && i + 1 < argc) {
+			hostIconSegment = fopen(argv[++i], "rb");
+			if (!hostIconSegment) {
+				fprintf(stderr, "cannot open %s\n", argv[i]);
+				return 1;
+			}
+		}
+		else frames = (uint32_t)strtoul(argv[i], 0, 0);
+	}
+	if (!frames) frames = 1;
+
+	uint64_t* frameTime = malloc(frames * sizeof(uint64_t));
+	uint64_t sprites = 0, textureLoads = 0, redundantLoads = 0, tlutLoads = 0, staleTluts = 0, uploadBytes = 0, dlBytes = 0;
+	uint32_t maxSprites = 0, maxLoads = 0;
+	uint64_t culled = 0, stateChanges = 0, unsortedChanges = 0, dropped = 0, calledBytes = 0, overlaps = 0;
+	uint64_t closedFrames = 0, closedSprites = 0, closedCulled = 0, closedBytes = 0, closedCalled = 0;
+	uint64_t idleFrames = 0, idleTime = 0, closedTime = 0;
+
+	construct_hostContext_t(&ctx);
+	construct_z64_inputHandler_t(&inputHandler, &ctx.gl.common.input[0].raw);
+	construct_menuInit_t(&menuInit);
+	#ifndef hardware
+	// Before init warms the cache; a pack that failed its check keeps no budget
+	if (cacheBudget && textureCache.budget) textureCache.budget = cacheBudget;
+	#else
+	(void)cacheBudget; // Nothing is cached
+	#endif
+	uint32_t initFrames = 0;
+	while (!update_menuInit_t(&menuInit, &menu, &inputHandler)) initFrames++;
+
+	uint8_t* recordBuffer = 0;
+	if (recordPath) {
+		uint32_t recordSize = MENU_RECORD_HEADER_SIZE + frames * MENU_RECORD_FRAME_MAX;
+		recordBuffer = malloc(recordSize);
+		construct_menuRecorder_t(&recorder, recordBuffer, recordSize);
+	}
+
+	scalar_t currentTime = 0;
+	uint32_t debug = 0, debug2 = 0;
+
+	for (uint32_t frame = 0; frame < frames; frame++) {
+		hostContext_setButtons(&ctx, hostScript_buttons(frame));
+		hostGfx_beginFrame(&ctx.gfx.overlay);
+		if (recordBuffer) update_menuRecorder_t(&recorder, &ctx.gl.common.input[0].raw);
+
+		uint8_t idle = menu.idle;
+		uint64_t start = hostClock_ns();
+		update_z64_inputHandler_t(&inputHandler, currentTime);
+		currentTime = timeAdd(currentTime, FRAMETIME);
+		update_menu_t(&menu, &inputHandler, &ctx.gl, currentTime, &debug, &debug2);
+		frameTime[frame] = hostClock_ns() - start;
+
+		sprites += hostGfx.sprites;
+		textureLoads += hostGfx.textureLoads;
+		redundantLoads += hostGfx.redundantLoads;
+		tlutLoads += hostGfx.tlutLoads;
+		staleTluts += hostGfx.staleTlutDraws;
+		uploadBytes += hostGfx.uploadBytes;
+		dlBytes += hostContext_dlBytes(&ctx);
+		calledBytes += hostGfx.calledBytes;
+		if (hostGfx.sprites > maxSprites) maxSprites = hostGfx.sprites;
+		if (hostGfx.textureLoads > maxLoads) maxLoads = hostGfx.textureLoads;
+		culled += drawStats.culled;
+		stateChanges += drawQueue.stateChanges;
+		unsortedChanges += drawQueueUnsortedChanges(&drawQueue);
+		overlaps += drawQueueOverlaps(&drawQueue);
+		dropped += drawQueue.dropped;
+		if (!menu.menuOpen) {
+			closedFrames++;
+			closedSprites += hostGfx.sprites;
+			closedCulled += drawStats.culled;
+			closedBytes += hostContext_dlBytes(&ctx);
+			closedCalled += hostGfx.calledBytes;
+			closedTime += frameTime[frame];
+		}
+		if (idle && menu.idle) {
+			idleFrames++;
+			idleTime += frameTime[frame];
+		}
+	}
+
+	printf("init         %u frames\n", initFrames + 1);
+	for (int i = 0; i < MENU_INIT_STAGES; i++) {
+		menuInitProfile_t* profile = &menuInit.profile[i];
+		printf("  %-10s %u frames, %u bytes, %.1f us\n", menuInitStageNames[i], profile->frames, profile->bytes,
+			profile->ticks * 1e6 / MENU_INIT_CLOCK_HZ);
+	}
+	#ifndef hardware
+	printf("cache        %u of %u bytes, %u hits, %u misses, %u evictions, %u failed\n", textureCache.used, textureCache.budget,
+		textureCache.hits, textureCache.misses, textureCache.evictions, textureCache.failures);
+	printf("prefetch     %u issued, %u drawn, %.1f%% of first draws hit\n", textureCache.prefetches, textureCache.prefetchHits,
+		textureCache.prefetchHits + textureCache.misses ? 100.0 * textureCache.prefetchHits / (textureCache.prefetchHits + textureCache.misses) : 0.0);
+	printf("arena        %u of %u bytes, high water %u, %u blocks, %u%% fragmented, %u failed\n", menuArena.used, menuArena.size,
+		menuArena.highWater, menuArena.blocks, arenaFragmentation(&menuArena), menuArena.failures);
+	#endif
+	printf("frames       %u\n", frames);
+	hostPrintPercentiles("frame", frameTime, frames);
+	printf("sprites      %.2f/frame (max %u), %.2f culled\n", (double)sprites / frames, maxSprites, (double)culled / frames);
+	printf("tex loads    %.2f/frame (max %u, %.2f redundant)\n", (double)textureLoads / frames, maxLoads, (double)redundantLoads / frames);
+	printf("tlut loads   %.2f/frame, %llu sprites drawn through an overwritten TLUT\n", (double)tlutLoads / frames,
+		(unsigned long long)staleTluts);
+	printf("state        %.2f changes/frame, %.2f in submission order, %llu sprites dropped\n", (double)stateChanges / frames,
+		(double)unsortedChanges / frames, (unsigned long long)dropped);
+	printf("overlaps     %llu sprite pairs at one layer and depth\n", (unsigned long long)overlaps);
+	printf("tmem upload  %.1f bytes/frame\n", (double)uploadBytes / frames);
+	printf("dl bytes     %.1f/frame, %.1f more in cached lists\n", (double)dlBytes / frames, (double)calledBytes / frames);
+	printf("lists        backgrounds %u recorded, %u called; hud %u recorded, %u called\n", drawBackgroundList.records,
+		drawBackgroundList.calls, drawHudList.records, drawHudList.calls);
+	if (closedFrames) {
+		printf("closed       %llu frames, %.2f sprites, %.2f culled, %.1f dl bytes/frame, %.1f in cached lists\n",
+			(unsigned long long)closedFrames, (double)closedSprites / closedFrames, (double)closedCulled / closedFrames,
+			(double)closedBytes / closedFrames, (double)closedCalled / closedFrames);
+		printf("idle         %llu of them, %.0f ns/frame idle, %.0f ns/frame closed\n", (unsigned long long)idleFrames,
+			idleFrames ? (double)idleTime / idleFrames : 0.0, (double)closedTime / closedFrames);
+	}
+
+	if (recordBuffer) {
+		FILE* f = fopen(recordPath, "wb");
+		if (!f || fwrite(recordBuffer, 1, recorder.used, f) != recorder.used) {
+			fprintf(stderr, "cannot write %s\n", recordPath);
+			return 1;
+		}
+		fclose(f);
+		printf("recorded     %u frames, %u bytes\n", recorder.frames, recorder.used);
+		free(recordBuffer);
+	}
+
+	int tlutCheck = drawTlutReloadCheck();
+	if (tlutCheck < 0) printf("tlut reload  no texture over 2 KB\n");
+	else printf("tlut reload  %s\n", tlutCheck ? "FAILED" : "ok");
+
+	free(frameTime);
+	return tlutCheck > 0 || staleTluts || overlaps;
+}
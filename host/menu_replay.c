@@ -0,0 +1,104 @@
+// Deterministic replayer for menu session recordings (see menuRecord.h).
+// Feeds each recorded frame through the input handler and menu, hashes the menu
+// after every frame and times the per-frame path.
+//
+// Build: cc -O2 -std=gnu99 -fgnu89-inline -I. -Ihost host/menu_replay.c -o menu_replay
+// Usage: menu_replay <recording> [--hashes out.txt] [--check golden.txt]
+//
+// --hashes writes one hex hash per frame. --check compares against such a file
+// and exits non-zero at the first frame that differs.
+
+#include "hostHarness.h"
+#include "menuRecord.h"
+
+static hostContext_t ctx;
+static z64_inputHandler_t inputHandler;
+static menu_t menu;
+
+static uint8_t* readFile(const char* path, uint32_t* size) {
+	FILE* f = fopen(path, "rb");
+	if (!f) return 0;
+	fseek(f, 0, SEEK_END);
+	long length = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	uint8_t* data = malloc(length > 0 ? length : 1);
+	*size = (uint32_t)fread(data, 1, length, f);
+	fclose(f);
+	return data;
+}
+
+int main(int argc, char** argv) {
+	const char* recordingPath = 0;
+	const char* hashesPath = 0;
+	const char* checkPath = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--hashes") && i + 1 < argc) hashesPath = argv[++i];
+		else if (!strcmp(argv[i], "--check") && i + 1 < argc) checkPath = argv[++i];
+		else recordingPath = argv[i];
+	}
+	if (!recordingPath) {
+		fprintf(stderr, "usage: %s <recording> [--hashes out.txt] [--check golden.txt]\n", argv[0]);
+		return 2;
+	}
+
+	uint32_t size = 0;
+	uint8_t* data = readFile(recordingPath, &size);
+	menuPlayback_t playback;
+	if (!data || !construct_menuPlayback_t(&playback, data, size)) {
+		fprintf(stderr, "%s: not a menu recording\n", recordingPath);
+		return 2;
+	}
+
+	FILE* hashes = hashesPath ? fopen(hashesPath, "w") : 0;
+	FILE* golden = checkPath ? fopen(checkPath, "r") : 0;
+	if ((hashesPath && !hashes) || (checkPath && !golden)) {
+		fprintf(stderr, "cannot open hash file\n");
+		return 2;
+	}
+
+	construct_hostContext_t(&ctx);
+	loadTextures();
+	construct_z64_inputHandler_t(&inputHandler, &ctx.gl.common.input[0].raw);
+	construct_menu_t(&menu, &inputHandler);
+
+	uint64_t* frameTime = malloc((playback.frames ? playback.frames : 1) * sizeof(uint64_t));
+	scalar_t currentTime = 0;
+	uint32_t debug = 0, debug2 = 0;
+	uint32_t digest = HASH_SEED;
+	int result = 0;
+
+	while (update_menuPlayback_t(&playback, &ctx.gl.common.input[0].raw)) {
+		hostGfx_beginFrame(&ctx.gfx.overlay);
+
+		uint64_t start = hostClock_ns();
+		update_z64_inputHandler_t(&inputHandler, currentTime);
+		currentTime = timeAdd(currentTime, FRAMETIME);
+		update_menu_t(&menu, &inputHandler, &ctx.gl, currentTime, &debug, &debug2);
+		frameTime[playback.frame - 1] = hostClock_ns() - start;
+
+		uint32_t hash = hash_menu_t(&menu);
+		digest = hashInt(digest, hash);
+		if (hashes) fprintf(hashes, "%08x\n", hash);
+
+		if (golden) {
+			unsigned int expected;
+			if (fscanf(golden, "%x", &expected) != 1 || expected != hash) {
+				printf("mismatch at frame %u: got %08x\n", playback.frame - 1, hash);
+				result = 1;
+				break;
+			}
+		}
+	}
+
+	printf("frames       %u of %u\n", playback.frame, playback.frames);
+	printf("digest       %08x\n", digest);
+	hostPrintPercentiles("frame", frameTime, playback.frame);
+
+	if (hashes) fclose(hashes);
+	if (golden) fclose(golden);
+	free(frameTime);
+	free(data);
+	return result;
+}
@@ -0,0 +1,127 @@
+// Host reader for textures/AllTextures. Maps the pack read-only, checks its
+// header, verifies every entry's checksum, counts entries deduplicated onto
+// another's data and times name lookups through the hash index. Nothing is
+// copied out of the mapping.
+//
+// Build: cc -O2 -std=gnu99 -fgnu89-inline -I. -Ihost host/pack_info.c -o pack_info
+// Usage: pack_info [pack] [--list] [--find NAME]
+//
+// pack defaults to textures/AllTextures. --find prints one entry by its TEX_
+// suffix, e.g. --find DPAD.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hostHarness.h"
+#include "texturePack.h"
+
+#define BENCH_REPEATS 2000
+
+static const char* formatNames[5][4] = {
+	{ "RGBA4", "RGBA8", "RGBA16", "RGBA32" },
+	{ "YUV4", "YUV8", "YUV16", "YUV32" },
+	{ "CI4", "CI8", "CI16", "CI32" },
+	{ "IA4", "IA8", "IA16", "IA32" },
+	{ "I4", "I8", "I16", "I32" },
+};
+
+static void printEntry(texturePack_t* pack, int id) {
+	texturePackEntry_t entry;
+	texturePackGet(pack, id, &entry);
+	const char* format = entry.fmt < 5 && entry.bitsiz < 4 ? formatNames[entry.fmt][entry.bitsiz] : "?";
+	printf("%4d %-40s %3ux%-3u %-6s 0x%05X %6u%s\n", id, texturePackName(pack, &entry), entry.width, entry.height,
+		format, entry.offset, entry.size, entry.source ? " built at runtime" : "");
+}
+
+int main(int argc, char** argv) {
+	const char* path = "textures/AllTextures";
+	const char* find = 0;
+	int list = 0;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--list")) list = 1;
+		else if (!strcmp(argv[i], "--find") && i + 1 < argc) find = argv[++i];
+		else path = argv[i];
+	}
+
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st)) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+	const void* data = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		fprintf(stderr, "cannot map %s\n", path);
+		return 1;
+	}
+
+	texturePack_t pack;
+	if (!construct_texturePack_t(&pack, data, (uint32_t)st.st_size) || !texturePackHasIndex(&pack)) {
+		fprintf(stderr, "%s is not a version %d texture pack\n", path, TEXTURE_PACK_VERSION);
+		return 1;
+	}
+	texturePackHeader_t* header = &pack.header;
+
+	if (find) {
+		int id = texturePackFind(&pack, find);
+		if (id < 0) {
+			fprintf(stderr, "no texture %s\n", find);
+			return 1;
+		}
+		printEntry(&pack, id);
+		return 0;
+	}
+	if (list) {
+		for (int id = 0; id < header->numEntries; id++) printEntry(&pack, id);
+	}
+
+	uint32_t bad = 0;
+	uint32_t probes = 0;
+	uint32_t shared = 0, sharedBytes = 0; // Entries pointing at an earlier entry's data
+	for (int id = 0; id < header->numEntries; id++) {
+		texturePackEntry_t entry;
+		texturePackGet(&pack, id, &entry);
+		if (!texturePackVerify(&pack, &entry) || texturePackFind(&pack, texturePackName(&pack, &entry)) != id) {
+			fprintf(stderr, "entry %d (%s) is corrupt\n", id, texturePackName(&pack, &entry));
+			bad++;
+		}
+		// Slots looked at to find it, the home slot included
+		uint32_t mask = header->numSlots - 1;
+		for (uint32_t slot = entry.hash & mask;; slot = (slot + 1) & mask) {
+			probes++;
+			if (texturePackRead16(pack.data + header->slotsOffset + slot * 2) == id + 1) break;
+		}
+		for (int other = 0; other < id && entry.size; other++) {
+			texturePackEntry_t earlier;
+			texturePackGet(&pack, other, &earlier);
+			if (earlier.offset != entry.offset || !earlier.size) continue;
+			shared++;
+			sharedBytes += entry.size;
+			break;
+		}
+	}
+
+	uint64_t start = hostClock_ns();
+	int found = 0;
+	for (int r = 0; r < BENCH_REPEATS; r++) {
+		for (int id = 0; id < header->numEntries; id++) {
+			texturePackEntry_t entry;
+			texturePackGet(&pack, id, &entry);
+			found += texturePackFind(&pack, texturePackName(&pack, &entry)) == id;
+		}
+	}
+	uint64_t ns = hostClock_ns() - start;
+
+	printf("pack         %s, version %u, %u bytes mapped\n", path, header->version, header->size);
+	printf("entries      %u, %u slots, %.2f probes per lookup\n", header->numEntries, header->numSlots, (double)probes / header->numEntries);
+	printf("payload      %u bytes, %u resident, index %u bytes\n", header->entriesOffset - TEXTURE_PACK_HEADER_SIZE,
+		header->residentSize - TEXTURE_PACK_HEADER_SIZE, header->size - header->entriesOffset);
+	printf("shared       %u entries alias earlier data, %u bytes\n", shared, sharedBytes);
+	printf("lookup       %.1f ns by name\n", (double)ns / ((uint64_t)BENCH_REPEATS * header->numEntries));
+	printf("checksums    %u of %u ok\n", header->numEntries - bad, header->numEntries);
+
+	munmap((void*)data, st.st_size);
+	return bad || found != BENCH_REPEATS * header->numEntries;
+}
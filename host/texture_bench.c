@@ -0,0 +1,87 @@
+// Host benchmark for the texture loader: copies a texture pack into an arena
+// with the old word-at-a-time writeTexture loop and with textureLoader.h's
+// block copy, whole and streamed in chunks, and reports bytes/sec.
+//
+// Build: cc -O2 -std=gnu99 -fgnu89-inline -fno-tree-loop-distribute-patterns -fno-tree-vectorize -I. -Ihost host/texture_bench.c -o texture_bench
+// Usage: texture_bench [pack] [repeats]
+//
+// pack defaults to textures/AllTextures. The two -fno flags keep the compiler
+// from turning either loop into a libc memcpy or SIMD, neither of which the
+// overlay has.
+
+#include "hostHarness.h"
+#include "textureLoader.h"
+
+#define BENCH_CHUNK 4096
+
+// The loader this replaces, kept as the baseline
+static void writeTextureWords(uint32_t* addr, uint32_t size, uint32_t* data) {
+	for (int o = 0; o < size; o++) {
+		addr[o] = data[o];
+	}
+}
+
+static void report(const char* label, uint64_t ns, uint64_t bytes, uint64_t baselineNs) {
+	printf("%-12s %8.1f MB/s  %6.2fx\n", label, bytes / (ns / 1e9) / (1 << 20), (double)baselineNs / ns);
+}
+
+int main(int argc, char** argv) {
+	const char* path = argc > 1 ? argv[1] : "textures/AllTextures";
+	uint32_t repeats = argc > 2 ? (uint32_t)strtoul(argv[2], 0, 0) : 2000;
+	if (!repeats) repeats = 1;
+
+	FILE* f = fopen(path, "rb");
+	if (!f) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+	fseek(f, 0, SEEK_END);
+	uint32_t size = (uint32_t)ftell(f) & ~7u;
+	fseek(f, 0, SEEK_SET);
+
+	uint32_t* pack = malloc(size + 8);
+	uint32_t* arena = malloc(size + 8);
+	uint32_t* check = malloc(size + 8);
+	if (fread(pack, 1, size, f) != size) {
+		fprintf(stderr, "cannot read %s\n", path);
+		return 1;
+	}
+	fclose(f);
+
+	uint64_t bytes = (uint64_t)size * repeats;
+	uint64_t start = hostClock_ns();
+	for (uint32_t i = 0; i < repeats; i++) writeTextureWords(arena, size / 4, pack);
+	uint64_t wordNs = hostClock_ns() - start;
+	memcpy(check, arena, size);
+
+	memset(arena, 0, size);
+	start = hostClock_ns();
+	for (uint32_t i = 0; i < repeats; i++) copyTextureBlock(arena, pack, size);
+	uint64_t blockNs = hostClock_ns() - start;
+	int blockOk = !memcmp(arena, check, size);
+
+	memset(arena, 0, size);
+	start = hostClock_ns();
+	for (uint32_t i = 0; i < repeats; i++) {
+		textureStream_t stream;
+		construct_textureStream_t(&stream, arena, pack, size);
+		while (update_textureStream_t(&stream, BENCH_CHUNK));
+	}
+	uint64_t streamNs = hostClock_ns() - start;
+	int streamOk = !memcmp(arena, check, size);
+
+	printf("pack         %s, %u bytes x %u\n", path, size, repeats);
+	report("word loop", wordNs, bytes, wordNs);
+	report("block copy", blockNs, bytes, wordNs);
+	report("stream 4K", streamNs, bytes, wordNs);
+
+	free(pack);
+	free(arena);
+	free(check);
+
+	if (!blockOk || !streamOk) {
+		fprintf(stderr, "copy mismatch\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,119 @@
+#ifndef HOST_Z64OVL_U10_H
+#define HOST_Z64OVL_U10_H
+
+// Host stand-in for z64ovl's OoT 1.0 header. Only the pieces the menu touches
+// are modelled; field names and layout follow z64ovl so menu.h builds unchanged.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MENU_HOST 1
+
+///
+/// CONTROLLER
+///
+
+typedef struct {
+	union {
+		struct {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+			uint16_t cr : 1;
+			uint16_t cl : 1;
+			uint16_t cd : 1;
+			uint16_t cu : 1;
+			uint16_t r : 1;
+			uint16_t l : 1;
+			uint16_t : 2;
+			uint16_t dr : 1;
+			uint16_t dl : 1;
+			uint16_t dd : 1;
+			uint16_t du : 1;
+			uint16_t s : 1;
+			uint16_t z : 1;
+			uint16_t b : 1;
+			uint16_t a : 1;
+#else
+			uint16_t a : 1;
+			uint16_t b : 1;
+			uint16_t z : 1;
+			uint16_t s : 1;
+			uint16_t du : 1;
+			uint16_t dd : 1;
+			uint16_t dl : 1;
+			uint16_t dr : 1;
+			uint16_t : 2;
+			uint16_t l : 1;
+			uint16_t r : 1;
+			uint16_t cu : 1;
+			uint16_t cd : 1;
+			uint16_t cl : 1;
+			uint16_t cr : 1;
+#endif
+		};
+		uint16_t pad;
+	};
+	int8_t x;
+	int8_t y;
+} z64_controller_t; // Button word has A in the MSB, matching the N64 on either host byte order
+
+typedef struct {
+	z64_controller_t raw;
+	uint16_t status;
+	z64_controller_t raw_prev;
+	uint16_t status_prev;
+	uint16_t pad_pressed;
+	int8_t x_diff;
+	int8_t y_diff;
+	uint16_t pad_released;
+	int8_t adjusted_x;
+	int8_t adjusted_y;
+} z64_input_t;
+
+///
+/// GRAPHICS
+///
+
+typedef struct {
+	uint32_t w0;
+	uint32_t w1;
+} Gfx;
+
+typedef struct {
+	uint32_t size;
+	Gfx* buf;
+	Gfx* p;
+	Gfx* d;
+} z64_disp_buf_t;
+
+typedef struct {
+	z64_disp_buf_t work;
+	z64_disp_buf_t poly_opa;
+	z64_disp_buf_t poly_xlu;
+	z64_disp_buf_t overlay;
+	uint32_t frame_count;
+} z64_gfx_t;
+
+///
+/// GLOBAL CONTEXT
+///
+
+typedef struct {
+	z64_gfx_t* gfx_ctxt;
+	z64_input_t input[4];
+} z64_common_t;
+
+typedef struct {
+	z64_common_t common;
+} z64_global_t;
+
+typedef struct {
+	uint8_t unused;
+} z64_player_t;
+
+// Save context memory image. Offsets into it match the game's save context so
+// Z64GL_SAVE_CONTEXT + 0x74 is the inventory, + 0x9C the owned equipment, etc.
+#define HOST_SAVE_CONTEXT_SIZE 0x1450
+static uint8_t hostSaveContext[HOST_SAVE_CONTEXT_SIZE];
+#define Z64GL_SAVE_CONTEXT ((uintptr_t)hostSaveContext)
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef HOST_Z64OVL_HELPERS_H
+#define HOST_Z64OVL_HELPERS_H
+
+// Host stand-in for z64ovl's helpers. Drawing writes real-sized display list
+// words into the overlay buffer and counts them so the harness can report
+// sprites, texture loads and display list bytes per frame.
+
+#include "oot/u10.h"
+
+#define G_IM_FMT_RGBA 0
+#define G_IM_FMT_YUV 1
+#define G_IM_FMT_CI 2
+#define G_IM_FMT_IA 3
+#define G_IM_FMT_I 4
+#define G_IM_SIZ_4b 0
+#define G_IM_SIZ_8b 1
+#define G_IM_SIZ_16b 2
+#define G_IM_SIZ_32b 3
+
+#define G_TX_RENDERTILE 0
+
+#define G_TT_NONE 0
+#define G_TT_RGBA16 (2 << 14)
+#define G_TF_POINT 0
+#define G_TF_BILERP (2 << 12)
+
+#define G_TX_ANCHOR_U 0
+#define G_TX_ANCHOR_C 1
+
+// F3DEX2 opcodes the menu can emit
+#define G_DL 0xDE
+#define G_ENDDL 0xDF
+#define G_TEXRECT 0xE4
+#define G_RDPLOADSYNC 0xE6
+#define G_RDPPIPESYNC 0xE7
+#define G_RDPTILESYNC 0xE8
+#define G_SETOTHERMODE_H 0xE3
+#define G_SETOTHERMODE_L 0xE2
+#define G_RDPHALF_1 0xE1
+#define G_RDPHALF_2 0xF1
+#define G_SETTILESIZE 0xF2
+#define G_LOADBLOCK 0xF3
+#define G_LOADTILE 0xF4
+#define G_SETTILE 0xF5
+#define G_LOADTLUT 0xF0
+#define G_SETPRIMCOLOR 0xFA
+#define G_SETCOMBINE 0xFC
+#define G_SETTIMG 0xFD
+
+typedef struct {
+	void* timg;
+	uint16_t width;
+	uint16_t height;
+	uint8_t fmt;
+	uint8_t bitsiz;
+} gfx_texture_t;
+
+typedef struct {
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+	uint8_t origin_anchor;
+} gfx_screen_tile_t;
+
+///
+/// DRAW COUNTERS
+///
+
+typedef struct {
+	uint32_t sprites; // Texture rectangles
+	uint32_t textureLoads;
+	uint32_t redundantLoads; // Loads of the texture that was already loaded
+	uint32_t tlutLoads;
+	uint32_t staleTlutDraws; // Rectangles drawn through a TLUT a texture load overwrote
+	uint32_t uploadBytes; // Texels and TLUTs copied to TMEM
+	uint32_t commands;
+	uint32_t calledBytes; // Display list bytes run through gSPDisplayList
+	void* timg;
+	void* lastLoaded;
+	uint8_t lut; // Texture LUT mode on
+	uint8_t tlutLoaded; // Upper TMEM holds the last TLUT loaded
+	Gfx* end;
+} hostGfxStats_t;
+
+static hostGfxStats_t hostGfx;
+
+// Load commands carry the bytes they upload in w1 so called lists can be
+// counted
+static inline void hostGfx_write(Gfx* g, uint8_t op, uint32_t w1) {
+	if (g < hostGfx.end) {
+		g->w0 = (uint32_t)op << 24;
+		g->w1 = w1;
+	}
+	hostGfx.commands++;
+
+	if (op == G_TEXRECT) {
+		hostGfx.sprites++;
+		if (hostGfx.lut && !hostGfx.tlutLoaded) hostGfx.staleTlutDraws++;
+	}
+	if (op == G_LOADTLUT) {
+		hostGfx.tlutLoads++;
+		hostGfx.tlutLoaded = 1;
+	}
+	if (op == G_LOADBLOCK || op == G_LOADTILE) {
+		if (hostGfx.timg == hostGfx.lastLoaded) hostGfx.redundantLoads++;
+		hostGfx.lastLoaded = hostGfx.timg;
+		hostGfx.textureLoads++;
+	}
+}
+
+static inline void hostGfx_setTimg(Gfx* g, void* timg) {
+	hostGfx.timg = timg;
+	hostGfx_write(g, G_SETTIMG, (uint32_t)(uintptr_t)timg);
+}
+
+static inline void hostGfx_beginFrame(z64_disp_buf_t* db) {
+	db->p = db->buf;
+	hostGfx.sprites = 0;
+	hostGfx.textureLoads = 0;
+	hostGfx.redundantLoads = 0;
+	hostGfx.tlutLoads = 0;
+	hostGfx.staleTlutDraws = 0;
+	hostGfx.uploadBytes = 0;
+	hostGfx.commands = 0;
+	hostGfx.calledBytes = 0;
+	hostGfx.timg = 0;
+	hostGfx.lastLoaded = 0;
+	hostGfx.lut = 0;
+	hostGfx.tlutLoaded = 0;
+	hostGfx.end = db->buf + db->size / sizeof(Gfx);
+}
+
+// Count what a called list draws as if it were in the frame's list
+static inline void hostGfx_call(Gfx* g, Gfx* dl) {
+	hostGfx_write(g, G_DL, (uint32_t)(uintptr_t)dl);
+	for (; dl->w0 >> 24 != G_ENDDL; dl++) {
+		uint8_t op = dl->w0 >> 24;
+		hostGfx.calledBytes += sizeof(Gfx);
+		if (op == G_TEXRECT) hostGfx.sprites++;
+		if (op == G_LOADTLUT) hostGfx.tlutLoads++;
+		if (op == G_LOADBLOCK) hostGfx.textureLoads++;
+		if (op == G_LOADTLUT || op == G_LOADBLOCK) hostGfx.uploadBytes += dl->w1;
+	}
+	hostGfx.calledBytes += sizeof(Gfx);
+	hostGfx.lastLoaded = 0; // Not followed through the list
+	hostGfx.tlutLoaded = 0;
+}
+
+///
+/// GBI
+///
+
+// Each macro writes as many words as the real F3DEX2 one. Arguments that
+// only select modes are accepted and ignored.
+#define gDPPipeSync(pkt) hostGfx_write(pkt, G_RDPPIPESYNC, 0)
+#define gDPSetCycleType(pkt, type) hostGfx_write(pkt, G_SETOTHERMODE_H, 0)
+#define gDPSetRenderMode(pkt, c0, c1) hostGfx_write(pkt, G_SETOTHERMODE_L, 0)
+#define gDPSetCombineMode(pkt, a, b) hostGfx_write(pkt, G_SETCOMBINE, 0)
+#define gDPSetPrimColor(pkt, m, l, r, g, b, a) hostGfx_write(pkt, G_SETPRIMCOLOR, ((uint32_t)(r) << 24) | ((g) << 16) | ((b) << 8) | (a))
+
+#define gDPSetTextureLUT(pkt, type) (hostGfx.lut = (type) != G_TT_NONE, hostGfx_write(pkt, G_SETOTHERMODE_H, type))
+#define gDPSetTextureFilter(pkt, type) hostGfx_write(pkt, G_SETOTHERMODE_H, type)
+#define gDPSetTile(pkt, fmt, siz, line, tmem, tile, palette, cmt, maskt, shiftt, cms, masks, shifts) \
+	((void)(line), hostGfx_write(pkt, G_SETTILE, ((uint32_t)(tile) << 24) | ((palette) << 20)))
+
+#define gDPLoadTextureBlock(pkt, timg, fmt, siz, width, height, pal, cms, cmt, masks, maskt, shifts, shiftt) \
+	do { \
+		hostGfx.uploadBytes += ((width) * (height) << (siz)) / 2; \
+		hostGfx_setTimg(pkt, (void*)(timg)); \
+		hostGfx_write(pkt, G_SETTILE, 0); \
+		hostGfx_write(pkt, G_RDPLOADSYNC, 0); \
+		hostGfx_write(pkt, G_LOADBLOCK, ((width) * (height) << (siz)) / 2); \
+		if ((siz) == G_IM_SIZ_32b || ((width) * (height) << (siz)) / 2 > 2048) hostGfx.tlutLoaded = 0; \
+		hostGfx_write(pkt, G_RDPPIPESYNC, 0); \
+		hostGfx_write(pkt, G_SETTILE, 0); \
+		hostGfx_write(pkt, G_SETTILESIZE, 0); \
+	} while (0)
+
+#define gDPLoadTextureBlock_4b(pkt, timg, fmt, width, height, pal, cms, cmt, masks, maskt, shifts, shiftt) \
+	gDPLoadTextureBlock(pkt, timg, fmt, G_IM_SIZ_4b, width, height, pal, cms, cmt, masks, maskt, shifts, shiftt)
+
+#define gDPLoadTLUT(pkt, count, tmemaddr, dram) \
+	do { \
+		hostGfx.uploadBytes += (count) * 2; \
+		hostGfx_write(pkt, G_SETTIMG, (uint32_t)(uintptr_t)(dram)); \
+		hostGfx_write(pkt, G_RDPTILESYNC, 0); \
+		hostGfx_write(pkt, G_SETTILE, 0); \
+		hostGfx_write(pkt, G_RDPLOADSYNC, 0); \
+		hostGfx_write(pkt, G_LOADTLUT, (count) * 2); \
+		hostGfx_write(pkt, G_RDPPIPESYNC, 0); \
+	} while (0)
+
+#define gSPDisplayList(pkt, dl) hostGfx_call(pkt, dl)
+// Only ends lists recorded outside the frame's buffer
+#define gSPEndDisplayList(pkt) \
+	do { \
+		(pkt)->w0 = (uint32_t)G_ENDDL << 24; \
+		(pkt)->w1 = 0; \
+	} while (0)
+
+#define gSPTextureRectangle(pkt, xl, yl, xh, yh, tile, s, t, dsdx, dtdy) \
+	do { \
+		hostGfx_write(pkt, G_TEXRECT, ((uint32_t)(xl) << 12) | ((yl) & 0xFFF)); \
+		hostGfx_write(pkt, G_RDPHALF_1, ((uint32_t)(s) << 16) | ((t) & 0xFFFF)); \
+		hostGfx_write(pkt, G_RDPHALF_2, ((uint32_t)(dsdx) << 16) | ((dtdy) & 0xFFFF)); \
+	} while (0)
+
+///
+/// HELPERS
+///
+
+static inline void zh_draw_ui_sprite(z64_disp_buf_t* db, gfx_texture_t* texture, gfx_screen_tile_t* tile, uint8_t alpha) {
+	int x = tile->x, y = tile->y;
+	if (tile->origin_anchor == G_TX_ANCHOR_C) {
+		x -= tile->width / 2;
+		y -= tile->height / 2;
+	}
+
+	gDPPipeSync(db->p++);
+	gDPSetCycleType(db->p++, G_CYC_1CYCLE);
+	gDPSetRenderMode(db->p++, G_RM_XLU_SURF, G_RM_XLU_SURF2);
+	gDPSetCombineMode(db->p++, G_CC_MODULATEIA_PRIM, G_CC_MODULATEIA_PRIM);
+	gDPSetPrimColor(db->p++, 0, 0, 0xFF, 0xFF, 0xFF, alpha);
+	gDPLoadTextureBlock(db->p++, texture->timg, texture->fmt, G_IM_SIZ_16b, texture->width, texture->height, 0, 0, 0, 0, 0, 0, 0);
+	gSPTextureRectangle(db->p++, x << 2, y << 2, (x + tile->width) << 2, (y + tile->height) << 2, G_TX_RENDERTILE, 0, 0,
+		tile->width ? (texture->width << 10) / tile->width : 0, tile->height ? (texture->height << 10) / tile->height : 0);
+}
+
+static inline z64_player_t* zh_get_player(z64_global_t* gl) {
+	static z64_player_t player;
+	return &player;
+}
+
+static inline void gfx_update_item_icon(z64_global_t* gl, uint8_t button) {}
+
+static inline void player_refresh_equipment(z64_global_t* gl, z64_player_t* player) {}
+
+#endif
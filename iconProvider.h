@@ -0,0 +1,108 @@
+#ifndef ICONPROVIDER_H
+#define ICONPROVIDER_H
+
+#include <z64ovl/oot/u10.h>
+#ifdef MENU_TEXTURES_HEADER
+#include MENU_TEXTURES_HEADER
+#else
+#include "textures.h"
+#endif
+#include "menuArena.h"
+
+// Builds the atlas pages texpack --rom-icons left out of the pack from the
+// game's own icon_item_static, which holds a 32x32 RGBA32 icon per item ID.
+// Each icon is read into a scratch block of menuArena and box filtered into
+// its RGBA16 cell, so the overlay ships no copy of art the game already has.
+
+#define ICON_ITEM_SIZE 0x1000 // Bytes per item in icon_item_static
+#define ICON_ITEM_WIDTH 32
+
+// iconRomRead(dst, offset, size) copies from icon_item_static. On hardware
+// it goes through the game's DMA manager; both addresses differ between ROM
+// versions, so they have to be defined for the one being patched. The host
+// harness reads a file written by texpack --icon-segment instead.
+#ifndef iconRomRead
+#if defined(ICON_DMA_ADDR) && defined(ICON_ITEM_STATIC_ROM)
+// DmaMgr_SendRequest1(vram, vrom, size)
+#define iconRomRead(dst, offset, size) ((void (*)(void*, uint32_t, uint32_t))ICON_DMA_ADDR)((dst), ICON_ITEM_STATIC_ROM + (offset), (size))
+#endif
+#endif
+
+#ifdef iconRomRead
+
+// 2x2 box filter, colors weighted by alpha like texpack's variants, packed
+// to big endian RGBA5551
+static void iconDownsample(uint8_t* cell, int pitch, const uint8_t* rgba) {
+	for (int y = 0; y < ATLAS_CELL_SIZE; y++) {
+		for (int x = 0; x < ATLAS_CELL_SIZE; x++) {
+			uint32_t sum[4] = { 0 };
+			for (int v = 0; v < 2; v++) {
+				for (int u = 0; u < 2; u++) {
+					const uint8_t* px = &rgba[((y * 2 + v) * ICON_ITEM_WIDTH + x * 2 + u) * 4];
+					for (int c = 0; c < 3; c++) sum[c] += px[c] * px[3];
+					sum[3] += px[3];
+				}
+			}
+
+			uint16_t texel = 0;
+			if (sum[3] >= 0x80 * 4) {
+				texel = 1;
+				for (int c = 0; c < 3; c++) {
+					uint32_t color = (sum[c] + sum[3] / 2) / sum[3];
+					texel |= ((color * 31 + 127) / 255) << (11 - c * 5);
+				}
+			}
+			uint8_t* out = &cell[y * pitch + x * 2];
+			out[0] = texel >> 8;
+			out[1] = texel;
+		}
+	}
+}
+
+// Whether atlasCells entry i is the first one drawing its cell
+static int iconIsFirstCell(int i) {
+	for (int j = 0; j < i; j++) {
+		if (atlasCells[j][0] == atlasCells[i][0] && atlasCells[j][1] == atlasCells[i][1] && atlasCells[j][2] == atlasCells[i][2]) return 0;
+	}
+	return 1;
+}
+
+// Cells of atlas page id, duplicates skipped
+static int iconPageCells(int id) {
+	int cells = 0;
+	for (int i = 0; i < NUM_ATLAS_CELLS; i++) cells += atlasCells[i][0] == id && iconIsFirstCell(i);
+	return cells;
+}
+
+// Bytes of icon_item_static read to build page id; the remaining count a
+// build starts from
+static inline uint32_t iconPageBytes(int id) {
+	return iconPageCells(id) * ICON_ITEM_SIZE;
+}
+
+// Read and filter icons of page id until maxBytes of icon_item_static have
+// been read, at least one per call; returns the bytes still to read, which
+// stay the same when there is no room for the scratch block
+uint32_t iconBuildPage(arena_t* scratch, int id, uint8_t* page, uint32_t remaining, uint32_t maxBytes) {
+	uint8_t* icon = (uint8_t*)arenaAlloc(scratch, ICON_ITEM_SIZE);
+	if (!icon) return remaining;
+
+	int skip = iconPageCells(id) - remaining / ICON_ITEM_SIZE; // Cells already built
+	uint32_t read = 0;
+	for (int i = 0; i < NUM_ATLAS_CELLS && remaining && (!read || read < maxBytes); i++) {
+		if (atlasCells[i][0] != id || !iconIsFirstCell(i) || skip-- > 0) continue;
+
+		iconRomRead(icon, atlasCells[i][4] * ICON_ITEM_SIZE, ICON_ITEM_SIZE);
+		int pitch = textureInfo[id].width * 2;
+		iconDownsample(&page[atlasCells[i][2] * pitch + atlasCells[i][1] * 2], pitch, icon);
+		read += ICON_ITEM_SIZE;
+		remaining -= ICON_ITEM_SIZE;
+	}
+
+	arenaFree(scratch, icon);
+	return remaining;
+}
+
+#endif
+
+#endif
@@ -1,46 +1,182 @@
 #ifndef MATHUTILS_H
 #define MATHUTILS_H
 
-void interpolateInt(float deltaTime, float d, int* v, int* p, int t) {
-	float ddt = d * deltaTime;
-	float ddd = d * ddt;
+#include <stdint.h>
+
+// The menu's time base and interpolators run on scalar_t. That is float, or
+// Q16.16 fixed point when built with MENU_FIXED_POINT, which keeps the FPU out
+// of the hot path and makes replays bit-exact whatever compiles them.
+// Constants go through SCALAR() and products through scalarMul.
+#ifdef MENU_FIXED_POINT
+typedef int32_t scalar_t;
+#define SCALAR_ONE 0x10000
+#define SCALAR(x) ((scalar_t)((x) * 65536.0 + ((x) < 0 ? -0.5 : 0.5)))
+
+static inline scalar_t scalarMul(scalar_t a, scalar_t b) {
+	return (scalar_t)(((int64_t)a * b) >> 16);
+}
+
+static inline scalar_t scalarDiv(scalar_t a, scalar_t b) {
+	return (scalar_t)(((int64_t)a * SCALAR_ONE) / b);
+}
+
+static inline scalar_t scalarFromInt(int i) {
+	return i * SCALAR_ONE;
+}
+
+// Toward zero, as a float to int conversion
+static inline int scalarToInt(scalar_t a) {
+	return a < 0 ? -(-a >> 16) : a >> 16;
+}
+
+// Times wrap every 32768 seconds; differences stay right across the wrap
+static inline scalar_t timeAdd(scalar_t time, scalar_t step) {
+	return (scalar_t)((uint32_t)time + (uint32_t)step);
+}
 
-	int force = *v - (*p - t) * ddd;
+static inline scalar_t timeSince(scalar_t now, scalar_t then) {
+	return (scalar_t)((uint32_t)now - (uint32_t)then);
+}
+#else
+typedef float scalar_t;
+#define SCALAR_ONE 1.f
+#define SCALAR(x) ((scalar_t)(x))
 
-	float e = 1 + ddt;
-	e *= e;
+static inline scalar_t scalarMul(scalar_t a, scalar_t b) {
+	return a * b;
+}
 
-	*v = force / e;
+static inline scalar_t scalarDiv(scalar_t a, scalar_t b) {
+	return a / b;
+}
 
-	*p += *v * deltaTime;
+static inline scalar_t scalarFromInt(int i) {
+	return i;
 }
 
-void interpolateFloat(float deltaTime, float d, float* v, float* p, float t) {
-	float ddt = d * deltaTime;
-	float ddd = d * ddt;
+static inline int scalarToInt(scalar_t a) {
+	return a;
+}
 
-	float force = *v - (*p - t) * ddd;
+static inline scalar_t timeAdd(scalar_t time, scalar_t step) {
+	return time + step;
+}
 
-	float e = 1 + ddt;
-	e *= e;
+static inline scalar_t timeSince(scalar_t now, scalar_t then) {
+	return now - then;
+}
+#endif
+
+#define SPRING_SETTLE_OMEGA 6.64 // omega * settle time; (1 + x)e^-x is 1% at x = 6.64
+#define SPRING_STEP_TOLERANCE 0.0001 // Seconds a step may differ by and reuse the cached decay
+
+// Critically damped spring, solved exactly for each step rather than
+// integrated, so it is stable for any step and a move from rest never
+// overshoots. settleTime is the seconds a move from rest takes to get within
+// 1% of its target. A step is a 2x2 matrix over the offset from the target
+// and the velocity, cached since frames are mostly the same length.
+typedef struct {
+	scalar_t settleTime;
+	scalar_t omega;
+	scalar_t deltaTime; // Step the matrix is for
+	scalar_t pp, pv; // p' = pp * p + pv * v
+	scalar_t vp, vv; // v' = vp * p + vv * v
+} spring_t;
+
+void setSpringSettleTime(spring_t* spring, scalar_t settleTime) {
+	if (spring->settleTime == settleTime) return;
+	spring->settleTime = settleTime;
+	spring->omega = scalarDiv(SCALAR(SPRING_SETTLE_OMEGA), settleTime);
+	spring->deltaTime = -SCALAR_ONE;
+}
+
+void construct_spring_t(spring_t* spring, scalar_t settleTime) {
+	spring->settleTime = 0;
+	spring->omega = 0;
+	spring->deltaTime = -SCALAR_ONE;
+	spring->pp = 0;
+	spring->pv = 0;
+	spring->vp = 0;
+	spring->vv = 0;
+	setSpringSettleTime(spring, settleTime);
+}
+
+// e^-x for x >= 0, without libm: a Taylor series on x / 16, squared four times
+scalar_t springDecay(scalar_t x) {
+	if (x > SCALAR(16)) return 0;
+	scalar_t y = scalarMul(x, SCALAR(1 / 16.));
+	scalar_t e = SCALAR_ONE - scalarMul(y, SCALAR_ONE - scalarMul(y, SCALAR(1 / 2.) - scalarMul(y, SCALAR(1 / 6.) - scalarMul(y, SCALAR(1 / 24.)))));
+	e = scalarMul(e, e);
+	e = scalarMul(e, e);
+	e = scalarMul(e, e);
+	return scalarMul(e, e);
+}
+
+static inline void springStep(spring_t* spring, scalar_t deltaTime) {
+	scalar_t change = deltaTime - spring->deltaTime;
+	if (change < SCALAR(SPRING_STEP_TOLERANCE) && change > -SCALAR(SPRING_STEP_TOLERANCE)) return;
+
+	scalar_t wt = scalarMul(spring->omega, deltaTime);
+	scalar_t decay = springDecay(wt);
+	spring->deltaTime = deltaTime;
+	spring->pp = scalarMul(SCALAR_ONE + wt, decay);
+	spring->pv = scalarMul(deltaTime, decay);
+	spring->vp = -scalarMul(scalarMul(spring->omega, wt), decay);
+	spring->vv = scalarMul(SCALAR_ONE - wt, decay);
+}
+
+void interpolateInt(scalar_t deltaTime, spring_t* spring, int* v, int* p, int t) {
+	springStep(spring, deltaTime);
+	scalar_t x = scalarFromInt(*p - t);
+	scalar_t velocity = scalarFromInt(*v);
+
+	*p = t + scalarToInt(scalarMul(spring->pp, x) + scalarMul(spring->pv, velocity));
+	*v = scalarToInt(scalarMul(spring->vp, x) + scalarMul(spring->vv, velocity));
+}
+
+#define SETTLE_INT_DISTANCE 1 // Steps from its target an interpolator may rest at
+#define SETTLE_INT_SPEED 8 // Steps per second below which it has stopped
+
+// interpolateInt that snaps onto the target once it comes to rest; returns
+// whether it is at rest on its target. Rest is within SETTLE_INT_DISTANCE and
+// under SETTLE_INT_SPEED, or stuck: the truncated step leaving it as it was,
+// which it then does for good, short of the target.
+uint8_t interpolateIntSettle(scalar_t deltaTime, spring_t* spring, int* v, int* p, int t) {
+	if (*p == t && !*v) return 1;
+
+	int lastV = *v;
+	int lastP = *p;
+	interpolateInt(deltaTime, spring, v, p, t);
+
+	uint8_t stuck = *v == lastV && *p == lastP;
+	uint8_t near = *p - t <= SETTLE_INT_DISTANCE && t - *p <= SETTLE_INT_DISTANCE && *v < SETTLE_INT_SPEED && *v > -SETTLE_INT_SPEED;
+	if (!stuck && !near) return 0;
+	*p = t;
+	*v = 0;
+	return 1;
+}
 
-	*v = force / e;
+// Step a scalar_t; a float unless built with MENU_FIXED_POINT
+void interpolateFloat(scalar_t deltaTime, spring_t* spring, scalar_t* v, scalar_t* p, scalar_t t) {
+	springStep(spring, deltaTime);
+	scalar_t x = *p - t;
 
-	*p += *v * deltaTime;
+	*p = t + scalarMul(spring->pp, x) + scalarMul(spring->pv, *v);
+	*v = scalarMul(spring->vp, x) + scalarMul(spring->vv, *v);
 }
 
 typedef struct {
-    float p;
-    float t;
-    float v;
-    float d;
+    scalar_t p;
+    scalar_t t;
+    scalar_t v;
+    spring_t spring;
 } interpolator_float_t;
 
 typedef struct {
     int p;
     int t;
     int v;
-    float d;
+    spring_t spring;
 } interpolator_int_t;
 
 
@@ -3,9 +3,11 @@
 
 #include <z64ovl/oot/u10.h>
 #include <z64ovl/z64ovl_helpers.h>
-#include "textures.h"
+#include "textureLoader.h"
+#include "menuDraw.h"
 #include "z64_inputHandler.h"
 #include "mathUtils.h"
+#include "guiAnimation.h"
 
 
 #define SW_NONE 0b00000000 
@@ -41,6 +43,14 @@
 #define CATEGORY_BOTTLE 5
 #define NUM_CATEGORIES 6
 #define NUM_ITEMS 48
+#define ITEM_SLOTS 0 // Animation slots of the items, in items order
+#define CATEGORY_SLOTS NUM_ITEMS // and of the category backgrounds, by id
+#if NUM_ITEMS + NUM_CATEGORIES > GUI_ANIMATION_SLOTS
+#error "guiAnimation has too few slots for the menu"
+#endif
+#if NUM_CATEGORIES * 2 > DRAW_DEPTHS
+#error "Categories are drawn at two depths each"
+#endif
 
 #define PROJ_BOW 0
 #define PROJ_FIRE 1
@@ -82,6 +92,11 @@
 #define ARMOR_IBOOTS 4
 #define ARMOR_HBOOTS 5
 
+// Ages an item can be used at
+#define ITEM_AGE_ADULT 0x01
+#define ITEM_AGE_CHILD 0x02
+#define ITEM_AGE_BOTH (ITEM_AGE_ADULT | ITEM_AGE_CHILD)
+
 
 #define baseMenuPositionX 76.f
 #define baseMenuPositionY 108.f
@@ -91,10 +106,17 @@
 #define noSelectOffsetX -4
 #define categoryWidth 115
 
-#define Inventory_Context 0x8011A644
-#define Equipment_Context 0x8011A66C
+#define FRAMETIME SCALAR(0.05)
 
-//Save context + 74 (Inventory) 
+#define CATEGORY_SETTLE_TIME 0.9f // Seconds a category takes at rest
+#define CATEGORY_SCROLL_SETTLE_TIME 0.25f // and at full speed, while scrolling is held
+#define ITEM_SETTLE_LAG 1.1f // Icons take this much longer than their category
+#define ALPHA_SETTLE_TIME 2.4f // Seconds fades take
+#define SCROLL_BOOST_STEP (1 / 9.f) // Speed each scroll adds, lost again each frame without a held scroll
+
+#define Link_Age (Z64GL_SAVE_CONTEXT + 0x04) // 0x8011A5D4, a word: 0 adult, 1 child
+#define Inventory_Context (Z64GL_SAVE_CONTEXT + 0x74) // 0x8011A644
+#define Equipment_Context (Z64GL_SAVE_CONTEXT + 0x9C) // 0x8011A66C
 
 ///
 /// GUI OBJECT
@@ -103,13 +125,9 @@
 typedef struct {
 	gfx_screen_tile_t tile;
 	gfx_texture_t texture;
-	float dampening;
-	float lastUpdate;
-	float targetX;
-	float targetY;
-	float velocityX;
-	float velocityY;
-} guiObject_t; // Single gui object with built in interpolator
+	uint16_t textureId;
+	int8_t slot; // In guiAnimation, -1 if it does not move
+} guiObject_t; // Single gui object, animated through guiAnimation
 
 ///
 /// MENU ITEM
@@ -119,8 +137,13 @@ typedef struct {
 	guiObject_t item;
 	uint8_t isShown;
 	uint8_t* has;
-	float offsetPositionX;
-	float offsetPositionY;
+	uint8_t atlasS; // Icon position in its atlas page
+	uint8_t atlasT;
+	uint8_t atlasPalette; // CI4 palette within the atlas TLUT
+	uint8_t tint; // TLUT_TINT_ variant of the atlas TLUT it is drawn with
+	uint8_t ages; // ITEM_AGE_ bits of the ages that can use it
+	scalar_t offsetPositionX;
+	scalar_t offsetPositionY;
 } menuItem_t; // Selectable menu item; wrapper for other data
 
 ///
@@ -155,21 +178,16 @@ typedef struct {
 	uint8_t menuOpen;
 	uint8_t dPadShow;
 	uint8_t cButton;
+	uint8_t idle; // Closed with everything at rest; only the D-pad hint is drawn
 	int index;
 	int category;
+	int scrollDirection; // 1 after scrolling down, -1 after scrolling up
     int categoryLength[6];
-	float lastTime;
-	float lastScrollTime;
-	float scrollTimeMin;
-	float scrollTimeMax;
-	float scrollTimeDecay;
-	float currentScrollTime;
-	float dampMax;
-	float dampMin;
-	float dampDecay;
-	float currentDamp;
-
-	guiObject_t smoothSelectionBox;
+	scalar_t lastTime;
+	scalar_t scrollBoost; // 0 at rest to 1 at full speed, built up by held scrolls
+	spring_t categorySpring;
+	spring_t itemSpring;
+
     guiObject_t selectionBox;
     interpolator_int_t selectionAlpha;
     int alphaDir;
@@ -182,49 +200,41 @@ typedef struct {
 	menuMeta_t cMeta[6];
 } menu_t; // Wrapper struct for all menu data
 
-static int bit_test(char bit, char byte)
-{
-    bit = 1 << bit;
-    return (bit & byte);
-}
-
 // Constructor for gui objects
 void construct_guiObject_t(guiObject_t* guiObject) {
-	guiObject->dampening = 1;
-	guiObject->lastUpdate = 0;
-	guiObject->targetX = 160;
-	guiObject->targetY = 160;
 	guiObject->tile.x = 160;
 	guiObject->tile.y = 160;
-	guiObject->velocityX = 0;
-	guiObject->velocityY = 0;	
+	guiObject->slot = -1;
 }
 
-// Update gui object interpolator
-void update_guiObject_t(guiObject_t* guiObject, float currentTime, uint8_t diu) {
-	if (diu) {
-		guiObject->tile.x = guiObject->targetX;
-		guiObject->tile.y = guiObject->targetY;
-	}
-	else {
-		float deltaTime = currentTime - guiObject->lastUpdate;
-		float ddt = guiObject->dampening * deltaTime;
-		float ddd = guiObject->dampening * ddt;
-
-		float forceX = guiObject->velocityX - (guiObject->tile.x - guiObject->targetX) * ddd;
-		float forceY = guiObject->velocityY - (guiObject->tile.y - guiObject->targetY) * ddd;
+// Animate a gui object through slot, resting where its tile is
+void animateGuiObject(guiObject_t* guiObject, int slot) {
+	guiObject->slot = slot;
+	guiAnimation.x[slot] = guiAnimation.targetX[slot] = scalarFromInt(guiObject->tile.x);
+	guiAnimation.y[slot] = guiAnimation.targetY[slot] = scalarFromInt(guiObject->tile.y);
+	guiAnimation.velocityX[slot] = 0;
+	guiAnimation.velocityY[slot] = 0;
+}
 
-		float e = 1 + ddt;
-		e *= e;
+static inline void setGuiTarget(guiObject_t* guiObject, scalar_t x, scalar_t y) {
+	guiAnimation.targetX[guiObject->slot] = x;
+	guiAnimation.targetY[guiObject->slot] = y;
+}
 
-		guiObject->velocityX = forceX / e;
-		guiObject->velocityY = forceY / e;
+// Copy an animated gui object's position to its tile
+static inline void syncGuiTile(guiObject_t* guiObject) {
+	guiObject->tile.x = scalarToInt(guiAnimation.x[guiObject->slot]);
+	guiObject->tile.y = scalarToInt(guiAnimation.y[guiObject->slot]);
+}
 
-		guiObject->tile.x += guiObject->velocityX * deltaTime;
-		guiObject->tile.y += guiObject->velocityY * deltaTime;
-	}
+// Set a gui object's texture from the texture table
+void setGuiTexture(guiObject_t* guiObject, int id) {
+	setTexture(&guiObject->texture, id);
+	guiObject->textureId = id;
+}
 
-	guiObject->lastUpdate = currentTime;
+void drawGuiObject(drawQueue_t* queue, int layer, int depth, guiObject_t* guiObject, uint8_t alpha) {
+	drawSprite(queue, layer, depth, guiObject->textureId, &guiObject->tile, alpha);
 }
 
 // Construct a category with number of menu items. We can't malloc so they much be define
@@ -232,21 +242,18 @@ void construct_menuCategory_t(menuCategory_t* category, menuItem_t* items, uint8
 	construct_guiObject_t(&category->categoryBackground);
 	category->alpha.p = 255;
 	category->alpha.t = 255;
+	category->alpha.v = 0;
+	construct_spring_t(&category->alpha.spring, SCALAR(ALPHA_SETTLE_TIME));
 
 	//Long Black Box init
 	category->categoryBackground.tile.x = baseMenuPositionX;
 	category->categoryBackground.tile.y = baseMenuPositionY;
-	category->categoryBackground.targetX = baseMenuPositionX;
-	category->categoryBackground.targetY = baseMenuPositionY;
+	animateGuiObject(&category->categoryBackground, CATEGORY_SLOTS + id);
 	category->categoryBackground.tile.origin_anchor = G_TX_ANCHOR_C;
 	category->categoryBackground.tile.width = categoryWidth;
 	category->categoryBackground.tile.height = 64;
 
-	category->categoryBackground.texture.timg = &tLongBlackBox;
-	category->categoryBackground.texture.width = 32;
-	category->categoryBackground.texture.height = 32;
-	category->categoryBackground.texture.fmt = G_IM_FMT_RGBA;
-	category->categoryBackground.texture.bitsiz = 3;
+	setGuiTexture(&category->categoryBackground, TEX_LONGBLAC);
 
 	category->length = length;
 	category->items = items;
@@ -255,56 +262,139 @@ void construct_menuCategory_t(menuCategory_t* category, menuItem_t* items, uint8
 
 	for (int i = 0; i < length; i++) {
 		construct_guiObject_t(&category->items[i].item);
-		category->items[i].offsetPositionX = -(categoryWidth / 2) + (16 * i);
-		category->items[i].offsetPositionY = -25;
+		category->items[i].offsetPositionX = scalarFromInt(-(categoryWidth / 2) + (16 * i));
+		category->items[i].offsetPositionY = scalarFromInt(-25);
 	}
 }
 
-// Update menu category; automated drawing
-void update_menuCategory_t(menuCategory_t* category, z64_global_t* gl, z64_inputHandler_t* input, menu_t* state, float currentTime, float deltaTime) {
-	update_guiObject_t(&category->categoryBackground, currentTime, state->demandImmediateUpdate);
+// Queue shown items from their atlas cells, with the TLUT variant of their
+// tint. Icons drawn at ATLAS_CELL_SIZE are point sampled; there is nothing to
+// filter when texels map 1:1 to pixels. Neighbouring icons can round a pixel
+// into each other, so every other one is drawn a depth further up.
+void drawAtlasItems(drawQueue_t* queue, int depth, menuItem_t* items, int length, uint8_t alpha) {
+	for (int i = 0; i < length; i++) {
+		if (!items[i].isShown) continue;
+		int id = items[i].item.textureId;
+		int tlut = textureInfo[id].tlut;
+		if (tlut != NO_TLUT) tlut += items[i].tint;
+		int palette = textureInfo[id].bitsiz == G_IM_SIZ_4b ? items[i].atlasPalette : 0;
+
+		drawQueueRegion(queue, DRAW_LAYER_ITEMS, depth + (i & 1), id, tlut, palette, &items[i].item.tile, items[i].atlasS, items[i].atlasT,
+			ATLAS_CELL_SIZE, ATLAS_CELL_SIZE, alpha);
+	}
+}
+
+// Queue a category's background and items where they are. Backgrounds of
+// neighbouring categories overlap, as do icons while they scroll past each
+// other, so each category is drawn at its own depths, in id order.
+void drawMenuCategory(menuCategory_t* category) {
+	drawGuiObject(&drawQueue, DRAW_LAYER_BACKGROUND, category->id * 2, &category->categoryBackground, category->alpha.p);
+	drawAtlasItems(&drawQueue, category->id * 2, category->items, category->length, category->alpha.p);
+}
 
-	interpolateInt(deltaTime, 3, &category->alpha.v, &category->alpha.p, category->alpha.t);
-    zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &category->categoryBackground.texture, &category->categoryBackground.tile, category->alpha.p);
+// Update menu category; positions are stepped for all categories at once by
+// update_menuAnimation. Returns whether its fade is at rest.
+uint8_t update_menuCategory_t(menuCategory_t* category, z64_global_t* gl, z64_inputHandler_t* input, menu_t* state, scalar_t currentTime, scalar_t deltaTime) {
+	uint8_t rest = interpolateIntSettle(deltaTime, &category->alpha.spring, &category->alpha.v, &category->alpha.p, category->alpha.t);
+	int background = category->categoryBackground.slot;
+	uint8_t age = *(int32_t*)Link_Age ? ITEM_AGE_CHILD : ITEM_AGE_ADULT;
 
 	for (int i = 0; i < category->length; i++) {
 		//Update positions relative to parent
-		category->items[i].item.targetX = category->items[i].offsetPositionX + category->categoryBackground.targetX;
-		category->items[i].item.targetY = category->items[i].offsetPositionY + category->categoryBackground.targetY;
-		
+		setGuiTarget(&category->items[i].item, category->items[i].offsetPositionX + guiAnimation.targetX[background],
+			category->items[i].offsetPositionY + guiAnimation.targetY[background]);
 			
-		uint8_t drawBoxes = state->category == category->id;
+		// Items Link cannot use at his age are greyed, and the selected icon highlighted
+		if (!(category->items[i].ages & age)) category->items[i].tint = TLUT_TINT_GREYED;
+		else if (state->menuOpen && state->category == category->id && state->index == i) category->items[i].tint = TLUT_TINT_HIGHLIGHTED;
+		else category->items[i].tint = TLUT_TINT_NORMAL;
+	}
+	return rest;
+}
 
-		
-		update_guiObject_t(&category->items[i].item, currentTime, state->demandImmediateUpdate);
-		
-		if (category->items[i].isShown) zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &category->items[i].item.texture, &category->items[i].item.tile, category->alpha.p);
+// Step every item and category background, each group on its spring, and
+// write their tiles. Returns whether all of them are at rest.
+uint8_t update_menuAnimation(menu_t* state, scalar_t deltaTime) {
+	uint32_t moving = 0;
+	if (state->demandImmediateUpdate) {
+		guiAnimationSnap(&guiAnimation, ITEM_SLOTS, NUM_ITEMS);
+		guiAnimationSnap(&guiAnimation, CATEGORY_SLOTS, NUM_CATEGORIES);
 	}
+	else {
+		moving += update_guiAnimation_t(&guiAnimation, ITEM_SLOTS, NUM_ITEMS, &state->itemSpring, deltaTime);
+		moving += update_guiAnimation_t(&guiAnimation, CATEGORY_SLOTS, NUM_CATEGORIES, &state->categorySpring, deltaTime);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) syncGuiTile(&state->items[i].item);
+	for (int i = 0; i < NUM_CATEGORIES; i++) syncGuiTile(&state->cCategory[i].categoryBackground);
+	return !moving;
 }
 
 
-// Construct menu data
-void construct_menu_t(menu_t* state) {
+// Layers recorded once and drawn from their lists until they change: the
+// category backgrounds move only while the menu opens, closes or scrolls, and
+// the D-pad hint only when the menu opens or closes
+drawList_t drawBackgroundList;
+drawList_t drawHudList;
+
+// Mark the items only one age can use; the rest can be used by both
+void setItemAges(menu_t* state) {
+	for (int i = 0; i < NUM_ITEMS; i++) state->items[i].ages = ITEM_AGE_BOTH;
+
+	menuItem_t* projectiles = state->cCategory[CATEGORY_PROJECTILE].items;
+	projectiles[PROJ_BOW].ages = ITEM_AGE_ADULT;
+	projectiles[PROJ_FIRE].ages = ITEM_AGE_ADULT;
+	projectiles[PROJ_ICE].ages = ITEM_AGE_ADULT;
+	projectiles[PROJ_LIGHT].ages = ITEM_AGE_ADULT;
+	projectiles[PROJ_HOOK].ages = ITEM_AGE_ADULT;
+	projectiles[PROJ_LONG].ages = ITEM_AGE_ADULT;
+	projectiles[PROJ_SLING].ages = ITEM_AGE_CHILD;
+	projectiles[PROJ_BOOMER].ages = ITEM_AGE_CHILD;
+
+	menuItem_t* weapons = state->cCategory[CATEGORY_WEAPON].items;
+	weapons[WEAPON_KOKIRI].ages = ITEM_AGE_CHILD;
+	weapons[WEAPON_MASTER].ages = ITEM_AGE_ADULT;
+	weapons[WEAPON_BIGGORON].ages = ITEM_AGE_ADULT;
+	weapons[WEAPON_DEKU].ages = ITEM_AGE_CHILD;
+	weapons[WEAPON_MIRROR].ages = ITEM_AGE_ADULT;
+
+	menuItem_t* armor = state->cCategory[CATEGORY_ARMOR].items;
+	armor[ARMOR_GORON].ages = ITEM_AGE_ADULT;
+	armor[ARMOR_ZORA].ages = ITEM_AGE_ADULT;
+	armor[ARMOR_IBOOTS].ages = ITEM_AGE_ADULT;
+	armor[ARMOR_HBOOTS].ages = ITEM_AGE_ADULT;
+
+	menuItem_t* hand = state->cCategory[CATEGORY_HAND].items;
+	hand[HAND_HAM].ages = ITEM_AGE_ADULT;
+	hand[HAND_STI].ages = ITEM_AGE_CHILD;
+}
+
+// Construct menu data; sets up D-pad auto-repeat on the input handler
+void construct_menu_t(menu_t* state, z64_inputHandler_t* input) {
 	state->doesExist = 1;
 	state->demandImmediateUpdate = 0;
 	state->menuOpen = 0;
 	state->dPadShow = 1;
 	state->category = 0;
+	state->scrollDirection = 1;
 	state->cButton = 0;
+	state->idle = 0;
     state->selectionAlpha.p = 255;
     state->selectionAlpha.t = 255;
     state->selectionAlpha.v = 0;
+    construct_spring_t(&state->selectionAlpha.spring, SCALAR(ALPHA_SETTLE_TIME));
     state->alphaDir = -11;
     state->index = 0;
-	state->lastScrollTime = 0;
-	state->scrollTimeMin = 0.1f;
-	state->scrollTimeMax = 0.25f;
-	state->scrollTimeDecay = 0.05f;
-	state->currentScrollTime = state->scrollTimeMax;
-	state->dampMax = 108;
-	state->dampMin = 9;
-	state->dampDecay = 11;
-	state->currentDamp = state->dampMin;
+	state->scrollBoost = 0;
+	construct_spring_t(&state->categorySpring, SCALAR(CATEGORY_SETTLE_TIME));
+	construct_spring_t(&state->itemSpring, SCALAR(CATEGORY_SETTLE_TIME * ITEM_SETTLE_LAG));
+	construct_guiAnimation_t(&guiAnimation);
+
+	setButtonRepeat(input, BUTTON_DU | BUTTON_DD | BUTTON_DL | BUTTON_DR, SCALAR(0.5), SCALAR(0.25), SCALAR(0.05), SCALAR(0.1));
+
+	construct_drawQueue_t(&drawQueue);
+	drawQueueCacheLayer(&drawQueue, DRAW_LAYER_BACKGROUND, &drawBackgroundList);
+	drawQueueCacheLayer(&drawQueue, DRAW_LAYER_HUD, &drawHudList);
 
 	construct_menuCategory_t(&state->cCategory[CATEGORY_PROJECTILE], state->items, 8, CATEGORY_PROJECTILE);
 	construct_menuCategory_t(&state->cCategory[CATEGORY_WEAPON], &state->items[8], 6, CATEGORY_WEAPON);
@@ -338,46 +428,6 @@ void construct_menu_t(menu_t* state) {
 	state->cMeta[5].above = CATEGORY_MAGIC;
 	state->cMeta[5].below = CATEGORY_PROJECTILE;
 
-	
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_BOW].item.texture.timg = &tBow;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_FIRE].item.texture.timg = &tFireArrow;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_ICE].item.texture.timg = &tIceArrow;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_LIGHT].item.texture.timg = &tLightArrows;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_HOOK].item.texture.timg = &tHookshot;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_LONG].item.texture.timg = &tLongshot;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_SLING].item.texture.timg = &tSlingshot;
-    state->cCategory[CATEGORY_PROJECTILE].items[PROJ_BOOMER].item.texture.timg = &tBoomerang;
-
-	//Set the icons for these, annd make defiens. See above/below
-	state->cCategory[CATEGORY_WEAPON].items[0].item.texture.timg = &tKokiriSword;
-	state->cCategory[CATEGORY_WEAPON].items[1].item.texture.timg = &tMasterSword;
-	state->cCategory[CATEGORY_WEAPON].items[2].item.texture.timg = &tBiggoron;
-	state->cCategory[CATEGORY_WEAPON].items[3].item.texture.timg = &tDekuShield;
-	state->cCategory[CATEGORY_WEAPON].items[4].item.texture.timg = &tHylianShield;
-	state->cCategory[CATEGORY_WEAPON].items[5].item.texture.timg = &tMirrorShield;
-
-	state->cCategory[CATEGORY_ARMOR].items[0].item.texture.timg = &tKokiriTunic;
-	state->cCategory[CATEGORY_ARMOR].items[1].item.texture.timg = &tGoronTunic;
-	state->cCategory[CATEGORY_ARMOR].items[2].item.texture.timg = &tZoraTunic;
-	state->cCategory[CATEGORY_ARMOR].items[3].item.texture.timg = &tKokiriBoots;
-	state->cCategory[CATEGORY_ARMOR].items[4].item.texture.timg = &tIronBoots;
-	state->cCategory[CATEGORY_ARMOR].items[5].item.texture.timg = &tHoverBoots;
-    
-	state->cCategory[CATEGORY_HAND].items[HAND_HAM].item.texture.timg = &tHammer;
-    state->cCategory[CATEGORY_HAND].items[HAND_BOM].item.texture.timg = &tBombs;
-    state->cCategory[CATEGORY_HAND].items[HAND_BOC].item.texture.timg = &tBombchu;
-    state->cCategory[CATEGORY_HAND].items[HAND_STI].item.texture.timg = &tDekuStick;
-    state->cCategory[CATEGORY_HAND].items[HAND_NUT].item.texture.timg = &tDekuNuts;
-
-    state->cCategory[CATEGORY_MAGIC].items[MAG_NAY].item.texture.timg = &tNayru;
-    state->cCategory[CATEGORY_MAGIC].items[MAG_DIN].item.texture.timg = &tDin;
-    state->cCategory[CATEGORY_MAGIC].items[MAG_FAR].item.texture.timg = &tFarore;
-
-    state->cCategory[CATEGORY_BOTTLE].items[BOTTLE_0].item.texture.timg = &tEmptyBottle;
-    state->cCategory[CATEGORY_BOTTLE].items[BOTTLE_1].item.texture.timg = &tEmptyBottle;
-    state->cCategory[CATEGORY_BOTTLE].items[BOTTLE_2].item.texture.timg = &tEmptyBottle;
-    state->cCategory[CATEGORY_BOTTLE].items[BOTTLE_3].item.texture.timg = &tEmptyBottle;
-
 
 	construct_guiObject_t(&state->selectionBox);
 	state->selectionBox.tile.x = 0;
@@ -386,20 +436,8 @@ void construct_menu_t(menu_t* state) {
 	state->selectionBox.tile.width = 19;
 	state->selectionBox.tile.height= 19;
 
-	state->selectionBox.texture.timg = &tRedBox;
-	state->selectionBox.texture.width = 32;
-	state->selectionBox.texture.height = 32;
-	state->selectionBox.texture.fmt = G_IM_FMT_RGBA;
-	state->selectionBox.texture.bitsiz = 3;
-    state->selectionBox.dampening = 999;
+	setGuiTexture(&state->selectionBox, TEX_RED);
 
-	state->cCategory[CATEGORY_PROJECTILE].categoryBackground.dampening = state->dampMin;
-	state->cCategory[CATEGORY_WEAPON].categoryBackground.dampening = state->dampMin;
-	state->cCategory[CATEGORY_ARMOR].categoryBackground.dampening = state->dampMin;
-	state->cCategory[CATEGORY_PROJECTILE].categoryBackground.dampening = state->dampMin;
-	state->cCategory[CATEGORY_MAGIC].categoryBackground.dampening = state->dampMin;
-	state->cCategory[CATEGORY_HAND].categoryBackground.dampening = state->dampMin;
-	state->cCategory[CATEGORY_BOTTLE].categoryBackground.dampening = state->dampMin;
 
 
 	construct_guiObject_t(&state->dPadTop);
@@ -409,11 +447,7 @@ void construct_menu_t(menu_t* state) {
 	state->dPadTop.tile.width = 40;
 	state->dPadTop.tile.height= 24;
 
-	state->dPadTop.texture.timg = &tDpad1;
-	state->dPadTop.texture.width = 64;
-	state->dPadTop.texture.height = 32;
-	state->dPadTop.texture.fmt = G_IM_FMT_RGBA;
-	state->dPadTop.texture.bitsiz = 2;
+	setGuiTexture(&state->dPadTop, TEX_DPAD_BASE_TOP);
 
 
 	construct_guiObject_t(&state->dPadBottom);
@@ -423,85 +457,152 @@ void construct_menu_t(menu_t* state) {
 	state->dPadBottom.tile.width = 40;
 	state->dPadBottom.tile.height= 24;
 
-	state->dPadBottom.texture.timg = &tDpad0;
-	state->dPadBottom.texture.width = 64;
-	state->dPadBottom.texture.height = 32;
-	state->dPadBottom.texture.fmt = G_IM_FMT_RGBA;
-	state->dPadBottom.texture.bitsiz = 2;
+	setGuiTexture(&state->dPadBottom, TEX_DPAD_BASE_BOTTOM);
 
     //Construct BGs and icons
     for (int i = 0; i < NUM_ITEMS; i++) {
-        state->items[i].item.dampening = state->dampMin - 1;
         state->items[i].item.tile.x = 0;
         state->items[i].item.tile.y = 0;
+        animateGuiObject(&state->items[i].item, ITEM_SLOTS + i);
         state->items[i].item.tile.origin_anchor = G_TX_ANCHOR_C;
         state->items[i].item.tile.width = 16;
         state->items[i].item.tile.height = 16;
+    }
 
-        state->items[i].item.texture.width = 32;
-        state->items[i].item.texture.height = 32;
-        state->items[i].item.texture.fmt = G_IM_FMT_RGBA;
-        state->items[i].item.texture.bitsiz = 2;
+    // Icons come from the category atlases, in items order
+    for (int i = 0; i < NUM_ATLAS_CELLS; i++) {
+        setGuiTexture(&state->items[i].item, atlasCells[i][0]);
+        state->items[i].atlasS = atlasCells[i][1];
+        state->items[i].atlasT = atlasCells[i][2];
+        state->items[i].atlasPalette = atlasCells[i][3];
     }
+
+	setItemAges(state);
 }
 
-inline void forceMoveCategory(menuCategory_t* category, float damp) {
-	for (int i = 0; i < category->length; i++) {
-		category->items[i].item.dampening = damp - 1;
-	}
+// Settle time of the categories at the current scroll speed. The speed ramps
+// omega, so it blends the rates rather than the times.
+static inline scalar_t scrollSettleTime(menu_t* state) {
+	scalar_t rest = SCALAR(1 / CATEGORY_SETTLE_TIME);
+	scalar_t fast = SCALAR(1 / CATEGORY_SCROLL_SETTLE_TIME);
+	return scalarDiv(SCALAR_ONE, rest + scalarMul(fast - rest, state->scrollBoost));
 }
 
 inline void forceMove(menu_t* state) {
-	state->currentDamp += state->dampDecay;
+	state->scrollBoost += SCALAR(SCROLL_BOOST_STEP);
+	if (state->scrollBoost > SCALAR_ONE) state->scrollBoost = SCALAR_ONE;
+	scalar_t settleTime = scrollSettleTime(state);
 
-	for (int i = 0; i < NUM_CATEGORIES; i++) {
-		state->cCategory[i].categoryBackground.dampening = state->currentDamp;
-		forceMoveCategory(&state->cCategory[i], state->currentDamp);
-	}
+	setSpringSettleTime(&state->categorySpring, settleTime);
+	setSpringSettleTime(&state->itemSpring, scalarMul(settleTime, SCALAR(ITEM_SETTLE_LAG)));
+}
+
+// Move the selection up or down a category, keeping the index inside it
+inline void scrollCategory(menu_t* state, int direction) {
+	state->scrollDirection = direction;
+	state->category += direction;
+	if (state->category > NUM_CATEGORIES - 1) state->category = 0;
+	if (state->category < 0) state->category = NUM_CATEGORIES - 1;
+
+	state->index = state->index > state->categoryLength[state->category] - 1 ? state->categoryLength[state->category] - 1 : state->index;
+	forceMove(state);
 }
 
 inline void updateCategoryPosition(menuCategory_t* offset, int position) {
-	float positionX = baseMenuPositionX;
-	float selectedPositionY = baseMenuPositionY;
-	float belowPositionY = baseMenuPositionY + baseMenuSizeOffset;
-	float abovePositionY = baseMenuPositionY - baseMenuSizeOffset;
-	float offscreenPositionX = offscreenMenuPositionX;
-	float offscreenAbovePositionY = baseMenuPositionY - baseMenuSizeOffset;
-	float offscreenBelowPositionY = baseMenuPositionY + baseMenuSizeOffset;
+	scalar_t positionX = SCALAR(baseMenuPositionX);
+	scalar_t selectedPositionY = SCALAR(baseMenuPositionY);
+	scalar_t belowPositionY = SCALAR(baseMenuPositionY + baseMenuSizeOffset);
+	scalar_t abovePositionY = SCALAR(baseMenuPositionY - baseMenuSizeOffset);
+	scalar_t offscreenPositionX = SCALAR(offscreenMenuPositionX);
+	scalar_t offscreenAbovePositionY = SCALAR(baseMenuPositionY - baseMenuSizeOffset);
+	scalar_t offscreenBelowPositionY = SCALAR(baseMenuPositionY + baseMenuSizeOffset);
 
 	if (position == 0) {
-		offset->categoryBackground.targetX = positionX;
-		offset->categoryBackground.targetY = selectedPositionY;
+		setGuiTarget(&offset->categoryBackground, positionX, selectedPositionY);
 		offset->alpha.t = 240;
 	}
 	else offset->alpha.t = 85;
 
 	if (position == 1) {
-		offset->categoryBackground.targetX = positionX + noSelectOffsetX;
-		offset->categoryBackground.targetY = abovePositionY;
+		setGuiTarget(&offset->categoryBackground, positionX + SCALAR(noSelectOffsetX), abovePositionY);
 	}
 
 	if (position == -1) {
-		offset->categoryBackground.targetX = positionX + noSelectOffsetX;
-		offset->categoryBackground.targetY = belowPositionY;
+		setGuiTarget(&offset->categoryBackground, positionX + SCALAR(noSelectOffsetX), belowPositionY);
 	}
 
 	if (position == 2) {
-		offset->categoryBackground.targetX = offscreenPositionX;
-		offset->categoryBackground.targetY = offscreenAbovePositionY;
+		setGuiTarget(&offset->categoryBackground, offscreenPositionX, offscreenAbovePositionY);
 	}
 
 	if (position == -2) {
-		offset->categoryBackground.targetX = offscreenPositionX;
-		offset->categoryBackground.targetY = offscreenBelowPositionY;
+		setGuiTarget(&offset->categoryBackground, offscreenPositionX, offscreenBelowPositionY);
 	}
 
 	if (position <= -3 || position >= 3) {
-		offset->categoryBackground.targetX = offscreenPositionX;
-		offset->categoryBackground.targetY = baseMenuPositionY;
+		setGuiTarget(&offset->categoryBackground, offscreenPositionX, SCALAR(baseMenuPositionY));
+	}
+}
+
+///
+/// PREFETCH
+///
+
+#ifndef hardware
+
+#define MENU_PREFETCH_BUDGET 0x800 // Bytes of icons prefetched per frame
+
+// Prefetch the pages and TLUTs of a category's items, shown or not as that is
+// only known once the menu is open; returns 0 once this frame's budget is
+// spent or the cache has no room
+static int prefetchCategory(menuCategory_t* category, uint32_t* budget) {
+	for (int i = 0; i < category->length; i++) {
+		int page = category->items[i].item.textureId;
+		int tlut = textureInfo[page].tlut;
+		int ids[1 + NUM_TLUT_TINTS] = { page, tlut, tlut + TLUT_TINT_GREYED, tlut + TLUT_TINT_HIGHLIGHTED };
+
+		for (int k = 0; k < 1 + NUM_TLUT_TINTS; k++) {
+			if (tlut == NO_TLUT && k) break;
+			if (textureCacheIsLoaded(&textureCache, ids[k])) continue;
+			*budget -= textureCachePrefetch(&textureCache, ids[k], *budget);
+			if (!textureCacheIsLoaded(&textureCache, ids[k])) return 0;
+		}
 	}
+	return 1;
 }
 
+// Warm the categories about to come into view. Closed, that is the ones
+// opening shows; open, the one the next scroll brings in, and the one after
+// it while a held scroll keeps scrollBoost up.
+void update_menuPrefetch(menu_t* state) {
+	uint32_t budget = MENU_PREFETCH_BUDGET;
+	if (textureCache.pendingId >= 0) budget -= textureCachePrefetch(&textureCache, textureCache.pendingId, budget);
+	if (textureCache.pendingId >= 0) return;
+
+	int ahead[3];
+	int count = 0;
+	int category = state->category;
+
+	if (!state->menuOpen) {
+		ahead[count++] = category;
+		ahead[count++] = state->cMeta[category].above;
+		ahead[count++] = state->cMeta[category].below;
+	}
+	else {
+		int steps = state->scrollBoost > SCALAR(SCROLL_BOOST_STEP) ? 3 : 2;
+		for (int i = 0; i < steps; i++) {
+			category = state->scrollDirection > 0 ? state->cMeta[category].below : state->cMeta[category].above;
+			if (i) ahead[count++] = category;
+		}
+	}
+
+	for (int i = 0; i < count; i++) {
+		if (!prefetchCategory(&state->cCategory[ahead[i]], &budget)) return;
+	}
+}
+
+#endif
+
 // Update Equipment State
 uint16_t updateLinkEquip(void* current_equip, uint8_t boot, uint8_t tunic, uint8_t shield, uint8_t sword)
 {
@@ -513,79 +614,100 @@ uint16_t updateLinkEquip(void* current_equip, uint8_t boot, uint8_t tunic, uint8
 	return out;
 }
 
+// Queue the D-pad hint
+void drawMenuHud(menu_t* state) {
+	if (state->menuOpen && state->dPadShow) 
+	{
+		setGuiTexture(&state->dPadBottom, TEX_DPAD);
+		drawGuiObject(&drawQueue, DRAW_LAYER_HUD, 0, &state->dPadBottom, 240);
+		setGuiTexture(&state->dPadTop, TEX_DPAD_TOP);
+		drawGuiObject(&drawQueue, DRAW_LAYER_HUD, 0, &state->dPadTop, 240);
+	}
+	else if (state->dPadShow)
+	{
+		setGuiTexture(&state->dPadTop, TEX_DPAD_BASE_TOP);
+		drawGuiObject(&drawQueue, DRAW_LAYER_HUD, 0, &state->dPadTop, 240);
+		setGuiTexture(&state->dPadBottom, TEX_DPAD_BASE_BOTTOM);
+		drawGuiObject(&drawQueue, DRAW_LAYER_HUD, 0, &state->dPadBottom, 240);
+	}
+}
+
 // Update menu data
-void update_menu_t(menu_t* state, z64_inputHandler_t* input, z64_global_t *gl, float currentTime, uint32_t* debug, uint32_t* debug2) {
-	float deltaTime = currentTime - state->lastTime;
+void update_menu_t(menu_t* state, z64_inputHandler_t* input, z64_global_t *gl, scalar_t currentTime, uint32_t* debug, uint32_t* debug2) {
+	scalar_t deltaTime = timeSince(currentTime, state->lastTime);
 	state->lastTime = currentTime;
+	drawStats.drawn = 0;
+	drawStats.culled = 0;
+	drawQueueClear(&drawQueue);
+
+	#ifndef hardware
+	update_textureCache_t(&textureCache);
+	#endif
+
+	// Idle, nothing moves until a D-pad press opens the menu or toggles the hint
+	if (state->idle && !(input->pressed & (BUTTON_DU | BUTTON_DL | BUTTON_DD | BUTTON_DR)) && !state->demandImmediateUpdate) {
+		for (int i = 0; i < NUM_CATEGORIES; i++) drawMenuCategory(&state->cCategory[i]);
+		drawMenuHud(state);
+		drawQueueFlush(&drawQueue, &gl->common.gfx_ctxt->overlay);
+		return;
+	}
+	state->idle = 0;
+
+	#ifndef hardware
+	update_menuPrefetch(state);
+	#endif
 
+	uint8_t rest = 1;
 	for (int i = 0; i < NUM_CATEGORIES; i++) {
-		update_menuCategory_t(&state->cCategory[i], gl, input, state, currentTime, deltaTime);
+		rest &= update_menuCategory_t(&state->cCategory[i], gl, input, state, currentTime, deltaTime);
 	}
+	rest &= update_menuAnimation(state, deltaTime);
+	for (int i = 0; i < NUM_CATEGORIES; i++) drawMenuCategory(&state->cCategory[i]);
 
 	if (!state->menuOpen) {
-		if (input->du.buttonState == STATE_PRESSED) state->dPadShow = !state->dPadShow;
+		if (input->pressed & BUTTON_DU) state->dPadShow = !state->dPadShow;
 
-		if (input->dl.buttonState == STATE_PRESSED || input->dd.buttonState == STATE_PRESSED || input->dr.buttonState == STATE_PRESSED) {
-			if (input->dl.buttonState == STATE_PRESSED) state->cButton = CLEFT;
-			if (input->dd.buttonState == STATE_PRESSED) state->cButton = CDOWN;
-			if (input->dr.buttonState == STATE_PRESSED) state->cButton = CRIGHT;
+		if (input->pressed & (BUTTON_DL | BUTTON_DD | BUTTON_DR)) {
+			if (input->pressed & BUTTON_DL) state->cButton = CLEFT;
+			if (input->pressed & BUTTON_DD) state->cButton = CDOWN;
+			if (input->pressed & BUTTON_DR) state->cButton = CRIGHT;
 
 			state->menuOpen = 1; 
 
 			for (int i = 0; i < NUM_CATEGORIES; i++) {
-				state->cCategory[i].categoryBackground.tile.y = baseMenuPositionY;
+				guiAnimation.y[state->cCategory[i].categoryBackground.slot] = SCALAR(baseMenuPositionY);
 				state->cCategory[i].alpha.t = 0;
 			}
 			
-			state->smoothSelectionBox.targetX = offscreenMenuPositionX;
-			state->smoothSelectionBox.targetY = baseMenuPositionY;
+			state->selectionBox.tile.x = offscreenMenuPositionX;
+			state->selectionBox.tile.y = baseMenuPositionY;
 
+			drawQueueFlush(&drawQueue, &gl->common.gfx_ctxt->overlay);
 			return;
 		}
 	}
-	else if (input->l.buttonState == STATE_PRESSED && state->menuOpen) { state->menuOpen = 0; return; }
+	else if ((input->pressed & BUTTON_L) && state->menuOpen) {
+		state->menuOpen = 0;
+
+		// The categories either side of the selected one part as they leave
+		guiAnimation.targetY[state->cCategory[state->cMeta[state->category].above].categoryBackground.slot] += SCALAR(offscreenMenuOffsetY);
+		guiAnimation.targetY[state->cCategory[state->cMeta[state->category].below].categoryBackground.slot] -= SCALAR(offscreenMenuOffsetY);
+
+		drawQueueFlush(&drawQueue, &gl->common.gfx_ctxt->overlay);
+		return;
+	}
 	
 	
 	if (state->menuOpen) 
 	{
-		if (input->dr.buttonState == STATE_PRESSED) state->index++;
-		if (input->dl.buttonState == STATE_PRESSED) state->index--;
-
-		if (input->du.buttonState == STATE_PRESSED) {
-            state->category--;
-            state->index = state->index > state->categoryLength[state->category] - 1 ? state->categoryLength[state->category] - 1: state->index;
-			forceMove(state);
-        }
-		if (input->dd.buttonState == STATE_PRESSED) {
-            state->category++;
-            state->index = state->index > state->categoryLength[state->category] - 1 ? state->categoryLength[state->category] - 1 : state->index;
-			forceMove(state);
-        }
-
-		if (input->du.buttonState == STATE_DOWN && currentTime - input->du.invokeTime > 0.5f && currentTime - state->lastScrollTime > state->currentScrollTime) {
-            state->category--;
-            state->index = state->index > state->categoryLength[state->category] - 1 ? state->categoryLength[state->category] - 1: state->index;
-			forceMove(state);
-			state->currentScrollTime -= state->scrollTimeDecay;
-			state->lastScrollTime = currentTime;
-        }
-		if (input->dd.buttonState == STATE_DOWN && currentTime - input->dd.invokeTime > 0.5f && currentTime - state->lastScrollTime > state->currentScrollTime) {
-            state->category++;
-            state->index = state->index > state->categoryLength[state->category] - 1 ? state->categoryLength[state->category] - 1 : state->index;
-			forceMove(state);
-			state->currentScrollTime -= state->scrollTimeDecay;
-			state->lastScrollTime = currentTime;
-        }
-		if (state->category > NUM_CATEGORIES - 1) state->category = 0;
-		if (state->category < 0) state->category = NUM_CATEGORIES - 1;
-
-
-		if (input->du.buttonState == STATE_UP && input->dd.buttonState == STATE_UP) {
-			state->currentScrollTime += state->scrollTimeDecay;
-			state->currentDamp -= state->dampDecay;
-		}
-		state->currentScrollTime = state->currentScrollTime < state->scrollTimeMin ? state->scrollTimeMin : state->currentScrollTime > state->scrollTimeMax ? state->scrollTimeMax : state->currentScrollTime;
-		state->currentDamp = state->currentDamp < state->dampMin ? state->dampMin : state->currentDamp > state->dampMax ? state->dampMax : state->currentDamp;
+		// Taps and held repeats both arrive through the input handler's repeat mask
+		if (input->repeat & BUTTON_DR) state->index++;
+		if (input->repeat & BUTTON_DL) state->index--;
+		if (input->repeat & BUTTON_DU) scrollCategory(state, -1);
+		if (input->repeat & BUTTON_DD) scrollCategory(state, 1);
+
+		if (!(input->held & (BUTTON_DU | BUTTON_DD))) state->scrollBoost -= SCALAR(SCROLL_BOOST_STEP);
+		if (state->scrollBoost < 0) state->scrollBoost = 0;
 
 
         if (state->index > state->categoryLength[state->category] - 1) state->index = 0;
@@ -642,7 +764,7 @@ void update_menu_t(menu_t* state, z64_inputHandler_t* input, z64_global_t *gl, f
 		state->cCategory[CATEGORY_BOTTLE].items[BOTTLE_3].isShown = inventory[21] != 0xFF;
 		
 
-		if (input->a.buttonState == STATE_PRESSED) 
+		if (input->pressed & BUTTON_A) 
 		{
 
 			uint8_t* current_item = (uint8_t*)(Z64GL_SAVE_CONTEXT + 0x68);
@@ -732,51 +854,31 @@ void update_menu_t(menu_t* state, z64_inputHandler_t* input, z64_global_t *gl, f
 		updateCategoryPosition(&state->cCategory[bbCat], -2);
 		updateCategoryPosition(&state->cCategory[bbbCat], -2);
 
-		state->smoothSelectionBox.targetX = state->cCategory[state->category].items[state->index].item.tile.x;
-		state->smoothSelectionBox.targetY = state->cCategory[state->category].items[state->index].item.tile.y;
+		state->selectionBox.tile.x = state->cCategory[state->category].items[state->index].item.tile.x;
+		state->selectionBox.tile.y = state->cCategory[state->category].items[state->index].item.tile.y;
 	}
 	else 
 	{
 		for (int i = 0; i < 6; i++) {
-			state->cCategory[i].categoryBackground.targetX = offscreenMenuPositionX;
+			guiAnimation.targetX[state->cCategory[i].categoryBackground.slot] = SCALAR(offscreenMenuPositionX);
 		}
 
-		state->cCategory[state->cMeta[state->category].above].categoryBackground.targetY += offscreenMenuOffsetY;
-		state->cCategory[state->cMeta[state->category].below].categoryBackground.targetY -= offscreenMenuOffsetY;
-        
-		state->smoothSelectionBox.targetX = offscreenMenuPositionX;
+		state->selectionBox.tile.x = offscreenMenuPositionX;
 	}
 
     state->selectionAlpha.t += state->alphaDir;
     if (state->selectionAlpha.t < 35 || state->selectionAlpha.t >= 255) state->alphaDir = -state->alphaDir;
     if (state->selectionAlpha.t < 0) state->selectionAlpha.t = 0;
     if (state->selectionAlpha.t > 255) state->selectionAlpha.t = 255;
-    interpolateInt(deltaTime, 3, &state->selectionAlpha.v, &state->selectionAlpha.p, state->selectionAlpha.t);
-    update_guiObject_t(&state->smoothSelectionBox, currentTime, state->demandImmediateUpdate);
-
-    state->selectionBox.tile.x = state->smoothSelectionBox.targetX;
-    state->selectionBox.tile.y = state->smoothSelectionBox.targetY;
+    interpolateInt(deltaTime, &state->selectionAlpha.spring, &state->selectionAlpha.v, &state->selectionAlpha.p, state->selectionAlpha.t);
 
-    zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->selectionBox.texture, &state->selectionBox.tile, state->selectionAlpha.p);
-    zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->smoothSelectionBox.texture, &state->smoothSelectionBox.tile, state->selectionAlpha.p / 3);
+    drawGuiObject(&drawQueue, DRAW_LAYER_SELECTION, 0, &state->selectionBox, state->selectionAlpha.p);
 
-    zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->selectionBox.texture, &state->selectionBox.tile, state->selectionAlpha.p);
-    zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->smoothSelectionBox.texture, &state->smoothSelectionBox.tile, state->selectionAlpha.p / 3);
+	drawMenuHud(state);
+	drawQueueFlush(&drawQueue, &gl->common.gfx_ctxt->overlay);
 
-	if (state->menuOpen && state->dPadShow) 
-	{
-		state->dPadBottom.texture.timg = &tDpad3;
-		zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->dPadBottom.texture, &state->dPadBottom.tile, 240);
-		state->dPadTop.texture.timg = &tDpad2;
-		zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->dPadTop.texture, &state->dPadTop.tile, 240);
-	}
-	else if (state->dPadShow)
-	{
-		state->dPadTop.texture.timg = &tDpad1;
-		zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->dPadTop.texture, &state->dPadTop.tile, 240);
-		state->dPadBottom.texture.timg = &tDpad0;
-		zh_draw_ui_sprite(&gl->common.gfx_ctxt->overlay, &state->dPadBottom.texture, &state->dPadBottom.tile, 240);
-	}
+	// The pulsing selection box is off screen while closed
+	state->idle = !state->menuOpen && rest;
 	state->demandImmediateUpdate = 0;
 }
 
@@ -0,0 +1,111 @@
+#ifndef MENUARENA_H
+#define MENUARENA_H
+
+#include <z64ovl/oot/u10.h>
+
+// First fit allocator over a fixed region of RDRAM, for textures and other
+// menu buffers. Every block starts with an 8 byte header holding its size and
+// a used bit, so blocks stay 8 byte aligned for the RDP and free neighbours
+// can be merged.
+
+#define ARENA_ALIGN 8
+#define ARENA_HEADER 8
+#define ARENA_USED 1
+
+typedef struct {
+	uint8_t* base;
+	uint32_t size;
+	uint32_t used; // Bytes in allocated blocks, headers included
+	uint32_t highWater; // Most bytes ever used at once
+	uint32_t blocks; // Allocated blocks
+	uint32_t failures; // Allocations that did not fit
+} arena_t;
+
+static inline uint32_t* arenaHeader(arena_t* arena, uint32_t offset) {
+	return (uint32_t*)(arena->base + offset);
+}
+
+void construct_arena_t(arena_t* arena, void* base, uint32_t size) {
+	arena->base = (uint8_t*)base;
+	arena->size = size & ~(ARENA_ALIGN - 1);
+	arena->used = 0;
+	arena->highWater = 0;
+	arena->blocks = 0;
+	arena->failures = 0;
+	*arenaHeader(arena, 0) = arena->size; // One free block
+}
+
+// Returns 0 when no free block is large enough
+void* arenaAlloc(arena_t* arena, uint32_t size) {
+	uint32_t need = (size + ARENA_HEADER + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+
+	for (uint32_t offset = 0; offset < arena->size;) {
+		uint32_t* header = arenaHeader(arena, offset);
+		uint32_t blockSize = *header & ~ARENA_USED;
+
+		if (!(*header & ARENA_USED) && blockSize >= need) {
+			// Split off the rest, which is a multiple of ARENA_ALIGN and so always
+			// holds a header. A rest with no room for data is still its own free
+			// block, so used only ever counts what was asked for.
+			if (blockSize > need) {
+				*arenaHeader(arena, offset + need) = blockSize - need;
+				blockSize = need;
+			}
+			*header = blockSize | ARENA_USED;
+
+			arena->used += blockSize;
+			arena->blocks++;
+			if (arena->used > arena->highWater) arena->highWater = arena->used;
+			return arena->base + offset + ARENA_HEADER;
+		}
+		offset += blockSize;
+	}
+
+	arena->failures++;
+	return 0;
+}
+
+void arenaFree(arena_t* arena, void* data) {
+	if (!data) return;
+	uint32_t target = (uint32_t)((uint8_t*)data - arena->base) - ARENA_HEADER;
+	uint32_t previous = arena->size; // None
+
+	for (uint32_t offset = 0; offset < arena->size;) {
+		uint32_t* header = arenaHeader(arena, offset);
+		uint32_t blockSize = *header & ~ARENA_USED;
+
+		if (offset == target) {
+			arena->used -= blockSize;
+			arena->blocks--;
+
+			// Merge with free neighbours
+			uint32_t next = offset + blockSize;
+			if (next < arena->size && !(*arenaHeader(arena, next) & ARENA_USED)) blockSize += *arenaHeader(arena, next);
+			if (previous < arena->size && !(*arenaHeader(arena, previous) & ARENA_USED)) *arenaHeader(arena, previous) += blockSize;
+			else *header = blockSize;
+			return;
+		}
+		previous = offset;
+		offset += blockSize;
+	}
+}
+
+uint32_t arenaLargestFree(arena_t* arena) {
+	uint32_t largest = 0;
+	for (uint32_t offset = 0; offset < arena->size;) {
+		uint32_t header = *arenaHeader(arena, offset);
+		uint32_t blockSize = header & ~ARENA_USED;
+		if (!(header & ARENA_USED) && blockSize > largest) largest = blockSize;
+		offset += blockSize;
+	}
+	return largest;
+}
+
+// Percent of the free space outside the largest free block
+uint32_t arenaFragmentation(arena_t* arena) {
+	uint32_t freeBytes = arena->size - arena->used;
+	if (!freeBytes) return 0;
+	return 100 - arenaLargestFree(arena) * 100 / freeBytes;
+}
+
+#endif
@@ -0,0 +1,444 @@
+#ifndef MENUDRAW_H
+#define MENUDRAW_H
+
+#include <z64ovl/oot/u10.h>
+#include <z64ovl/z64ovl_helpers.h>
+#include "textureLoader.h"
+
+// Lower level sprite drawing than zh_draw_ui_sprite: render state, texture
+// loads and rectangles are emitted separately so one load can serve several
+// rectangles, and every format texpack emits can be drawn.
+//
+// Sprites are not drawn when submitted. They are queued with a sort key of
+// layer, depth, texture, TLUT, palette, filter and alpha, and drawQueueFlush
+// emits them in key order as one display list, each piece of state only when
+// it differs from the last sprite's. Sprites of one layer that may overlap
+// are given different depths, so sorting by state never reorders them.
+//
+// Layers that rarely change can be given a drawList_t. Their sprites are
+// recorded into it once and called with one command on every frame they are
+// the same; any change of position, texture, TLUT, palette or alpha records
+// them again.
+
+#define TMEM_TLUT 256 // TMEM word address of the TLUT, the upper half
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+
+// Sprites emitted and culled this frame; update_menu_t resets them
+typedef struct {
+	uint16_t drawn;
+	uint16_t culled; // Off screen or fully transparent
+} drawStats_t;
+
+drawStats_t drawStats;
+
+// Layers, drawn back to front
+#define DRAW_LAYER_BACKGROUND 0
+#define DRAW_LAYER_ITEMS 1
+#define DRAW_LAYER_SELECTION 2
+#define DRAW_LAYER_HUD 3
+
+#define DRAW_LAYERS 4
+#define DRAW_DEPTHS 16 // Within a layer, drawn back to front; sprites at one depth must not overlap
+
+#define DRAW_QUEUE_SIZE 64
+#define DRAW_LIST_WORDS 64 // Gfx words a cached layer can take
+
+// State a sprite may need changed, DRAW_CHANGE_ bits
+#define DRAW_CHANGE_SETUP 0x01 // Cycle type, render mode and combiner
+#define DRAW_CHANGE_PRIM 0x02
+#define DRAW_CHANGE_LUT 0x04 // Texture LUT mode
+#define DRAW_CHANGE_TLUT 0x08
+#define DRAW_CHANGE_TEXTURE 0x10
+#define DRAW_CHANGE_PALETTE 0x20
+#define DRAW_CHANGE_FILTER 0x40
+
+typedef struct {
+	uint32_t key; // Sort order: layer, depth, texture, tint, palette, filter, alpha
+	gfx_screen_tile_t tile;
+	uint16_t id;
+	uint16_t tlut; // TLUT variant, NO_TLUT if none
+	uint8_t s; // Region of the texture drawn, in texels
+	uint8_t t;
+	uint8_t width;
+	uint8_t height;
+	uint8_t palette;
+	uint8_t alpha;
+} drawQueueEntry_t;
+
+typedef struct {
+	uint8_t setup;
+	uint8_t lut;
+	uint8_t palette;
+	uint8_t point;
+	int texture;
+	int tlut;
+	uint32_t prim;
+} drawState_t; // What the RDP was last given
+
+// A layer recorded into a display list. It is double buffered: the RDP may
+// still be reading last frame's copy while the next one is recorded.
+typedef struct {
+	Gfx buf[2][DRAW_LIST_WORDS];
+	uint8_t current; // Buffer holding the recording
+	uint8_t sprites; // Sprites recorded
+	uint32_t signature; // drawListSignature of what was recorded, 0 if nothing
+	uint32_t records; // Times recorded
+	uint32_t calls; // Frames drawn from the recording
+} drawList_t;
+
+typedef struct {
+	drawQueueEntry_t entries[DRAW_QUEUE_SIZE];
+	uint8_t order[DRAW_QUEUE_SIZE]; // Entries by key
+	uint8_t length;
+	uint8_t dropped; // Sprites that did not fit
+	uint16_t stateChanges; // DRAW_CHANGE_ pieces emitted by the last flush
+	drawList_t* lists[DRAW_LAYERS]; // Cached layers, 0 for ones drawn every frame
+} drawQueue_t;
+
+drawQueue_t drawQueue;
+
+static inline void drawLoadTlut(z64_disp_buf_t* db, int tlut) {
+	void* address = textureAddress(tlut);
+	if (address) gDPLoadTLUT(db->p++, textureInfo[tlut].width, TMEM_TLUT, address);
+}
+
+// Same render state zh_draw_ui_sprite sets up for a sprite. I and IA textures
+// are tinted through the prim color, which every sprite sets.
+static inline void drawSpriteSetup(z64_disp_buf_t* db) {
+	gDPPipeSync(db->p++);
+	gDPSetCycleType(db->p++, G_CYC_1CYCLE);
+	gDPSetRenderMode(db->p++, G_RM_XLU_SURF, G_RM_XLU_SURF2);
+	gDPSetCombineMode(db->p++, G_CC_MODULATEIA_PRIM, G_CC_MODULATEIA_PRIM);
+}
+
+// The siz argument of the load macros has to be a literal
+static inline void drawLoadTexture(z64_disp_buf_t* db, gfx_texture_t* texture) {
+	switch (texture->bitsiz) {
+		case G_IM_SIZ_4b:
+			gDPLoadTextureBlock_4b(db->p++, texture->timg, texture->fmt, texture->width, texture->height, 0,
+				G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMASK, G_TX_NOMASK, G_TX_NOLOD, G_TX_NOLOD);
+			break;
+		case G_IM_SIZ_8b:
+			gDPLoadTextureBlock(db->p++, texture->timg, texture->fmt, G_IM_SIZ_8b, texture->width, texture->height, 0,
+				G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMASK, G_TX_NOMASK, G_TX_NOLOD, G_TX_NOLOD);
+			break;
+		case G_IM_SIZ_32b:
+			gDPLoadTextureBlock(db->p++, texture->timg, texture->fmt, G_IM_SIZ_32b, texture->width, texture->height, 0,
+				G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMASK, G_TX_NOMASK, G_TX_NOLOD, G_TX_NOLOD);
+			break;
+		default:
+			gDPLoadTextureBlock(db->p++, texture->timg, texture->fmt, G_IM_SIZ_16b, texture->width, texture->height, 0,
+				G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMASK, G_TX_NOMASK, G_TX_NOLOD, G_TX_NOLOD);
+			break;
+	}
+}
+
+// Point the render tile of a loaded CI4 texture at another 16 color palette.
+// The tile is set up again whole, so texture gives its row length in TMEM.
+static inline void drawSetPalette(z64_disp_buf_t* db, gfx_texture_t* texture, int palette) {
+	gDPSetTile(db->p++, G_IM_FMT_CI, G_IM_SIZ_4b, ((texture->width >> 1) + 7) >> 3, 0, G_TX_RENDERTILE, palette,
+		G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMASK, G_TX_NOLOD, G_TX_NOMIRROR | G_TX_CLAMP, G_TX_NOMASK, G_TX_NOLOD);
+}
+
+// Whether any of the tile falls on screen
+static inline int drawTileOnScreen(gfx_screen_tile_t* tile) {
+	int x = tile->x;
+	int y = tile->y;
+	if (tile->origin_anchor == G_TX_ANCHOR_C) {
+		x -= tile->width / 2;
+		y -= tile->height / 2;
+	}
+	return x + tile->width > 0 && x < SCREEN_WIDTH && y + tile->height > 0 && y < SCREEN_HEIGHT;
+}
+
+// Whether a sprite would put anything on screen
+static inline int drawIsVisible(gfx_screen_tile_t* tile, uint8_t alpha) {
+	return alpha && tile->width && tile->height && drawTileOnScreen(tile);
+}
+
+// A region drawn at the size it is stored at maps one texel to one pixel
+static inline int drawIsUnscaled(gfx_screen_tile_t* tile, int width, int height) {
+	return tile->width == width && tile->height == height;
+}
+
+// Draw the width x height region at (s, t) of the loaded texture into the tile
+static inline void drawTileRect(z64_disp_buf_t* db, gfx_screen_tile_t* tile, int s, int t, int width, int height) {
+	int x = tile->x;
+	int y = tile->y;
+	if (tile->origin_anchor == G_TX_ANCHOR_C) {
+		x -= tile->width / 2;
+		y -= tile->height / 2;
+	}
+
+	int dsdx = 1 << 10;
+	int dtdy = 1 << 10;
+	if (!drawIsUnscaled(tile, width, height)) {
+		dsdx = (width << 10) / tile->width;
+		dtdy = (height << 10) / tile->height;
+	}
+
+	gSPTextureRectangle(db->p++, x << 2, y << 2, (x + tile->width) << 2, (y + tile->height) << 2, G_TX_RENDERTILE,
+		s << 5, t << 5, dsdx, dtdy);
+}
+
+///
+/// QUEUE
+///
+
+static inline void construct_drawState_t(drawState_t* state) {
+	state->setup = 0;
+	state->lut = 0;
+	state->palette = 0;
+	state->point = 0;
+	state->texture = -1;
+	state->tlut = NO_TLUT;
+	state->prim = 0;
+}
+
+static inline void construct_drawList_t(drawList_t* list) {
+	list->current = 0;
+	list->sprites = 0;
+	list->signature = 0;
+	list->records = 0;
+	list->calls = 0;
+}
+
+// Empty the queue for the next frame
+static inline void drawQueueClear(drawQueue_t* queue) {
+	queue->length = 0;
+	queue->dropped = 0;
+}
+
+static inline void construct_drawQueue_t(drawQueue_t* queue) {
+	drawQueueClear(queue);
+	queue->stateChanges = 0;
+	for (int i = 0; i < DRAW_LAYERS; i++) queue->lists[i] = 0;
+}
+
+// Draw layer from list, which has to stay allocated as long as the queue
+static inline void drawQueueCacheLayer(drawQueue_t* queue, int layer, drawList_t* list) {
+	construct_drawList_t(list);
+	queue->lists[layer] = list;
+}
+
+static inline uint32_t drawEntryPrim(drawQueueEntry_t* entry) {
+	const uint8_t* tint = textureInfo[entry->id].tint;
+	return ((uint32_t)tint[0] << 24) | (tint[1] << 16) | (tint[2] << 8) | entry->alpha;
+}
+
+static inline int drawEntryIsUnscaled(drawQueueEntry_t* entry) {
+	return drawIsUnscaled(&entry->tile, entry->width, entry->height);
+}
+
+// Whether loading texture id writes into the upper half of TMEM and so over
+// the TLUT. 32-bit texels are split across both halves.
+static inline int drawLoadClobbersTlut(int id) {
+	const textureInfo_t* info = &textureInfo[id];
+	if (info->bitsiz == G_IM_SIZ_32b) return 1;
+	uint32_t line = ((((uint32_t)info->width << info->bitsiz) >> 1) + 7) & ~7;
+	return line * info->height > TMEM_TLUT * 8;
+}
+
+// DRAW_CHANGE_ bits entry needs over state, and state updated to match
+static int drawStateChanges(drawState_t* state, drawQueueEntry_t* entry) {
+	int changes = 0;
+	int lut = entry->tlut != NO_TLUT;
+	int point = drawEntryIsUnscaled(entry);
+	uint32_t prim = drawEntryPrim(entry);
+
+	if (!state->setup) {
+		// The first sprite sets every mode
+		changes |= DRAW_CHANGE_SETUP | DRAW_CHANGE_PRIM | DRAW_CHANGE_LUT;
+		state->setup = 1;
+		state->point = 0;
+		state->lut = lut;
+		state->prim = prim;
+	}
+	if (prim != state->prim) changes |= DRAW_CHANGE_PRIM;
+	if (lut != state->lut) changes |= DRAW_CHANGE_LUT;
+	if (lut && entry->tlut != state->tlut) changes |= DRAW_CHANGE_TLUT;
+	if (entry->id != state->texture) {
+		changes |= DRAW_CHANGE_TEXTURE;
+		state->palette = 0; // Loading resets the render tile to palette 0
+	}
+	if (entry->palette != state->palette) changes |= DRAW_CHANGE_PALETTE;
+	if (point != state->point) changes |= DRAW_CHANGE_FILTER;
+
+	state->prim = prim;
+	state->lut = lut;
+	if (lut) state->tlut = entry->tlut;
+	// The next CI sprite has to load its TLUT again
+	if ((changes & DRAW_CHANGE_TEXTURE) && drawLoadClobbersTlut(entry->id)) state->tlut = NO_TLUT;
+	state->texture = entry->id;
+	state->palette = entry->palette;
+	state->point = point;
+	return changes;
+}
+
+static inline int drawChangeCount(int changes) {
+	int count = 0;
+	for (; changes; changes &= changes - 1) count++;
+	return count;
+}
+
+// Queue the width x height region at (s, t) of texture id, drawn into tile
+// with TLUT variant tlut. Sprites that would not show are culled here, before
+// their texture is looked up, so they cost no commands and no cache traffic.
+static void drawQueueRegion(drawQueue_t* queue, int layer, int depth, int id, int tlut, int palette, gfx_screen_tile_t* tile,
+	int s, int t, int width, int height, uint8_t alpha) {
+	if (!drawIsVisible(tile, alpha)) {
+		drawStats.culled++;
+		return;
+	}
+	if (queue->length == DRAW_QUEUE_SIZE) {
+		queue->dropped++;
+		return;
+	}
+
+	drawQueueEntry_t* entry = &queue->entries[queue->length];
+	entry->tile = *tile;
+	entry->id = id;
+	entry->tlut = tlut;
+	entry->s = s;
+	entry->t = t;
+	entry->width = width;
+	entry->height = height;
+	entry->palette = palette;
+	entry->alpha = alpha;
+	entry->key = ((uint32_t)layer << 30) | ((uint32_t)(depth & 0xF) << 26) | ((uint32_t)(id & 0x3FF) << 16)
+		| ((tlut == NO_TLUT ? 0 : (tlut - textureInfo[id].tlut) & 3) << 14) | ((palette & 0xF) << 10)
+		| (drawEntryIsUnscaled(entry) << 9) | alpha;
+
+	// Insertion keeps sprites with equal keys in submission order
+	int i = queue->length++;
+	for (; i > 0 && queue->entries[queue->order[i - 1]].key > entry->key; i--) queue->order[i] = queue->order[i - 1];
+	queue->order[i] = entry - queue->entries;
+}
+
+// Whole texture stretched over the tile; replaces zh_draw_ui_sprite for
+// textures from the table
+static inline void drawSprite(drawQueue_t* queue, int layer, int depth, int id, gfx_screen_tile_t* tile, uint8_t alpha) {
+	drawQueueRegion(queue, layer, depth, id, textureInfo[id].tlut, 0, tile, 0, 0, textureInfo[id].width, textureInfo[id].height, alpha);
+}
+
+// Emit queued sprites first to end - 1 in key order, continuing from state.
+// Sprites whose texture or TLUT is not resident are skipped without touching
+// the state.
+static void drawQueueEmit(drawQueue_t* queue, z64_disp_buf_t* db, drawState_t* state, int first, int end) {
+	gfx_texture_t texture = { 0 };
+	int loaded = -1; // Texture described by texture
+
+	for (int i = first; i < end; i++) {
+		drawQueueEntry_t* entry = &queue->entries[queue->order[i]];
+		if (entry->id != loaded) {
+			setTexture(&texture, entry->id);
+			texture.timg = textureAddress(entry->id);
+			loaded = entry->id;
+		}
+		if (!texture.timg || (entry->tlut != NO_TLUT && entry->tlut != state->tlut && !textureAddress(entry->tlut))) continue;
+
+		int changes = drawStateChanges(state, entry);
+		queue->stateChanges += drawChangeCount(changes);
+
+		if (changes & DRAW_CHANGE_SETUP) drawSpriteSetup(db);
+		if (changes & DRAW_CHANGE_PRIM) {
+			gDPSetPrimColor(db->p++, 0, 0, state->prim >> 24, (state->prim >> 16) & 0xFF, (state->prim >> 8) & 0xFF, entry->alpha);
+		}
+		if (changes & DRAW_CHANGE_LUT) gDPSetTextureLUT(db->p++, state->lut ? G_TT_RGBA16 : G_TT_NONE);
+		if (changes & DRAW_CHANGE_TLUT) drawLoadTlut(db, entry->tlut);
+		if (changes & DRAW_CHANGE_TEXTURE) drawLoadTexture(db, &texture);
+		if (changes & DRAW_CHANGE_PALETTE) drawSetPalette(db, &texture, entry->palette);
+		if (changes & DRAW_CHANGE_FILTER) gDPSetTextureFilter(db->p++, state->point ? G_TF_POINT : G_TF_BILERP);
+
+		drawTileRect(db, &entry->tile, entry->s, entry->t, entry->width, entry->height);
+		drawStats.drawn++;
+	}
+}
+
+// Leave the filter as zh_draw_ui_sprite expects it
+static inline void drawStateRestore(z64_disp_buf_t* db, drawState_t* state) {
+	if (state->point) gDPSetTextureFilter(db->p++, G_TF_BILERP);
+	construct_drawState_t(state);
+}
+
+static inline uint32_t drawHashWord(uint32_t hash, uint32_t word) {
+	return (hash ^ word) * 0x01000193;
+}
+
+// Everything the recording of sprites first to end - 1 depends on, addresses
+// included since cached textures can move. Looking the textures up also
+// keeps them from being evicted while a recording uses them.
+static uint32_t drawListSignature(drawQueue_t* queue, int first, int end) {
+	uint32_t hash = 0x811C9DC5;
+	for (int i = first; i < end; i++) {
+		drawQueueEntry_t* entry = &queue->entries[queue->order[i]];
+		hash = drawHashWord(hash, entry->key);
+		hash = drawHashWord(hash, ((uint32_t)(uint16_t)entry->tile.x << 16) | (uint16_t)entry->tile.y);
+		hash = drawHashWord(hash, ((uint32_t)entry->tile.width << 16) | entry->tile.height);
+		hash = drawHashWord(hash, ((uint32_t)entry->s << 24) | (entry->t << 16) | (entry->width << 8) | entry->height);
+		hash = drawHashWord(hash, entry->tile.origin_anchor);
+		hash = drawHashWord(hash, (uint32_t)(uintptr_t)textureAddress(entry->id));
+		if (entry->tlut != NO_TLUT) hash = drawHashWord(hash, (uint32_t)(uintptr_t)textureAddress(entry->tlut));
+	}
+	return hash ? hash : 1;
+}
+
+// Call the recording of the layer's sprites first to end - 1 if it is still
+// what they would draw; otherwise draw them this frame and record the words
+// into the other buffer of list
+static void drawQueueEmitList(drawQueue_t* queue, drawList_t* list, z64_disp_buf_t* db, int first, int end) {
+	uint32_t signature = drawListSignature(queue, first, end);
+	if (signature == list->signature) {
+		gSPDisplayList(db->p++, list->buf[list->current]);
+		drawStats.drawn += list->sprites;
+		list->calls++;
+		return;
+	}
+
+	drawState_t state;
+	construct_drawState_t(&state);
+	Gfx* start = db->p;
+	uint16_t drawn = drawStats.drawn;
+	drawQueueEmit(queue, db, &state, first, end);
+	drawStateRestore(db, &state);
+
+	// One word is left for the end of the list
+	uint32_t words = db->p - start;
+	list->signature = 0;
+	if (words >= DRAW_LIST_WORDS) return;
+
+	Gfx* buf = list->buf[list->current ^ 1];
+	for (uint32_t i = 0; i < words; i++) buf[i] = start[i];
+	gSPEndDisplayList(&buf[words]);
+	list->current ^= 1;
+	list->sprites = drawStats.drawn - drawn;
+	list->signature = signature;
+	list->records++;
+}
+
+// Emit the queued sprites in key order, cached layers through their lists.
+// The entries stay queued until drawQueueClear starts the next frame.
+void drawQueueFlush(drawQueue_t* queue, z64_disp_buf_t* db) {
+	drawState_t state;
+	construct_drawState_t(&state);
+	queue->stateChanges = 0;
+
+	for (int first = 0, end; first < queue->length; first = end) {
+		uint32_t layer = queue->entries[queue->order[first]].key >> 30;
+		for (end = first; end < queue->length && queue->entries[queue->order[end]].key >> 30 == layer; end++);
+
+		drawList_t* list = queue->lists[layer];
+		if (!list) {
+			drawQueueEmit(queue, db, &state, first, end);
+			continue;
+		}
+		// Lists start and end with nothing set
+		drawStateRestore(db, &state);
+		drawQueueEmitList(queue, list, db, first, end);
+	}
+
+	drawStateRestore(db, &state);
+}
+
+#endif
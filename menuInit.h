@@ -0,0 +1,130 @@
+#ifndef MENUINIT_H
+#define MENUINIT_H
+
+#include "menu.h"
+
+// Staged actor startup. init() only constructs this state machine; play()
+// advances it once per frame so no single frame pays for the whole startup.
+// With MENU_TEXTURE_CACHE the cache is warmed with the UI textures
+// MENU_INIT_TEXTURE_BUDGET bytes per frame, then the menu is constructed.
+// The hardware build embeds its textures, so it only has the menu stage.
+// Nothing is updated or drawn until ready.
+
+#ifndef hardware
+#define MENU_INIT_TEXTURE_BUDGET 0x1000 // Bytes of textures copied per frame
+
+#define MENU_INIT_TEXTURES 0
+#define MENU_INIT_MENU 1
+#define MENU_INIT_READY 2
+#define MENU_INIT_STAGES 2 // Stages before ready
+#else
+#define MENU_INIT_MENU 0
+#define MENU_INIT_READY 1
+#define MENU_INIT_STAGES 1
+#endif
+
+#ifndef MENU_INIT_CLOCK
+// CP0 Count, which runs at half the CPU clock
+static inline uint32_t menuInitCount(void) {
+	uint32_t count;
+	__asm__ volatile("mfc0 %0, $9" : "=r"(count));
+	return count;
+}
+#define MENU_INIT_CLOCK() menuInitCount()
+#define MENU_INIT_CLOCK_HZ 46875000
+#endif
+
+#ifndef hardware
+static const char* menuInitStageNames[MENU_INIT_STAGES] = { "textures", "menu" };
+#else
+static const char* menuInitStageNames[MENU_INIT_STAGES] = { "menu" };
+#endif
+
+typedef struct {
+	uint32_t frames;
+	uint32_t ticks; // MENU_INIT_CLOCK ticks
+	uint32_t bytes;
+} menuInitProfile_t; // Startup cost of one stage
+
+typedef struct {
+	uint8_t stage;
+	uint8_t ready;
+	#ifndef hardware
+	int nextTexture; // Next resident texture to start copying
+	textureStream_t textures;
+	#endif
+	menuInitProfile_t profile[MENU_INIT_STAGES];
+} menuInit_t;
+
+void construct_menuInit_t(menuInit_t* init) {
+	init->stage = 0;
+	init->ready = 0;
+	#ifndef hardware
+	init->nextTexture = 0;
+	construct_textureStream_t(&init->textures, 0, 0, 0);
+	construct_textureCache_t(&textureCache, TEXTURE_CACHE_BUDGET);
+	#endif
+	for (int i = 0; i < MENU_INIT_STAGES; i++) {
+		init->profile[i].frames = 0;
+		init->profile[i].ticks = 0;
+		init->profile[i].bytes = 0;
+	}
+}
+
+#ifndef hardware
+// Atlas pages and their TLUTs are left to load when a shown item first
+// needs them
+static int menuInitIsAtlasTexture(int id) {
+	for (int i = 0; i < NUM_ATLAS_CELLS; i++) {
+		int tlut = textureInfo[atlasCells[i][0]].tlut;
+		if (atlasCells[i][0] == id || (tlut != NO_TLUT && id >= tlut && id < tlut + NUM_TLUT_TINTS)) return 1;
+	}
+	return 0;
+}
+#endif
+
+// Run one frame of startup; returns whether the menu is ready
+uint8_t update_menuInit_t(menuInit_t* init, menu_t* menu, z64_inputHandler_t* input) {
+	if (init->ready) return 1;
+
+	menuInitProfile_t* profile = &init->profile[init->stage];
+	uint32_t start = MENU_INIT_CLOCK();
+
+	switch (init->stage) {
+		#ifndef hardware
+		case MENU_INIT_TEXTURES: {
+			uint32_t budget = MENU_INIT_TEXTURE_BUDGET;
+			while (budget) {
+				if (!init->textures.remaining) {
+					int id = init->nextTexture++;
+					if (id == NUM_LOADED_TEXTURES) {
+						init->stage++;
+						break;
+					}
+					if (!menuInitIsAtlasTexture(id) && textureCacheHasRoom(&textureCache, id)) {
+						textureCacheBegin(&textureCache, id, TEXTURE_CACHE_GUARD, &init->textures);
+					}
+					continue;
+				}
+				uint32_t remaining = init->textures.remaining;
+				update_textureStream_t(&init->textures, budget);
+				budget -= remaining - init->textures.remaining;
+			}
+			profile->bytes += MENU_INIT_TEXTURE_BUDGET - budget;
+			break;
+		}
+		#endif
+		case MENU_INIT_MENU:
+			construct_menu_t(menu, input);
+			profile->bytes += sizeof(menu_t);
+			init->stage++;
+			break;
+	}
+
+	profile->ticks += MENU_INIT_CLOCK() - start;
+	profile->frames++;
+	init->ready = init->stage == MENU_INIT_READY;
+	return init->ready;
+}
+
+#endif
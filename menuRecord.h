@@ -0,0 +1,231 @@
+#ifndef MENURECORD_H
+#define MENURECORD_H
+
+#include "menu.h"
+
+// Session recording: a header followed by one record per frame.
+//
+//   header  "LMRC" | u16 version | u16 reserved | u32 frame count
+//   frame   u16 buttons | s8 stick x | s8 stick y | u8 tag
+//           [tag == RECORD_TAG_SAVE: 24 inventory bytes | u16 equipment]
+//
+// Multi-byte values are big-endian. Save bytes are only written on the first
+// frame and when they change, so an idle frame costs 5 bytes.
+
+#define MENU_RECORD_MAGIC "LMRC"
+#define MENU_RECORD_VERSION 1
+#define MENU_RECORD_HEADER_SIZE 12
+#define MENU_RECORD_INVENTORY_SIZE 24
+#define MENU_RECORD_SAVE_SIZE (MENU_RECORD_INVENTORY_SIZE + 2)
+#define MENU_RECORD_FRAME_MAX (5 + MENU_RECORD_SAVE_SIZE)
+
+#define RECORD_TAG_NONE 0
+#define RECORD_TAG_SAVE 1
+
+#ifndef MENU_RECORD_ADDR
+#define MENU_RECORD_ADDR 0x80700000 // Expansion pak RAM
+#define MENU_RECORD_SIZE 0x00100000
+#endif
+
+static inline void recordWrite16(uint8_t* out, uint16_t v) {
+	out[0] = v >> 8;
+	out[1] = v & 0xFF;
+}
+
+static inline void recordWrite32(uint8_t* out, uint32_t v) {
+	recordWrite16(out, v >> 16);
+	recordWrite16(out + 2, v & 0xFFFF);
+}
+
+static inline uint16_t recordRead16(const uint8_t* in) {
+	return (in[0] << 8) | in[1];
+}
+
+static inline uint32_t recordRead32(const uint8_t* in) {
+	return ((uint32_t)recordRead16(in) << 16) | recordRead16(in + 2);
+}
+
+// Inventory bytes followed by the big-endian equipment word
+static inline void readSaveSnapshot(uint8_t* out) {
+	uint8_t* inventory = (uint8_t*)Inventory_Context;
+	uint16_t* equipment = (uint16_t*)Equipment_Context;
+	for (int i = 0; i < MENU_RECORD_INVENTORY_SIZE; i++) out[i] = inventory[i];
+	recordWrite16(&out[MENU_RECORD_INVENTORY_SIZE], *equipment);
+}
+
+static inline void writeSaveSnapshot(const uint8_t* in) {
+	uint8_t* inventory = (uint8_t*)Inventory_Context;
+	uint16_t* equipment = (uint16_t*)Equipment_Context;
+	for (int i = 0; i < MENU_RECORD_INVENTORY_SIZE; i++) inventory[i] = in[i];
+	*equipment = recordRead16(&in[MENU_RECORD_INVENTORY_SIZE]);
+}
+
+///
+/// RECORDER
+///
+
+typedef struct {
+	uint8_t* buffer;
+	uint32_t size;
+	uint32_t used;
+	uint32_t frames;
+	uint8_t overflow;
+	uint8_t hasSave;
+	uint8_t save[MENU_RECORD_SAVE_SIZE];
+} menuRecorder_t;
+
+void construct_menuRecorder_t(menuRecorder_t* recorder, uint8_t* buffer, uint32_t size) {
+	recorder->buffer = buffer;
+	recorder->size = size;
+	recorder->used = MENU_RECORD_HEADER_SIZE;
+	recorder->frames = 0;
+	recorder->overflow = size < MENU_RECORD_HEADER_SIZE;
+	recorder->hasSave = 0;
+
+	if (recorder->overflow) return;
+	for (int i = 0; i < 4; i++) buffer[i] = MENU_RECORD_MAGIC[i];
+	recordWrite16(&buffer[4], MENU_RECORD_VERSION);
+	recordWrite16(&buffer[6], 0);
+	recordWrite32(&buffer[8], 0);
+}
+
+// Append this frame's controller and save state. The header frame count is kept
+// current so the buffer can be dumped at any point.
+void update_menuRecorder_t(menuRecorder_t* recorder, z64_controller_t* controller) {
+	if (recorder->overflow) return;
+	if (recorder->used + MENU_RECORD_FRAME_MAX > recorder->size) {
+		recorder->overflow = 1;
+		return;
+	}
+
+	uint8_t snapshot[MENU_RECORD_SAVE_SIZE];
+	readSaveSnapshot(snapshot);
+
+	uint8_t changed = !recorder->hasSave;
+	for (int i = 0; i < MENU_RECORD_SAVE_SIZE && !changed; i++) changed = snapshot[i] != recorder->save[i];
+
+	uint8_t* out = &recorder->buffer[recorder->used];
+	recordWrite16(out, *(uint16_t*)controller);
+	out[2] = (uint8_t)controller->x;
+	out[3] = (uint8_t)controller->y;
+	out[4] = changed ? RECORD_TAG_SAVE : RECORD_TAG_NONE;
+	recorder->used += 5;
+
+	if (changed) {
+		for (int i = 0; i < MENU_RECORD_SAVE_SIZE; i++) recorder->save[i] = out[5 + i] = snapshot[i];
+		recorder->hasSave = 1;
+		recorder->used += MENU_RECORD_SAVE_SIZE;
+	}
+
+	recorder->frames++;
+	recordWrite32(&recorder->buffer[8], recorder->frames);
+}
+
+///
+/// PLAYBACK
+///
+
+typedef struct {
+	const uint8_t* data;
+	uint32_t size;
+	uint32_t offset;
+	uint32_t frames;
+	uint32_t frame;
+} menuPlayback_t;
+
+// Returns 0 if the data is not a recording this build understands
+int construct_menuPlayback_t(menuPlayback_t* playback, const uint8_t* data, uint32_t size) {
+	playback->data = data;
+	playback->size = size;
+	playback->offset = MENU_RECORD_HEADER_SIZE;
+	playback->frame = 0;
+	playback->frames = 0;
+
+	if (size < MENU_RECORD_HEADER_SIZE) return 0;
+	for (int i = 0; i < 4; i++) if (data[i] != MENU_RECORD_MAGIC[i]) return 0;
+	if (recordRead16(&data[4]) != MENU_RECORD_VERSION) return 0;
+
+	playback->frames = recordRead32(&data[8]);
+	return 1;
+}
+
+// Feed the next frame into the controller and save context. Returns 0 once the
+// recording is exhausted or truncated.
+int update_menuPlayback_t(menuPlayback_t* playback, z64_controller_t* controller) {
+	if (playback->frame >= playback->frames || playback->offset + 5 > playback->size) return 0;
+
+	const uint8_t* in = &playback->data[playback->offset];
+	*(uint16_t*)controller = recordRead16(in);
+	controller->x = (int8_t)in[2];
+	controller->y = (int8_t)in[3];
+	playback->offset += 5;
+
+	if (in[4] == RECORD_TAG_SAVE) {
+		if (playback->offset + MENU_RECORD_SAVE_SIZE > playback->size) return 0;
+		writeSaveSnapshot(&in[5]);
+		playback->offset += MENU_RECORD_SAVE_SIZE;
+	}
+
+	playback->frame++;
+	return 1;
+}
+
+///
+/// STATE HASH
+///
+
+// FNV-1a over what the menu shows and does: selection, visibility, on-screen
+// tiles and alphas, and the equip slots it writes. Velocities and other internal
+// interpolator state are left out on purpose so a change in how the menu
+// animates internally hashes the same as long as every frame looks the same.
+
+#define HASH_SEED 0x811C9DC5
+#define HASH_PRIME 0x01000193
+
+static inline uint32_t hashBytes(uint32_t hash, const void* data, uint32_t size) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (uint32_t i = 0; i < size; i++) hash = (hash ^ bytes[i]) * HASH_PRIME;
+	return hash;
+}
+
+static inline uint32_t hashInt(uint32_t hash, int32_t v) {
+	return hashBytes(hash, &v, sizeof(v));
+}
+
+static inline uint32_t hashTile(uint32_t hash, gfx_screen_tile_t* tile) {
+	hash = hashInt(hash, tile->x);
+	hash = hashInt(hash, tile->y);
+	hash = hashInt(hash, tile->width);
+	return hashInt(hash, tile->height);
+}
+
+uint32_t hash_menu_t(menu_t* state) {
+	uint32_t hash = HASH_SEED;
+
+	hash = hashInt(hash, state->menuOpen);
+	hash = hashInt(hash, state->dPadShow);
+	hash = hashInt(hash, state->cButton);
+	hash = hashInt(hash, state->index);
+	hash = hashInt(hash, state->category);
+
+	for (int i = 0; i < NUM_CATEGORIES; i++) {
+		hash = hashTile(hash, &state->cCategory[i].categoryBackground.tile);
+		hash = hashInt(hash, state->cCategory[i].alpha.p);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		hash = hashTile(hash, &state->items[i].item.tile);
+		hash = hashInt(hash, state->items[i].isShown);
+	}
+
+	hash = hashTile(hash, &state->selectionBox.tile);
+	hash = hashInt(hash, state->selectionAlpha.p);
+
+	hash = hashTile(hash, &state->dPadTop.tile);
+	hash = hashTile(hash, &state->dPadBottom.tile);
+
+	// Button items and equipment as written back by the menu
+	return hashBytes(hash, (uint8_t*)(Z64GL_SAVE_CONTEXT + 0x68), 0x0C);
+}
+
+#endif
@@ -2,6 +2,10 @@
 #include <z64ovl/z64ovl_helpers.h>
 #include "z64_inputHandler.h"
 #include "menu.h"
+#include "menuInit.h"
+#ifdef MENU_RECORD
+#include "menuRecord.h"
+#endif
 
 #define ACT_ID 0x0082
 
@@ -16,27 +20,29 @@
 #define G_IM_SIZ_16b                  2
 #define G_IM_SIZ_32b                  3
 
-#define FRAMETIME 0.05f
-
 
 typedef struct {
 	z64_actor_t actor;
 	z64_inputHandler_t inputHandler;
-	float currentTime;
+	scalar_t currentTime;
 	uint32_t currentFrame;
 	
+	menuInit_t menuInit;
 	menu_t menu;
 	uint32_t debug;
 	uint32_t debug2;
 	uint32_t end;
 	uint32_t end2;
 	float* LinkPos;
+#ifdef MENU_RECORD
+	menuRecorder_t recorder;
+#endif
 } entity_t;
 
 
 static void init(entity_t *en, z64_global_t *gl) 
 {
-	loadTextures();
+	construct_menuInit_t(&en->menuInit);
 	en->currentTime = 0;
 	en->end = 0xDEADBEEF;
 	en->end2 = 0xDEADBEEF;
@@ -48,14 +54,23 @@ static void init(entity_t *en, z64_global_t *gl)
 	#endif
 	
 	construct_z64_inputHandler_t(&en->inputHandler, &gl->common.input[0].raw);
-	construct_menu_t(&en->menu);
-	
+
+	#ifdef MENU_RECORD
+	construct_menuRecorder_t(&en->recorder, (uint8_t*)MENU_RECORD_ADDR, MENU_RECORD_SIZE);
+	#endif
+
 }
 
 static void dest(entity_t *en, z64_global_t *gl) {}
 
 static void play(entity_t *en, z64_global_t *gl) 
 {
+	// Startup runs a stage per frame; input and time start once the menu is ready
+	if (!update_menuInit_t(&en->menuInit, &en->menu, &en->inputHandler)) return;
+
+	#ifdef MENU_RECORD
+	update_menuRecorder_t(&en->recorder, en->inputHandler.controller);
+	#endif
 
 	update_z64_inputHandler_t(&en->inputHandler, en->currentTime);
 	en->actor.pos_2.x = en->LinkPos[0];
@@ -65,7 +80,9 @@ static void play(entity_t *en, z64_global_t *gl)
 
 static void draw(entity_t *en, z64_global_t *gl)
 {
-	en->currentTime += FRAMETIME; //TODO: Get from game
+	if (!en->menuInit.ready) return;
+
+	en->currentTime = timeAdd(en->currentTime, FRAMETIME); //TODO: Get from game
 	en->currentFrame++;
 
 	update_menu_t(&en->menu, &en->inputHandler, gl, en->currentTime, &en->debug, &en->debug2);
@@ -0,0 +1,331 @@
+#ifndef TEXTURELOADER_H
+#define TEXTURELOADER_H
+
+#include <z64ovl/oot/u10.h>
+#include <z64ovl/z64ovl_helpers.h>
+
+// textures.h is generated by tools/texpack from textures_png; regenerate it
+// rather than editing it. This file decides where the textures live.
+// MENU_TEXTURES_HEADER names another generated header to build against, such
+// as one from texpack --rom-icons.
+#ifdef MENU_TEXTURES_HEADER
+#include MENU_TEXTURES_HEADER
+#else
+#include "textures.h"
+#endif
+#include "texturePack.h"
+#include "menuArena.h"
+
+#if TEXTURES_PACK_VERSION != TEXTURE_PACK_VERSION
+#error "textures.h is from another version of texpack; regenerate it"
+#endif
+
+#define MENU_ARENA_SIZE 0x20000 // Bytes from mallocStartAddr owned by menuArena
+#ifdef MENU_HOST
+static uint8_t hostMenuArena[MENU_ARENA_SIZE] __attribute__((aligned(8), unused)); // Only the cache uses it
+#define mallocStartAddr ((uintptr_t)hostMenuArena)
+#else
+#define mallocStartAddr 0x80AA0000
+#endif
+
+// Embed the resident textures in the overlay instead of copying them into
+// menuArena through the texture cache, unless built with MENU_TEXTURE_CACHE
+#ifndef MENU_TEXTURE_CACHE
+#define hardware
+#endif
+
+#ifdef ROM_ICON_PAGES
+// textures.h was built with texpack --rom-icons
+#ifdef hardware
+#error "Atlas pages built from icon_item_static need the texture cache; build with MENU_TEXTURE_CACHE or regenerate textures.h without --rom-icons"
+#endif
+#include "iconProvider.h"
+#ifndef iconRomRead
+#error "Define ICON_DMA_ADDR and ICON_ITEM_STATIC_ROM for the ROM version to read icon_item_static"
+#endif
+#endif
+
+#ifdef hardware
+#define textureAddress(id) ((void*)((uint8_t*)tResidentTextures + textureInfo[id].offset))
+#else
+// Textures are copied into menuArena the first time they are drawn
+#define textureAddress(id) textureCacheGet(&textureCache, id)
+#define NUM_LOADED_TEXTURES NUM_RESIDENT_TEXTURES // Ones the pack in the overlay holds
+#endif
+
+arena_t menuArena;
+
+#define TEXTURE_COPY_BLOCK 32 // Bytes moved per iteration of copyTextureBlock
+
+// Bulk copy between 8 byte aligned buffers, which texpack guarantees for
+// every texture. Each block is read into registers before any of it is
+// written so the loads are not stalled behind the stores.
+static inline void copyTextureBlock(void* dst, const void* src, uint32_t size) {
+	uint32_t* d = (uint32_t*)dst;
+	const uint32_t* s = (const uint32_t*)src;
+	uint32_t blocks = size / TEXTURE_COPY_BLOCK;
+
+	while (blocks--) {
+		uint32_t w0 = s[0], w1 = s[1], w2 = s[2], w3 = s[3];
+		uint32_t w4 = s[4], w5 = s[5], w6 = s[6], w7 = s[7];
+		d[0] = w0; d[1] = w1; d[2] = w2; d[3] = w3;
+		d[4] = w4; d[5] = w5; d[6] = w6; d[7] = w7;
+		d += 8;
+		s += 8;
+	}
+
+	for (uint32_t o = 0; o < (size % TEXTURE_COPY_BLOCK) / 4; o++) d[o] = s[o];
+}
+
+// A copy of part of a texture pack (AllTextures or its leading resident part)
+// into the texture arena. The pack is read in place; nothing is staged.
+typedef struct {
+	const uint8_t* src;
+	uint8_t* dst;
+	uint32_t remaining;
+} textureStream_t;
+
+void construct_textureStream_t(textureStream_t* stream, void* arena, const void* pack, uint32_t size) {
+	stream->src = (const uint8_t*)pack;
+	stream->dst = (uint8_t*)arena;
+	stream->remaining = size;
+}
+
+// Copy up to maxBytes, a multiple of 8 so the next copy stays aligned;
+// returns the bytes still to copy
+uint32_t update_textureStream_t(textureStream_t* stream, uint32_t maxBytes) {
+	uint32_t size = stream->remaining < maxBytes ? stream->remaining : maxBytes;
+	copyTextureBlock(stream->dst, stream->src, size);
+	stream->src += size;
+	stream->dst += size;
+	stream->remaining -= size;
+	return stream->remaining;
+}
+
+// Texture data is padded to 8 bytes in the pack
+static inline uint32_t textureBytes(int id) {
+	uint32_t bits = (uint32_t)textureInfo[id].width * textureInfo[id].height << (textureInfo[id].bitsiz + 2);
+	return ((bits >> 3) + 7) & ~7;
+}
+
+///
+/// CACHE
+///
+
+#ifndef hardware
+
+#ifndef TEXTURE_CACHE_BUDGET
+#define TEXTURE_CACHE_BUDGET 0x8000 // Bytes of menuArena textures may use, headers included
+#endif
+#define TEXTURE_CACHE_GUARD 2 // Frames a drawn texture is kept; the RDP may still be reading last frame's
+#define TEXTURE_CACHE_PREFETCH_AGE 60 // Frames undrawn before a prefetch may evict a texture
+
+typedef struct {
+	uint8_t* address[NUM_TEXTURES]; // 0 when not resident
+	uint32_t lastUse[NUM_TEXTURES]; // Frame the texture was last drawn
+	uint32_t budget;
+	uint32_t used;
+	uint32_t frame;
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t evictions;
+	uint32_t failures; // Misses that could not be loaded
+	int pendingId; // Prefetch still being copied, -1 for none
+	textureStream_t pending;
+	uint8_t prefetched[NUM_TEXTURES]; // Prefetched and not drawn yet
+	uint32_t prefetches;
+	uint32_t prefetchHits; // Draws that found a prefetched texture
+} textureCache_t;
+
+textureCache_t textureCache;
+
+// Whether the embedded part of AllTextures starts with the header texpack
+// wrote. It is an array of words, so the header is read as words.
+static inline int textureCachePackIsValid(void) {
+	return tResidentTextures[0] == TEXTURE_PACK_MAGIC && tResidentTextures[1] >> 16 == TEXTURE_PACK_VERSION
+		&& tResidentTextures[3] == RESIDENT_TEXTURES_SIZE;
+}
+
+// Hand menuArena its region and start with nothing cached. A pack with the
+// wrong header gets no budget, so nothing is loaded from it.
+void construct_textureCache_t(textureCache_t* cache, uint32_t budget) {
+	construct_arena_t(&menuArena, (void*)mallocStartAddr, MENU_ARENA_SIZE);
+	if (!textureCachePackIsValid()) budget = 0;
+	for (int id = 0; id < NUM_TEXTURES; id++) cache->address[id] = 0;
+	cache->budget = budget;
+	cache->used = 0;
+	cache->frame = TEXTURE_CACHE_GUARD;
+	cache->hits = 0;
+	cache->misses = 0;
+	cache->evictions = 0;
+	cache->failures = 0;
+	cache->pendingId = -1;
+	for (int id = 0; id < NUM_TEXTURES; id++) cache->prefetched[id] = 0;
+	cache->prefetches = 0;
+	cache->prefetchHits = 0;
+}
+
+// Once per frame, before anything is drawn
+void update_textureCache_t(textureCache_t* cache) {
+	cache->frame++;
+}
+
+static inline uint32_t textureCacheBlock(int id) {
+	return textureBytes(id) + ARENA_HEADER;
+}
+
+static void textureCacheDrop(textureCache_t* cache, int id) {
+	if (id == cache->pendingId) cache->pendingId = -1;
+	arenaFree(&menuArena, cache->address[id]);
+	cache->address[id] = 0;
+	cache->prefetched[id] = 0;
+	cache->used -= textureCacheBlock(id);
+}
+
+// Drop the least recently drawn texture that has not been drawn for minAge
+// frames; returns 0 when there is none
+int textureCacheEvict(textureCache_t* cache, uint32_t minAge) {
+	int oldest = -1;
+	for (int id = 0; id < NUM_TEXTURES; id++) {
+		if (!cache->address[id] || cache->frame - cache->lastUse[id] < minAge) continue;
+		if (oldest < 0 || cache->lastUse[id] < cache->lastUse[oldest]) oldest = id;
+	}
+	if (oldest < 0) return 0;
+
+	textureCacheDrop(cache, oldest);
+	cache->evictions++;
+	return 1;
+}
+
+// Whether texture id comes from somewhere other than the pack
+static inline int textureCacheIsBuilt(int id) {
+	#ifdef ROM_ICON_PAGES
+	return textureInfo[id].source == TEXTURE_SOURCE_ROM_ICONS;
+	#else
+	return 0;
+	#endif
+}
+
+// Whether texture id fits without evicting anything
+static inline int textureCacheHasRoom(textureCache_t* cache, int id) {
+	return cache->used + textureCacheBlock(id) <= cache->budget;
+}
+
+// Make room for texture id, evicting textures undrawn for minAge frames, and
+// set up the copy of its data without running it; returns 0 when it cannot fit
+int textureCacheBegin(textureCache_t* cache, int id, uint32_t minAge, textureStream_t* stream) {
+	uint32_t size = textureBytes(id);
+	if (id >= NUM_LOADED_TEXTURES && !textureCacheIsBuilt(id)) return 0; // Not in the pack
+
+	while (cache->used + textureCacheBlock(id) > cache->budget) {
+		if (!textureCacheEvict(cache, minAge)) return 0;
+	}
+	// A fragmented arena can refuse a block the budget allows
+	while (!(cache->address[id] = (uint8_t*)arenaAlloc(&menuArena, size))) {
+		if (!textureCacheEvict(cache, minAge)) return 0;
+	}
+
+	cache->used += textureCacheBlock(id);
+	cache->lastUse[id] = cache->frame - TEXTURE_CACHE_GUARD; // Not drawn yet
+	construct_textureStream_t(stream, cache->address[id], (uint8_t*)tResidentTextures + textureInfo[id].offset, size);
+	#ifdef ROM_ICON_PAGES
+	// Counts icons left to read rather than bytes to copy
+	if (textureCacheIsBuilt(id)) construct_textureStream_t(stream, cache->address[id], 0, iconPageBytes(id));
+	#endif
+	return 1;
+}
+
+// Run up to maxBytes of the copy or build of texture id begun by
+// textureCacheBegin; returns what is still left
+static uint32_t textureCacheFill(textureStream_t* stream, int id, uint32_t maxBytes) {
+	#ifdef ROM_ICON_PAGES
+	if (textureCacheIsBuilt(id)) {
+		stream->remaining = iconBuildPage(&menuArena, id, stream->dst, stream->remaining, maxBytes);
+		return stream->remaining;
+	}
+	#endif
+	return update_textureStream_t(stream, maxBytes);
+}
+
+// Address of texture id, loading it on a miss; 0 when it cannot be loaded
+void* textureCacheGet(textureCache_t* cache, int id) {
+	if (cache->address[id]) {
+		cache->hits++;
+		if (id == cache->pendingId && textureCacheFill(&cache->pending, id, cache->pending.remaining)) {
+			textureCacheDrop(cache, id);
+			cache->failures++;
+			return 0;
+		}
+		if (id == cache->pendingId) cache->pendingId = -1;
+		if (cache->prefetched[id]) {
+			cache->prefetched[id] = 0;
+			cache->prefetchHits++;
+		}
+	}
+	else {
+		textureStream_t stream;
+		cache->misses++;
+		if (!textureCacheBegin(cache, id, TEXTURE_CACHE_GUARD, &stream)) {
+			cache->failures++;
+			return 0;
+		}
+		if (textureCacheFill(&stream, id, stream.remaining)) {
+			textureCacheDrop(cache, id);
+			cache->failures++;
+			return 0;
+		}
+	}
+
+	cache->lastUse[id] = cache->frame;
+	return cache->address[id];
+}
+
+// Whether texture id is cached and fully copied
+static inline int textureCacheIsLoaded(textureCache_t* cache, int id) {
+	return cache->address[id] && id != cache->pendingId;
+}
+
+// Copy up to maxBytes of the prefetch in progress, starting on texture id
+// when there is none; returns the bytes copied. A prefetch counts as a use,
+// so the next ones cannot evict it before it is drawn.
+uint32_t textureCachePrefetch(textureCache_t* cache, int id, uint32_t maxBytes) {
+	if (cache->pendingId < 0) {
+		if (cache->address[id] || !textureCacheBegin(cache, id, TEXTURE_CACHE_PREFETCH_AGE, &cache->pending)) return 0;
+		cache->lastUse[id] = cache->frame;
+		cache->pendingId = id;
+		cache->prefetched[id] = 1;
+		cache->prefetches++;
+	}
+
+	uint32_t remaining = cache->pending.remaining;
+	if (!textureCacheFill(&cache->pending, cache->pendingId, maxBytes)) cache->pendingId = -1;
+	// A built page reads whole icons and can overrun maxBytes
+	remaining -= cache->pending.remaining;
+	return remaining < maxBytes ? remaining : maxBytes;
+}
+
+#endif
+
+// Load the resident textures at once, up to the cache budget; the overlay
+// spreads this over frames with menuInit.h
+void loadTextures() {
+	#ifndef hardware
+	textureStream_t stream;
+	construct_textureCache_t(&textureCache, TEXTURE_CACHE_BUDGET);
+	for (int id = 0; id < NUM_LOADED_TEXTURES && textureCacheHasRoom(&textureCache, id); id++) {
+		if (textureCacheBegin(&textureCache, id, TEXTURE_CACHE_GUARD, &stream)) update_textureStream_t(&stream, stream.remaining);
+	}
+	#endif
+}
+
+// Point a sprite texture at a texture from the table. The address is looked up
+// again when drawing, as cached textures can move.
+void setTexture(gfx_texture_t* texture, int id) {
+	texture->timg = 0;
+	texture->width = textureInfo[id].width;
+	texture->height = textureInfo[id].height;
+	texture->fmt = textureInfo[id].fmt;
+	texture->bitsiz = textureInfo[id].bitsiz;
+}
+
+#endif
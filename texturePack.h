@@ -0,0 +1,169 @@
+#ifndef TEXTUREPACK_H
+#define TEXTUREPACK_H
+
+#include <stdint.h>
+
+// Layout of textures/AllTextures, shared by tools/texpack, the host tools and
+// the loader. All fields are big endian, as the N64 reads them.
+//
+//   header   TEXTURE_PACK_HEADER_SIZE bytes
+//   payload  texture data, resident textures first, each PACK_ALIGN aligned
+//   entries  one texturePackEntry per texture, indexed by TEX_ id
+//   slots    open addressed hash table of entry index + 1 by name, 0 if empty
+//   names    NUL terminated texture names, the TEX_ suffixes
+//
+// The header and the resident payload are the prefix the overlay embeds. The
+// index follows the payload so it costs the overlay nothing.
+
+#define TEXTURE_PACK_MAGIC 0x4C4D5450 // "LMTP"
+#define TEXTURE_PACK_VERSION 1
+#define TEXTURE_PACK_HEADER_SIZE 32
+#define TEXTURE_PACK_ENTRY_SIZE 32
+#define TEXTURE_PACK_ALIGN 8
+
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t numEntries;
+	uint32_t size; // Whole pack
+	uint32_t residentSize; // Header and resident payload
+	uint32_t entriesOffset;
+	uint32_t slotsOffset;
+	uint32_t numSlots; // Power of two, at least twice numEntries
+	uint32_t namesOffset;
+} texturePackHeader_t;
+
+typedef struct {
+	uint32_t hash; // texturePackHash of the name
+	uint32_t offset; // Of the data, from the start of the pack
+	uint32_t size; // Unpadded
+	uint32_t checksum; // texturePackHash of the data
+	uint32_t name; // Offset into the names
+	uint16_t width;
+	uint16_t height;
+	uint16_t tlut; // Entry of the TLUT, 0xFFFF if none
+	uint8_t fmt;
+	uint8_t bitsiz;
+	uint8_t tint[3];
+	uint8_t source;
+} texturePackEntry_t;
+
+typedef struct {
+	const uint8_t* data;
+	texturePackHeader_t header;
+} texturePack_t;
+
+static inline uint16_t texturePackRead16(const uint8_t* in) {
+	return (in[0] << 8) | in[1];
+}
+
+static inline uint32_t texturePackRead32(const uint8_t* in) {
+	return ((uint32_t)in[0] << 24) | (in[1] << 16) | (in[2] << 8) | in[3];
+}
+
+// FNV-1a, over names for the index and over data for the checksums
+static uint32_t texturePackHash(const void* data, uint32_t size) {
+	const uint8_t* in = (const uint8_t*)data;
+	uint32_t hash = 0x811C9DC5;
+	for (uint32_t i = 0; i < size; i++) hash = (hash ^ in[i]) * 0x01000193;
+	return hash;
+}
+
+static uint32_t texturePackHashName(const char* name) {
+	uint32_t size = 0;
+	while (name[size]) size++;
+	return texturePackHash(name, size);
+}
+
+// Read the header of a pack of size bytes; returns 0 if it is not a pack of
+// this version or its sections do not fit. Nothing is copied, so data has to
+// stay mapped.
+int construct_texturePack_t(texturePack_t* pack, const void* data, uint32_t size) {
+	const uint8_t* in = (const uint8_t*)data;
+	texturePackHeader_t* header = &pack->header;
+	pack->data = in;
+	if (size < TEXTURE_PACK_HEADER_SIZE) return 0;
+
+	header->magic = texturePackRead32(in);
+	header->version = texturePackRead16(in + 4);
+	header->numEntries = texturePackRead16(in + 6);
+	header->size = texturePackRead32(in + 8);
+	header->residentSize = texturePackRead32(in + 12);
+	header->entriesOffset = texturePackRead32(in + 16);
+	header->slotsOffset = texturePackRead32(in + 20);
+	header->numSlots = texturePackRead32(in + 24);
+	header->namesOffset = texturePackRead32(in + 28);
+
+	if (header->magic != TEXTURE_PACK_MAGIC || header->version != TEXTURE_PACK_VERSION) return 0;
+	// A resident prefix only has the header and payload
+	if (size < header->residentSize || (size < header->size && size != header->residentSize)) return 0;
+	if (size == header->residentSize) return 1;
+
+	return header->entriesOffset + header->numEntries * TEXTURE_PACK_ENTRY_SIZE <= header->slotsOffset
+		&& header->slotsOffset + header->numSlots * 2 <= header->namesOffset && header->namesOffset <= header->size
+		&& header->numSlots >= 2u * header->numEntries && header->numSlots && !(header->numSlots & (header->numSlots - 1));
+}
+
+// Whether the index was loaded along with the payload
+static inline int texturePackHasIndex(texturePack_t* pack) {
+	return pack->header.entriesOffset < pack->header.size && pack->header.numSlots;
+}
+
+// Entry for TEX_ id; returns 0 when out of range
+int texturePackGet(texturePack_t* pack, int id, texturePackEntry_t* entry) {
+	if (id < 0 || id >= pack->header.numEntries) return 0;
+	const uint8_t* in = pack->data + pack->header.entriesOffset + id * TEXTURE_PACK_ENTRY_SIZE;
+
+	entry->hash = texturePackRead32(in);
+	entry->offset = texturePackRead32(in + 4);
+	entry->size = texturePackRead32(in + 8);
+	entry->checksum = texturePackRead32(in + 12);
+	entry->name = texturePackRead32(in + 16);
+	entry->width = texturePackRead16(in + 20);
+	entry->height = texturePackRead16(in + 22);
+	entry->tlut = texturePackRead16(in + 24);
+	entry->fmt = in[26];
+	entry->bitsiz = in[27];
+	entry->tint[0] = in[28];
+	entry->tint[1] = in[29];
+	entry->tint[2] = in[30];
+	entry->source = in[31];
+	return 1;
+}
+
+static inline const char* texturePackName(texturePack_t* pack, texturePackEntry_t* entry) {
+	return (const char*)pack->data + pack->header.namesOffset + entry->name;
+}
+
+static inline const void* texturePackData(texturePack_t* pack, texturePackEntry_t* entry) {
+	return pack->data + entry->offset;
+}
+
+// TEX_ id of the texture called name ("DPAD" for TEX_DPAD) in one hash and
+// usually one probe; returns -1 if there is none. Probes stop after numSlots
+// so a table with no empty slot cannot spin.
+int texturePackFind(texturePack_t* pack, const char* name) {
+	uint32_t hash = texturePackHashName(name);
+	uint32_t mask = pack->header.numSlots - 1;
+	const uint8_t* slots = pack->data + pack->header.slotsOffset;
+
+	for (uint32_t probe = 0, slot = hash & mask; probe < pack->header.numSlots; probe++, slot = (slot + 1) & mask) {
+		int id = texturePackRead16(slots + slot * 2) - 1;
+		if (id < 0) return -1;
+
+		texturePackEntry_t entry;
+		if (!texturePackGet(pack, id, &entry) || entry.hash != hash) continue;
+		const char* other = texturePackName(pack, &entry);
+		int i = 0;
+		while (name[i] && name[i] == other[i]) i++;
+		if (name[i] == other[i]) return id;
+	}
+	return -1;
+}
+
+// Whether the data of entry still matches its checksum
+static inline int texturePackVerify(texturePack_t* pack, texturePackEntry_t* entry) {
+	return entry->offset + entry->size <= pack->header.size && texturePackHash(texturePackData(pack, entry), entry->size) == entry->checksum;
+}
+
+#endif
@@ -1,495 +1,1070 @@
-#define mallocStartAddr 0x80AA0000
+#ifndef TEXTURES_H
+#define TEXTURES_H
 
-#define hardware
+// Generated by tools/texpack from textures_png. Do not edit.
 
-#define dKokiriTunic {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012081,0x51818A81,0x8A817203,0x72032081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012081,0x51818A81,0x8A817203,0x51815181,0x51810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00813901,0x8A818A81,0x8A818A81,0x39015181,0x72032081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000101C1,0x01C17203,0x8A818A81,0x8A818A81,0x39015181,0x72030281,0x02810081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x010101C1,0x01C101C1,0x01C15181,0x8A818A81,0x8A815181,0x39013901,0x39010281,0x02810281,0x01C10081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010101,0x01C10281,0x02810281,0x01C101C1,0x01C10281,0x01C17203,0x8A815181,0x208101C1,0x02810281,0x02810281,0x02810281,0x02810281,0x01010001,0x00010001,0x00010001,0x000101C1,0x02810281,0x02810281,0x02810281,0x01C101C1,0x01C101C1,0x02812081,0x72033901,0x39010281,0x02810281,0x02810281,0x02810281,0x02810281,0x02810281,0x01C10081,0x00010001,0x00010281,0x02810281,0x02810281,0x02810281,0x01C10101,0x01C101C1,0x01C101C1,0x51813901,0x51810281,0x02810281,0x02810281,0x02810281,0x02810281,0x02810281,0x02810001,0x00010001,0x00010101,0x02810281,0x02810281,0x02810281,0x01C101C1,0x01C101C1,0x02814B0F,0x72035181,0xAD650281,0x02810281,0x02810281,0x01C101C1,0x01C10281,0x02810281,0x01010081,0x00010001,0x00010101,0x02810281,0x02810281,0x02810281,0x01010101,0x01C101C1,0x01C14B0F,0xAD65FFFF,0xAD650281,0x02810281,0x02810281,0x01C101C1,0x01C101C1,0x01C101C1,0x01010081,0x00010001,0x00010101,0x01C10281,0x01C10281,0x01C101C1,0x01010101,0x01C101C1,0x01C14B0F,0x51817203,0xAD654B0F,0x02810281,0x02810281,0x01C10101,0x01C101C1,0x01C101C1,0x01C10081,0x00010001,0x00010081,0x01C101C1,0x01C10101,0x01C101C1,0x01010101,0x010101C1,0x01C10281,0x51817203,0x02810281,0x028101C1,0x028101C1,0x01010101,0x01010081,0x010101C1,0x01C10001,0x00010001,0x00010001,0x00810081,0x00810081,0x00810081,0x00810101,0x01C101C1,0x01C14B0F,0xAD65AD65,0xFFFF0281,0x02810281,0x01C10281,0x01C10081,0x00810081,0x008101C1,0x00810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00810101,0x010101C1,0x01C14B0F,0x4B0FAD65,0xAD650281,0x02810281,0x028101C1,0x01010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00810101,0x010101C1,0x01C13901,0x01C101C1,0x02814B0F,0x028101C1,0x028101C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010101,0x010101C1,0x028194C9,0x94C994C9,0x94C90281,0x02810281,0x028101C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39015181,0x51815181,0x94C9EF4F,0xEF4FEF4F,0xEF4FEF4F,0x94C98A81,0x8A818A81,0x39010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20813901,0x51815181,0x720394C9,0xEF4FEF4F,0xEF4F94C9,0x8A818A81,0x72037203,0x39010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00810101,0x208101C1,0x01C14B0F,0x94C994C9,0x94C95181,0x02810281,0x518101C1,0x00810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x008101C1,0x01C101C1,0x02810281,0x01C101C1,0x02810281,0x02810281,0x02810281,0x00810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01010101,0x01C10281,0x01C10281,0x01C101C1,0x02810281,0x02810281,0x02810281,0x00810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x010101C1,0x01C101C1,0x02810281,0x01C10101,0x02810281,0x02810281,0x02810281,0x01C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x010101C1,0x01C101C1,0x028101C1,0x01C10101,0x02810281,0x02810281,0x02810281,0x01C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x008101C1,0x01C10281,0x01C10281,0x028101C1,0x01C10281,0x02810281,0x02810281,0x01010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01010101,0x01010101,0x01C10101,0x010101C1,0x01C10101,0x00810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dAduldWallet {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410001,0x00010001,0x00010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C518C5,0x520B4189,0x4189520B,0x4189520B,0x4189520B,0x29070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2907520B,0x520B4189,0x520B520B,0x520B728F,0x520B520B,0x41890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014189,0x520B520B,0x520B520B,0x520B520B,0x520B520B,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012907,0x520B4189,0x520B520B,0x41894189,0x41892907,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2907520B,0x4189520B,0x4189520B,0x520B0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x8B518B51,0x728F728F,0x728F520B,0x418918C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xA415739F,0x8C65A415,0x739F728F,0x4A570841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012907,0x8C65BDAB,0xA4158C65,0x8B518B51,0x8B5118C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x520B520B,0x728F520B,0x41892907,0x739F728F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001728F,0x728F8B51,0x4189728F,0x41892907,0x8B51A415,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x728F8B51,0x728F8B51,0x8B518B51,0xA4158B51,0xA415BDAB,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001520B,0x8B518B51,0x8B51728F,0x8B51728F,0x8B518B51,0x8B51BDAB,0x8B510841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x520BA415,0x8B51728F,0xA415728F,0xA4158B51,0x8B51A415,0x728FA415,0xBDAB4189,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C5,0xA4158B51,0x8B51A415,0xA415728F,0x728F2907,0x728FA415,0x728F8B51,0xA4158B51,0x29070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A415,0xA415A415,0xA415A415,0xA415739F,0x4A574A57,0x3991728F,0x728F8B51,0x8B518B51,0x520B18C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41898B51,0xA415A415,0xA415A415,0x8B514A57,0x4A57739F,0x4A573991,0x3991728F,0x8B518B51,0xA4152907,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8B51A415,0xA415A415,0xA4158B51,0x39918C65,0x8C65739F,0x739F739F,0x39914189,0x8B51728F,0x8C654189,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x8B51A415,0xA415A415,0xA4158B51,0x3991BDAB,0xBDAB8C65,0x739F739F,0x39914189,0x728F728F,0x520B2907,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C5,0x8B51A415,0xA415A415,0xA415728F,0x3991FFFF,0xBDAB8C65,0xBDAB8C65,0x39914189,0x4189728F,0x41894189,0x29070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C5,0x8B518B51,0x8B518B51,0x8B51728F,0x3991FFFF,0xFFFFFFFF,0xFFFFBDAB,0x4A572907,0x520B520B,0x41894189,0x41890841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C5,0x728F728F,0x728F8B51,0x8B51728F,0x3991BDAB,0x8C658C65,0x8C65BDAB,0x39914189,0x4189520B,0x41894189,0x41890841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x520B728F,0x728F728F,0x8B51520B,0x39913991,0x739F4A57,0x739F8C65,0x4A572907,0x41894189,0x41894189,0x520B0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x2907520B,0x520B728F,0x728F520B,0x41892907,0x39914A57,0x8C652907,0x18C54189,0x41894189,0x4189520B,0x41890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08414189,0x520B520B,0x728F520B,0x41892907,0x18C53991,0x29072907,0x4189520B,0x41894189,0x29074189,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x29072907,0x41894189,0x41892907,0x18C518C5,0x29074189,0x520B520B,0x520B4189,0x29072907,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x08412907,0x41894189,0x18C518C5,0x41894189,0x41894189,0x29072907,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x18C518C5,0x18C518C5,0x18C52907,0x18C50841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dAgony {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B9B,0x7B9B7B9B,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B9B,0x7B9B7B9B,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1043AD23,0xAD23AD23,0xBDE9949F,0x949F18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x62D5949F,0x949FAD23,0xBDE9BDE9,0xBDE9BDE9,0x7B9B318D,0x318D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000162D5,0x949F7B9B,0x7B9B949F,0xAD23BDE9,0xBDE9BDE9,0xBDE9BDE9,0xBDE97B9B,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000162D5,0x949F7B9B,0x7B9B949F,0xAD23BDE9,0xBDE9BDE9,0xBDE9BDE9,0xBDE97B9B,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012909,0x2909AD23,0xAD237B9B,0x7B9B62D5,0x949F7B9B,0x7B9BBDE9,0xBDE9BDE9,0xBDE9BDE9,0xBDE9BDE9,0xBDE92909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C7AD23,0xAD23AD23,0xAD23AD23,0xAD23AD23,0x949F62D5,0x62D5949F,0xBDE9BDE9,0xBDE9BDE9,0xBDE9BDE9,0xBDE962D5,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x10437B9B,0xAD23949F,0x949FAD23,0xAD23AD23,0xAD23AD23,0x62D5420F,0x420F7B9B,0xBDE9BDE9,0xBDE9BDE9,0xBDE97B9B,0x7B9B62D5,0x10430001,0x00010001,0x00010001,0x00010001,0x00011043,0x10437B9B,0xAD23949F,0x949FAD23,0xAD23AD23,0xAD23AD23,0x62D5420F,0x420F7B9B,0xBDE9BDE9,0xBDE9BDE9,0xBDE97B9B,0x7B9B62D5,0x10430001,0x00010001,0x00010001,0x00010001,0x00017B9B,0x7B9BAD23,0x7B9B7B9B,0x7B9B7B9B,0xAD23AD23,0xAD237B9B,0x4A514A51,0x4A51420F,0xAD23BDE9,0xBDE9BDE9,0x949F62D5,0x62D52909,0x00010001,0x00010001,0x00010001,0x00010001,0x7B9B949F,0x949F62D5,0x949FAD23,0xAD23949F,0x949F949F,0x949F4A51,0x4A514A51,0x4A51420F,0x7B9BBDE9,0xBDE9AD23,0x4A51420F,0x420F0001,0x00010001,0x00010001,0x00010001,0x000118C7,0x949F949F,0x949F949F,0x949F949F,0x949F949F,0x949F4A51,0x4A514A51,0x4A51420F,0x420F318D,0x62D5BDE9,0xBDE962D5,0x4A510001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x949F949F,0x949F949F,0x949F949F,0x949F949F,0x949F4A51,0x4A514A51,0x4A51420F,0x420F318D,0x62D5BDE9,0xBDE962D5,0x4A510001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001949F,0x7B9B7B9B,0x7B9B949F,0x949F949F,0x949F949F,0x4A514A51,0x4A514A51,0x420F4A51,0x4A51949F,0x949F62D5,0x62D54A51,0x18C70001,0x00010001,0x00010001,0x00010001,0x00012909,0x2909949F,0x7B9B7B9B,0x7B9B7B9B,0x7B9B949F,0x949F62D5,0x4A514A51,0x4A514A51,0x4A5162D5,0x62D5BDE9,0xAD23420F,0x420F18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x0843BDE9,0xBDE9BDE9,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B62D5,0x4A514A51,0x4A514A51,0x62D5AD23,0xAD23BDE9,0x949F4A51,0x4A511043,0x00010001,0x00010001,0x00010001,0x00010001,0x0843BDE9,0xBDE9BDE9,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B62D5,0x4A514A51,0x4A514A51,0x62D5AD23,0xAD23BDE9,0x949F4A51,0x4A511043,0x00010001,0x00010001,0x00010001,0x00010001,0x08437B9B,0x7B9B949F,0xBDE9BDE9,0xBDE9949F,0x7B9B7B9B,0x7B9B62D5,0x4A514A51,0x4A514A51,0x62D5AD23,0xAD23AD23,0x62D562D5,0x62D518C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00012909,0x2909318D,0x420F62D5,0x62D5949F,0xAD237B9B,0x7B9B7B9B,0x4A514A51,0x4A514A51,0xAD23AD23,0xAD237B9B,0x4A514A51,0x4A51420F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08432909,0x318D318D,0x318D420F,0x7B9BBDE9,0xBDE9AD23,0x4A514A51,0x4A5162D5,0xBDE97B9B,0x7B9B62D5,0x4A5162D5,0x62D51043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08432909,0x318D318D,0x318D420F,0x7B9BBDE9,0xBDE9AD23,0x4A514A51,0x4A5162D5,0xBDE97B9B,0x7B9B62D5,0x4A5162D5,0x62D51043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x318D318D,0x318D318D,0x420F62D5,0x62D5949F,0xBDE9AD23,0xAD23949F,0x949F62D5,0x62D562D5,0x62D5318D,0x318D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x1043318D,0x318D318D,0x318D4A51,0x4A51949F,0x949F949F,0x62D562D5,0x62D54A51,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C7318D,0x318D318D,0x318D420F,0x420F62D5,0x62D562D5,0x62D54A51,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C7318D,0x318D318D,0x318D420F,0x420F62D5,0x62D562D5,0x62D54A51,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x318D318D,0x318D4A51,0x62D54A51,0x4A510843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x18C72909,0x4A511043,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBeans {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x01410041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010A83,0x0B430A83,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x0A830A83,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010B43,0x0A830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830B43,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x0C430B43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x01410B43,0x0B430B43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x0C430C43,0x0C430C43,0x0B430B43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830B43,0x0C430C43,0x0C430C43,0x0B430C43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x0B430B43,0x4C454C45,0x96474C45,0x0C430C43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010B43,0x0A830B43,0x0C434C45,0x2DAF9647,0x4C450B43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01410B43,0x0A8319CB,0x4C450C43,0x4C450C43,0x19CB0B43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B430B43,0x0A830A83,0x01410A83,0x0B4351C5,0x4C450B43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010A83,0x0B430B43,0x0B4319CB,0x19CB51C5,0x19CB0A83,0x0A830A83,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830B43,0x0B431423,0x14231423,0x13150B43,0x0A830A83,0x0A830141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010A83,0x0A831315,0x14231423,0x2DAF2DAF,0x14231315,0x0B430B43,0x0A830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830A83,0x0A831315,0x13151423,0x2DAF2DAF,0x2DAF1315,0x0B430B43,0x0A830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x0B430A83,0x0A8319CB,0x13151423,0x14231423,0x14234C45,0x0B430A83,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830B43,0x0B430B43,0x19CB19CB,0x19CB1315,0x13151315,0x51C51315,0x0B430141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x0A834C45,0x4C459647,0x0B431315,0x19CB19CB,0x19CB19CB,0x13150B43,0x0A830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830A83,0x4C459647,0x96479647,0x96474C45,0x0A8319CB,0x19CB19CB,0x0A830A83,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01410A83,0x0A830A83,0x4C454C45,0x96479647,0x96479647,0x0C430B43,0x0B430B43,0x0B430041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00410041,0x0A8351C5,0xCA0B51C5,0x0A830A83,0x51C551C5,0x96479647,0x96479647,0x0C430C43,0x0C430B43,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x01410141,0x0C430C43,0x0B430A83,0x51C5CA0B,0xCA0BCA0B,0xCA0B51C5,0x51C54C45,0x51C54C45,0x51C551C5,0x0C430C43,0x0A830041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01410B43,0x0B430B43,0x0B430A83,0x51C5CA0B,0xCA0BCA0B,0xCA0B4C45,0x51C551C5,0x51C551C5,0x51C50C43,0x0C430A83,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x0B430C43,0x0C434C45,0x51C5CA0B,0xCA0BCA0B,0xCA0B4C45,0x0C430C43,0x0B430C43,0x0C430B43,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00410B43,0x0C434C45,0x000151C5,0x51C551C5,0x51C50C43,0x0C430C43,0x0C430C43,0x0A830041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0A830C43,0x0A8351C5,0x51C551C5,0x0C430C43,0x0C430C43,0x0A830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x0A830C43,0x0B430C43,0x0C430A83,0x01410041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00410001,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBiggoron {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C92991,0x29910845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C9C679,0xC679C679,0xA5270001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C9,0xFFFFC679,0xC679A527,0x6BA30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C9FFFF,0xFFFFC679,0x6BA36BA3,0x4ADD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C9,0xFFFFFFFF,0xC6796BA3,0x4ADD4ADD,0x008B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6BA3FFFF,0xFFFFC679,0x6BA34ADD,0x4ADD2991,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014ADD,0xFFFFFFFF,0xFFFF6BA3,0x4ADD4ADD,0x29910001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6BA3FFFF,0xFFFFFFFF,0x6BA34ADD,0x4ADD2991,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016BA3,0xFFFFFFFF,0xFFFF4ADD,0x4ADD4ADD,0x4ADD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4ADDFFFF,0xFFFFFFFF,0x6BA34ADD,0x4ADD4ADD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C679,0xFFFFFFFF,0xFFFF4ADD,0x4ADD4ADD,0x29910001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA527FFFF,0xFFFFFFFF,0x4ADD4ADD,0x4ADD4ADD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0845C679,0xFFFFFFFF,0xFFFF6BA3,0x4ADD4ADD,0x4ADD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC679FFFF,0xFFFFFFFF,0x6BA34ADD,0x4ADD4ADD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C679,0xFFFFFFFF,0xFFFF6BA3,0x4ADD4ADD,0x4ADD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001008B,0x00010001,0x00010001,0x000118C9,0xA527FFFF,0xFFFFFFFF,0x6BA34ADD,0x4ADD4ADD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001257F,0x4ADD0001,0x00010001,0x0845FFFF,0xFFFFFFFF,0xFFFF6BA3,0x4ADD4ADD,0x4ADD0845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0845257F,0x257F0963,0x000118C9,0xFFFFFFFF,0xFFFFFFFF,0x4ADD4ADD,0x4ADD4ADD,0x18C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C9257F,0x257F257F,0x1237C679,0xFFFFFFFF,0xFFFF6BA3,0x4ADD4ADD,0x4ADD0845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2991257F,0x12371237,0x257FA527,0xA527C679,0x6BA34ADD,0x4ADD4ADD,0x18C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001008B,0x09631237,0x1237A527,0xA527A527,0x72CB6BA3,0x4ADD18C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014ADD,0x6BA3A527,0xA527A527,0x72CB4ADD,0x18C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C96BA3,0xA52772CB,0x6BA36BA3,0x12370963,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x6BA3A527,0x29912991,0x1237257F,0x257F1237,0x008B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016BA3,0xA5274ADD,0x29912991,0x09631237,0x12371237,0x12370845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001008B,0x6BA3A527,0x4ADD2991,0x18C90001,0x08451237,0x12371237,0x12370963,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001257F,0x257F4ADD,0x29910845,0x00010001,0x00010963,0x12370963,0x09630963,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2991257F,0x12371237,0x29910001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x09631237,0x1237008B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x008B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBolero {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC905C905,0xC905F947,0xF947F947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC905C905,0xC905F947,0xF947F947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C5C905,0xC905C905,0xF947F947,0xF9470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C5C905,0xC905C905,0xF947F947,0xF9470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C5C905,0xC905C905,0xF947F947,0xF9470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C588C5,0x88C588C5,0xC905C905,0xC905F947,0xF947F947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C588C5,0x88C588C5,0xC905C905,0xC905F947,0xF947F947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C588C5,0x88C588C5,0xC905C905,0xC905F947,0xF947F947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x88C588C5,0x88C5C905,0xC905C905,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x88C588C5,0x88C5C905,0xC905C905,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x88C588C5,0x88C5C905,0xC905C905,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x0001C905,0xC905C905,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x0001C905,0xC905C905,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x0001C905,0xC905C905,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x000188C5,0x88C588C5,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x000188C5,0x88C588C5,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x000188C5,0x88C588C5,0x38433843,0x38430001,0x00010001,0x00010001,0xF947F947,0xF947F947,0xF947F947,0xF947F947,0xF94788C5,0x88C588C5,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x38433843,0x38430001,0x00010001,0x00010001,0xF947F947,0xF947F947,0xF947F947,0xF947F947,0xF94788C5,0x88C588C5,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x38433843,0x38430001,0x00010001,0x00010001,0xF947F947,0xF947F947,0xF947F947,0xF947F947,0xF94788C5,0x88C588C5,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x38433843,0x38430001,0x00010001,0xF947F947,0xF947F947,0xF947C905,0xC905C905,0xC905C905,0xC905C905,0xC905C905,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x38433843,0x38430001,0x00010001,0xF947F947,0xF947F947,0xF947C905,0xC905C905,0xC905C905,0xC905C905,0xC905C905,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x38433843,0x38430001,0x00010001,0xF947F947,0xF947F947,0xF947C905,0xC905C905,0xC905C905,0xC905C905,0xC905C905,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x38433843,0x38430001,0x00010001,0xF947F947,0xC905C905,0xC905C905,0xC905C905,0xC905C905,0xC90588C5,0x88C588C5,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xF947F947,0xC905C905,0xC905C905,0xC905C905,0xC905C905,0xC90588C5,0x88C588C5,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xF947F947,0xC905C905,0xC905C905,0xC905C905,0xC905C905,0xC90588C5,0x88C588C5,0x88C588C5,0x88C53843,0x38433843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x38433843,0x38433843,0x38433843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x38433843,0x38433843,0x38433843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x88C588C5,0x38433843,0x38433843,0x38433843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013843,0x38433843,0x38433843,0x38433843,0x38433843,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013843,0x38433843,0x38433843,0x38433843,0x38433843,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013843,0x38433843,0x38433843,0x38433843,0x38433843,0x38433843,0x38430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBombBag20 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011881,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x08410001,0x00017205,0x72053903,0x28C128C1,0x00011041,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017205,0x72057205,0x61C37205,0x61C37205,0x720561C3,0x61C34943,0x49430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C1,0x494361C3,0x61C361C3,0x61C37205,0x61C34943,0x390361C3,0x72051041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413903,0x49434943,0x494361C3,0x49434943,0x49434943,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x28C14943,0x49434943,0x49434943,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C13903,0x39033903,0x494328C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x48C1BA45,0xBA45BA45,0xBA451041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C1BA45,0xBA45BA45,0xBA450801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x61C361C3,0x61C361C3,0x61C33903,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014943,0x72053903,0x61C361C3,0x61C361C3,0x39030841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C14943,0x49433903,0x49437205,0x72057205,0x61C33903,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x61C361C3,0x49434943,0x39037205,0x61C361C3,0x61C361C3,0x28C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C1,0x61C34943,0x39034943,0x49437205,0x494361C3,0x49434943,0x49431041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x080161C3,0x720561C3,0x61C37205,0x61C37205,0x61C361C3,0x61C34943,0x49433903,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18814943,0x61C361C3,0x72057205,0x72057205,0x61C34943,0x494361C3,0x61C34943,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C14943,0x72057205,0x720561C3,0x72057205,0x61C34943,0x72057205,0x494361C3,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C161C3,0x7205BA45,0x720561C3,0x720561C3,0x49434943,0x72057205,0x49434943,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104161C3,0x72057205,0x720561C3,0x61C361C3,0x61C37205,0x72054943,0x39034943,0x39030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014943,0x494361C3,0x72054943,0x61C361C3,0x61C34943,0x39033903,0x49434943,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x39033903,0x49433903,0x39034943,0x49433903,0x28C13903,0x49433903,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10411881,0x28C128C1,0x188128C1,0x39033903,0x28C13903,0x39030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10411881,0x28C128C1,0x28C13903,0x39030801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBombBag30 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000138C1,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016141,0x38C10841,0x38C19A41,0x79C19A41,0x79C179C1,0x51011841,0x61415101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28815101,0x79C179C1,0x79C179C1,0x79C19A41,0x79C179C1,0x79C16141,0x79C19A41,0x51010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x38C15101,0x614179C1,0x614179C1,0x9A416141,0x51015101,0x79C15101,0x38C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012881,0x38C15101,0x51015101,0x51015101,0x614138C1,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18415101,0x51015101,0x51015101,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10857B59,0x5A957B59,0x7B595A95,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085B56D,0x5A95FFFF,0xB56D5A95,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18417B59,0x5A95B56D,0x7B596141,0x18410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016141,0x9A4179C1,0x79C16141,0x510179C1,0x79C16141,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x61416141,0x614138C1,0x614179C1,0x79C179C1,0x79C179C1,0x51010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016141,0x614179C1,0x61416141,0x614179C1,0x9A419A41,0x9A419A41,0x79C16141,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x084179C1,0x79C16141,0x51016141,0x38C179C1,0x79C16141,0x61416141,0x79C16141,0x51010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x79C179C1,0x79C15101,0x510179C1,0x51019A41,0x9A416141,0x79C16141,0x51016141,0x614138C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x79C179C1,0x79C16141,0x79C19A41,0x61419A41,0x9A416141,0x79C179C1,0x61416141,0x61416141,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000179C1,0x79C19A41,0x79C179C1,0x9A419A41,0x79C19A41,0x9A416141,0x51016141,0x61416141,0x61416141,0x38C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08416141,0x510179C1,0x79C179C1,0x79C179C1,0x79C19A41,0x9A4179C1,0x51015101,0x79C179C1,0x61416141,0x51010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18416141,0x61419A41,0x9A419A41,0x79C179C1,0x79C19A41,0x9A4179C1,0x614179C1,0x9A419A41,0x614179C1,0x61411841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x288179C1,0x79C19A41,0x9A419A41,0x79C179C1,0x79C19A41,0x79C16141,0x614179C1,0x9A419A41,0x79C15101,0x51012881,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08416141,0x9A419A41,0x9A419A41,0x79C179C1,0x79C179C1,0x61416141,0x79C19A41,0x9A4179C1,0x51015101,0x614138C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08415101,0x79C179C1,0x79C19A41,0x79C16141,0x614179C1,0x79C179C1,0x79C16141,0x51015101,0x38C16141,0x61412881,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000138C1,0x51016141,0x614179C1,0x79C16141,0x614179C1,0x79C179C1,0x51015101,0x38C138C1,0x51015101,0x51011841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x510138C1,0x51015101,0x61415101,0x38C15101,0x61415101,0x510138C1,0x38C138C1,0x61416141,0x51010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x288138C1,0x38C138C1,0x38C12881,0x288138C1,0x38C138C1,0x38C138C1,0x38C15101,0x510138C1,0x38C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x288138C1,0x28812881,0x38C12881,0x288138C1,0x38C138C1,0x38C15101,0x38C11841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x288138C1,0x38C138C1,0x38C138C1,0x51015101,0x38C11841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x08410841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBombBag40 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x204140C3,0x00011001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x61031001,0x00011001,0x61038985,0x61038985,0x71458985,0x50C33083,0x20416103,0x40C31001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x89858985,0x89857145,0x89858985,0x71458985,0x89858985,0x71457145,0x50C36103,0x89853083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012041,0x308340C3,0x71457145,0x71456103,0x71458985,0x89857145,0x714550C3,0x71458985,0x89857145,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x308350C3,0x50C36103,0x50C37145,0x898550C3,0x61036103,0x61033083,0x10011001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012041,0x40C350C3,0x50C350C3,0x40C340C3,0x610340C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x204140C3,0x50C350C3,0x50C350C3,0x20410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294550C3,0x40C340C3,0x61038B49,0x20410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8B498B49,0x8B49CD97,0xCD978B49,0x29450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8B498B49,0x8B49F71D,0xF71D8B49,0x20410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10016103,0x8B498985,0x7145CD97,0xCD977145,0x610340C3,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x71458985,0x714540C3,0x61038985,0x61037145,0x89858985,0x61032041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017145,0x50C350C3,0x40C350C3,0x50C38985,0x89858985,0x71457145,0x714550C3,0x20410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x71457145,0x89856103,0x50C36103,0x40C38985,0x71458985,0xA1C58985,0x89858985,0x71452041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000150C3,0x61038985,0x610350C3,0x50C36103,0x30838985,0x89856103,0x61037145,0x610350C3,0x610350C3,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017145,0x71457145,0x50C340C3,0x50C350C3,0x50C38985,0xA1C550C3,0x61036103,0x610350C3,0x61036103,0x30830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x50C36103,0x71457145,0x610350C3,0x89857145,0x6103A1C5,0xA1C56103,0x71457145,0x610350C3,0x61036103,0x61032041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x71457145,0x89857145,0x71457145,0xA1C58985,0x7145A1C5,0xA1C57145,0x50C350C3,0x61037145,0x61036103,0x610350C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x61037145,0x89858985,0x71458985,0x89858985,0x71458985,0x89857145,0x50C340C3,0x40C350C3,0x61036103,0x50C36103,0x20410001,0x00010001,0x00010001,0x00010001,0x00010001,0x000150C3,0x40C36103,0x89858985,0x71458985,0x71457145,0x71458985,0xA1C58985,0x610350C3,0x61038985,0x89856103,0x61036103,0x30830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016103,0x50C37145,0xA1C5A1C5,0xA1C58985,0x61038985,0x8985A1C5,0xA1C58985,0x50C36103,0x8985A1C5,0xA1C57145,0x71457145,0x30830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017145,0x71458985,0xA1C5A1C5,0xA1C57145,0x50C37145,0x89858985,0x89856103,0x50C37145,0xA1C5A1C5,0xA1C56103,0x50C350C3,0x40C31001,0x00010001,0x00010001,0x00010001,0x00010001,0x000150C3,0x71458985,0xA1C5A1C5,0xA1C57145,0x71457145,0x71457145,0x610350C3,0x50C37145,0xA1C5A1C5,0x714550C3,0x40C36103,0x50C32041,0x00010001,0x00010001,0x00010001,0x00010001,0x000140C3,0x61038985,0x71458985,0xA1C58985,0x71456103,0x61037145,0x71457145,0x71457145,0x71456103,0x40C340C3,0x50C36103,0x50C32041,0x00010001,0x00010001,0x00010001,0x00010001,0x00012041,0x50C36103,0x61036103,0x89858985,0x71456103,0x61037145,0x89858985,0x71456103,0x40C340C3,0x308340C3,0x61036103,0x40C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x40C350C3,0x50C36103,0x71457145,0x610340C3,0x50C37145,0x71457145,0x50C350C3,0x30833083,0x40C350C3,0x50C350C3,0x50C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x204140C3,0x30833083,0x308350C3,0x40C33083,0x308340C3,0x50C350C3,0x40C33083,0x30833083,0x40C36103,0x610350C3,0x20410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012041,0x40C33083,0x30833083,0x30832041,0x20413083,0x308340C3,0x308340C3,0x308340C3,0x50C350C3,0x308340C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10012041,0x30833083,0x20413083,0x30833083,0x20413083,0x40C340C3,0x308340C3,0x40C340C3,0x20411001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10013083,0x30833083,0x308340C3,0x30833083,0x40C340C3,0x50C33083,0x20411001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10011001,0x10012041,0x20412041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBossKey {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A4B,0x6A4B9351,0x93512083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBCDBBCDB,0xBCDB4987,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBCDBBCDB,0xBCDB4987,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xEEAB9351,0x93510001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0xEEAB9351,0x93513105,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0xBCDBBCDB,0xBCDBEEAB,0xEEABBCDB,0xBCDB9351,0x6A4B3105,0x31051083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0xBCDBBCDB,0xBCDBEEAB,0xEEABBCDB,0xBCDB9351,0x6A4B3105,0x31051083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019351,0xEEABEEAB,0xEEABEEAB,0xBCDBEEAB,0xEEABEEAB,0xEEABEEAB,0xEEAB3105,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x0841BCDB,0xEEABBCDB,0xBCDB9351,0xB1C56A4B,0x6A4BB1C5,0x93519351,0x93513105,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0x4987EEAB,0xEEAB9351,0x93517103,0x40814081,0x40814081,0x6A4B9351,0x93514987,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0x4987EEAB,0xEEAB9351,0x93517103,0x40814081,0x40814081,0x6A4B9351,0x93514987,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0x4987BCDB,0x9351B1C5,0xB1C54081,0xB1C57103,0x71037103,0xB1C59351,0x93514987,0x20830001,0x00010001,0x00011083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0x49879351,0x9351B1C5,0xB1C5B1C5,0xB1C5B1C5,0xB1C5B1C5,0xB1C56A4B,0x6A4B6A4B,0x10830001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08419351,0x9351B1C5,0xB1C57103,0x40814081,0x40814081,0x71036A4B,0x6A4B6A4B,0x31050001,0x00010001,0xEEAB1083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08419351,0x9351B1C5,0xB1C57103,0x40814081,0x40814081,0x71036A4B,0x6A4B6A4B,0x31050001,0x00010001,0xEEAB1083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019351,0x9351B1C5,0xB1C54081,0x40814081,0x40817103,0x71033105,0x31054987,0x93516A4B,0x6A4B9351,0xBCDB0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A4B,0x6A4BEEAB,0xBCDB9351,0x93517103,0x40817103,0x71034081,0x00014987,0x49876A4B,0x9351BCDB,0xBCDB6A4B,0x49870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987EEAB,0xEEABEEAB,0x6A4B4987,0x49873105,0x08410001,0x00010001,0x00011083,0x10831083,0x10830001,0x00011083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987EEAB,0xEEABEEAB,0x6A4B4987,0x49873105,0x08410001,0x00010001,0x00011083,0x10831083,0x10830001,0x00011083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A4B,0xEEABEEAB,0xEEAB6A4B,0x10830001,0x00010001,0x10831083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A4B,0x6A4BEEAB,0xEEAB6A4B,0x6A4B1083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A4BFFFF,0xFFFFEEAB,0x6A4B2083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A4BFFFF,0xFFFFEEAB,0x6A4B2083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A4B,0xEEABEEAB,0xEEAB6A4B,0x49876A4B,0x6A4B1083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A4B,0x6A4BEEAB,0xFFFF6A4B,0x6A4B2083,0x93519351,0x93513105,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3105EEAB,0xEEABEEAB,0x49873105,0x31056A4B,0x93514987,0x49870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3105EEAB,0xEEABEEAB,0x49873105,0x31056A4B,0x93514987,0x49870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987BCDB,0xBCDB6A4B,0x49879351,0x93519351,0x49870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x10831083,0x20836A4B,0x6A4B4987,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBigPoeBottle {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31453145,0x3145420F,0x31453145,0x31451085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x834D834D,0xCD5F834D,0x834D834D,0x3145834D,0x31450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013145,0x834D941B,0x834D834D,0x834D834D,0x834D834D,0x31450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x834D834D,0x941BCD5F,0x834D834D,0x834D834D,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x2109420F,0x62D5941B,0x834D834D,0x834D62D5,0x834D294B,0x294B294B,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0x420F941B,0x941B941B,0x941B62D5,0x420F834D,0x420F294B,0x294B294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x294B294B,0x294B420F,0x420F420F,0x420F420F,0x62D5941B,0x941B62D5,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x21092109,0x294B294B,0x3145420F,0x3145294B,0x420F294B,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x2109294B,0x21092109,0x21092109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x2109294B,0x2109420F,0xCD5F834D,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x2109294B,0x294B834D,0xF6A3F6A3,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085420F,0x420F294B,0x294B294B,0x62D5F6A3,0xCD5F834D,0x294B294B,0x294B2109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x420F420F,0x420F62D5,0x294B294B,0x420FF6A3,0x941BF6A3,0xCD5F294B,0x294B2109,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x420F294B,0x941BCD5F,0x6AE7294B,0x834DF6A3,0xF6A3F6A3,0xF6A362D5,0x21092109,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109420F,0x420F6AE7,0xFFFF941B,0x62D5CD5F,0xF6A3F6A3,0xF6A3F6A3,0xF6A3F6A3,0xCD5F2109,0x21092109,0x21092109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0x294BCD5F,0x941B62D5,0xCD5FF6A3,0xF6A3F6A3,0x941BCD5F,0xF6A3F6A3,0xF6A3941B,0x21092109,0x21092109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x420F6AE7,0x2109294B,0xCD5FF6A3,0xF6A3420F,0x10851085,0x941BF6A3,0xF6A3F6A3,0x2109294B,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B294B,0x294B294B,0x294B2109,0x00013145,0x3F0F3F0F,0x1085F6A3,0xF6A3F6A3,0x941B294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x294B420F,0x294B294B,0x294B1085,0x3F0F3F0F,0x420F3F0F,0x3F0F1085,0x0001F6A3,0xF6A3F6A3,0xF6A32109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B2109,0x21092109,0x10851085,0x10851085,0x10850001,0x1085F6A3,0xF6A3CD5F,0xF6A3834D,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x294B294B,0x294B294B,0x294B294B,0x420F1085,0x2109294B,0x420F62D5,0xCD5FF6A3,0xCD5FE98D,0xCD5F941B,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B294B,0x6AE7CD5F,0xCD5FE98D,0x941BCD5F,0xF6A3FFFF,0xCD5FE98D,0xE98D834D,0x294B420F,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x2109294B,0x294B2109,0x62D5941B,0x941BE98D,0xE98DE98D,0xE98DE98D,0xE98DE98D,0xE98DCD5F,0x294B2109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x10851085,0xCD5F941B,0x2109420F,0xE98DE98D,0xE98DE98D,0xE98DCD5F,0xCD5FF6A3,0x62D5420F,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x2109294B,0x0001834D,0x834DCD5F,0x1085294B,0xCD5FCD5F,0xE98DCD5F,0xCD5FCD5F,0xF6A3CD5F,0xF6A36AE7,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x00013145,0x31451085,0x0001294B,0xCD5FCD5F,0xF6A3CD5F,0xCD5F941B,0x941B62D5,0x941B834D,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x10853145,0xCD5F834D,0x1085294B,0xCD5FCD5F,0xCD5FCD5F,0x62D5294B,0x62D5420F,0x294B420F,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294B,0x21091085,0x834D1085,0x2109294B,0x941B941B,0xCD5FCD5F,0x294B294B,0x294B6AE7,0x62D5294B,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x21092109,0x00012109,0x294B294B,0x420F420F,0x420F294B,0x420F941B,0xCD5FCD5F,0x6AE7420F,0x294B2109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x10852109,0x21092109,0x21092109,0x294B294B,0x294B294B,0x62D56AE7,0x6AE76AE7,0x420F294B,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBugsBottle {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21093185,0x31855A47,0x5A473185,0x31851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x834D834D,0x8C1B834D,0x834D834D,0x5A47834D,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x834D8C1B,0x834D834D,0x834D834D,0x834D834D,0x31850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x834D834D,0x8C1B8C1B,0x834D834D,0x834D5A47,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x210939D1,0x5A958C1B,0x834D834D,0x834D5A95,0x5A4739D1,0x39D1294B,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0x39D18C1B,0x8C1BADAD,0x8C1B834D,0x5A95834D,0x5A47294B,0x294B294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x294B294B,0x294B3185,0x39D139D1,0x5A475A95,0x5A958C1B,0x8C1B5A95,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x1085294B,0x210939D1,0x294B3185,0x294B294B,0x39D1294B,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x21092109,0x21092109,0x21092109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x2109294B,0x21092109,0x21092109,0x21091085,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294B,0x294B39D1,0x39D1294B,0x21092109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10855A95,0x5A955A95,0x39D139D1,0x39D139D1,0x294B294B,0x294B294B,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x39D15A95,0x39D15A95,0x5A955A95,0x5A9539D1,0x294B294B,0x294B294B,0x294B294B,0x21091085,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139D1,0x39D15A95,0x8C1BADAD,0xADADADAD,0x8C1B39D1,0x294B2109,0x21092109,0x21092109,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210939D1,0x39D15A95,0xADADADAD,0xADADADAD,0xADAD39D1,0x294B2109,0x21092109,0x21092109,0x21092109,0x21092109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0x39D15A95,0xADADADAD,0xADADADAD,0x5A95294B,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B39D1,0x39D139D1,0x39D15A95,0x8C1B5A95,0x39D13185,0x5A473185,0x21092109,0x21092109,0x21092109,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B294B,0x31855A47,0x39D1294B,0x294B3185,0x5A472109,0x21092109,0x21092109,0x2109294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x294B39D1,0x294B294B,0x31853185,0x3185294B,0x21095A47,0x294B2109,0x21092109,0x21092109,0x21092109,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B294B,0x21092109,0x39D12425,0x24252425,0x242539D1,0x31852109,0x21092109,0x21092109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x294B294B,0x294B2109,0x294B2425,0x136D273F,0x273F273F,0x273F2425,0x5A953185,0x21092109,0x2109294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B2109,0x2425273F,0x136D2425,0xADADADAD,0x8C1B834D,0x5A47834D,0x5A472109,0x21092109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x21092109,0x24252425,0x136D136D,0x5A9539D1,0x294B3185,0x10853185,0x5A473185,0x21092109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x2109294B,0x294B2109,0x2109294B,0x294B2109,0x21092109,0x21092109,0x21092109,0x31855A47,0x3185294B,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x2109294B,0x294B2109,0x21092109,0x5A475A47,0x21092109,0x21092109,0x2109294B,0x294B2109,0x31853185,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294B,0x294B2109,0x21092109,0x5A473185,0x21092109,0x210939D1,0x5A958C1B,0x39D139D1,0x31853185,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294B,0x294B294B,0x294B3185,0x5A473185,0x2109294B,0x294B294B,0x39D15A95,0x5A9539D1,0x39D1294B,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x2109294B,0x294B294B,0x5A473185,0x294B294B,0x294B294B,0x39D139D1,0x5A955A95,0x5A95294B,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x21092109,0x21093185,0x5A47294B,0x294B294B,0x294B39D1,0x39D18C1B,0xADADADAD,0x8C1B294B,0x294B2109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x21092109,0x21092109,0x31852109,0x294B294B,0x294B294B,0x5A958C1B,0x8C1B5A95,0x39D1294B,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBottleMilkHalf {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39453945,0x394572CB,0x39453945,0x39451085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x93D193D1,0x93D193D1,0x72CB72CB,0x72CB72CB,0x39450001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x93D193D1,0x93D193D1,0x72CB72CB,0x72CB72CB,0x39450001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x72CB93D1,0x93D193D1,0x93D193D1,0x72CB72CB,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C718C7,0x2109318D,0x318D93D1,0x6B5B93D1,0x72CB72CB,0x72CB318D,0x318D318D,0x18C71085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x2109318D,0x318D4A53,0x8C638C63,0x72CB72CB,0x4A5372CB,0x4A53318D,0x21092109,0x210918C7,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C72109,0x2109318D,0x2109318D,0x318D4A53,0x72CB4A53,0x318D6B5B,0x6B5B4A53,0x21092109,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x2109318D,0x318D3945,0x21093945,0x318D318D,0x18C718C7,0x10851085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x18C72109,0x18C718C7,0x21092109,0x210918C7,0x18C71085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x21092109,0x210918C7,0x210918C7,0x18C718C7,0x18C71085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109318D,0x4A53318D,0x21092109,0x18C72109,0x2109318D,0x21091085,0x08430001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x1085318D,0x4A536B5B,0x8C636B5B,0x4A534A53,0x4A534A53,0x4A536B5B,0x6B5B318D,0x18C70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x318D318D,0x8C636B5B,0x6B5B4A53,0x4A534A53,0x318D4A53,0x4A534A53,0x6B5B6B5B,0x318D18C7,0x10850001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x08432109,0x318D6B5B,0x6B5B8C63,0xCE738C63,0x318D2109,0x21092109,0x21092109,0x21094A53,0x6B5B318D,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C7318D,0x4A538C63,0x6B5BCE73,0xCE73CE73,0x4A532109,0x21092109,0x21092109,0x210918C7,0x4A534A53,0x18C71085,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21094A53,0x8C634A53,0x6B5BCE73,0xCE738C63,0x6B5B4A53,0x4A534A53,0x4A53318D,0x4A53318D,0x318D6B5B,0x210918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x318D318D,0x8C63CE73,0xCE73FFFF,0xCE73FFFF,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x4A5318C7,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21094A53,0x8C63CE73,0xCE73CE73,0xFFFFCE73,0xFFFFCE73,0xFFFFCE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x4A5318C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x318D6B5B,0x8C63CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C63CE73,0xCE736B5B,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21098C63,0x8C6319BD,0x19BDFFFF,0x19BD19BD,0xCE7319BD,0xFFFF19BD,0xCE73CE73,0x19BD8C63,0x19BD19BD,0x8C6318C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21098C63,0x8C6319BD,0x19BDCE73,0x19BD19BD,0xCE7319BD,0xCE7319BD,0xCE73CE73,0x19BD19BD,0x19BD6B5B,0x8C6318C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x8C6319BD,0x19BD19BD,0x19BD19BD,0xCE7319BD,0xCE7319BD,0xCE73CE73,0x19BD19BD,0x19BD8C63,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x6B5B19BD,0x19BD19BD,0x19BD19BD,0xCE7319BD,0xCE7319BD,0xCE73CE73,0x19BD8C63,0x19BD6B5B,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x72CB19BD,0xCE7319BD,0x8C6319BD,0xCE7319BD,0xCE7319BD,0x19BD19BD,0x19BDCE73,0x19BD19BD,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x6B5BCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE736B5B,0x4A532109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109318D,0x8C638C63,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C636B5B,0x4A532109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21092109,0x6B5B4A53,0x6B5B6B5B,0x6B5B8C63,0x8C638C63,0x6B5B8C63,0x8C63CE73,0x8C636B5B,0x6B5B6B5B,0x318D2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C72109,0x318D318D,0x318D318D,0x4A534A53,0x318D4A53,0x4A534A53,0x318D318D,0x4A534A53,0x318D2109,0x210918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x108518C7,0x21092109,0x21092109,0x318D2109,0x318D318D,0x318D318D,0x318D4A53,0x6B5B8C63,0x318D2109,0x210918C7,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C718C7,0x318D318D,0x2109318D,0x318D318D,0x318D318D,0x4A536B5B,0x6B5B6B5B,0x318D2109,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x00010001,0x00010001,0x00011085,0x10850843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dBottlePoe {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x29032903,0x29035A49,0x5A492903,0x29031085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x834D834D,0x94A3834D,0x834D834D,0x5A49834D,0x29030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012903,0x834DBDC3,0x834D834D,0x834D834D,0x834D834D,0x29030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x834D834D,0x94A394A3,0x834D834D,0x834D5A49,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x210939D1,0x525B94A3,0x834D834D,0x834D834D,0x5A4939D1,0x39D1294B,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0x39D17B9D,0x94A394A3,0x7B9D834D,0x39D1834D,0x39D1294B,0x294B2109,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x294B294B,0x294B39D1,0x39D15A49,0x5A4939D1,0x7B9D7B9D,0x94A3525B,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294B,0x2109294B,0x294B294B,0x294B39D1,0x294B2109,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x2109294B,0x29032109,0x21092109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x2109294B,0x21092109,0x21092109,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x2109294B,0x21092109,0x21092109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x108539D1,0x39D1294B,0x294B294B,0x2109294B,0x294B294B,0x294B294B,0x294B2109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x39D139D1,0x39D1525B,0x294B294B,0x294B294B,0x294B294B,0x2109294B,0x294B2109,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139D1,0x39D139D1,0x94A3BDEF,0x7B9D294B,0x294B7B9D,0x94A3BDEF,0xBDEF525B,0x21092109,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210939D1,0x294B94A3,0xBDEF94A3,0x525B294B,0xBDEFFFFF,0xFFFFFFFF,0xFFFFFFFF,0x94A32109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B39D1,0x294BBDEF,0x94A37B9D,0x7B9DBDEF,0xFFFFFFFF,0x7B9D94A3,0xBDEFFFFF,0xFFFF7B9D,0x21092109,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x39D17B9D,0x21092109,0xBDEFBDEF,0xBDEF2109,0x00011085,0x7B9DFFFF,0xFFFFFFFF,0x21092109,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B294B,0x2109294B,0x294B5A49,0x00015A49,0xBDC3BDC3,0x1085BDEF,0xFFFFFFFF,0x525B294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x294B39D1,0x294B294B,0x294B1085,0xBDC3BDC3,0x1085BDC3,0xBDC32903,0x0001BDEF,0xFFFF7B9D,0x94A32109,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B2109,0x21092109,0x10852903,0x00011085,0x00011085,0x0001BDEF,0xBDEF7B9D,0x7B9D294B,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x294B294B,0x294B2109,0x294B294B,0x525B0001,0x2109294B,0x39D1525B,0x94A394A3,0x7B9D39D1,0x94A32109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x294B294B,0x525B72F3,0x72F3525B,0x94A394A3,0xBDEFFFFF,0xBDEF525B,0x39D17B9D,0x39D12109,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x2109294B,0x294B1085,0x525B294B,0x525B72F3,0x72F3525B,0x525B525B,0x525B525B,0x525B525B,0x21092109,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x294B294B,0x10851085,0xBDC37B9D,0x10852109,0x525B72F3,0x72F372F3,0x72F372F3,0x72F372F3,0x39D139D1,0x294B2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x2109294B,0x0001834D,0xBDC3BDC3,0x2109294B,0x525B72F3,0x72F372F3,0x72F372F3,0x72F372F3,0x72F3525B,0x21092109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x00012903,0x00012903,0x0001294B,0x294B72F3,0x72F372F3,0x72F372F3,0x72F32109,0x294B294B,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294B,0x00015A49,0xBDC35A49,0x1085294B,0x210939D1,0x294B2109,0x294B525B,0x525B525B,0x294B294B,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21092109,0x21092903,0x5A492903,0x2109294B,0x294B294B,0x525B2109,0x39D139D1,0x39D172F3,0x525B294B,0x294B2109,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x21092109,0x10852109,0x294B294B,0x294B294B,0x294B294B,0x39D17B9D,0xBDEFBDEF,0x7B9D39D1,0x21092109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x10852109,0x21092109,0x21092109,0x294B294B,0x294B294B,0x525B7B9D,0x7B9D7B9D,0x39D1294B,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBrokenBiggoron {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08890001,0x00010001,0x00010001,0x08859D2D,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010043,0x257F4A9D,0x00010001,0x00010885,0xFFFFFFFF,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010885,0x257F257F,0x09630001,0x0889FFFF,0xFFFFFFFF,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010885,0x257F257F,0x257F1237,0x9D2DFFFF,0xFFFFFFFF,0x4A9D4A9D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001218F,0x257F1237,0x1237257F,0x9D2DB4D7,0xCDE76BE3,0x4A9D4A9D,0x4A9D0889,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010043,0x218F0963,0x12371237,0xCDE79D2D,0xB4D76BE3,0x6BE34A9D,0x08890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4A9D6BE3,0xCDE79D2D,0xCDE772CB,0x4A9D0889,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010889,0x6BE39D2D,0x72CB6BE3,0x6BE31237,0x09630001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08856BE3,0x9D2D218F,0x218F1237,0x257F257F,0x12370889,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6BE39D2D,0x4A9D218F,0x218F0963,0x12371237,0x12371237,0x08850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08896BE3,0x9D2D4A9D,0x218F218F,0x00010885,0x12371237,0x12371237,0x09630001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010043,0x1237257F,0x4A9D218F,0x00430001,0x00010001,0x09631237,0x09630963,0x09630001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001218F,0x257F1237,0x1237218F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00430963,0x12371237,0x08890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010889,0x00430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSkullMask {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420F,0x5AD31885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019CA1,0x9CA19CA1,0x18850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019CA1,0x9CA19CA1,0x9CA10843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10839CA1,0x9CA1B5A7,0xB5A72909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08439CA1,0xB5A79CA1,0xB5A77B99,0x08430001,0x00010001,0x084318C7,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019CA1,0x9CA1B5A7,0x9CA17B99,0x420F0001,0x08437B99,0xFFFFE6F1,0xE6F1420F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x9CA19CA1,0x9CA17B99,0x7B995AD3,0xB5A7FFFF,0xFFFFFFFF,0xE6F1E6F1,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18855AD3,0x5AD37B99,0x7B997B99,0xB5A7FFFF,0xFFFFFFFF,0xFFFFE6F1,0xB5A71885,0x00010001,0x00010001,0x00010843,0x00010001,0x00010001,0x00010843,0x08430001,0x00010001,0x00010001,0x00010843,0x0843318B,0x5AD37B99,0x420FE6F1,0xFFFFFFFF,0xFFFFFFFF,0xE6F1E6F1,0x318B318B,0x420F5AD3,0x9CA1E6F1,0xE6F17B99,0x084318C7,0x9CA1B5A7,0x9CA11083,0x00010001,0x00010001,0x00010001,0x1083318B,0x420F420F,0x318B5AD3,0xFFFFFFFF,0xFFFFFFFF,0xFFFFE6F1,0xE6F1E6F1,0xE6F1FFFF,0xFFFFE6F1,0xE6F1E6F1,0xB5A7B5A7,0x9CA17B99,0x7B99420F,0x00010001,0x00010001,0x00010001,0x5AD3420F,0x420F318B,0x420F9CA1,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xE6F1E6F1,0xE6F1B5A7,0xB5A79CA1,0x9CA17B99,0x7B995AD3,0x00010001,0x00010001,0x00011083,0xE6F1B5A7,0x7B997B99,0xB5A7FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFE6F1,0xE6F1B5A7,0x9CA19CA1,0x9CA19CA1,0x9CA15AD3,0x00010001,0x00010001,0x0001318B,0xE6F1FFFF,0xFFFF5AD3,0x18C7318B,0xE6F1E6F1,0xE6F1E6F1,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xE6F1E6F1,0xE6F19CA1,0x7B999CA1,0x9CA19CA1,0x9CA11885,0x00010001,0x00010001,0x00015AD3,0xE6F1FFFF,0x5AD30843,0x00010001,0x420FFFFF,0x9CA1B5A7,0xB5A7E6F1,0xE6F1E6F1,0xFFFFFFFF,0xE6F1E6F1,0xE6F17B99,0x7B997B99,0x9CA19CA1,0x29090001,0x00010001,0x00010001,0x0001420F,0xE6F1E6F1,0x29090001,0x00010001,0x420FFFFF,0xE6F1B5A7,0x9CA19CA1,0xB5A7FFFF,0xE6F1E6F1,0xE6F1E6F1,0xE6F19CA1,0x7B995AD3,0x318B0843,0x00010001,0x00010001,0x00010001,0x00012909,0xB5A7E6F1,0x420F0001,0x0001318B,0xFFFFFFFF,0xFFFFFFFF,0xFFFFE6F1,0xE6F1420F,0x29095AD3,0xB5A7E6F1,0xE6F1B5A7,0x9CA15AD3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0xB5A7E6F1,0xB5A79CA1,0x9CA1FFFF,0xFFFFFFFF,0xE6F1FFFF,0xFFFFE6F1,0x420F0001,0x00010843,0x5AD3E6F1,0xB5A7B5A7,0x9CA15AD3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x420F9CA1,0xB5A7E6F1,0xE6F1E6F1,0xE6F1FFFF,0xE6F1B5A7,0xE6F1E6F1,0x10830001,0x00010001,0x2909B5A7,0xB5A7B5A7,0x9CA1318B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420F,0x9CA19CA1,0xB5A7B5A7,0xB5A77B99,0x9CA1B5A7,0xB5A7E6F1,0x318B0001,0x00010001,0x5AD3B5A7,0xB5A79CA1,0x7B990843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x420F7B99,0x9CA19CA1,0x5AD3420F,0x318B9CA1,0xB5A7B5A7,0xB5A75AD3,0x420F7B99,0xB5A7B5A7,0x9CA19CA1,0x318B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08431885,0x7B997B99,0x29090843,0x00017B99,0x9CA19CA1,0x9CA19CA1,0xB5A79CA1,0xB5A7B5A7,0x9CA1420F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019CA1,0x9CA19CA1,0x420F5AD3,0x00015AD3,0x7B997B99,0x9CA17B99,0x9CA19CA1,0x9CA19CA1,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x318BFFFF,0xE6F1B5A7,0xB5A79CA1,0x7B997B99,0x7B997B99,0x5AD35AD3,0x7B995AD3,0x5AD30843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C79CA1,0xB5A7E6F1,0x9CA19CA1,0x9CA19CA1,0xB5A75AD3,0x18C70843,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0xFFFFE6F1,0x9CA1E6F1,0xE6F1B5A7,0xE6F1B5A7,0x18C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x9CA1B5A7,0x9CA1FFFF,0xE6F1B5A7,0x9CA1B5A7,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1885420F,0x18C7B5A7,0xB5A7318B,0x18C72909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08430843,0x18C70843,0x08430843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSOLDOUT {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5295BDEF,0xBDEFBDEF,0x84210001,0x00011085,0x9CE7BDEF,0xBDEF9CE7,0x21090001,0x318DBDEF,0x6B5B0001,0x00010001,0x318DBDEF,0xBDEFBDEF,0x9CE76B5B,0x00010001,0x00010001,0x0001318D,0xFFFFFFFF,0xEF7BEF7B,0xFFFF6B5B,0x1085D6B5,0xFFFFFFFF,0xFFFFFFFF,0xEF7B2109,0x4211FFFF,0x84210001,0x00010001,0x4211FFFF,0xFFFFFFFF,0xFFFFFFFF,0xD6B51085,0x00010001,0x00018421,0xFFFF6B5B,0x00011085,0xBDEF318D,0x8421FFFF,0xBDEF0001,0x00019CE7,0xFFFF9CE7,0x4211FFFF,0x84210001,0x00010001,0x4211FFFF,0x84210001,0x2109D6B5,0xFFFF8421,0x00010001,0x00016B5B,0xFFFFEF7B,0x8C63318D,0x00010001,0xBDEFFFFF,0x318D0001,0x00011085,0xFFFFEF7B,0x4211FFFF,0x84210001,0x00010001,0x4211FFFF,0x84210001,0x00012109,0xFFFFD6B5,0x00010001,0x00010001,0x8C63FFFF,0xFFFFFFFF,0xBDEF1085,0xBDEFFFFF,0x00010001,0x00010001,0xFFFFFFFF,0x4211FFFF,0x84210001,0x00010001,0x4211FFFF,0x84210001,0x00010001,0xFFFFFFFF,0x00010001,0x00010001,0x00012109,0x6B5BD6B5,0xFFFFAD6B,0xBDEFFFFF,0x21090001,0x00010001,0xFFFFFFFF,0x4211FFFF,0x84210001,0x00010001,0x4211FFFF,0x84210001,0x00011085,0xFFFFFFFF,0x00010001,0x00016B5B,0xD6B51085,0x00011085,0xFFFFBDEF,0x9CE7FFFF,0x84210001,0x00016B5B,0xFFFFBDEF,0x4211FFFF,0x84210001,0x00010001,0x4211FFFF,0x84210001,0x00018421,0xFFFFAD6B,0x00010001,0x00019CE7,0xFFFFD6B5,0x6B5BAD6B,0xFFFFAD6B,0x318DFFFF,0xFFFF8C63,0x8421EF7B,0xFFFF5295,0x4211FFFF,0xD6B5BDEF,0xBDEFBDEF,0x6B5BFFFF,0xBDEF8421,0xBDEFFFFF,0xFFFF318D,0x00010001,0x00011085,0xBDEFFFFF,0xFFFFFFFF,0xD6B5318D,0x00016B5B,0xEF7BFFFF,0xFFFFFFFF,0x84210001,0x4211FFFF,0xFFFFFFFF,0xFFFFFFFF,0x8421FFFF,0xFFFFFFFF,0xFFFFD6B5,0x42110001,0x00010001,0x00010001,0x0001318D,0x42114211,0x00010001,0x00010001,0x00014211,0x42111085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21094211,0x42110001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018C63,0xFFFFFFFF,0xFFFFEF7B,0x52950001,0xBDEFFFFF,0x42110001,0x00018421,0xFFFFBDEF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8421FFFF,0xEF7B6B5B,0x8C63FFFF,0xEF7B2109,0xBDEFFFFF,0x42110001,0x00018421,0xFFFF8421,0x84219CE7,0xFFFFD6B5,0x84218421,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xEF7BFFFF,0x318D0001,0x00019CE7,0xFFFF6B5B,0xBDEFFFFF,0x42110001,0x00018421,0xFFFF4211,0x00014211,0xFFFFBDEF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0xFFFFD6B5,0x00010001,0x00014211,0xFFFFBDEF,0xBDEFFFFF,0x42110001,0x00018421,0xFFFF4211,0x00014211,0xFFFFBDEF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001318D,0xFFFFBDEF,0x00010001,0x00014211,0xFFFFBDEF,0xBDEFFFFF,0x42110001,0x00018421,0xFFFF4211,0x00014211,0xFFFFBDEF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFFEF7B,0x00010001,0x00016B5B,0xFFFF9CE7,0xBDEFFFFF,0x42110001,0x00018C63,0xFFFF4211,0x00014211,0xFFFFBDEF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBDEFFFFF,0x6B5B0001,0x1085D6B5,0xFFFF6B5B,0x8C63FFFF,0x84210001,0x1085EF7B,0xFFFF318D,0x00014211,0xFFFFBDEF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x318DEF7B,0xFFFFEF7B,0xEF7BFFFF,0xBDEF0001,0x318DFFFF,0xFFFFEF7B,0xEF7BFFFF,0xBDEF0001,0x00014211,0xFFFFBDEF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001318D,0xAD6BBDEF,0xBDEF8421,0x10850001,0x0001318D,0xAD6BBDEF,0xBDEF8421,0x10850001,0x0001318D,0xBDEF8C63,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSpookyMask {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x08411081,0x08410841,0x108118C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41C57B0D,0x6A896A89,0x398541C5,0x52075207,0x21031081,0x18C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A89,0x93D16A89,0x6A896A89,0x93D16A89,0x6A893143,0x18C33143,0x52073143,0x18C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x6A896A89,0x41C57B0D,0x52076A89,0x7B0D7B0D,0x7B0D3985,0x31437B0D,0x52076A89,0x39852103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A89,0x39853985,0x52077B0D,0x6A896A89,0x6A8993D1,0x6A8941C5,0x41C57B0D,0x41C55207,0x6A893985,0x52070841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41C55207,0x31433143,0x18C318C3,0x41C55207,0x7B0D6A89,0x7B0D6A89,0x41C541C5,0x520741C5,0x7B0D41C5,0x41C55207,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x6A8941C5,0x31430841,0x00010841,0x31436A89,0x93D193D1,0x6A8993D1,0x52073143,0x7B0D6A89,0x52076A89,0x398541C5,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141C5,0x39853985,0x10810001,0x00010001,0x18C37B0D,0x93D193D1,0x7B0D93D1,0x6A895207,0x52075207,0x520793D1,0x39853143,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x08016A89,0x314341C5,0x08410001,0x00010001,0x52075207,0x6A897B0D,0x6A8993D1,0x41C53143,0x18C318C3,0x41C57B0D,0x41C52103,0x21030001,0x00010001,0x00010001,0x00010001,0x00010001,0x10815207,0x31433985,0x18C30001,0x00013143,0x52076A89,0x6A8941C5,0x93D141C5,0x18C30001,0x00010801,0x314393D1,0x6A8918C3,0x21030001,0x00010001,0x00010001,0x00010001,0x00010001,0x39855207,0x21036A89,0x6A8918C3,0x31433143,0x7B0D6A89,0x39855207,0x93D13143,0x08010001,0x00010001,0x41C593D1,0x52071081,0x21030001,0x00010001,0x00010001,0x00010001,0x00011081,0x520741C5,0x52076A89,0x52076A89,0x31435207,0x6A8941C5,0x18C36A89,0x93D13143,0x08410001,0x00010001,0x41C593D1,0x398518C3,0x18C30001,0x00010001,0x00010001,0x00010001,0x000118C3,0x6A893985,0x93D17B0D,0x7B0D6A89,0x210393D1,0x6A8941C5,0x31433985,0x39853985,0x10810001,0x000118C3,0x7B0D7B0D,0x210318C3,0x08010001,0x00010001,0x00010001,0x00010001,0x00013143,0x6A893143,0x6A8941C5,0x7B0D6A89,0x6A8993D1,0x7B0D6A89,0x21031081,0x21036A89,0x41C53143,0x21036A89,0x93D15207,0x18C318C3,0x00010001,0x00010001,0x00010001,0x00010001,0x000141C5,0x52073143,0x41C541C5,0x6A895207,0x6A896A89,0x7B0D6A89,0x41C51081,0x52077B0D,0x39856A89,0x314341C5,0x6A892103,0x18C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00013985,0x31435207,0x41C541C5,0x41C55207,0x6A8941C5,0x398541C5,0x398518C3,0x520741C5,0x6A895207,0x31433985,0x21033985,0x21030001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141C5,0x39857B0D,0x41C53985,0x39855207,0x31432103,0x108141C5,0x41C518C3,0x21035207,0x52073143,0x41C53985,0x52073985,0x18C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x39856A89,0x41C53985,0x52075207,0x10810001,0x000141C5,0x314318C3,0x39853143,0x18C33985,0x6A8941C5,0x520741C5,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x314341C5,0x41C53985,0x6A8941C5,0x00010001,0x00013143,0x210318C3,0x39852103,0x398541C5,0x6A895207,0x39853985,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x41C53985,0x39853143,0x6A892103,0x00010001,0x00012103,0x21033143,0x41C56A89,0x52072103,0x210341C5,0x39850841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21033985,0x41C52103,0x520718C3,0x00010001,0x08412103,0x398541C5,0x41C55207,0x314318C3,0x39853985,0x18C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08012103,0x39853143,0x41C53985,0x08410001,0x41C53143,0x520741C5,0x41C53143,0x18C32103,0x314318C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012103,0x39853985,0x398541C5,0x39853143,0x39855207,0x41C53985,0x31432103,0x10812103,0x21030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21033143,0x31433985,0x398541C5,0x41C55207,0x41C53985,0x39851081,0x18C30801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012103,0x21033985,0x39855207,0x520741C5,0x41C52103,0x18C31081,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x21033985,0x41C541C5,0x39853143,0x18C30841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10813143,0x41C53143,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dWeirdEgg {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x49877BDB,0x7BDB2109,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987FFFF,0xFFFFFFFF,0xC62DC62D,0x9CE32109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017BDB,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC62D,0xC62D9CE3,0x49870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x2109FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC62D,0xC62D9CE3,0x9CE31885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC62D,0xC62D9CE3,0x9CE37BDB,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC62DC62D,0xC62D9CE3,0x9CE37BDB,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C62D,0xC62DFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC62DC62D,0xC62D9CE3,0x9CE37BDB,0x6A490801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1041C62D,0xFFFFC62D,0xFFFFFFFF,0xFFFFC62D,0xC62DC62D,0x9CE39CE3,0x7BDB7BDB,0x7BDB1885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109C62D,0xC62DC62D,0xFFFFC62D,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0x9CE37BDB,0x7BDB2109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987C62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0x7BDB7BDB,0x7BDB4987,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x4987C62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0x7BDB7BDB,0x7BDB6A49,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x49879CE3,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0xC62DFFFF,0xC62DC62D,0x9CE37BDB,0x7BDB4987,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49879CE3,0x9CE39CE3,0xC62D9CE3,0x9CE3C62D,0xC62DC62D,0xFFFFC62D,0x7BDB7BDB,0x7BDB7BDB,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10414987,0x6A499CE3,0x9CE39CE3,0x9CE3C62D,0x9CE39CE3,0xC62DFFFF,0xC62DC62D,0x9CE37BDB,0x7BDB1885,0x31030801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0x8B09D4CF,0x8B097BDB,0x9CE39CE3,0x9CE39CE3,0x9CE39CE3,0x9CE3C62D,0xC62D9CE3,0x9CE37BDB,0x7BDB3103,0x49873103,0x31030801,0x00010001,0x00010001,0x00010001,0x00010001,0xD4CFABCD,0x6A498B09,0xD4CF6A49,0x7BDB7BDB,0x9CE37BDB,0x9CE37BDB,0x7BDBC62D,0xC62D9CE3,0x7BDB7BDB,0x21094987,0x49874987,0x49876A49,0x08010001,0x00010001,0x00010001,0x00010001,0x3103D4CF,0xABCD8B09,0xABCDD4CF,0xABCD7BDB,0x7BDB7BDB,0x7BDB7BDB,0x7BDB6A49,0x7BDB6A49,0x7BDB6A49,0x49878B09,0x6A493103,0x6A493103,0x00010001,0x00010001,0x00010001,0x00010001,0x8B098B09,0xD4CF8B09,0x6A498B09,0x8B09ABCD,0xD4CFABCD,0xABCD8B09,0xABCD7BDB,0x8B098B09,0x8B094987,0x6A494987,0x49878B09,0x8B094987,0x18850001,0x00010001,0x00010001,0x00010801,0x8B096A49,0xABCDD4CF,0xD4CF8B09,0xABCDABCD,0x8B096A49,0x49876A49,0x49874987,0x8B098B09,0x49878B09,0x8B09ABCD,0x6A498B09,0xABCD3103,0x08010001,0x00010001,0x00010001,0x00010801,0x49876A49,0x8B09ABCD,0xABCDD4CF,0xD4CFABCD,0x8B098B09,0xD4CFABCD,0xD4CFABCD,0x8B094987,0x8B09ABCD,0x8B093103,0x3103ABCD,0x6A493103,0x10410001,0x00010001,0x00010001,0x00010001,0x4987ABCD,0x6A496A49,0x49874987,0xABCDABCD,0xABCD8B09,0x8B098B09,0xD4CFABCD,0xD4CFABCD,0xABCD8B09,0x31038B09,0xABCD6A49,0x8B094987,0x08010001,0x00010001,0x00010001,0x00010001,0x10413103,0x31036A49,0xABCDD4CF,0xABCD6A49,0x6A494987,0xABCD6A49,0x6A496A49,0x8B098B09,0x49874987,0x8B09ABCD,0x6A496A49,0x31031041,0x00010001,0x00010001,0x00010001,0x00010001,0x08010801,0x08010801,0x4987ABCD,0x6A498B09,0x8B098B09,0xD4CFABCD,0xABCDABCD,0x8B094987,0x31034987,0x6A494987,0x31033103,0x10410801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A49,0x8B09ABCD,0x8B098B09,0x8B096A49,0x6A496A49,0x8B091041,0x08013103,0x49870801,0x08010801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08010001,0x00014987,0x31030001,0x00011041,0x31030001,0x00010001,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dZeldaLedder {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08432949,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141CD,0xCDA9CDA9,0xB49F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015A93,0xCDA9CDA9,0xCDA9CDA9,0xCDA9B49F,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015A93,0xCDA9CDA9,0xCDA9CDA9,0xCDA97B9B,0xB49FCDA9,0x7B9B0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0xB49FCDA9,0xCDA9B49F,0x7B9B7B9B,0x5A935A93,0xCDA9CDA9,0xCDA97B9B,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0xCDA9CDA9,0xCDA9CDA9,0x7B9B7B9B,0xB49FB49F,0xB49FCDA9,0xCDA9CDA9,0xCDA9CDA9,0x7B9B18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0x7B9BCDA9,0xCDA9CDA9,0xCDA9B49F,0xB49FCDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0x5A93CDA9,0xCDA9CDA9,0xCDA9B49F,0xB49FB49F,0xCDA9CDA9,0xCDA9B49F,0xC949B49F,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA91085,0x00010001,0x00010001,0x00010001,0x00010843,0xB49FCDA9,0xCDA9CDA9,0x7B9BB49F,0xCDA9B49F,0xB49FB49F,0xB49FCDA9,0xCDA9B49F,0xC949C949,0xC949CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0x18C70001,0x00010001,0x00010843,0x5A93CDA9,0xCDA9CDA9,0xCDA941CD,0xB49FCDA9,0xCDA9CDA9,0xCDA9CDA9,0xC949C949,0xCDA9CDA9,0xC949C949,0xC949CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA92949,0x00010001,0x18C7CDA9,0xCDA9CDA9,0xCDA9CDA9,0x7B9B7B9B,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xC949C949,0xB49FB49F,0xC949B49F,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xB49F7B9B,0xCDA9CDA9,0x18C70001,0x08437B9B,0xCDA9CDA9,0xB49F5A93,0x7B9BCDA9,0xCDA9CDA9,0xC949C949,0xB49FB49F,0xCDA9B49F,0xC949C949,0xB49FCDA9,0xCDA9CDA9,0xCDA97B9B,0x7B9B41CD,0x5A93B49F,0xCDA95A93,0x00010001,0x00012109,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xB49FC949,0xC949C949,0xC949B49F,0xC949C949,0xC949CDA9,0xCDA9B49F,0x7B9BB49F,0xCDA9CDA9,0xCDA97B9B,0x29490001,0x00010001,0x00011083,0x5A93B49F,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9C949,0xC949C949,0xB49FCDA9,0xCDA9C949,0xC949CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9B49F,0x7B9B18C7,0x00010001,0x00010001,0x00010001,0x21097B9B,0x7B9BCDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0x7B9B7B9B,0x7B9B5A93,0x10830001,0x00010001,0x00010001,0x00015A93,0x7B9B7B9B,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA97B9B,0xB49FCDA9,0xCDA9CDA9,0xCDA9CDA9,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x10830001,0x00010001,0x00010001,0x00011085,0x7B9B7B9B,0x7B9BCDA9,0xCDA9CDA9,0xCDA9CDA9,0xCDA9CDA9,0xB49F7B9B,0xCDA9CDA9,0xCDA9CDA9,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B1083,0x00010001,0x00010001,0x00010001,0x00010001,0x41CD7B9B,0x7B9B7B9B,0xCDA9CDA9,0xCDA9CDA9,0xCDA97B9B,0x2949CDA9,0xCDA9CDA9,0xB49F7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B9B,0x7B9B7B9B,0x7B9BCDA9,0xCDA9CDA9,0xB49F7B9B,0xCDA9CDA9,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B1083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0x7B9B7B9B,0x7B9B7B9B,0xCDA9CDA9,0xCDA9CDA9,0xB49F7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B398B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7B9B7B9B,0x7B9B7B9B,0x7B9BB49F,0xB49F7B9B,0x7B9B7B9B,0x7B9B7B9B,0x5A93398B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21097B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x5A93398B,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015A93,0x7B9B7B9B,0x7B9B7B9B,0x7B9B7B9B,0x7B9B5A93,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x7B9B7B9B,0x7B9B7B9B,0x7B9B41CD,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5A937B9B,0x7B9B5A93,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x084341CD,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dZoraMask {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x298D3A53,0x3A533A53,0x3A53214B,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4B19C6F7,0xC6F7FFFF,0xFFFFFFFF,0xC6F7C6F7,0xA5AD6BDF,0x214B0043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x214BC6F7,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC6F7,0xC6F7C6F7,0xC6F7A5AD,0x3A530043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0xA5ADFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC6F7C6F7,0xC6F7C6F7,0xC6F7A5AD,0xA5AD6BDF,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000184A5,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC6F7,0xC6F7C6F7,0xC6F7C6F7,0xA5ADA5AD,0xA5ADA5AD,0x84A5214B,0x00010001,0x00010001,0x00010001,0x00010001,0x18C70001,0x00010001,0x6BDFA5AD,0xA5ADFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC6F7,0xC6F7C6F7,0xC6F7C6F7,0xC6F7A5AD,0xA5ADA5AD,0x84A56BDF,0x214B0001,0x00010001,0x00010001,0x00010001,0x004384A5,0x00433A53,0x84A5A5AD,0x298D3A53,0x4B19C6F7,0xFFFFFFFF,0xC6F7C6F7,0xC6F7C6F7,0xC6F7A5AD,0xA5ADA5AD,0xA5ADA5AD,0x84A584A5,0x6BDF3A53,0x00430001,0x00010001,0x00010001,0x00013A53,0xA5ADA5AD,0xA5AD3A53,0x84A5214B,0x298D84A5,0xFFFFFFFF,0xC6F7A5AD,0xA5ADA5AD,0xA5ADA5AD,0xA5ADA5AD,0xA5ADA5AD,0x84A584A5,0x4B196BDF,0x3A530001,0x00010001,0x00010001,0x00010001,0x298D84A5,0xC6F73A53,0x3A5318C7,0x298D84A5,0xFFFFC6F7,0xA5AD84A5,0x84A584A5,0x84A5A5AD,0xA5ADA5AD,0xA5AD84A5,0x84A584A5,0x6BDF6BDF,0x4B19214B,0x00010001,0x00010001,0x00010001,0x00433A53,0xA5AD6BDF,0x4B196BDF,0xA5ADA5AD,0xC6F784A5,0x6BDF4B19,0x214B18C7,0x18C7214B,0x3A536BDF,0x84A584A5,0x84A56BDF,0x4B196BDF,0x6BDF3A53,0x00430001,0x00010001,0x00010001,0x0001214B,0xC6F7C6F7,0xA5ADA5AD,0xC6F7C6F7,0x84A56BDF,0x6BDF4B19,0x3A53214B,0x18C7214B,0x4B191085,0x3A534B19,0x6BDF6BDF,0x4B193A53,0x298D0001,0x00010001,0x00010001,0x00010001,0x0001214B,0x84A584A5,0xA5ADA5AD,0xC6F7A5AD,0x6BDF6BDF,0x6BDF6BDF,0x6BDF3A53,0x1085214B,0x3A5318C7,0x3A5384A5,0x6BDF3A53,0x3A53298D,0x00011085,0x10851085,0x00010001,0x00010001,0x000118C7,0x84A5A5AD,0x84A584A5,0x84A56BDF,0x6BDF6BDF,0x6BDF6BDF,0x84A584A5,0x4B19214B,0x18C7214B,0x4B196BDF,0x4B194B19,0x3A533A53,0x298D3A53,0x4B193A53,0x00010001,0x00010001,0x00011085,0xA5ADA5AD,0xA5ADA5AD,0x4B196BDF,0x6BDF6BDF,0x6BDF6BDF,0x84A584A5,0x84A584A5,0x4B194B19,0x6BDFA5AD,0xA5AD84A5,0x84A584A5,0x6BDF4B19,0x4B19214B,0x10850043,0x00010001,0x00010001,0xA5ADFFFF,0xC6F7C6F7,0xA5AD6BDF,0x6BDF84A5,0x6BDF6BDF,0x6BDF84A5,0x84A584A5,0x84A584A5,0x6BDF6BDF,0x6BDF4B19,0x6BDF4B19,0x4B194B19,0x298D3A53,0x00010001,0x00010001,0x00010001,0x84A5C6F7,0xC6F7C6F7,0x84A56BDF,0x6BDF84A5,0x84A584A5,0x6BDF84A5,0x84A584A5,0x84A56BDF,0x6BDF6BDF,0x18C71085,0x298D3A53,0x298D3A53,0x10850001,0x00010001,0x00010001,0x00010001,0x4B19C6F7,0xA5ADC6F7,0xA5AD6BDF,0x84A56BDF,0x6BDF6BDF,0x6BDF84A5,0x84A584A5,0x6BDF6BDF,0x6BDF18C7,0x00010001,0x00010043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C7C6F7,0xC6F7C6F7,0xA5ADA5AD,0x84A56BDF,0x6BDF84A5,0x84A56BDF,0x84A56BDF,0x6BDF6BDF,0x18C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000184A5,0xA5ADC6F7,0xA5ADA5AD,0xA5AD6BDF,0x84A56BDF,0x84A584A5,0x84A56BDF,0x6BDF1085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001298D,0x84A5A5AD,0xA5AD84A5,0x84A5A5AD,0x84A584A5,0x84A56BDF,0x6BDF4B19,0x00430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3A5384A5,0x84A584A5,0x84A584A5,0x84A56BDF,0x6BDF6BDF,0x18C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001298D,0x4B196BDF,0x6BDF6BDF,0x6BDF4B19,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x298D18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBulledBag30 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10830841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x8B4F8B4F,0x41871083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x5A498B4F,0x9C158B4F,0x41874187,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10835A49,0xCE279C15,0x8B4F72CB,0x5A495A49,0x5A493143,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62D5CE27,0xCE2762D5,0xCE27CE27,0x9C1572CB,0x5A4972CB,0x5A494187,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000162D5,0x62D50841,0x5A498B4F,0x9C1562D5,0x62D5CE27,0xCE27CE27,0x62D51083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C31083,0x62D562D5,0x00014187,0x8B4F9C15,0x9C158B4F,0x72CB9C15,0x9C159C15,0x62D50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0xCE27C507,0xC5070001,0x10838B4F,0x9C159C15,0xCE279C15,0x72CB72CB,0x62D5318D,0x4187318D,0x318D0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018B4F,0xCE27C507,0x72CB1083,0x8B4F8B4F,0x8B4F8B4F,0xCE279C15,0x72CB9C15,0x72CB5A49,0x3143318D,0xCE271083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C507,0xC50772CB,0x31435A49,0x8B4F8B4F,0x8B4F8B4F,0x72CB8B4F,0x8B4F72CB,0x72CB4187,0x31430841,0xCE271083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x31433143,0x31439C15,0x8B4F8B4F,0x8B4F72CB,0x8B4F9C15,0x72CB72CB,0x5A494187,0x4187318D,0xFFFF318D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41878B4F,0x72CB8B4F,0x8B4F8B4F,0x72CB72CB,0x5A495A49,0x5A495A49,0x72CBC507,0xC5075A49,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x418772CB,0x5A495A49,0x5A4972CB,0x5A4972CB,0x5A495A49,0x5A495A49,0xC507CE27,0xC507C507,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10835A49,0x72CB5A49,0x72CB8B4F,0x72CB72CB,0x72CB72CB,0x72CB8B4F,0xC507CE27,0xC5078B4F,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015A49,0x72CB72CB,0x8B4F8B4F,0x72CB72CB,0x8B4F72CB,0x72CB4187,0x4187C507,0xC5073143,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x5A4972CB,0x5A495A49,0x72CB72CB,0x5A495A49,0x5A494187,0x20C320C3,0x20C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C34187,0x41875A49,0x41874187,0x41874187,0x41873143,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x31433143,0x41873143,0x41874187,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x108320C3,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBulledBag40 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000149C5,0xA3C949C5,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C38347,0x83476A87,0x49C53143,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C36A87,0x6A876A87,0xA3C98347,0x49C549C5,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x31438347,0x83478347,0x83478347,0x6A876A87,0x6A8749C5,0x31431041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C76A87,0xC515FFFF,0xFFFFC515,0xE65B6A87,0x6A876A87,0x6A8749C5,0x49C50841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x8C1DA3C9,0xA3C96A87,0x8C1D6A87,0x83478C1D,0x8C1D8C1D,0x6A876A87,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B8C1D,0x49C5A3C9,0xA3C9E65B,0xA3C98347,0xA3C9E65B,0xFFFF8C1D,0x8C1D6A87,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xE65BA3C9,0xC51518C7,0xA3C9C515,0xC515A3C9,0xC515A3C9,0x83478347,0x6A878347,0x6A8749C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018347,0xE65BC515,0x83478347,0xA3C9A3C9,0xA3C9E65B,0xE65B8347,0x8347A3C9,0xA3C9A3C9,0x6A8749C5,0x49C518C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A3C9,0xE65BA3C9,0x83478347,0xC515C515,0xC515E65B,0xE65BA3C9,0x83478347,0xA3C96A87,0x49C549C5,0x8C1D294B,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A87,0x834749C5,0x8347A3C9,0xA3C9A3C9,0xA3C9A3C9,0xA3C9A3C9,0xA3C98347,0x83476A87,0x49C518C7,0xFFFF294B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x0001A3C9,0xA3C9A3C9,0xA3C9A3C9,0xA3C9A3C9,0xA3C9A3C9,0x83478347,0x83476A87,0x49C58347,0xE65B1041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1041A3C9,0xA3C9A3C9,0xA3C9A3C9,0x8347A3C9,0xC515A3C9,0x83478347,0x6A876A87,0xA3C9E65B,0xE65BA3C9,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A87A3C9,0xA3C9A3C9,0xC515A3C9,0x83478347,0x83476A87,0x83476A87,0x6A876A87,0xC515E65B,0xE65BA3C9,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xA3C9A3C9,0x83476A87,0x83478347,0x83478347,0x83476A87,0x6A876A87,0x6A878347,0xA3C9E65B,0xC5158347,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x8347A3C9,0x83478347,0x83478347,0x83478347,0x83478347,0x83478347,0x8347A3C9,0x8347A3C9,0x49C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x8347A3C9,0xA3C9C515,0xC515E65B,0xA3C98347,0x83478347,0x83478347,0x8347A3C9,0x49C53143,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x8347A3C9,0xC515E65B,0xE65BC515,0xA3C98347,0x83478347,0xA3C98347,0x834749C5,0x49C51041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49C56A87,0x8347A3C9,0xA3C98347,0x8347A3C9,0x83478347,0x83476A87,0x6A8749C5,0x31430841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08413143,0x6A876A87,0x6A876A87,0x83478347,0x83476A87,0x6A876A87,0x49C549C5,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x20C33143,0x49C56A87,0x49C549C5,0x49C549C5,0x49C56A87,0x6A8749C5,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C33143,0x49C549C5,0x49C549C5,0x49C56A87,0x49C520C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08411041,0x104120C3,0x31433143,0x49C53143,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBulledBag50 {0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x104169C5,0x00011041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104189C1,0x9A87B38F,0x89C17181,0x30810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000189C1,0x59417181,0x59415941,0x69C55941,0x59410001,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017181,0x594169C5,0x69C569C5,0x71815941,0x59415941,0x59415941,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10416293,0xB38F69C5,0x89C17181,0x59417181,0x71815941,0x59417181,0x59415941,0x30811041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016293,0x7181BDAD,0xFFFFBDAD,0xB38F9A87,0x9A87B38F,0x9A877181,0x59415941,0x59415941,0x59414101,0x59414101,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBDAD6293,0x89C19A87,0x62936293,0x629389C1,0xB38FBDAD,0xB38F6293,0x59415941,0x594169C5,0x594169C5,0x59415941,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001BDAD,0x20C589C1,0x89C189C1,0x9A87B38F,0x9A8769C5,0xB38FBDAD,0xBDADBDAD,0x5941B38F,0x62936293,0x69C55941,0x59411041,0x00010001,0x00010001,0x00010001,0x00010001,0x10411041,0x62936293,0x718189C1,0x89C19A87,0xB38F9A87,0x9A8789C1,0x718189C1,0x69C56293,0x7181BDAD,0xFFFFBDAD,0x62937181,0x41010001,0x00010001,0x00010001,0x00010001,0x00013081,0xEE11EE11,0xB38F20C5,0x89C189C1,0xB38F9A87,0x89C19A87,0xB38F89C1,0x9A879A87,0x89C189C1,0x89C19A87,0x62936293,0x62935941,0x10411041,0x00010001,0x00010001,0x00010001,0x0001EE11,0xFFFFEE11,0x69C589C1,0x89C19A87,0x89C17181,0xB38FB38F,0xB38F9A87,0x89C189C1,0x718189C1,0x89C189C1,0x9A8769C5,0x41014101,0x62936293,0x20C50001,0x00010001,0x00010001,0x0001EE11,0xEE119A87,0x89C17181,0x7181B38F,0xB38FB38F,0xB38FEE11,0xEE11B38F,0x89C17181,0x718189C1,0x89C19A87,0x89C17181,0x594169C5,0x00016293,0x62930001,0x00010001,0x00010001,0x0001B38F,0x9A8769C5,0x718189C1,0xB38F89C1,0x89C189C1,0x9A87B38F,0xB38F9A87,0x89C17181,0x89C189C1,0x89C17181,0x71815941,0x41014101,0x000120C5,0xFFFF0001,0x00010001,0x00010001,0x000120C5,0x00017181,0x89C189C1,0x89C189C1,0x89C19A87,0x89C189C1,0x89C189C1,0x89C189C1,0x89C17181,0x71817181,0x71815941,0x59413081,0x000120C5,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x104189C1,0x89C189C1,0x89C189C1,0x89C19A87,0x89C189C1,0x9A879A87,0x9A8789C1,0x71817181,0x71817181,0x71815941,0x59413081,0x000169C5,0xBDAD1041,0x00010001,0x00010001,0x00010001,0x89C189C1,0x89C189C1,0x9A87B38F,0x9A8789C1,0x89C189C1,0x9A879A87,0x89C189C1,0x71817181,0x71815941,0x59417181,0x71817181,0xEE11EE11,0xEE119A87,0x10410001,0x00010001,0x00011041,0x89C189C1,0x9A8789C1,0x9A879A87,0x89C189C1,0x71817181,0x71817181,0x71817181,0x71815941,0x59415941,0x71817181,0x59419A87,0xEE11FFFF,0xEE11B38F,0x41010001,0x00010001,0x00014101,0x89C19A87,0x89C17181,0x71817181,0x71817181,0x71817181,0x71817181,0x59417181,0x59417181,0x59415941,0x71817181,0x718169C5,0xEE11EE11,0xEE119A87,0x10410001,0x00010001,0x00015941,0x89C189C1,0x71817181,0x71817181,0x71817181,0x89C17181,0x71817181,0x71817181,0x59417181,0x71817181,0x71817181,0x59413081,0x69C5EE11,0xB38F20C5,0x00010001,0x00010001,0x00015941,0x71819A87,0x89C17181,0x71817181,0x89C19A87,0x89C189C1,0x71817181,0x71817181,0x71817181,0x71817181,0x71815941,0x41013081,0x000120C5,0x20C50001,0x00010001,0x00010001,0x00014101,0x718189C1,0xB38FB38F,0xB38FB38F,0xEE11B38F,0x9A8789C1,0x71817181,0x89C189C1,0x89C189C1,0x71817181,0x59415941,0x41011041,0x00010001,0x00010001,0x00010001,0x00010001,0x00013081,0x71817181,0x9A87B38F,0xB38FEE11,0xBDADB38F,0x89C189C1,0x71817181,0x718189C1,0x89C189C1,0x71817181,0x59414101,0x41011041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41014101,0x594189C1,0x9A8789C1,0x89C189C1,0x71817181,0x718189C1,0x89C17181,0x89C17181,0x71815941,0x41014101,0x41010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013081,0x41015941,0x59415941,0x59415941,0x71817181,0x71817181,0x71817181,0x59415941,0x594169C5,0x41014101,0x30810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413081,0x30814101,0x41015941,0x59415941,0x59415941,0x41015941,0x41015941,0x69C569C5,0x41014101,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413081,0x30814101,0x41014101,0x41014101,0x41014101,0x41015941,0x69C569C5,0x41014101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10411041,0x30813081,0x41013081,0x41014101,0x41014101,0x41014101,0x41010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x10413081,0x10413081,0x30814101,0x30813081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dBunnyHood {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A44F,0xF6DB6AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AC9F6DB,0xF6DBBD11,0x6AC90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA44FF6DB,0xF6DBBD11,0x834D1883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBD11A44F,0xA44FBD11,0xA44F6AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBD118B1B,0x6A178B1B,0xA44F6AC9,0x00010001,0x00010001,0x00010001,0x00011883,0xF6DBF6DB,0x834D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA44F8B1B,0x6A174991,0xA44F834D,0x18830001,0x00010001,0x00010001,0x1883F6DB,0xF6DBF6DB,0xBD112905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA44F8B1B,0x6A174991,0x834D834D,0x29050001,0x00010001,0x00010001,0xF6DBF6DB,0xBD11BD11,0xBD1141C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x834D8B1B,0x6A174991,0x834DA44F,0x29050001,0x00010001,0x00012905,0x834D6A17,0x8B1BBD11,0xBD116AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AC98B1B,0x6A174991,0x8B1B834D,0x29050001,0x00010001,0x0841BD11,0x8B1B4991,0x4991A44F,0xA44F41C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AC98B1B,0x6A174991,0x834DA44F,0x29050001,0x00010001,0x41C5834D,0x6A174991,0x6A17A44F,0x834D1883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41C58B1B,0x6A174991,0x8B1BA44F,0x29050001,0x00010001,0xBD118B1B,0x49914991,0x6A17A44F,0x834D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1883834D,0x6A178B1B,0xDD6DA44F,0x29050001,0x00016AC9,0x834D6A17,0x49914991,0xBD11834D,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841A44F,0x8B1BDD6D,0xDD6DA44F,0x18830001,0x2905BD11,0x8B1B4991,0x49918B1B,0xBD116AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841A44F,0x8B1BDD6D,0xDD6D834D,0x00010001,0x834D834D,0x6A174991,0x6A17DD6D,0x834D0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001834D,0x6A17DD6D,0xDD6D834D,0x00010841,0xBD11834D,0x49914991,0xDD6DBD11,0x41C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001834D,0x8B1BFFFF,0xDD6D6AC9,0x00016AC9,0xA44F6A17,0x4991DD6D,0xF6DB6AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012905,0x8B1BFFFF,0xBD1141C5,0x0001A44F,0x834D4991,0xDD6DDD6D,0x834D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0xBD11DD6D,0xBD1141C5,0x41C5BD11,0x8B1BDD6D,0xFFFFA44F,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AC9F6DB,0xBD11F6DB,0xF6DBBD11,0xA44FBD11,0xDD6DFFFF,0xA44F1883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841BD11,0xBD110001,0x1883BD11,0xF6DBBD11,0xA44FBD11,0xDD6DBD11,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xA44FF6DB,0xF6DBBD11,0xF6DBF6DB,0xF6DB0001,0x0841834D,0xA44F834D,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A44F,0xF6DBF6DB,0xF6DBFFFF,0xFFFFF6DB,0xF6DB6AC9,0x29056AC9,0xA44F834D,0x41C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1883F6DB,0xBD11A44F,0x834D6AC9,0x6A17BD11,0xF6DBF6DB,0xBD11BD11,0xA44FA44F,0x6AC91883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AC96AC9,0x41C541C5,0x29050841,0x00010841,0x2905834D,0xBD11BD11,0xA44F834D,0x6AC941C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA44F6AC9,0x6AC92905,0x08410001,0x00010001,0x00010001,0x6AC9A44F,0xA44F834D,0x6AC941C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AC92905,0x29050001,0x00010001,0x00010001,0x00010001,0x084141C5,0xA44F6AC9,0x834D6AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x6AC9834D,0x6AC96AC9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41C5834D,0x834D41C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841834D,0x834D2905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841834D,0x6AC90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012905,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dClaimCheck {0x00010001,0x00010001,0x00010001,0x0001420F,0x420F318B,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843A4E3,0xA4E3A4E3,0xA4E383DD,0x52930001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5293A4E3,0x9461A4E3,0x9461A4E3,0xA4E36B59,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA4E39461,0x83DD420F,0x6B5983DD,0xA4E383DD,0x83DD420F,0x29491085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001318B,0xA4E383DD,0x94619461,0x94619461,0x420F5293,0x83DD9461,0xA4E3A4E3,0x83DD2949,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001318B,0xA4E383DD,0x9461A4E3,0x946183DD,0xA4E3A4E3,0x94616B59,0x529383DD,0x83DDA4E3,0xA4E3A4E3,0x52935293,0x18C71085,0x18C70843,0x00010001,0x00010001,0x00010001,0x00010001,0x1085A4E3,0x946183DD,0x83DD5293,0xA4E383DD,0x946183DD,0x94619461,0xA4E383DD,0x6B595293,0x6B596B59,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x83DD420F,0x08430001,0x00010001,0x00010001,0x2949A4E3,0x94616B59,0x6B595293,0x83DD83DD,0x83DDA4E3,0x83DD6B59,0x83DD83DD,0x83DDA4E3,0x94619461,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x420F0001,0x00010001,0x00010001,0x318BA4E3,0xA4E35293,0x946183DD,0x6B596B59,0x83DD9461,0x6B5983DD,0x83DD83DD,0x946183DD,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E39461,0x21090001,0x00010001,0x00010001,0x420F9461,0xA4E3A4E3,0xA4E39461,0x94616B59,0x6B5983DD,0x83DDA4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x83DD6B59,0x52939461,0xA4E36B59,0x10850001,0x00010001,0x000118C7,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x946183DD,0xA4E3A4E3,0x6B59A4E3,0xA4E3A4E3,0xA4E3A4E3,0x83DD6B59,0x5293420F,0x318B318B,0x318B420F,0xA4E3420F,0x10850001,0x00010001,0x0843A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x318B6B59,0xA4E3A4E3,0xA4E3A4E3,0x94616B59,0x5293318B,0x318B318B,0x318B2949,0x318B5293,0x6B59A4E3,0x83DD2109,0x00010001,0x00010001,0x83DDA4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E39461,0x318B5293,0x94616B59,0x5293318B,0x318B318B,0x318B318B,0x318B5293,0x52939461,0xA4E3A4E3,0xA4E3A4E3,0x420F18C7,0x00010001,0x000118C7,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x946183DD,0x318B6B59,0x420F318B,0x318B318B,0x318B5293,0x6B599461,0x9461A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E36B59,0x318B0001,0x00010001,0x00016B59,0xA4E3A4E3,0x94615293,0x52935293,0x318B2949,0x318BA4E3,0x6B595293,0x529383DD,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E35293,0x29490001,0x00010001,0x0001A4E3,0xA4E3A4E3,0x83DD318B,0x29492949,0x29495293,0x6B59A4E3,0x9461A4E3,0x6B599461,0x83DDA4E3,0x52939461,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E318C7,0x08430001,0x00010001,0x1085A4E3,0xA4E3A4E3,0x83DD420F,0x83DD9461,0xA4E3A4E3,0x94619461,0xA4E3A4E3,0xA4E3A4E3,0x94615293,0x83DD9461,0x83DD5293,0x6B599461,0x9461A4E3,0x83DD2949,0x00010001,0x00010001,0x2109A4E3,0xA4E3A4E3,0xA4E39461,0xA4E3A4E3,0xA4E3A4E3,0xA4E36B59,0x9461A4E3,0xA4E3A4E3,0xA4E39461,0xA4E35293,0x83DD9461,0x83DD83DD,0x83DDA4E3,0x6B592109,0x00010001,0x00010001,0x108583DD,0x9461A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0x94619461,0x94616B59,0xA4E3A4E3,0x318B1085,0x00010001,0x00010001,0x00015293,0x420F6B59,0x83DDA4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E3A4E3,0xA4E35293,0x83DD9461,0x9461A4E3,0xA4E39461,0x5293420F,0x946183DD,0xA4E39461,0x318B0843,0x00010001,0x00010001,0x00012949,0x318B420F,0x52935293,0x52936B59,0x9461A4E3,0xA4E3A4E3,0x94615293,0x52936B59,0x946183DD,0xA4E3A4E3,0x21092109,0x52939461,0xA4E383DD,0x420F0001,0x00010001,0x00010001,0x00010001,0x08432949,0x318B318B,0x21092949,0x52936B59,0x9461A4E3,0xA4E3A4E3,0xA4E36B59,0x83DD6B59,0x83DD9461,0x10851085,0x9461A4E3,0xA4E36B59,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2949318B,0x420F420F,0x9461A4E3,0xA4E3A4E3,0xA4E3A4E3,0x83DDA4E3,0x5293A4E3,0xA4E3A4E3,0xA4E35293,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x21091085,0x420F5293,0x6B596B59,0x52939461,0x9461A4E3,0xA4E3A4E3,0xA4E39461,0x83DD5293,0x318B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085420F,0x420F5293,0x2109420F,0x52935293,0x83DD83DD,0x52935293,0x5293420F,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x21092109,0x318B420F,0x52935293,0x529318C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x108518C7,0x318B2949,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dCojiro {0x00010001,0x00010001,0x00010001,0x00010001,0x6003B001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012801,0x60032801,0xB001B001,0x28012801,0xB0016003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001B001,0xB001B001,0xB001B001,0xB001B001,0xB001B001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016003,0xB001B001,0x61936193,0x6193B001,0xB0012801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012801,0x600303B5,0x04FF04FF,0x04FF02EB,0xB0010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010155,0x02210047,0x00010001,0x00010001,0x00010001,0x00010001,0x00010221,0x02EB04FF,0x03B50155,0x04FF04FF,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010221,0x04FF03B5,0x02EB03B5,0x00010001,0x00010001,0x00010001,0x00010001,0x00477AC3,0x03B504FF,0x02EB0001,0x02EB04FF,0x02EB0001,0x00010001,0x00010001,0x00010001,0x00010001,0x015504FF,0x02EB0221,0x02EB0155,0x02210001,0x00010001,0x00010001,0x00010001,0xCC41CC41,0x02EB03B5,0x02210001,0x02EB03B5,0x03B50001,0x00010001,0x00010001,0x00010001,0x00010001,0x03B502EB,0x03B503B5,0x03B503B5,0x02210047,0x00010001,0x00010001,0x0001CC41,0xCC41CC41,0xCC410221,0x02210155,0x03B503B5,0x03B50001,0x00010001,0x00010001,0x00010001,0x00010155,0x03B503B5,0x03B503B5,0x03B503B5,0x02210155,0x00010001,0x00010001,0x29017AC3,0x7AC37AC3,0x7AC37AC3,0x022102EB,0x03B503B5,0x03B50001,0x00010001,0x00010001,0x00010001,0x000102EB,0x03B503B5,0x03B503B5,0x03B502EB,0x02EB0155,0x00010001,0x00010001,0x00012801,0x00010001,0x00010155,0x02EB02EB,0x02EB03B5,0x04FF0001,0x00010001,0x00010001,0x00010001,0x004703B5,0x02EB03B5,0x03B502EB,0x03B502EB,0x03B502EB,0x00010001,0x00010001,0x00010001,0x00010001,0x28016003,0x02210221,0x02EB03B5,0x04FF0001,0x00010001,0x00010001,0x00010047,0x02EB03B5,0x03B503B5,0x03B503B5,0x03B503B5,0x03B502EB,0x00010001,0x00010001,0x00010001,0x00010001,0x60036003,0x022102EB,0x02EB03B5,0x04FF0001,0x00010001,0x00010001,0x00010155,0x03B502EB,0x03B502EB,0x03B503B5,0x03B502EB,0x03B502EB,0x00010001,0x00010001,0x00010001,0x00010001,0xB0016003,0x022102EB,0x03B504FF,0x04FF0047,0x00010001,0x00010001,0x000103B5,0x03B503B5,0x03B503B5,0x03B502EB,0x03B503B5,0x03B50221,0x00010001,0x00010001,0x00010001,0x00010001,0x28010155,0x02EB03B5,0x03B504FF,0x04FF0155,0x00010001,0x00010001,0x02EB03B5,0x03B504FF,0x04FF03B5,0x03B503B5,0x03B502EB,0x03B50221,0x00010001,0x00010001,0x00010001,0x00010001,0x000102EB,0x02EB03B5,0x04FF04FF,0x04FF03B5,0x022102EB,0x03B504FF,0x04FF04FF,0x04FF04FF,0x04FF02EB,0x03B503B5,0x03B503B5,0x02EB0221,0x00010001,0x00010001,0x00010001,0x00010001,0x004702EB,0x03B504FF,0x03B504FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF03B5,0x03B502EB,0x03B503B5,0x03B50155,0x00010001,0x00010001,0x00010001,0x00010001,0x004702EB,0x03B504FF,0x04FF03B5,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF03B5,0x03B503B5,0x02EB03B5,0x02EB0155,0x00010001,0x00010001,0x00010001,0x00010001,0x022103B5,0x03B503B5,0x03B504FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x022103B5,0x03B503B5,0x02EB0001,0x00010001,0x00010001,0x00010001,0x00010047,0x02EB03B5,0x03B503B5,0x04FF04FF,0x03B504FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF03B5,0x02EB02EB,0x03B503B5,0x02210001,0x00010001,0x00010001,0x00010001,0x00010047,0x02EB03B5,0x03B504FF,0x03B503B5,0x03B503B5,0x03B503B5,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x04FF04FF,0x02210221,0x03B502EB,0x01550001,0x00010001,0x00010001,0x00010001,0x00010155,0x02EB03B5,0x03B503B5,0x04FF04FF,0x04FF0221,0x03B503B5,0x03B503B5,0x04FF04FF,0x03B502EB,0x03B504FF,0x02210221,0x03B503B5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010155,0x02EB03B5,0x03B503B5,0x03B503B5,0x04FF0221,0x022103B5,0x03B503B5,0x02EB02EB,0x03B503B5,0x03B503B5,0x01550221,0x03B50155,0x00010001,0x00010001,0x00010001,0x00010001,0x00010221,0x02EB02EB,0x02EB03B5,0x03B503B5,0x03B502EB,0x022102EB,0x03B503B5,0x02EB02EB,0x02EB04FF,0x04FF03B5,0x022102EB,0x02EB0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010155,0x022102EB,0x02EB02EB,0x02EB03B5,0x03B502EB,0x02210155,0x02EB03B5,0x03B503B5,0x04FF03B5,0x03B50221,0x02EB0221,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x022102EB,0x022102EB,0x022102EB,0x02EB02EB,0x02210221,0x02210221,0x03B503B5,0x03B504FF,0x01550047,0x02210047,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00470155,0x02210221,0x02EB0221,0x02210221,0x02210221,0x02210155,0x01550155,0x01550001,0x00010047,0x01550001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00470155,0x01550155,0x01550221,0x01550155,0x01550155,0x01550001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00472901,0x29012901,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x29012901,0x29010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dCompass {0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x000300CD,0x01A701A7,0x01A701A7,0x0A2F00CD,0x00CD0003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x01A70A2F,0x0A2F01A7,0x01A701A7,0x01A70A2F,0x0A2F0A2F,0x0A2F2B37,0x01A70003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x01A70A2F,0x0A2F01A7,0x01A701A7,0x01A70A2F,0x0A2F0A2F,0x0A2F2B37,0x01A70003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100CD,0x00CD01A7,0x015901A7,0x01A701A7,0x01590113,0x011300CD,0x011301A7,0x01A70A2F,0x2B372B37,0x2B3700CD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01130A2F,0x0A2F0159,0x01A70113,0x011300CD,0x00CD535D,0x535D0113,0x00CD0113,0x01130113,0x0A2F2B37,0x2B372B37,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100CD,0x01A701A7,0x01A70159,0x011300CD,0x00CD00CD,0x535D9DF5,0x9DF5535D,0x01130113,0x01130113,0x01132B37,0x2B379DF5,0x2B370047,0x00470001,0x00010001,0x00010001,0x00010001,0x000100CD,0x01A701A7,0x01A70159,0x011300CD,0x00CD00CD,0x535D9DF5,0x9DF5535D,0x01130113,0x01130113,0x01132B37,0x2B379DF5,0x2B370047,0x00470001,0x00010001,0x00010001,0x00010003,0x000301A7,0x01A701A7,0x01A70113,0x00CD00CD,0x00CD0113,0x9DF59DF5,0x9DF59DF5,0x01130113,0x01130113,0x011301A7,0x01A79DF5,0x9DF50A2F,0x0A2F0047,0x00010001,0x00010001,0x00010113,0x011301A7,0x01A70113,0x011300CD,0x00CD00CD,0x00CD535D,0x9DF59DF5,0x9DF59DF5,0x535D0113,0x01130113,0x01130159,0x01592B37,0xFFFF0A2F,0x0A2F0113,0x00010001,0x00010001,0x000101A7,0x01A70A2F,0x015900CD,0x00CD00CD,0x00CD0113,0x01139DF5,0x9DF59DF5,0x9DF59DF5,0x535D0113,0x01130113,0x01590113,0x01130A2F,0xFFFF2B37,0x2B3701A7,0x00470001,0x00010001,0x000101A7,0x01A70A2F,0x015900CD,0x00CD00CD,0x00CD0113,0x01139DF5,0x9DF59DF5,0x9DF59DF5,0x535D0113,0x01130113,0x01590113,0x01130A2F,0xFFFF2B37,0x2B3701A7,0x00470001,0x00010001,0x004701A7,0x01A70A2F,0x00CD00CD,0x00CD00CD,0x00CD9DF5,0x9DF59DF5,0xBE55BE55,0xBE559DF5,0x9DF50159,0x01590159,0x01590113,0x01130A2F,0xFFFF2B37,0x2B3701A7,0x01130001,0x00010001,0x00CD0A2F,0x0A2F01A7,0x00CD00CD,0x00CD00CD,0x535D9DF5,0x9DF5910D,0xBE55BE55,0xBE55BE55,0x9DF5535D,0x535D0159,0x01590113,0x01130A2F,0x9DF52B37,0x2B3701A7,0x01130001,0x00010001,0x00CD0A2F,0x0A2F0159,0x00CD00CD,0x00CD00CD,0x4111910D,0x910DBE55,0xBE55BE55,0xBE55910D,0x910D4111,0x41110159,0x01590159,0x01592B37,0x9DF50A2F,0x0A2F01A7,0x01590001,0x00010001,0x00CD0A2F,0x0A2F0159,0x00CD00CD,0x00CD00CD,0x4111910D,0x910DBE55,0xBE55BE55,0xBE55910D,0x910D4111,0x41110159,0x01590159,0x01592B37,0x9DF50A2F,0x0A2F01A7,0x01590001,0x00010001,0x01130A2F,0x0A2F0159,0x00CD0113,0x01130113,0x00CD910D,0x910D910D,0x910D910D,0x910D910D,0x41110159,0x01590159,0x01590A2F,0x0A2F2B37,0x2B370A2F,0x0A2F01A7,0x01590001,0x00010001,0x00CD01A7,0x01A70113,0x011300CD,0x00CD0113,0x01134111,0x4111910D,0x910D910D,0x910D910D,0x01590159,0x01590159,0x0A2F0A2F,0x0A2F2B37,0x2B3701A7,0x01A701A7,0x01130001,0x00010001,0x00CD01A7,0x01A701A7,0x00CD0113,0x01130113,0x01134111,0x4111910D,0x910D910D,0x910D4111,0x01590159,0x01590A2F,0x0A2F0A2F,0x0A2F0A2F,0x0A2F01A7,0x01A701A7,0x00CD0001,0x00010001,0x00CD01A7,0x01A701A7,0x00CD0113,0x01130113,0x01134111,0x4111910D,0x910D910D,0x910D4111,0x01590159,0x01590A2F,0x0A2F0A2F,0x0A2F0A2F,0x0A2F01A7,0x01A701A7,0x00CD0001,0x00010001,0x00030159,0x015901A7,0x01590113,0x01130113,0x01130113,0x0113910D,0x910D910D,0x910D0159,0x01590A2F,0x0A2F0A2F,0x0A2F0A2F,0x0A2F0A2F,0x01A701A7,0x01A701A7,0x00010001,0x00010001,0x000100CD,0x00CD01A7,0x01A70113,0x01130113,0x01130113,0x01134111,0x910D4111,0x41110159,0x0A2F0A2F,0x0A2F0A2F,0x0A2F0A2F,0x0A2F01A7,0x015901A7,0x01A70113,0x00010001,0x00010001,0x00010001,0x00010159,0x01A701A7,0x01A70159,0x01590159,0x01590113,0x41110159,0x01590A2F,0x0A2F0A2F,0x0A2F0A2F,0x01A70159,0x01590159,0x01590159,0x01590003,0x00010001,0x00010001,0x00010001,0x00010159,0x01A701A7,0x01A70159,0x01590159,0x01590113,0x41110159,0x01590A2F,0x0A2F0A2F,0x0A2F0A2F,0x01A70159,0x01590159,0x01590159,0x01590003,0x00010001,0x00010001,0x00010001,0x00010001,0x015901A7,0x01A70A2F,0x01A701A7,0x01A701A7,0x01A70A2F,0x0A2F0A2F,0x0A2F01A7,0x01A701A7,0x01590159,0x01590159,0x01590003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00030159,0x0159535D,0x2B372B37,0x2B372B37,0x2B370A2F,0x0A2F0A2F,0x01590159,0x01590159,0x01590159,0x01590113,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x000300CD,0x01590159,0x0159535D,0x01A70159,0x01590159,0x01590159,0x01590159,0x01130159,0x01590001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x000300CD,0x01590159,0x0159535D,0x01A70159,0x01590159,0x01590159,0x01590159,0x01130159,0x01590001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00470047,0x004700CD,0x004700CD,0x00CD00CD,0x01130159,0x01590159,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010047,0x00470047,0x00470047,0x00470047,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dCucco {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xB0015843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3001B001,0x30013001,0xB001B001,0x30015843,0x30010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5843B001,0xB001B001,0xB001B001,0xB001B001,0xB0010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3001B001,0xB001B001,0xA5298AC7,0xB001B001,0xB0010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0x63191083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015843,0x8AC7FFFF,0xFFFFFFFF,0xC631B001,0x30010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC631A529,0xA529C631,0x63190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0xFFFFC631,0x4211C631,0xC631A529,0x63190001,0x00010001,0x00010001,0x00010001,0x0001A529,0x63198421,0x84218421,0xC6314211,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0xC631A529,0x00018421,0xC631A529,0x8AC71083,0x00010001,0x00010001,0x00010001,0x10836319,0xA529A529,0xA529A529,0xA529A529,0x10830001,0x00010001,0x00010001,0x00010001,0x00016319,0xC6318421,0x00014211,0xA529A529,0xC401C401,0x10830001,0x00010001,0x00010001,0x21096319,0xA529A529,0xA529A529,0xA529A529,0x42110001,0x00010001,0x00010001,0x00010001,0x0001C631,0xA529A529,0x42116319,0x8421C401,0xC401C401,0x8AC70001,0x00010001,0x00010001,0x42118421,0xA529A529,0xA529A529,0xA529A529,0xA5290001,0x00010001,0x00010001,0x00010001,0x0001C631,0xA529A529,0x84216319,0x8AC78AC7,0x8AC78AC7,0x8AC73101,0x00010001,0x00010001,0x63198421,0xA529A529,0xA529A529,0xA529A529,0xA5294211,0x00010001,0x00010001,0x00010001,0x0001C631,0xA5298421,0x84218421,0x63193001,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0x8421A529,0xA529A529,0xA529A529,0xA529A529,0x00010001,0x00010001,0x00010001,0x0001C631,0xA5298421,0x84218421,0x58433001,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0xA529A529,0xA529A529,0xA529A529,0xA529A529,0x42110001,0x00010001,0x00010001,0x1083C631,0xC631A529,0x84216319,0x58435843,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0x8421A529,0xA529A529,0xA529A529,0xA529A529,0xA5290001,0x00010001,0x00010001,0x1083C631,0xC631C631,0x84218421,0x5843B001,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0xA529A529,0xA529A529,0x8421FFFF,0xFFFFC631,0xC6318421,0x00010001,0x00010001,0x4211FFFF,0xC631C631,0xA5298421,0x63195843,0x00010001,0x00010001,0x00010001,0x00010001,0x4211A529,0xA529A529,0xA529A529,0x8421FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC631,0xA5296319,0xFFFFC631,0xC631C631,0xA529A529,0x84211083,0x00010001,0x00010001,0x00010001,0x00010001,0x2109A529,0xA529A529,0xA529A529,0xA529FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC631C631,0xC631C631,0xC631A529,0x84212109,0x00010001,0x00010001,0x00010001,0x00010001,0x21098421,0xA529A529,0xA5298421,0xA529FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC631FFFF,0xC631C631,0xC631C631,0x84214211,0x00010001,0x00010001,0x00010001,0x00010001,0x00018421,0xA529A529,0xA5298421,0xA529FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC631,0xFFFFC631,0xC631C631,0xC631C631,0xA5298421,0x10830001,0x00010001,0x00010001,0x00010001,0x00016319,0xA529A529,0x84216319,0xC631C631,0xFFFFC631,0xFFFFFFFF,0xFFFFC631,0xFFFFC631,0xC631C631,0xC631C631,0xC631A529,0xA5298421,0x10830001,0x00010001,0x00010001,0x00010001,0x00012109,0xA529A529,0x63196319,0xC631C631,0xC631FFFF,0xFFFFFFFF,0xC631C631,0xC631C631,0xA529A529,0xC631C631,0xA529C631,0xA529A529,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x8421A529,0x84214211,0xC631C631,0xA529C631,0xC631A529,0xA529A529,0xC631C631,0x6319C631,0xC631C631,0xA529A529,0xA529A529,0x42110001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109A529,0x63194211,0xC631C631,0xC631A529,0x8421A529,0xC631A529,0xC6316319,0x6319C631,0xC631A529,0xA529A529,0xA5298421,0x63190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0x63196319,0xA529C631,0xA5298421,0x84218421,0xA529C631,0x84216319,0x8421A529,0xA529A529,0xA529A529,0xA5298421,0x63190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x63196319,0x6319C631,0xC631C631,0xA529A529,0xC6318421,0x63196319,0x8421A529,0xA529A529,0x84218421,0x84218421,0x42110001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10836319,0x21096319,0x84218421,0xC631A529,0x42116319,0x63196319,0x84218421,0x84218421,0x84218421,0x84216319,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x00010001,0x10832109,0x21092109,0x63196319,0x63196319,0x63198421,0x63198421,0x63198421,0x63191083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10834211,0x42114211,0x42116319,0x63194211,0x42114211,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10831083,0x31011083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013101,0x31013101,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dDefauldSong {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCE73CE73,0xCE73FFFF,0xFFFFFFFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCE73CE73,0xCE73FFFF,0xFFFFFFFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C63CE73,0xCE73CE73,0xFFFFFFFF,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C63CE73,0xCE73CE73,0xFFFFFFFF,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C63CE73,0xCE73CE73,0xFFFFFFFF,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C638C63,0x8C638C63,0xCE73CE73,0xCE73FFFF,0xFFFFFFFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C638C63,0x8C638C63,0xCE73CE73,0xCE73FFFF,0xFFFFFFFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C638C63,0x8C638C63,0xCE73CE73,0xCE73FFFF,0xFFFFFFFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x8C638C63,0x8C63CE73,0xCE73CE73,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x8C638C63,0x8C63CE73,0xCE73CE73,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x8C638C63,0x8C63CE73,0xCE73CE73,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x0001CE73,0xCE73CE73,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x0001CE73,0xCE73CE73,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x0001CE73,0xCE73CE73,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00018C63,0x8C638C63,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00018C63,0x8C638C63,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00018C63,0x8C638C63,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFF8C63,0x8C638C63,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFF8C63,0x8C638C63,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFF8C63,0x8C638C63,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x39CF0001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x39CF0001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x39CF0001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x39CF0001,0x00010001,0xFFFFFFFF,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE738C63,0x8C638C63,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFFFFFF,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE738C63,0x8C638C63,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFFFFFF,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE738C63,0x8C638C63,0x8C638C63,0x8C6339CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x8C638C63,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF39CF,0x39CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dDekuShield {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49056189,0x28834905,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x6189724F,0x61894905,0x61892043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08016189,0x4905724F,0x49052883,0x28836189,0xE62938C5,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x38C52883,0x38C54905,0x724F6189,0x38C54905,0xE629E629,0xE62938C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000138C5,0x20432883,0x288338C5,0x288338C5,0x28836189,0x6189724F,0xC45DC45D,0xA35538C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x490538C5,0x618938C5,0x38C52883,0x20432883,0x38C538C5,0x724F6189,0x4905A355,0xC45D724F,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x288338C5,0x288338C5,0x38C52883,0x28834905,0x4905724F,0x38C56189,0x38C56189,0xA355A355,0x28830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28834905,0x61894905,0x61892883,0x38C5A143,0xE9C1E9C1,0xE9C1A143,0xA1434905,0x38C5724F,0xA355A355,0x724F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012883,0x49056189,0x724F724F,0xA35538C5,0xA143E9C1,0xE9C16189,0x61896189,0x61894905,0x61896189,0xA355A355,0x724F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x080138C5,0x38C54905,0x61896189,0x724FA143,0xE9C1E9C1,0x618938C5,0x49054905,0x490538C5,0x38C52883,0x724F724F,0x724F2043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x4905724F,0x61896189,0x61894905,0x6189E9C1,0xE9C16189,0x724F38C5,0x38C56189,0x38C538C5,0x28834905,0x724F724F,0x724F4905,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x38C5724F,0x20434905,0x49056189,0xA143E9C1,0xE9C12883,0x61896189,0x38C5A143,0xE9C1A143,0x61894905,0x6189724F,0x724F6189,0x08010001,0x00010001,0x00010001,0x00010001,0x0001A355,0x49054905,0x288338C5,0x49054905,0xA143E9C1,0xA1432043,0x20432883,0xA143E9C1,0xE9C1E9C1,0xA1434905,0x4905724F,0x724F724F,0x38C50801,0x00010001,0x00010001,0x00010001,0x0001C45D,0xA3556189,0x38C5724F,0x49056189,0x4905E9C1,0xE9C12043,0x20432043,0xA143A143,0x61896189,0xE9C16189,0x38C52043,0x49056189,0x724F6189,0x00010001,0x00010001,0x00010001,0x0001C45D,0xC45D38C5,0x61896189,0x490538C5,0x38C5E9C1,0xE9C16189,0x38C538C5,0x28832883,0x20436189,0xE9C14905,0x38C52883,0x20436189,0x61896189,0x61890001,0x00010001,0x00010001,0x0001A355,0xE6294905,0x38C5A355,0x724F4905,0x49056189,0xE9C1E9C1,0xA14338C5,0x49052043,0x2883E9C1,0xE9C14905,0x28832883,0x38C52043,0x20432043,0x49052043,0x00010001,0x00010001,0x0001E629,0xE6294905,0x38C56189,0x724FA143,0xA143724F,0xA143A143,0xE9C1A143,0xA143A143,0xA143E9C1,0x38C52883,0x28832883,0x28832883,0x28832043,0x10410001,0x00010001,0x00010001,0x0001A355,0xE629E629,0x49052883,0xA143E9C1,0xE9C1A143,0xA3556189,0xA143E9C1,0xE9C1E9C1,0xE9C14905,0x28832883,0x10412883,0x38C52883,0x38C52043,0x00010001,0x00010001,0x00010001,0x0001724F,0xE629C45D,0x61894905,0x4905A143,0xE9C1E9C1,0xE9C1E9C1,0xA143A143,0xE9C1E9C1,0xA1432043,0x20432043,0x20431041,0x20432043,0x10410001,0x00010001,0x00010001,0x00010001,0x0801724F,0xE629C45D,0x724F4905,0x38C54905,0x49054905,0xA143E9C1,0xE9C1A143,0xA1432043,0x10412043,0x20432043,0x20432883,0x20431041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0xC45DC45D,0xA3554905,0x38C538C5,0x38C538C5,0x20432043,0x28834905,0x38C52043,0x38C52043,0x490538C5,0x288338C5,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0801A355,0xA355724F,0x38C54905,0x49056189,0x49054905,0x28834905,0x38C538C5,0x28832043,0x28832883,0x20430801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012883,0xA355724F,0x288338C5,0x49054905,0x490538C5,0x38C52883,0x20432883,0x38C538C5,0x28832883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20436189,0x618938C5,0x61894905,0x28832043,0x38C538C5,0x28832883,0x38C538C5,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x61894905,0x38C52883,0x28832043,0x10412883,0x28832043,0x38C51041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x20431041,0x10412043,0x10411041,0x10412883,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dDungeonMap {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420B,0x420B2949,0x29490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420B,0x420B2949,0x29490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012107,0x2107C623,0xA51FA51F,0xA51F5AD1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015AD1,0x5AD1C623,0xC623A51F,0xA51F5AD1,0x00010001,0x00010001,0x08430843,0x08430843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015AD1,0x5AD1C623,0xC6238419,0x8419420B,0x0843420B,0x420BC623,0xC623C623,0xC623C623,0xA51FA51F,0xA51F8419,0x420B2949,0x29490843,0x00010001,0x00010001,0x00010001,0x00010001,0x00015AD1,0x5AD1C623,0xC6238419,0x8419420B,0x0843420B,0x420BC623,0xC623C623,0xC623C623,0xA51FA51F,0xA51F8419,0x420B2949,0x29490843,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A51F,0xA51FC623,0xA51F8419,0x84195AD1,0x420BA51F,0xA51FC623,0xC623C623,0xC623C623,0xC623A51F,0xA51FA51F,0xA51FA51F,0xA51F420B,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C623,0xC623C623,0xC6238419,0x8419420B,0x2949C623,0xC6238419,0x5AD1A51F,0xA51F8419,0xA51FC623,0xC623A51F,0xA51FA51F,0xA51F2107,0x00010001,0x00010001,0x00010001,0x00010001,0x0843C623,0xC623C623,0xA51F8419,0x8419420B,0x420BC623,0xC6238419,0x420B5AD1,0x5AD12107,0x420B2107,0x21075AD1,0xA51FA51F,0xA51F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843C623,0xC623C623,0xA51F8419,0x8419420B,0x420BC623,0xC6238419,0x420B5AD1,0x5AD12107,0x420B2107,0x21075AD1,0xA51FA51F,0xA51F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2107C623,0xC623C623,0xA51F5AD1,0x5AD12949,0x5AD1C623,0xC623A51F,0xA51FA51F,0xA51F420B,0x5AD12949,0x29492107,0xA51F8419,0x84190001,0x00010001,0x00010001,0x00010001,0x00010001,0x5AD1C623,0xC623C623,0xA51F5AD1,0x5AD12949,0x21072107,0x21072107,0x29495AD1,0x5AD18419,0x8419A51F,0xA51FA51F,0xA51F5AD1,0x5AD10001,0x00010001,0x00010001,0x00010001,0x00010001,0xC623C623,0xC623C623,0xA51F420B,0x420B420B,0xA51F5AD1,0x5AD18419,0xE2B35AD1,0x5AD12949,0x5AD12949,0x29492107,0xA51F5AD1,0x5AD10001,0x00010001,0x00010001,0x00010001,0x00010001,0xC623C623,0xC623C623,0xA51F420B,0x420B420B,0xA51F5AD1,0x5AD18419,0xE2B35AD1,0x5AD12949,0x5AD12949,0x29492107,0xA51F5AD1,0x5AD10001,0x00010001,0x00010001,0x00010001,0x00010001,0xC623C623,0xC623C623,0x8419420B,0x420B420B,0xC623420B,0x420BE2B3,0xE2B35AD1,0x5AD1C623,0xFFFF8419,0x8419420B,0xA51F420B,0x420B0001,0x00010001,0x00010001,0x00010001,0x00010843,0xC623C623,0xC623C623,0x8419420B,0x420B420B,0x420B0843,0x08430843,0x08430843,0x0843420B,0xA51F420B,0x420B8419,0x84192949,0x29490001,0x00010001,0x00010001,0x00010001,0x00012107,0xC623C623,0xC623A51F,0x8419420B,0x420B5AD1,0x296D2949,0x29494E8D,0x4E8D2107,0x21075AD1,0x420B2107,0x21078419,0xA51F2107,0x21070001,0x00010001,0x00010001,0x00010001,0x00012107,0xC623C623,0xC623A51F,0x8419420B,0x420B5AD1,0x296D2949,0x29494E8D,0x4E8D2107,0x21075AD1,0x420B2107,0x21078419,0xA51F2107,0x21070001,0x00010001,0x00010001,0x00010001,0x00015AD1,0x08432107,0x21075AD1,0x5AD12949,0x2949296D,0x296D2949,0x29494E8D,0x4E8D2107,0x2107E907,0xE907618B,0x618B8419,0xA51F420B,0x420B0001,0x00010001,0x00010001,0x00010001,0x00012949,0x21075AD1,0x5AD12949,0x2949420B,0x420B420B,0x29492949,0x29495AD1,0x420B420B,0x420B5AD1,0x5AD1420B,0x420B8419,0xA51F420B,0x420B0001,0x00010001,0x00010001,0x00010843,0x0843420B,0x2949420B,0x420B420B,0x29495AD1,0x5AD18419,0xC623C623,0xC623A51F,0xA51FA51F,0xA51F5AD1,0x420B2107,0x2107A51F,0xA51F5AD1,0x5AD10001,0x00010001,0x00010001,0x00010843,0x0843420B,0x2949420B,0x420B420B,0x29495AD1,0x5AD18419,0xC623C623,0xC623A51F,0xA51FA51F,0xA51F5AD1,0x420B2107,0x2107A51F,0xA51F5AD1,0x5AD10001,0x00010001,0x00010001,0x00010001,0x00015AD1,0x84198419,0x8419A51F,0x8419420B,0x420B8419,0xC6235AD1,0x5AD15AD1,0x8419A51F,0xA51FA51F,0xA51F8419,0x8419A51F,0xA51F5AD1,0x5AD10001,0x00010001,0x00010001,0x00010001,0x00010843,0x8419A51F,0xA51F420B,0x420B5AD1,0x5AD18419,0x21070843,0x08430001,0x00010843,0x08435AD1,0xA51FA51F,0xA51FA51F,0xA51F420B,0x420B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2107420B,0x420B5AD1,0x5AD12107,0x21070843,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420B,0x420B8419,0xA51F2949,0x29490001,0x00010001,0x00010001,0x00010001,0x00010001,0x2107420B,0x420B5AD1,0x5AD12107,0x21070843,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420B,0x420B8419,0xA51F2949,0x29490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012107,0x420B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dEponaSong {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59858207,0x82078207,0xA2C9A2C9,0xA2C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59858207,0x82078207,0xA2C9A2C9,0xA2C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59858207,0x82078207,0xA2C9A2C9,0xA2C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59855985,0x59855985,0x82078207,0x8207A2C9,0xA2C9A2C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59855985,0x59855985,0x82078207,0x8207A2C9,0xA2C9A2C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59855985,0x59855985,0x82078207,0x8207A2C9,0xA2C9A2C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x59855985,0x59858207,0x82078207,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x59855985,0x59858207,0x82078207,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x59855985,0x59858207,0x82078207,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x00010001,0x00018207,0x82078207,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x00010001,0x00018207,0x82078207,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x00010001,0x00018207,0x82078207,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x00010001,0x00015985,0x59855985,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x00010001,0x00015985,0x59855985,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59855985,0x59852083,0x20832083,0x00010001,0x00015985,0x59855985,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC631C631,0x59855985,0x59855985,0x59852083,0x20832083,0x00010001,0x00010001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C631,0xF7BDC631,0xC631C631,0x59855985,0x59852083,0x20832083,0x00010001,0x00010001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC631F7BD,0xC631F7BD,0x21492149,0xC6315985,0x59852083,0x20832083,0x00010001,0x00010001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x0001C631,0xF7BDF7BD,0x21492149,0x2149C631,0x59852083,0x20832083,0x00010001,0x00010001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0xC631F7BD,0xF7BD69C7,0x21492149,0x2149F7BD,0x59852083,0x20832083,0x00010001,0x00010001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0xC631F7BD,0xA2C969C7,0x69C72149,0x69C7F7BD,0xC6312083,0x20832083,0x00010001,0x00010001,0x00010001,0x20832083,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C631,0xF7BDA2C9,0xA2C9A2C9,0x69C769C7,0x69C769C7,0xF7BDC631,0x20832083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C631,0xF7BDA2C9,0xA2C9A2C9,0x214969C7,0xA2C969C7,0xF7BDC631,0x20832083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C631,0xF7BDA2C9,0xA2C9F7BD,0x2149A2C9,0xA2C969C7,0x69C7F7BD,0x20832083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C631,0xA2C9A2C9,0x69C72149,0xA2C9A2C9,0xA2C9A2C9,0x69C72083,0x20832083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA2C9A2C9,0x69C7A2C9,0xA2C9A2C9,0xA2C969C7,0x69C72083,0x20832083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A2C9,0xA2C9A2C9,0xA2C9A2C9,0xA2C9A2C9,0x69C769C7,0x69C72083,0x20832083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0xA2C9A2C9,0xA2C9A2C9,0xA2C9A2C9,0x69C769C7,0x69C769C7,0x69C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x2149A2C9,0xA2C9A2C9,0xA2C969C7,0x69C769C7,0x69C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0x21492149,0x214969C7,0x69C769C7,0x69C769C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0x21492149,0x21492149,0x214969C7,0x69C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0x21492149,0x21492149,0x21490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dEyedrops {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141CD,0x41CD2107,0x21070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210741CD,0x62D341CD,0x41CD41CD,0x08470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010847,0x41CD62D3,0x62D341CD,0x41CD62D3,0x8C1B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000162D3,0x41CD62D3,0x41CD41CD,0x62D38C1B,0xD5D90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210762D3,0x62D362D3,0x41CD41CD,0x62D3D5D9,0xD5D90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62D341CD,0x8C1B41CD,0x41CD62D3,0x8C1BD5D9,0x62D30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010847,0x00012107,0x41CD62D3,0x8C1B41CD,0x41CD41CD,0x8C1BD5D9,0x41CD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010847,0x210741CD,0x421794B1,0x8C1B8C1B,0x62D341CD,0x41CD62D3,0xD5D9D5D9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010847,0x41CD41CD,0x421741CD,0x4217FFFF,0x94B194B1,0x94B18C1B,0x8C1B8C1B,0xD5D9D5D9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012107,0x421741CD,0x42174217,0x41CD4217,0x19594217,0x94B194B1,0x94B13379,0x94B194B1,0xD5D941CD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141CD,0x421762D3,0x42174217,0x421741CD,0x42174217,0x42174217,0x421719E1,0x94B194B1,0x94B18C1B,0x62D341CD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210762D3,0x421741CD,0x421741CD,0x41CD4217,0x42174217,0x19E14217,0x19E14217,0x19594217,0x421741CD,0x41CD4217,0x21070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x421762D3,0x195941CD,0x42174217,0x42174217,0x94B194B1,0x42173379,0x33793379,0x19E13379,0x41CD10CF,0x19594217,0x42170847,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10CF1959,0x19E11959,0x195919E1,0x19E13379,0x557F557F,0x557F94B1,0x33793379,0x337919E1,0x19591959,0x10CF1959,0x195910CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10CF19E1,0x195919E1,0x19E11959,0x19E1557F,0x557F557F,0x557F557F,0x557F557F,0x33791959,0x10CF1959,0x195910CF,0x19591959,0x08470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011959,0x19E119E1,0x19E119E1,0x19E13379,0x557F557F,0x557F557F,0x557F557F,0x337919E1,0x19591959,0x10CF1959,0x19591959,0x19590847,0x00010001,0x00010001,0x00010001,0x00010001,0x000110CF,0x19E11959,0x19E11959,0x3379557F,0x557F557F,0x557F557F,0x557F3379,0x195919E1,0x19E119E1,0x195919E1,0x19591959,0x19591959,0x08470001,0x00010001,0x00010001,0x00010001,0x00010847,0x19E119E1,0x19E11959,0x3379557F,0x557F557F,0x557F557F,0x557F19E1,0x19E119E1,0x19E11959,0x19591959,0x19591959,0x19591959,0x10CF0001,0x00010001,0x00010001,0x00010001,0x00010847,0x19E11959,0x19E119E1,0x19E13379,0x557F557F,0x557F557F,0x557F3379,0x337919E1,0x19E11959,0x19E11959,0x19E11959,0x19E110CF,0x19590001,0x00010001,0x00010001,0x00010001,0x000110CF,0x19E11959,0x19E11959,0x19591959,0x1959557F,0x557F557F,0x557F3379,0x33793379,0x337919E1,0x195919E1,0x195919E1,0x19591959,0x19590001,0x00010001,0x00010001,0x00010001,0x000119E1,0x19591959,0x19591959,0x19591959,0x19593379,0x3379557F,0x33793379,0x33793379,0x19E11959,0x19E119E1,0x19E119E1,0x19591959,0x08470001,0x00010001,0x00010001,0x00010001,0x10CF1959,0x19591959,0x19591959,0x19591959,0x19E13379,0x33793379,0x33793379,0x337919E1,0x19E119E1,0x33793379,0x19E11959,0x19E10847,0x00010001,0x00010001,0x00010001,0x00010001,0x19591959,0x19591959,0x19591959,0x19591959,0x19E13379,0x33793379,0x33793379,0x337919E1,0x19E13379,0x19E11959,0x195910CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x195919E1,0x19591959,0x19591959,0x19591959,0x19E119E1,0x33793379,0x33793379,0x19E11959,0x19E119E1,0x195919E1,0x08470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08471959,0x19591959,0x19591959,0x19591959,0x19E119E1,0x195919E1,0x19E119E1,0x19E11959,0x19E119E1,0x10CF0847,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000110CF,0x19591959,0x19591959,0x19591959,0x195919E1,0x19591959,0x19E119E1,0x195919E1,0x19E11959,0x08470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10CF10CF,0x10CF1959,0x19591959,0x19591959,0x19591959,0x19591959,0x19591959,0x19E11959,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010847,0x08470847,0x00010001,0x00010847,0x19591959,0x19E119E1,0x19E119E1,0x19E110CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10CF1959,0x19591959,0x19591959,0x10CF10CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010847,0x10CF10CF,0x10CF10CF,0x08470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dFireMed {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10012043,0x20432043,0x20431001,0x10011001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10012043,0x20432043,0x20431001,0x10011001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x308340C5,0x40C540C5,0x40C55907,0x59075907,0x59075907,0x40C52043,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x30835907,0x5907A189,0x79077907,0x79075907,0x79077907,0x79077907,0xA189A189,0xA18940C5,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x308340C5,0x79077907,0x790740C5,0x308340C5,0x40C540C5,0x40C53083,0x308340C5,0x40C5A189,0xA1897907,0x79072043,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x308340C5,0x79077907,0x790740C5,0x308340C5,0x40C540C5,0x40C53083,0x308340C5,0x40C5A189,0xA1897907,0x79072043,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x10015907,0x5907A189,0x790740C5,0x40C55907,0x5907718D,0x718D718D,0x718D718D,0x718D718D,0x590740C5,0x40C57907,0x79077907,0x79071001,0x00010001,0x00010001,0x00010001,0x00010001,0x5907A189,0xA1897907,0x40C5718D,0x718D718D,0x718D5907,0x5907718D,0x718D718D,0x718D718D,0x718D718D,0x718D7907,0x79077907,0x79077907,0x00010001,0x00010001,0x00010001,0x00013083,0x7907A189,0xA1895907,0x718D718D,0x718D5907,0x40C5A189,0xA189AA91,0xAA91AA91,0xAA91718D,0x718D718D,0x718D718D,0x5907A189,0xA189A189,0x30830001,0x00010001,0x00010001,0x00013083,0x7907A189,0xA1895907,0x718D718D,0x718D5907,0x40C5A189,0xA189AA91,0xAA91AA91,0xAA91718D,0x718D718D,0x718D718D,0x5907A189,0xA189A189,0x30830001,0x00010001,0x00010001,0x0001A189,0xD20BA189,0xA189718D,0xAA91718D,0x718D40C5,0xA189AA91,0xAA91AA91,0xEB555907,0x59077907,0xD20BAA91,0xAA91AA91,0x7907A189,0xA189D20B,0x79071001,0x10010001,0x00012043,0x2043A189,0xF28DA189,0xA189AA91,0xAA917907,0x79077907,0xD20BEB55,0xEB55EB55,0x40C57907,0x7907F28D,0xEB55EB55,0xEB55EB55,0xAA91A189,0xA189D20B,0xA1893083,0x30830001,0x00013083,0x3083F28D,0xD20BD20B,0xD20BEB55,0xD20BA189,0xA1897907,0x5907718D,0x718D40C5,0x5907F28D,0xF28DEB55,0xF499F499,0xF499EB55,0xEB55D20B,0xD20BF28D,0xF28D40C5,0x40C50001,0x00013083,0x3083F28D,0xD20BD20B,0xD20BEB55,0xD20BA189,0xA1897907,0x5907718D,0x718D40C5,0x5907F28D,0xF28DEB55,0xF499F499,0xF499EB55,0xEB55D20B,0xD20BF28D,0xF28D40C5,0x40C50001,0x000140C5,0x40C5F28D,0xF28DEB55,0xEB55F499,0xEB55F28D,0xF28DD20B,0xD20BA189,0xA189A189,0xF28DF28D,0xF28DF499,0xF499F499,0xF499A189,0xF499EB55,0xEB55F28D,0xF28D5907,0x59070001,0x000140C5,0x40C5F28D,0xF28DEB55,0xEB55F499,0xF28DA189,0xA189D20B,0xD20BF28D,0xF28DF28D,0xF28DF28D,0xF28DF499,0xEB555907,0x5907D20B,0xF499EB55,0xEB55F28D,0xF28D7907,0x79070001,0x00013083,0x3083D20B,0xF28DD20B,0xD20BEB55,0xA1895907,0x59075907,0x7907A189,0xA189A189,0xD20BF28D,0xF28D7907,0x5907D20B,0xD20BD20B,0xEB55D20B,0xD20BF28D,0xD20B40C5,0x40C50001,0x00013083,0x3083D20B,0xF28DD20B,0xD20BEB55,0xA1895907,0x59075907,0x7907A189,0xA189A189,0xD20BF28D,0xF28D7907,0x5907D20B,0xD20BD20B,0xEB55D20B,0xD20BF28D,0xD20B40C5,0x40C50001,0x00012043,0x2043A189,0xD20BA189,0xA189718D,0xA1895907,0x59077907,0x79077907,0x79077907,0x7907A189,0xA189A189,0xA1897907,0x7907A189,0xAA91A189,0xA189D20B,0xA1893083,0x30830001,0x00010001,0x00017907,0xD20BA189,0xA189718D,0x718D5907,0x59073083,0x40C540C5,0x40C53083,0x40C540C5,0x40C540C5,0x59075907,0x5907718D,0x79077907,0x7907D20B,0x79070001,0x00010001,0x00010001,0x00013083,0x7907A189,0xA1897907,0x5907718D,0x718D40C5,0x30833083,0x30833083,0x30832043,0x20433083,0x40C5718D,0x718D5907,0x5907A189,0xA1897907,0x30830001,0x00010001,0x00010001,0x00013083,0x7907A189,0xA1897907,0x5907718D,0x718D40C5,0x30833083,0x30833083,0x30832043,0x20433083,0x40C5718D,0x718D5907,0x5907A189,0xA1897907,0x30830001,0x00010001,0x00010001,0x00010001,0x59077907,0x7907A189,0x59075907,0x5907718D,0x40C55907,0x59073083,0x308340C5,0x40C55907,0x718D5907,0x59075907,0xA189A189,0xA1893083,0x00010001,0x00010001,0x00010001,0x00010001,0x100140C5,0x40C5A189,0x79075907,0x590740C5,0x59075907,0x59075907,0x5907718D,0x718D5907,0x40C540C5,0x40C57907,0x790740C5,0x40C51001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x20433083,0x7907A189,0xA189A189,0x40C540C5,0x40C53083,0x40C53083,0x30833083,0x5907A189,0xA1895907,0x40C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x20433083,0x7907A189,0xA189A189,0x40C540C5,0x40C53083,0x40C53083,0x30833083,0x5907A189,0xA1895907,0x40C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x204340C5,0x40C57907,0x79077907,0x79077907,0x79077907,0x79077907,0x79073083,0x30833083,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x20432043,0x40C540C5,0x40C540C5,0x30833083,0x30833083,0x40C52043,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x20431001,0x10012043,0x20431001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x20431001,0x10012043,0x20431001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dForesdMed {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00430043,0x004300C5,0x00C50001,0x00010083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00430043,0x004300C5,0x00C50001,0x00010083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010083,0x008300C5,0x01070107,0x01070187,0x01870187,0x01870187,0x010700C5,0x00C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010083,0x00C50187,0x0187024B,0x02090209,0x02090209,0x0209024B,0x024B024B,0x0B0D0B0D,0x0B0D0187,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C5,0x00C50107,0x024B024B,0x024B0107,0x00C50107,0x01070187,0x01870107,0x01070107,0x0107024B,0x024B0B0D,0x020900C5,0x00C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C5,0x00C50107,0x024B024B,0x024B0107,0x00C50107,0x01070187,0x01870107,0x01070107,0x0107024B,0x024B0B0D,0x020900C5,0x00C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00430209,0x02090B0D,0x02090107,0x01070209,0x024B0B0D,0x0B0D0B0D,0x0B0D0B0D,0x0B0D0B0D,0x02090187,0x0187024B,0x024B0209,0x020900C5,0x00010001,0x00010001,0x00010001,0x00010001,0x02090209,0x02090B0D,0x01870B0D,0x0B0D0B0D,0x0209024B,0x024B13D1,0x13D113D1,0x13D113D1,0x0B0D024B,0x024B0187,0x024B0B0D,0x0B0D0187,0x00010001,0x00010001,0x00010001,0x00010043,0x020913D1,0x13D10187,0x0B0D0B0D,0x0B0D0107,0x0B0D0B0D,0x0B0D1513,0x13D10187,0x01870187,0x024B13D1,0x13D10B0D,0x02090B0D,0x0B0D024B,0x00C50001,0x00010001,0x00010001,0x00010043,0x020913D1,0x13D10187,0x0B0D0B0D,0x0B0D0107,0x0B0D0B0D,0x0B0D1513,0x13D10187,0x01870187,0x024B13D1,0x13D10B0D,0x02090B0D,0x0B0D024B,0x00C50001,0x00010001,0x00010001,0x00010209,0x13D1024B,0x024B0B0D,0x13D113D1,0x13D10209,0x13D11513,0x151313D1,0x0209024B,0x024B0209,0x0B0D0209,0x020913D1,0x0B0D024B,0x024B13D1,0x024B0001,0x00010001,0x00010001,0x00010B0D,0x1513024B,0x024B13D1,0x36591513,0x151313D1,0x15133659,0x365913D1,0x020900C5,0x00C500C5,0x00C50209,0x020913D1,0x15130B0D,0x0B0D13D1,0x0B0D00C5,0x00C50001,0x000100C5,0x00C513D1,0x151313D1,0x13D13659,0x365913D1,0x13D10209,0x15133659,0x36591513,0x36593659,0x36594FE1,0x365913D1,0x13D113D1,0x365913D1,0x13D11513,0x13D10187,0x01870001,0x000100C5,0x00C513D1,0x151313D1,0x13D13659,0x365913D1,0x13D10209,0x15133659,0x36591513,0x36593659,0x36594FE1,0x365913D1,0x13D113D1,0x365913D1,0x13D11513,0x13D10187,0x01870001,0x00010209,0x02091513,0x15133659,0x36594FE1,0x4FE14FE1,0x4FE10187,0x024B3659,0x36594FE1,0x4FE11513,0x15130B0D,0x36594FE1,0x4FE14FE1,0x4FE13659,0x36591513,0x1513024B,0x024B0001,0x00010187,0x01871513,0x15133659,0x36594FE1,0x36594FE1,0x4FE13659,0x0B0D1513,0x15134FE1,0x4FE13659,0x36590B0D,0x02093659,0x36594FE1,0x4FE11513,0x15131513,0x1513024B,0x024B0001,0x00010083,0x008313D1,0x151313D1,0x13D13659,0x13D10B0D,0x0B0D1513,0x36593659,0x365913D1,0x13D13659,0x36591513,0x024B0B0D,0x0B0D3659,0x365913D1,0x13D11513,0x13D100C5,0x00C50001,0x00010083,0x008313D1,0x151313D1,0x13D13659,0x13D10B0D,0x0B0D1513,0x36593659,0x365913D1,0x13D13659,0x36591513,0x024B0B0D,0x0B0D3659,0x365913D1,0x13D11513,0x13D100C5,0x00C50001,0x00010043,0x0043024B,0x15130B0D,0x0B0D0B0D,0x13D10187,0x01870187,0x01070107,0x0107024B,0x0B0D3659,0x36591513,0x13D113D1,0x13D11513,0x15130B0D,0x0B0D1513,0x024B00C5,0x00C50001,0x00010001,0x00010209,0x0B0D0B0D,0x0B0D024B,0x0B0D0209,0x0209024B,0x024B0209,0x02090107,0x13D11513,0x151313D1,0x0187024B,0x024B13D1,0x024B024B,0x024B13D1,0x024B0001,0x00010001,0x00010001,0x000100C5,0x020913D1,0x13D10209,0x024B0B0D,0x0B0D0187,0x02090209,0x020913D1,0x13D10B0D,0x0B0D024B,0x0107024B,0x024B0209,0x018713D1,0x13D10187,0x00830001,0x00010001,0x00010001,0x000100C5,0x020913D1,0x13D10209,0x024B0B0D,0x0B0D0187,0x02090209,0x020913D1,0x13D10B0D,0x0B0D024B,0x0107024B,0x024B0209,0x018713D1,0x13D10187,0x00830001,0x00010001,0x00010001,0x00010001,0x01870209,0x02090B0D,0x0209024B,0x024B0B0D,0x0B0D13D1,0x13D113D1,0x13D10187,0x01870187,0x024B0209,0x02090187,0x0B0D024B,0x024B0107,0x00010001,0x00010001,0x00010001,0x00010001,0x00010187,0x0187024B,0x024B0187,0x01870187,0x02090209,0x02090209,0x0209024B,0x024B024B,0x01870107,0x0107024B,0x024B0107,0x01070043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010107,0x01870B0D,0x0B0D0B0D,0x02090187,0x01870107,0x01070107,0x01070107,0x01070B0D,0x0B0D0107,0x01070083,0x00830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010107,0x01870B0D,0x0B0D0B0D,0x02090187,0x01870107,0x01070107,0x01070107,0x01070B0D,0x0B0D0107,0x01070083,0x00830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00C50107,0x0107024B,0x024B024B,0x024B0209,0x024B024B,0x024B024B,0x01870107,0x010700C5,0x00830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C5,0x00C500C5,0x00C500C5,0x00C500C5,0x00C500C5,0x008300C5,0x00C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00430001,0x00010083,0x00430001,0x00010043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00430001,0x00010083,0x00430001,0x00010043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dFrog {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AC10201,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011405,0x1D87769D,0x1D871D87,0x14050201,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010AC1,0x769D769D,0x769D769D,0x1D871D87,0x1D871D87,0x1D870AC1,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001CE73,0xFFFFFFFF,0x769D1D87,0x1D871405,0x1D871405,0x14051405,0x0AC10201,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00C1FFFF,0xCE735355,0x84615355,0x0AC1CE73,0xFFFFCE73,0x14050AC1,0x0AC10AC1,0x0AC10201,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00C1CE73,0x84610001,0x31CD8461,0x769DFFFF,0xCE738461,0x84611405,0x14050AC1,0x0AC10AC1,0x02010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018461,0x53550001,0x5355CE73,0xCE73CE73,0x31CD0001,0x84618461,0x14051405,0x0AC10AC1,0x0AC10201,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C1,0x535531CD,0x53555355,0x8461CE73,0x00C100C1,0x84618461,0x0AC11405,0x14050AC1,0x0AC10AC1,0x02010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010AC1,0x140531CD,0x53551D87,0x1D875355,0x31CD31CD,0x84615355,0x0AC11405,0x53551405,0x0AC10AC1,0x02010201,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AC11D87,0x1D871D87,0x1D871D87,0x1D871405,0x53555355,0x53550201,0x0AC11405,0x14051D87,0x14050AC1,0x0AC10201,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C1,0x1D871D87,0x1D871D87,0x1D871D87,0x1D871D87,0x1D871D87,0x1D871405,0x1D871405,0x14051405,0x14050AC1,0x0AC10201,0x02010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x02011D87,0x1D871D87,0x1D871D87,0x1D871D87,0x1D871D87,0x1D871D87,0x1D871D87,0x14050AC1,0x14050AC1,0x0AC10AC1,0x02010201,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011405,0x14055355,0x84618461,0x769D769D,0x769D769D,0x1D871405,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10201,0x0AC10201,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AC11405,0x48014801,0x48014801,0x48014801,0x48014801,0x48014801,0x48014801,0x48014801,0x38C10201,0x0AC10AC1,0x0AC10AC1,0x02010201,0x00010001,0x00010001,0x00010001,0x00010001,0x1D871405,0x38C14801,0x48014801,0x48014801,0x48014801,0x48014801,0x48014801,0x38C10201,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x02010AC1,0x00C10001,0x00010001,0x00010001,0x00010001,0x0AC11D87,0x72414801,0x48014801,0x48014801,0x48014801,0x480138C1,0x14051405,0x14050AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10201,0x02010AC1,0x00C10001,0x00010001,0x00010001,0x00010001,0x00C11405,0x1D871405,0x14050AC1,0x72410AC1,0x14051405,0x14051405,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10201,0x02010201,0x02010AC1,0x00C10001,0x00010001,0x00010001,0x00010001,0x000100C1,0x0AC11D87,0x14051405,0x14051405,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10201,0x0AC10201,0x02010AC1,0x02010001,0x00010001,0x00010001,0x00010001,0x00C10201,0x0AC10201,0x02010AC1,0x02010AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10AC1,0x0AC10201,0x00C10AC1,0x02010AC1,0x02010001,0x00010001,0x00010001,0x00C131CD,0x769D769D,0x1D870AC1,0x02010201,0x02010AC1,0x02010AC1,0x02010AC1,0x0AC10201,0x0AC10AC1,0x020100C1,0x00010001,0x00C10AC1,0x02010AC1,0x02010001,0x00010001,0x00010001,0x00010201,0x00C11D87,0x0AC100C1,0x000100C1,0x02010201,0x02010201,0x02010201,0x020100C1,0x00C10001,0x00010001,0x00010201,0x1D870AC1,0x02010201,0x00C10201,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001769D,0x0AC10201,0x020100C1,0x02010201,0x0AC100C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000131CD,0x0AC11D87,0x140500C1,0x000100C1,0x02010001,0x00C10AC1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010201,0x1D871D87,0x14051D87,0x140500C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C1,0x00010201,0x14050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGerudoCard {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C50001,0x000118C5,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0xBDAD9CE7,0x9CE7FFFF,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0xBDAD9CE7,0x9CE7FFFF,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0x83975A53,0x5A532949,0x18C50001,0x00010001,0x29499CE7,0x9CE79CE7,0xBDADBDAD,0xBDAD398B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0x83979419,0x94198397,0x83978397,0x83978397,0xBDAD6AD5,0x6AD59CE7,0x420F0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420F,0x94198397,0x83979419,0x94199419,0x9419BDAD,0x9CE79CE7,0x9CE79419,0x6AD55A53,0x5A5318C5,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420F,0x94198397,0x83979419,0x94199419,0x9419BDAD,0x9CE79CE7,0x9CE79419,0x6AD55A53,0x5A5318C5,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018397,0x94198397,0x83979419,0x83979CE7,0x9CE77BE1,0x7BE19CE7,0x9CE79CE7,0x83978397,0x83978397,0xAC9B6AD5,0x6AD50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019419,0x94199419,0x94199419,0x8397BDAD,0xBDAD420F,0x7BE19CE7,0x9CE7AC9B,0x83979419,0x94199419,0x94199419,0x94190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08439419,0xAC9B9419,0x94199419,0x94196AD5,0x6AD57BE1,0x7BE17BE1,0x7BE1AC9B,0x94198397,0x8397AC9B,0x94198397,0x83970001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08439419,0xAC9B9419,0x94199419,0x94196AD5,0x6AD57BE1,0x7BE17BE1,0x7BE1AC9B,0x94198397,0x8397AC9B,0x94198397,0x83970001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C5,0x18C5AC9B,0xAC9B9419,0x9419AC9B,0x94198397,0x83976AD5,0x6AD59419,0x9419AC9B,0x9419AC9B,0xAC9B9419,0x94198397,0x83970001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001398B,0x398BAC9B,0x94199419,0x94199419,0x83979419,0x94199419,0x94198397,0x83979419,0x9419AC9B,0xAC9B9419,0x94198397,0x83970001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001AC9B,0xAC9BAC9B,0xAC9B6AD5,0x6AD58397,0x6AD55A53,0x5A536AD5,0x83976AD5,0x6AD58397,0x83979419,0x9419AC9B,0xAC9B420F,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001AC9B,0xAC9BAC9B,0xAC9B6AD5,0x6AD58397,0x6AD55A53,0x5A536AD5,0x83976AD5,0x6AD58397,0x83979419,0x9419AC9B,0xAC9B420F,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08439419,0x9419AC9B,0xAC9B8397,0x83979419,0x6AD55A53,0x5A535A53,0x420F5A53,0x5A53398B,0x5A538397,0x8397AC9B,0xAC9B398B,0x398B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2949AC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0x83978397,0x83976AD5,0x6AD56AD5,0x6AD5AC9B,0xAC9B18C5,0x18C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x83979419,0x94199419,0x9419AC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0x94199419,0x9419AC9B,0xAC9B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83979419,0x94199419,0x9419AC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0x94199419,0x9419AC9B,0xAC9B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x83979419,0x94195A53,0x5A536AD5,0x6AD59419,0x5A539419,0x94199419,0x9419AC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0x6AD50001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C5,0x9419AC9B,0xAC9B6AD5,0x6AD55A53,0x5A536AD5,0x5A538397,0x83975A53,0x6AD59419,0x94198397,0x6AD59419,0x9419AC9B,0x420F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001AC9B,0xAC9B9419,0x9419AC9B,0x9419AC9B,0xAC9B9419,0x6AD5AC9B,0xAC9B8397,0x9419AC9B,0xAC9B8397,0x5A538397,0x8397AC9B,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001AC9B,0xAC9B9419,0x9419AC9B,0x9419AC9B,0xAC9B9419,0x6AD5AC9B,0xAC9B8397,0x9419AC9B,0xAC9B8397,0x5A538397,0x8397AC9B,0x08430001,0x00010001,0x00010001,0x00010001,0x00010843,0x0843AC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9B9419,0x9419AC9B,0xAC9BAC9B,0xAC9BAC9B,0x6AD59419,0x94195A53,0x00010001,0x00010001,0x00010001,0x00010001,0x00016AD5,0x6AD5AC9B,0x398BAC9B,0xAC9BAC9B,0x9419AC9B,0xAC9BAC9B,0xAC9BAC9B,0xAC9B420F,0xAC9BAC9B,0xAC9BAC9B,0xAC9B8397,0x83970001,0x00010001,0x00010001,0x00010001,0x00010001,0x08435A53,0x5A530843,0x2949AC9B,0xAC9B5A53,0x5A53AC9B,0xAC9B420F,0xAC9B420F,0x420F420F,0xAC9BAC9B,0xAC9B420F,0xAC9B0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x08435A53,0x5A530843,0x2949AC9B,0xAC9B5A53,0x5A53AC9B,0xAC9B420F,0xAC9B420F,0x420F420F,0xAC9BAC9B,0xAC9B420F,0xAC9B0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5A532949,0x29490843,0x941918C5,0x18C5420F,0x420F0001,0x00015A53,0x83970843,0x0843420F,0x398B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x00010001,0x00010001,0x00010001,0x00012949,0x00010001,0x000118C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGerudoMask {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413083,0x30833083,0x30830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3083D189,0xD189D189,0x99079907,0x99079907,0x68C53083,0x30833083,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000168C5,0xD189D189,0xD189D189,0x68C59907,0x68C59907,0x9907D189,0xD1899907,0x990768C5,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3083D189,0xD189D189,0xD1899907,0x68C568C5,0x68C568C5,0x9907D189,0xD189D189,0x99079907,0x68C53083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000168C5,0x9907D189,0xD189D189,0xD1899907,0x68C568C5,0x68C568C5,0xD189D189,0xD189D189,0xD1899907,0x990768C5,0x30830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30839907,0xD189D189,0xD189D189,0xD18968C5,0x30835187,0x9A8D9A8D,0xD189D189,0xD189D189,0xD1899907,0x68C568C5,0x68C53083,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x9907D189,0x68C568C5,0x9907D189,0xD18968C5,0x39079A8D,0x9A8D9A8D,0x9A8DD189,0xD189D189,0x99079907,0x68C568C5,0x68C53083,0x10410001,0x00010001,0x00010001,0x00010001,0x000168C5,0xD189D189,0x30833083,0x30833083,0x68C53083,0x39079A8D,0x9A8D9A8D,0x9A8DD189,0xD1899907,0x990768C5,0x68C53907,0x308368C5,0x68C50001,0x00010001,0x00010001,0x00010001,0x000168C5,0x68C53083,0x3083A489,0xA4893907,0x30833083,0x7A099A8D,0x9A8D9A8D,0x7A09D189,0xD1899907,0x68C53907,0x39073907,0x30839907,0x99073083,0x00010001,0x00010001,0x00010001,0x00013083,0x30831041,0x1041A489,0xA489A489,0x7A0968C5,0x9A8D9A8D,0x7A097A09,0x7A099A8D,0xD18968C5,0x39073083,0x30833083,0x99079907,0x68C568C5,0x00010001,0x00010001,0x00010001,0x00013083,0x9A8D5A91,0x39075A91,0x7A09A489,0x9A8D9A8D,0x9A8D7A09,0x7A0968C5,0x99079907,0x99073083,0x30833083,0x390768C5,0xD1899907,0x990768C5,0x10410001,0x00010001,0x00010001,0x00015187,0x9A8DFFFF,0xA4897A09,0x7A097A09,0x9A8D9A8D,0x9A8D5187,0x7A095187,0x68C57A09,0x9A8D7A09,0x30833083,0x68C59907,0x99079907,0x68C568C5,0x30830001,0x00010001,0x00010001,0x00019A8D,0x83DBBD63,0xA489A489,0xA489A489,0x9A8D9A8D,0x7A095187,0x7A097A09,0x7A09A489,0xA489A489,0x7A095187,0x99079907,0x990768C5,0x68C568C5,0x68C50001,0x00010001,0x00010001,0x39079A8D,0x9A8DBD63,0xBD63BD63,0xBD637A09,0x7A099A8D,0x51875187,0x7A097A09,0x7A093907,0x39075187,0x51875187,0x68C568C5,0x68C568C5,0x68C568C5,0x30830001,0x00010001,0x00010001,0x51879A8D,0x9A8D9A8D,0x9A8D9A8D,0x9A8D9A8D,0x9A8D5187,0x51875187,0x7A095A91,0x51877A09,0x518783DB,0x39073907,0x518768C5,0x68C568C5,0x68C568C5,0x68C50001,0x00010001,0x00010001,0x51879A8D,0x9A8D9A8D,0x9A8D9A8D,0x9A8D7A09,0x7A095187,0x51875187,0x7A0983DB,0x83DBA489,0xA489A489,0x83DB83DB,0x7A097A09,0x68C568C5,0x68C568C5,0x30830001,0x00010001,0x00010001,0x51879A8D,0x9A8D9A8D,0x9A8D9A8D,0x7A099A8D,0x7A095187,0x51875187,0x7A097A09,0x9A8D83DB,0x83DB83DB,0xBD637A09,0x7A095187,0x518768C5,0x68C568C5,0x00010001,0x00010001,0x00010001,0x30837A09,0x9A8D7A09,0x7A093907,0x39077A09,0x51875187,0x51875187,0x7A099A8D,0x7A099A8D,0x83DB83DB,0x5A917A09,0x7A095187,0x390768C5,0x68C50001,0x00010001,0x00010001,0x00010001,0x10417A09,0x7A097A09,0x9A8D5A91,0x5A913083,0x30833907,0x51875187,0x7A097A09,0x7A097A09,0x7A097A09,0x7A097A09,0x51875187,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x10417A09,0x7A0983DB,0x83DB83DB,0x83DB5A91,0x39073907,0x39075187,0x51877A09,0x7A097A09,0x7A097A09,0x7A095187,0x51875187,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015187,0x7A095A91,0x5A915A91,0x5A915A91,0x83DB3907,0x39073907,0x39075187,0x7A097A09,0x7A097A09,0x7A095187,0x51873083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x7A099A8D,0x5A9183DB,0x83DB83DB,0x5A915A91,0x39075A91,0x51877A09,0x7A097A09,0x7A095187,0x51875187,0x51870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x51877A09,0x7A095A91,0x83DB83DB,0x83DB83DB,0x39073907,0x39075187,0x7A097A09,0x51875187,0x51875187,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10417A09,0x7A097A09,0x5A915A91,0x5A915A91,0x5A915A91,0x39075187,0x7A095187,0x51875187,0x51871041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013907,0x7A097A09,0x7A095187,0x39073907,0x39073907,0x51875187,0x51875187,0x51875187,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x51877A09,0x7A097A09,0x7A095187,0x51875187,0x51875187,0x51875187,0x39070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10415187,0x7A097A09,0x7A095187,0x51875187,0x51875187,0x30830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013083,0x39075187,0x51875187,0x51875187,0x30831041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413083,0x30833083,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGiandWalled {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x08011041,0x188320C3,0x08011041,0x00010801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x18833105,0x20C349C7,0x20C349C7,0x49C75A09,0x49C749C7,0x39450801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x49C73945,0x31053945,0x310549C7,0x394549C7,0x394549C7,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C349C7,0x39453945,0x49C73945,0x39453945,0x39453945,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x39453945,0x39453945,0x31053945,0x394520C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x39453945,0x39453945,0x31053945,0x31050801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000149C7,0x6A8B49C7,0x49C749C7,0x49C73945,0x39453105,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B55,0xB49BB49B,0xB49BB49B,0x7B557B55,0x5A091883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B55,0xB49BB49B,0xB49BB49B,0x7B557B55,0x7B551041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08011883,0x5A095A09,0x7B556A8B,0x7B5549C7,0x5A097B55,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000149C7,0x394520C3,0x20C33105,0x18831883,0xB49B7B55,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A8B6A8B,0x5A095A09,0x6A8B5A09,0x83093945,0x7B55B49B,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015A09,0x6A8B6A8B,0x5A095A09,0x83095A09,0x83096A8B,0x8309EEA1,0x5A090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A8B8309,0x83095A09,0x830949C7,0x83095A09,0x83095A09,0x6A8BB49B,0xB49B1883,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000149C7,0x83098309,0x5A096A8B,0x83095A09,0x83095A09,0x6A8B8309,0x49C76A8B,0xB49B7B55,0x18830801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10416A8B,0x83095A09,0x83098309,0x5A095A09,0x7B5549C7,0x5A098309,0x49C78309,0x83097B55,0x20C320C3,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5A098309,0x83098309,0x83098309,0x83097B55,0x39455A09,0x5A0949C7,0x5A095A09,0x83097B55,0x7B5520C3,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x83098309,0x83098309,0x83096A8B,0x6A8B6A8B,0x7B557B55,0x6A8B5A09,0x49C749C7,0x6A8B49C7,0xB49B5A09,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000149C7,0x83098309,0x83098309,0x83096A8B,0x6A8BB49B,0xB49B7B55,0x7B557B55,0x6A8B3105,0x5A095A09,0xB49B7B55,0x10410801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08015A09,0x83098309,0x83098309,0x83096A8B,0x7B55B49B,0xEEA17B55,0x7B557B55,0x5A093105,0x49C75A09,0x310520C3,0x18830801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08015A09,0x83098309,0x83098309,0x6A8B6A8B,0x7B55EEA1,0xB49BB49B,0xB49BB49B,0x6A8B3105,0x394549C7,0x39453105,0x31051041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18836A8B,0x6A8B6A8B,0x83098309,0x6A8B6A8B,0x7B55EEA1,0xEEA1EEA1,0xEEA1EEA1,0x49C73105,0x310549C7,0x39453105,0x39451041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104149C7,0x5A095A09,0x5A095A09,0x5A096A8B,0x8309EEA1,0xB49BB49B,0xB49BB49B,0x6A8B3105,0x39453945,0x31053105,0x31051883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104149C7,0x49C749C7,0x5A095A09,0x5A0949C7,0x6A8B7B55,0x7B557B55,0x8309B49B,0x5A0920C3,0x31053945,0x39453945,0x39451883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x49C749C7,0x49C75A09,0x5A093945,0x310549C7,0x6A8B6A8B,0x7B557B55,0x18833945,0x39453945,0x31053105,0x39451883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x39453945,0x394549C7,0x49C73945,0x31053105,0x49C77B55,0x49C71883,0x31053945,0x31053945,0x31053945,0x39450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08013105,0x31053105,0x39453945,0x20C31883,0x18833105,0x18833105,0x39453945,0x39453945,0x18833105,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x18831041,0x20C33105,0x39451883,0x18831883,0x20C33945,0x39453945,0x394520C3,0x20C30801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x188320C3,0x20C31883,0x18831883,0x20C320C3,0x20C320C3,0x18831041,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x10411883,0x10411041,0x10411883,0x10410801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoldGaundled {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C30801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0xB1C9B1C9,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1041B1C9,0x6A4960C5,0x184160C5,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x51C76A49,0x390560C5,0x6A49B1C9,0xB1C91841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08010801,0x08013905,0x51C751C7,0x51C73905,0xB1C960C5,0x60C51841,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C3B1C9,0xB1C960C5,0x3905BCD3,0x838F6A49,0x51C73905,0x6A4960C5,0x60C560C5,0xB1C91841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x1841B1C9,0xB1C96A49,0x838FF719,0x838F838F,0x51C751C7,0x390560C5,0xB1C9B1C9,0x60C560C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18416A49,0xB1C93905,0xF719BCD3,0xBCD3838F,0x60C560C5,0x60C560C5,0x39056A49,0x60C51841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x080160C5,0x6A49838F,0xBCD3838F,0x6A4960C5,0x60C5C84D,0xB1C93905,0x390551C7,0x60C5B1C9,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000151C7,0x51C7F719,0xBCD3C84D,0x60C560C5,0xC84DC84D,0x6A49838F,0x838F6A49,0xB1C9B1C9,0x60C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000151C7,0x838FF719,0xF719C84D,0xC84DC84D,0xC84DC84D,0xF719F719,0xBCD36A49,0x51C73905,0x60C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104151C7,0xBCD36A49,0xF719C84D,0x60C5C84D,0xC84DB1C9,0xBCD3BCD3,0xBCD3838F,0x390528C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013905,0x6A4951C7,0x6A4951C7,0x838F838F,0x6A4960C5,0xC84D838F,0x838F838F,0x51C751C7,0x39050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3905838F,0x6A4951C7,0x51C7BCD3,0xBCD3838F,0x6A496A49,0x6A496A49,0x6A496A49,0x51C73905,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413905,0x51C7BCD3,0x838F838F,0x838F51C7,0x6A496A49,0x51C751C7,0x51C751C7,0x51C73905,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013905,0x6A4951C7,0x51C7BCD3,0xBCD3BCD3,0xBCD3838F,0x51C751C7,0x39053905,0x51C73905,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x390551C7,0xBCD351C7,0x6A49838F,0xF719F719,0xF719F719,0x51C73905,0x390551C7,0x28C30801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C351C7,0x6A4951C7,0xBCD3BCD3,0x838F838F,0xF719F719,0xF719F719,0x3905838F,0x39050801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A49BCD3,0x6A4951C7,0xBCD3BCD3,0xBCD36A49,0x838F838F,0xBCD3BCD3,0x838F838F,0x39050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x080151C7,0x6A49838F,0x51C76A49,0x838FF719,0xF719F719,0xBCD3838F,0x28C328C3,0x39051041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0xB1C96A49,0x51C7BCD3,0xBCD3838F,0x6A49F719,0xF719F719,0xF719838F,0x51C7BCD3,0x39050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10416A49,0x6A496A49,0x51C7BCD3,0xBCD3BCD3,0x51C76A49,0xBCD3BCD3,0xBCD3BCD3,0x6A496A49,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0xB1C9B1C9,0x6A49BCD3,0xF719F719,0xBCD3BCD3,0x6A493905,0x51C751C7,0x51C71041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x3905B1C9,0x6A49BCD3,0xF719F719,0xF719F719,0xBCD351C7,0x838F28C3,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08013905,0x51C751C7,0x838FBCD3,0xBCD3BCD3,0xF719838F,0x6A4951C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x39053905,0x39053905,0x51C76A49,0x6A496A49,0x51C71041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x080151C7,0x39053905,0x28C328C3,0x390528C3,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x39053905,0x39053905,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10413905,0x390528C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x39050801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoldenScale {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00C10241,0x01C10141,0x01C100C1,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000101C1,0x0BC502C1,0x02410241,0x024102C1,0x02410241,0x02C10241,0x00C10041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000101C1,0x14C70BC5,0x01C102C1,0x02C102C1,0x14C70BC5,0x14C702C1,0x024102C1,0x024101C1,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x024102C1,0x0BC514C7,0x0BC50BC5,0x0BC514C7,0x0BC50BC5,0x0BC50BC5,0x0BC50241,0x02C101C1,0x01C10141,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00410BC5,0x0BC50BC5,0x02C10BC5,0x14C70BC5,0x14C714C7,0x14C714C7,0x0BC50BC5,0x024101C1,0x01C10241,0x01C10241,0x00C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x02C102C1,0x0BC514C7,0x14C714C7,0x3F533F53,0x3F533F53,0x14C714C7,0x0BC502C1,0x02C101C1,0x02410241,0x02410241,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x000102C1,0x01C102C1,0x02C114C7,0x14C73F53,0x3F533F53,0x3F533F53,0x3F5314C7,0x0BC50241,0x02C102C1,0x02C10141,0x01C101C1,0x01410141,0x00C10001,0x00010001,0x00010001,0x00010001,0x014102C1,0x024102C1,0x14C73F53,0x3F533F53,0x3F533F53,0x3F533F53,0x3F533F53,0x14C70241,0x02410241,0x024101C1,0x014101C1,0x01C101C1,0x00C10041,0x00010001,0x00010001,0x00010001,0x024102C1,0x02C10BC5,0x14C73F53,0x3F533F53,0x3F53FF99,0x3F53D5D3,0xA451634D,0x634D634D,0x634D634D,0x634D634D,0x024101C1,0x01C101C1,0x01410141,0x00410001,0x00010001,0x00010041,0x024102C1,0x02C114C7,0x14C73F53,0x3F53FF99,0xFF99D5D3,0xD5D3A451,0xD5D3634D,0x634D634D,0x634D634D,0x634D634D,0x02C10241,0x01C10141,0x01C10141,0x00C10001,0x00010001,0x00010141,0x02410241,0x02C114C7,0x3F533F53,0xFF99FF99,0xFF99D5D3,0xA451A451,0xA451634D,0x634D634D,0x634D634D,0x634D634D,0x634D0241,0x024101C1,0x024101C1,0x01410001,0x00010001,0x004101C1,0x02C102C1,0x0BC50BC5,0x3F53FF99,0xFF99FF99,0xFF99FF99,0xD5D3A451,0xA451A451,0x634D634D,0x634D634D,0x634D634D,0x634D0241,0x024102C1,0x02C101C1,0x00C10041,0x00010001,0x000101C1,0x02C10241,0x02C10BC5,0xA451D5D3,0xFF99FF99,0xFF99FF99,0xD5D3D5D3,0xA451A451,0x634D634D,0x634D634D,0x634D634D,0x01C10141,0x024102C1,0x02410241,0x014100C1,0x00010001,0x004101C1,0x0BC50BC5,0x0BC50BC5,0xA451A451,0xD5D3FF99,0xFF99FF99,0xFF99D5D3,0xD5D3A451,0xA451634D,0x634D634D,0x634D634D,0x024101C1,0x024101C1,0x01C101C1,0x014100C1,0x00010001,0x00C10241,0x024102C1,0x024102C1,0x634DA451,0xD5D3D5D3,0xFF99FF99,0xFF99FF99,0xFF99D5D3,0xA451A451,0xA451634D,0x634D634D,0x014101C1,0x02C101C1,0x014101C1,0x01C100C1,0x00010001,0x00410241,0x02C10241,0x02410241,0x02C1634D,0xA451D5D3,0xFF99FF99,0xFF99FF99,0xFF99D5D3,0xA451A451,0xA451634D,0x634D634D,0x02410241,0x02410141,0x01410241,0x02410141,0x00010001,0x00410241,0x024102C1,0x024102C1,0x02C10BC5,0x634DA451,0xD5D3FF99,0xFF99FF99,0xFF99FF99,0xD5D3D5D3,0xA451A451,0x634D02C1,0x02C10BC5,0x02C10241,0x01C10241,0x024100C1,0x00010001,0x00410141,0x024102C1,0x0BC502C1,0x02410241,0x634DA451,0xD5D3D5D3,0xFF99FF99,0xFF99FF99,0xFF99D5D3,0xD5D3A451,0x634D0BC5,0x0BC50BC5,0x02C10241,0x024102C1,0x01410041,0x00010001,0x000101C1,0x02C102C1,0x02C102C1,0x02C102C1,0x02C1634D,0xA451A451,0xD5D3FF99,0xFF99FF99,0xFF99FF99,0xFF99D5D3,0x0BC50BC5,0x0BC502C1,0x01C102C1,0x02C10241,0x01C10001,0x00010001,0x000100C1,0x01C102C1,0x0BC50241,0x01C102C1,0x02C10241,0x634DA451,0xA451D5D3,0xFF99FF99,0xFF99FF99,0xFF99634D,0x0BC514C7,0x0BC50BC5,0x02C10241,0x024101C1,0x01C10001,0x00010001,0x00010001,0x024101C1,0x02410241,0x02C10BC5,0x02410141,0x0241634D,0xA451A451,0xD5D3FF99,0xFF99FF99,0xD5D314C7,0x14C70BC5,0x0BC502C1,0x024101C1,0x01C101C1,0x00410001,0x00010001,0x00010001,0x01410241,0x02C102C1,0x02C10BC5,0x024101C1,0x01C10141,0x634DA451,0xA451D5D3,0xFF99FF99,0x0BC50BC5,0x0BC50BC5,0x0BC50BC5,0x02C10241,0x01410141,0x00010001,0x00010001,0x00010001,0x00010141,0x024102C1,0x02C102C1,0x02C10241,0x01C101C1,0x00C1634D,0xA451A451,0xD5D302C1,0x02C10BC5,0x0BC50BC5,0x0BC502C1,0x01C101C1,0x01C10041,0x00010001,0x00010001,0x00010001,0x00010041,0x01C10241,0x024101C1,0x01C10241,0x01C101C1,0x01410141,0x01410241,0x02410241,0x02C10241,0x0BC502C1,0x01C10241,0x01C101C1,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00410141,0x01C101C1,0x01C101C1,0x02410241,0x01410141,0x014101C1,0x01C10241,0x02C102C1,0x02410241,0x02410241,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000100C1,0x01410141,0x01C10241,0x01C101C1,0x01C10141,0x01410141,0x01410241,0x02410241,0x01C101C1,0x02410241,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00C100C1,0x014101C1,0x014101C1,0x01C101C1,0x00C10141,0x014101C1,0x02410241,0x01C101C1,0x01410041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x014100C1,0x01C101C1,0x01C101C1,0x024102C1,0x02410141,0x01C10141,0x01410141,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00C10141,0x01410141,0x01C10141,0x00C10141,0x00C10041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x00410041,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoldSkulldula {0x00010001,0x00010001,0x00010001,0x00011881,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013101,0x31016241,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x938B1881,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013101,0x31016241,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x938B1881,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x10416241,0x62414983,0x18810001,0x00010001,0x49834A0B,0x4A0B4983,0x72C94A0B,0x4A0B3101,0x00010001,0x00011881,0x49834983,0x49830001,0x00010001,0x00010001,0x00010001,0x00010001,0x31014983,0x49831881,0x62411881,0x188172C9,0x72C972C9,0x72C972C9,0x72C972C9,0x72C972C9,0x72C91041,0x10416241,0x31014983,0x49833101,0x00010001,0x00010001,0x00013101,0x31016241,0x62411041,0x10411041,0x6241938B,0x938B72C9,0x938BB4D1,0xB4D1938B,0x72C94A0B,0x4A0B72C9,0x72C972C9,0x72C96241,0x10410001,0x00013101,0x62413101,0x31010001,0x00013101,0x31016241,0x62411041,0x10411041,0x6241938B,0x938B72C9,0x938BB4D1,0xB4D1938B,0x72C94A0B,0x4A0B72C9,0x72C972C9,0x72C96241,0x10410001,0x00013101,0x62413101,0x31010001,0x0001938B,0x938B6241,0x18810001,0x00010001,0xB4D14A0B,0x4A0B4A0B,0xE65BE65B,0xE65B72C9,0x72C972C9,0x72C972C9,0x72C972C9,0x72C972C9,0x18C70001,0x00011041,0x49836241,0x62410001,0x00010001,0x00010001,0x10410001,0x00013101,0xB4D14A0B,0x4A0B0001,0x4A0BB4D1,0xB4D1938B,0x72C972C9,0x72C9938B,0x72C972C9,0x72C9938B,0x4A0B0001,0x00010001,0x18810001,0x00010001,0x00010001,0x00016241,0x49833101,0x3101938B,0xE65B4A0B,0x4A0B0001,0x0001B4D1,0xB4D1938B,0x938BB4D1,0xB4D14A0B,0x00014A0B,0x4A0BB4D1,0x938B72C9,0x72C9938B,0x49830001,0x00010001,0x00010001,0x00016241,0x49833101,0x3101938B,0xE65B4A0B,0x4A0B0001,0x0001B4D1,0xB4D1938B,0x938BB4D1,0xB4D14A0B,0x00014A0B,0x4A0BB4D1,0x938B72C9,0x72C9938B,0x49830001,0x00010001,0x00010001,0x00013101,0x49834983,0x4983B4D1,0xE65B3101,0x31010001,0x00014A0B,0x4A0BB4D1,0xB4D14A0B,0x4A0B0001,0x00014A0B,0x4A0BE65B,0xE65BB4D1,0xB4D16241,0x49830001,0x00010001,0x00010001,0x00013101,0x31011041,0x1041B4D1,0xE65B4A0B,0x4A0B1041,0x18C7B4D1,0xB4D1E65B,0xE65BE65B,0xE65B72C9,0x4A0B938B,0x938BE65B,0xB4D11881,0x18811881,0x49830001,0x00010001,0x18814A0B,0x4A0B6241,0x18810001,0x00014A0B,0xB4D1B4D1,0xB4D1B4D1,0xB4D1E65B,0xE65B938B,0x938BE65B,0xE65BE65B,0xB4D1B4D1,0xB4D1B4D1,0x4A0B0001,0x00010001,0x49836241,0x62413101,0x18814A0B,0x4A0B6241,0x18810001,0x00014A0B,0xB4D1B4D1,0xB4D1B4D1,0xB4D1E65B,0xE65B938B,0x938BE65B,0xE65BE65B,0xB4D1B4D1,0xB4D1B4D1,0x4A0B0001,0x00010001,0x49836241,0x62413101,0x6241938B,0x938B3101,0x00010001,0x00010001,0x4A0B938B,0x938B938B,0xB4D1E65B,0xE65B938B,0x4A0BE65B,0xE65BB4D1,0x72C94A0B,0x4A0B72C9,0x18810001,0x00010001,0x31016241,0x62416241,0x00010001,0x00010001,0x00010001,0x00011881,0x1881938B,0x938BB4D1,0x72C9938B,0x938B938B,0x938B938B,0x938B72C9,0x4A0B938B,0x938B4A0B,0x62411041,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011881,0x188172C9,0x49836241,0x6241B4D1,0x938B938B,0x938B938B,0x72C972C9,0x72C94A0B,0x938B938B,0x938B938B,0x938B3101,0x31010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011881,0x188172C9,0x49836241,0x6241B4D1,0x938B938B,0x938B938B,0x72C972C9,0x72C94A0B,0x938B938B,0x938B938B,0x938B3101,0x31010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016241,0x62414983,0x10414983,0x4983938B,0xB4D1938B,0x938B72C9,0x4A0B72C9,0x72C972C9,0x938B6241,0x62414885,0x31014983,0x49830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016241,0x62413101,0x18811041,0x1041B4D1,0x72C94A0B,0x4A0B4A0B,0x18C718C7,0x18C74A0B,0xB4D10001,0x00013101,0x18816241,0x62410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016241,0x62411041,0x62414983,0x4983B4D1,0x4A0B4A0B,0x4A0B18C7,0x18C718C7,0x18C73101,0xB4D1938B,0x938B6241,0x10414983,0x49831041,0x00010001,0x00010001,0x00010001,0x00010001,0x00016241,0x62411041,0x62414983,0x4983B4D1,0x4A0B4A0B,0x4A0B18C7,0x18C718C7,0x18C73101,0xB4D1938B,0x938B6241,0x10414983,0x49831041,0x00010001,0x00010001,0x00010001,0x00013101,0x72C93101,0x31010001,0x62414983,0x498372C9,0x48854885,0x488518C7,0x18C74885,0x48854885,0x72C94983,0x49834983,0x10413101,0x31014983,0x62411041,0x10410001,0x00011041,0x1041B4D1,0x938B1881,0x18811881,0x62411881,0x188172C9,0x31014885,0x48854885,0x488518C7,0x18C71881,0x62411881,0x18816241,0x18811041,0x10416241,0x72C96241,0x62410001,0x00010001,0x00010001,0x00010001,0x00013101,0x62410001,0x00010001,0x10411005,0x10054885,0x48851881,0x18811005,0x10410001,0x00016241,0x18810001,0x00010001,0x00011041,0x10410001,0x00010001,0x00010001,0x00010001,0x00013101,0x62410001,0x00010001,0x10411005,0x10054885,0x48851881,0x18811005,0x10410001,0x00016241,0x18810001,0x00010001,0x00011041,0x10410001,0x00010001,0x00010001,0x000172C9,0x72C9938B,0x49830001,0x00010001,0x00010001,0x00010001,0x00011005,0x10050001,0x00010001,0x00011881,0x49831881,0x18811041,0x00010001,0x00010001,0x00010001,0x00010001,0x938BB4D1,0xB4D16241,0x10410001,0x00010001,0x00011005,0x10050001,0x00011005,0x10050001,0x00010001,0x00010001,0x49836241,0x62416241,0x10410001,0x00010001,0x00010001,0x00010001,0x49831881,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011881,0x18813101,0x00010001,0x00010001,0x00010001,0x00010001,0x49831881,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011881,0x18813101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoronBraceled {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49C51081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013945,0xAC4972C7,0x00010001,0x00010001,0x000172C7,0x72C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018B89,0xDD8B72C7,0x08410001,0x00015A47,0xFF4FDD8B,0xAC490841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841DD8B,0xFF4F8B89,0x10811081,0xFF4FFF4F,0xFF4F72C7,0x8B8972C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3945DD8B,0xDD8BDD8B,0x8B89DD8B,0xFF4FFF4F,0x49C52903,0xAC49AC49,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xAC49DD8B,0xDD8BDD8B,0xAC49DD8B,0xFF4F72C7,0x00010001,0x8B89AC49,0x8B890001,0x00010001,0x00010841,0x72C7AC49,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0xDD8B8B89,0x290372C7,0xAC49FF4F,0x5A470001,0x00010001,0x8B89AC49,0xAC491081,0x00010001,0x5A47FF4F,0xFF4FFF4F,0x29030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018B89,0xDD8B5A47,0x00010001,0x8B89FF4F,0xDD8B72C7,0x39451081,0x8B89AC49,0xAC4972C7,0x49C5DD8B,0xFF4FFF4F,0xFF4FDD8B,0x29030001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001DD8B,0xFF4F1081,0x000149C5,0xDD8BFF4F,0xFF4F72C7,0x8B898B89,0xAC49AC49,0xAC49DD8B,0xDD8BFF4F,0xFF4FFF4F,0xFF4FDD8B,0x5A470001,0x00010001,0x00010001,0x00010001,0x00010001,0x2903DD8B,0xDD8B2903,0x8B89AC49,0xFF4F72C7,0x00010001,0x49C58B89,0xAC493945,0x49C55A47,0x8B89AC49,0xFF4FFF4F,0xFF4FDD8B,0x8B890001,0x00010001,0x00010001,0x00010001,0x00010001,0x72C7DD8B,0xDD8BDD8B,0xAC495A47,0x10810001,0x00010001,0x10818B89,0xAC492903,0x00010001,0x000172C7,0xFF4FFF4F,0xDD8BDD8B,0x72C70001,0x00010001,0x00010001,0x00010001,0x00010001,0xDD8BFF4F,0xDD8BAC49,0x8B890001,0x00010001,0x00010001,0x00015A47,0xAC49AC49,0x10810001,0x3945FF4F,0xFF4FFF4F,0xDD8BDD8B,0x72C70001,0x00010001,0x00010001,0x00010001,0x00013945,0xDD8BFF4F,0xDD8BAC49,0xAC4949C5,0x00010001,0x00010001,0x00011081,0x8B89AC49,0x49C50001,0xFF4FFF4F,0xFF4FFF4F,0xDD8BDD8B,0x72C70001,0x00010001,0x00010001,0x00010001,0x0001AC49,0xFF4FDD8B,0xDD8BAC49,0xDD8BAC49,0x00010001,0x00010001,0x00012903,0x8B89DD8B,0xAC49DD8B,0xFF4FFF4F,0xFF4FDD8B,0xDD8BDD8B,0x49C50001,0x00010001,0x00010001,0x00010001,0x0841DD8B,0xFF4FDD8B,0xAC49AC49,0xFF4FDD8B,0x00010001,0x00010841,0x72C7AC49,0xAC49DD8B,0xDD8BFF4F,0xFF4FFF4F,0xFF4FDD8B,0xDD8BAC49,0x00010001,0x00010001,0x00010001,0x00010001,0x3945DD8B,0xDD8BDD8B,0xAC49DD8B,0xFF4FFF4F,0x49C50001,0x49C58B89,0xAC49AC49,0xAC49DD8B,0xFF4FFF4F,0xFF4FFF4F,0xDD8BDD8B,0xDD8B8B89,0x00010001,0x00010001,0x00010001,0x00010001,0x8B898B89,0x72C772C7,0x5A478B89,0xDD8BFF4F,0x8B898B89,0xAC49AC49,0xAC49AC49,0xDD8BDD8B,0xFF4FFF4F,0xFF4FFF4F,0xDD8BDD8B,0xDD8B3945,0x00010001,0x00010001,0x00010001,0x2903AC49,0xDD8B8B89,0x8B8972C7,0x8B898B89,0x8B895A47,0x5A4772C7,0x8B89AC49,0xAC49AC49,0xDD8BDD8B,0xFF4FFF4F,0xFF4FFF4F,0xDD8BDD8B,0xAC490001,0x00010001,0x00010001,0x00010001,0x5A47AC49,0xAC498B89,0x8B898B89,0xAC49AC49,0xAC498B89,0x72C749C5,0x49C549C5,0x8B89AC49,0xDD8BDD8B,0xFF4FFF4F,0xFF4FDD8B,0xDD8BDD8B,0x5A470001,0x00010001,0x00010001,0x00010001,0x49C549C5,0x5A478B89,0x8B89AC49,0x8B895A47,0x49C572C7,0xAC498B89,0xAC4972C7,0x5A475A47,0x8B89FF4F,0xFF4FFF4F,0xFF4FDD8B,0xDD8BDD8B,0x10810001,0x00010001,0x00010001,0x00010001,0x000149C5,0x49C572C7,0x8B89AC49,0xDD8BDD8B,0xAC4972C7,0x49C549C5,0x5A4772C7,0xAC498B89,0x72C772C7,0xAC49FF4F,0xFF4FDD8B,0xDD8BAC49,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x39453945,0x8B89AC49,0x72C772C7,0x8B8972C7,0x5A475A47,0x49C53945,0x49C549C5,0x8B89AC49,0x8B898B89,0xDD8BDD8B,0xAC4972C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10812903,0x29035A47,0xAC4972C7,0x394549C5,0x49C55A47,0x49C53945,0x49C53945,0x39455A47,0x72C7AC49,0x8B89AC49,0xDD8B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x39453945,0x49C572C7,0x8B895A47,0x39452903,0x39453945,0x49C55A47,0x49C53945,0x394549C5,0x72C7AC49,0xAC490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x29033945,0x394572C7,0x8B895A47,0x39452903,0x39453945,0x49C53945,0x49C53945,0x394572C7,0xAC490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x10812903,0x394572C7,0x8B8972C7,0x72C73945,0x39453945,0x49C572C7,0x49C53945,0x72C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x29032903,0x394549C5,0x72C78B89,0x8B89AC49,0xAC49DD8B,0x5A473945,0x39450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08412903,0x39455A47,0x5A4749C5,0x49C52903,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoronMask {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41C75A49,0x7B4BE661,0xE6615A49,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012905,0xBC91BC91,0xBC91BC91,0xBC919C0D,0x9C0D9C0D,0x310B1883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141C7,0xBC91BC91,0xBC91BC91,0xBC91BC91,0xBC919C0D,0x9C0D9C0D,0x7B4B41C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141C7,0xBC91BC91,0xBC91BC91,0xBC91BC91,0xBC91BC91,0x9C0D9C0D,0x9C0D7B4B,0x7B4B5A49,0x29050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141C7,0xBC91BC91,0xBC91BC91,0xBC91BC91,0xBC91BC91,0xBC91BC91,0x9C0D9C0D,0x9C0D9C0D,0x7B4B7B4B,0x5A491883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7B4BBC91,0xBC91BC91,0xBC91BC91,0xBC91BC91,0xBC91BC91,0xBC919C0D,0x9C0D9C0D,0x9C0D7B4B,0x7B4B7B4B,0x5A492905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001BC91,0xBC919C0D,0x5A499C0D,0xBC91BC91,0xBC91BC91,0xBC91BC91,0x9C0DBC91,0x9C0D9C0D,0x9C0D7B4B,0x7B4B7B4B,0x5A495A49,0x18830001,0x00010001,0x00010001,0x00010001,0x00012905,0xBC91BC91,0x9C0D7B4B,0x9C0D9C0D,0xBC91BC91,0xBC91BC91,0x9C0DBC91,0xBC919C0D,0x9C0D7B4B,0x9C0D7B4B,0x7B4B7B4B,0x5A495A49,0x41C70001,0x00010001,0x00010001,0x00010001,0x2905BC91,0xBC91BC91,0xBC91A465,0x729D51D7,0x9C0DBC91,0xBC91BC91,0xBC91BC91,0x9C0D9C0D,0x9C0D9C0D,0x9C0D7B4B,0x7B4B7B4B,0x7B4B5A49,0x41C71883,0x00010001,0x00010001,0x00011883,0xBC91BC91,0xBC91BC91,0xA465A465,0x729D4151,0x9C0DBC91,0xBC91BC91,0xBC919C0D,0x9C0D9C0D,0x9C0D9C0D,0x7B4B7B4B,0x7B4B5A49,0x5A495A49,0x41C72905,0x00010001,0x00010001,0x00019C0D,0xBC91BC91,0xBC919C0D,0x51D7729D,0x729D729D,0xE661E661,0xE661BC91,0xBC91BC91,0x9C0D9C0D,0x9C0D7B4B,0x7B4B7B4B,0x5A4941C7,0x5A495A49,0x5A492905,0x00010001,0x00010001,0x1883BC91,0xBC91BC91,0xBC915A49,0x51D7729D,0xA465E661,0xE661E661,0xE661BC91,0xBC91BC91,0x9C0D9C0D,0x7B4B5A49,0x41515A49,0x5A4941C7,0x5A495A49,0x41C741C7,0x18830001,0x00010001,0x2905BC91,0x9C0DBC91,0x9C0D9C0D,0x9C0DBC91,0xFFFFE661,0xFFFFE661,0xE661BC91,0xBC919C0D,0x9C0D9C0D,0x41C7310B,0x415151D7,0x5A495A49,0x41C75A49,0x5A4941C7,0x18830001,0x00010001,0x41C79C0D,0x9C0D9C0D,0x9C0DBC91,0xBC91E661,0xE661E661,0xE661E661,0xBC91BC91,0x9C0D9C0D,0x7B4B7B4B,0x310B4151,0x4151A465,0x729D5A49,0x5A495A49,0x41C741C7,0x29050001,0x00010001,0x41C77B4B,0x9C0D9C0D,0x9C0D9C0D,0xBC91BC91,0xE661E661,0xE6617B4B,0x9C0D7B4B,0x7B4B7B4B,0x7B4B7B4B,0x310B310B,0x310B51D7,0x5A497B4B,0x5A495A49,0x5A4941C7,0x29050001,0x00010001,0x18837B4B,0x7B4B5A49,0x7B4B7B4B,0x7B4B9C0D,0x9C0DBC91,0x9C0D9C0D,0x9C0D7B4B,0x7B4B7B4B,0x7B4B7B4B,0x41C7310B,0x310B310B,0x41C75A49,0x5A495A49,0x41C741C7,0x29050001,0x00010001,0x00015A49,0x5A4941C7,0x5A495A49,0x7B4B5A49,0x7B4B7B4B,0x7B4B7B4B,0x7B4B7B4B,0x7B4B7B4B,0x7B4B7B4B,0x5A495A49,0x41C741C7,0x5A495A49,0x5A495A49,0x41C741C7,0x29050001,0x00010001,0x00012905,0x41C741C7,0x41C75A49,0x5A495A49,0x5A4941C7,0x5A497B4B,0x7B4B7B4B,0x5A497B4B,0x5A497B4B,0x5A495A49,0x5A495A49,0x5A495A49,0x5A4941C7,0x41C741C7,0x29050001,0x00010001,0x00010001,0x290541C7,0x41C741C7,0x41C741C7,0x5A495A49,0x41C741C7,0x41C741C7,0x5A495A49,0x5A495A49,0x5A495A49,0x5A495A49,0x5A495A49,0x41C741C7,0x41C741C7,0x29050001,0x00010001,0x00010001,0x18832905,0x41C741C7,0x5A4941C7,0x41C741C7,0x41C741C7,0x5A4941C7,0x41C741C7,0x41C741C7,0x41C741C7,0x5A4941C7,0x41C741C7,0x41C741C7,0x41C72905,0x18830001,0x00010001,0x00010001,0x00011883,0x290541C7,0x41C75A49,0x5A495A49,0x41C741C7,0x290541C7,0x41C741C7,0x41C741C7,0x41C741C7,0x41C741C7,0x41C741C7,0x41C741C7,0x29052905,0x00010001,0x00010001,0x00010001,0x00010001,0x18831883,0x29052905,0x41C741C7,0x41C75A49,0x5A4941C7,0x29052905,0x29052905,0x29052905,0x290541C7,0x41C741C7,0x5A4941C7,0x29052905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x29052905,0x29052905,0x41C72905,0x290541C7,0x290541C7,0x290541C7,0x29052905,0x290541C7,0x41C741C7,0x310B2905,0x29050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x18831883,0x29052905,0x29052905,0x29052905,0x29052905,0x29052905,0x29052905,0x29052905,0x29051883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x18832905,0x18832905,0x18832905,0x29052905,0x29052905,0x29052905,0x29051883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x18832905,0x18832905,0x18832905,0x18831883,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoronRuby {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x084190C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000190C5,0x90C5C905,0x58C50841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000190C5,0x90C5C905,0x58C50841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x58C5C905,0xC905C905,0xC9051841,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014183,0x418320C3,0x00010001,0x00010001,0x00010001,0x000158C5,0x90C5C905,0xC90590C5,0xC90558C5,0x58C51841,0x00010001,0x00010001,0x00010801,0x08014183,0x10810001,0x00010001,0x00010841,0x0841A407,0xD58BA407,0xA4074183,0x10810841,0x084190C5,0x90C5C905,0xC90590C5,0xC90590C5,0x90C558C5,0x08414183,0x41834183,0x7285D58B,0xD58BD58B,0x00010001,0x00010001,0x00010841,0x0841A407,0xD58BA407,0xA4074183,0x10810841,0x084190C5,0x90C5C905,0xC90590C5,0xC90590C5,0x90C558C5,0x08414183,0x41834183,0x7285D58B,0xD58BD58B,0x00010001,0x00010001,0x00010801,0x08017285,0xD58BD58B,0xD58BD58B,0xD58B90C5,0x90C590C5,0xC905C905,0xC90590C5,0xC90590C5,0x90C558C5,0x7285D58B,0xD58BD58B,0xD58BA407,0xA4077285,0x00010001,0x00010001,0x00010001,0x000120C3,0x7285D58B,0xD58BD58B,0xA40790C5,0x90C5C905,0xC90590C5,0x90C558C5,0x90C5C905,0xC90590C5,0x90C5D58B,0xD58BD58B,0xA407A407,0xA40720C3,0x00010001,0x00010001,0x00010001,0x00010801,0x7285A407,0xA407D58B,0x90C5C905,0xC905C905,0x58C558C5,0x58C558C5,0x58C590C5,0x90C5C905,0xC905A407,0xA407D58B,0xA407A407,0xA4070001,0x00010001,0x00010001,0x00010001,0x00010801,0x7285A407,0xA407D58B,0x90C5C905,0xC905C905,0x58C558C5,0x58C558C5,0x58C590C5,0x90C5C905,0xC905A407,0xA407D58B,0xA407A407,0xA4070001,0x00010001,0x00010001,0x00010001,0x00010001,0x72857285,0x7285D58B,0xC905C905,0xC905C905,0x58C558C5,0x58C520C3,0x58C590C5,0x90C590C5,0xC905C905,0xC905A407,0xA4077285,0x72850001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C3A407,0xA407A407,0xA407C905,0xC905C905,0x58C558C5,0x58C558C5,0x58C590C5,0x90C5C905,0xC905D58B,0xD58B7285,0xD58B0801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001D58B,0xD58BA407,0xA407C905,0xC905C905,0x58C558C5,0x58C520C3,0x58C590C5,0x90C5C905,0x90C5A407,0xA407D58B,0xA4070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001D58B,0xD58BA407,0xA407C905,0xC905C905,0x58C558C5,0x58C520C3,0x58C590C5,0x90C5C905,0x90C5A407,0xA407D58B,0xA4070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x20C3D58B,0xA40790C5,0x90C5C905,0x58C558C5,0x58C558C5,0x58C590C5,0x90C5C905,0xA407A407,0xA407D58B,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x0801D58B,0x7285A407,0xA407C905,0x90C558C5,0x58C520C3,0x58C590C5,0x90C590C5,0xA407A407,0xA407A407,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017285,0xA407A407,0xA40790C5,0x90C558C5,0x58C558C5,0x58C590C5,0x90C558C5,0xA407D58B,0xD58B20C3,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017285,0xA407A407,0xA40790C5,0x90C558C5,0x58C558C5,0x58C590C5,0x90C558C5,0xA407D58B,0xD58B20C3,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0xD58BA407,0xA4077285,0xC90590C5,0x90C558C5,0x90C590C5,0x90C5A407,0xA407D58B,0xD58B0801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0xA407A407,0xA407A407,0xC905C905,0xC90590C5,0xC90590C5,0x90C5D58B,0xD58B7285,0x72850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C3D58B,0xD58BA407,0xA407C905,0xC905C905,0xC905A407,0xA407A407,0xD58B4183,0x41830801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C3D58B,0xD58BA407,0xA407C905,0xC905C905,0xC905A407,0xA407A407,0xD58B4183,0x41830801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0801D58B,0xD58B7285,0xA407A407,0xA407A407,0xD58BA407,0xA407A407,0xA4070801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08017285,0x7285D58B,0x72857285,0x72857285,0x72857285,0x7285D58B,0x41830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x1081D58B,0x72854183,0x41834183,0x20C3A407,0xA407D58B,0x10810801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x1081D58B,0x72854183,0x41834183,0x20C3A407,0xA407D58B,0x10810801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0xA4074183,0x41834183,0x4183D58B,0xD58B1081,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x10817285,0x72854183,0xD58B20C3,0x20C30801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014183,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014183,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dGoronTunic {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012001,0x61418A41,0x8A418A41,0x614138C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012001,0x61418A41,0x8A418A41,0x38C16141,0x61410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x100138C1,0x8A418A41,0x8A418A41,0x38C138C1,0x8A412001,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10014801,0x60018A41,0x8A418A41,0x8A418A41,0x38C16141,0x61417001,0x70011001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30014801,0x48014801,0x60017001,0x8A418A41,0x8A416141,0x38C138C1,0x61417001,0x70017001,0x70012001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x60017001,0x70017001,0x48014801,0x48016001,0x70016141,0x8A416141,0x20016001,0x70017001,0x70017001,0x70017001,0x70016001,0x20010001,0x00010001,0x00010001,0x00014801,0x70017001,0x70017001,0x70017001,0x48014801,0x48016001,0x60016141,0x614138C1,0x38C17001,0x70017001,0x70017001,0x70017001,0x70017001,0x70017001,0x70012001,0x00010001,0x00016001,0x70017001,0x70017001,0x70017001,0x60014801,0x48016001,0x60016001,0x61416141,0x61417001,0x70017001,0x70017001,0x60016001,0x70017001,0x70017001,0x70010001,0x00010001,0x00013001,0x70017001,0x70017001,0x70017001,0x48014801,0x48016001,0x4801724F,0x724F38C1,0xB5257001,0x70017001,0x60017001,0x60016001,0x60016001,0x60017001,0x30011001,0x00010001,0x00013001,0x60017001,0x70017001,0x60016001,0x48014801,0x48014801,0x6001724F,0xB525FFFF,0xB5256001,0x70017001,0x70016001,0x48014801,0x48016001,0x60016001,0x30012001,0x00010001,0x00013001,0x48016001,0x60016001,0x60016001,0x30013001,0x48016001,0x4801724F,0x724F6141,0xB525724F,0x60016001,0x60016001,0x48014801,0x48014801,0x48014801,0x30012001,0x00010001,0x00011001,0x48014801,0x48014801,0x48014801,0x20013001,0x48014801,0x60016001,0x61418A41,0x70017001,0x70016001,0x70016001,0x48013001,0x30013001,0x30014801,0x48010001,0x00010001,0x00010001,0x20013001,0x20012001,0x20012001,0x20013001,0x48014801,0x6001724F,0xB525B525,0xB5256141,0x70016001,0x60016001,0x48012001,0x20012001,0x20014801,0x20010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x20012001,0x48014801,0x4801724F,0x724FB525,0xB525724F,0x60017001,0x60016001,0x20010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20013001,0x30014801,0x600138C1,0x60016001,0x61417001,0x70016001,0x60016001,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10012001,0x48014801,0x61418A41,0xAC89AC89,0xAC896141,0x60017001,0x60016001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x38C16141,0x61416141,0xAC89EF4F,0xEF4FEF4F,0xEF4FEF4F,0xAC898A41,0x8A418A41,0x38C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x200138C1,0x38C16141,0x8A41AC89,0xEF4FEF4F,0xEF4FAC89,0x8A418A41,0x8A418A41,0x38C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10013001,0x38C138C1,0x38C1724F,0xAC89AC89,0xAC896141,0x70016141,0x61416141,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20014801,0x48016001,0x60016001,0x480138C1,0x70017001,0x70017001,0x70016001,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30014801,0x48016001,0x60017001,0x48014801,0x70017001,0x70017001,0x70017001,0x20010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30014801,0x60016001,0x60017001,0x48013001,0x60017001,0x70017001,0x70017001,0x48010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011001,0x30014801,0x48016001,0x60017001,0x48014801,0x60017001,0x70017001,0x70017001,0x48010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20014801,0x60016001,0x60016001,0x60014801,0x48017001,0x70017001,0x70016001,0x48010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20013001,0x48013001,0x48014801,0x10014801,0x48013001,0x10010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dHeardCondainer {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x18C74A11,0x294D294D,0x294D294D,0x08430001,0x00010001,0x000118C7,0x18C718C7,0x294D294D,0x294D0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x18C74A11,0x294D294D,0x294D294D,0x08430001,0x00010001,0x000118C7,0x18C718C7,0x294D294D,0x294D0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4A1183E1,0x83E1ACE9,0x83E183E1,0x83E183E1,0x731B18C7,0x18C70843,0x731B83E1,0x83E1ACE9,0x83E183E1,0x83E183E1,0x731B0843,0x08430001,0x00010001,0x00010001,0x00010001,0x000183E1,0xACE9ACE9,0xACE94A11,0x4A1181D1,0x81D1731B,0xACE983E1,0x83E183E1,0xACE983E1,0x83E181D1,0x81D14A11,0x4A1183E1,0xACE983E1,0x83E1294D,0x00010001,0x00010001,0x0001731B,0x731BEDAD,0x83E14A11,0x4A11ACE9,0xEDADF295,0xF295F295,0x81D1ACE9,0xACE9ACE9,0x83E1F295,0xF295EDAD,0xF295F295,0xF295B0C7,0x731BACE9,0xACE983E1,0x294D0001,0x00010001,0x0001731B,0x731BEDAD,0x83E14A11,0x4A11ACE9,0xEDADF295,0xF295F295,0x81D1ACE9,0xACE9ACE9,0x83E1F295,0xF295EDAD,0xF295F295,0xF295B0C7,0x731BACE9,0xACE983E1,0x294D0001,0x00010001,0x0843ACE9,0xACE9EDAD,0x731BEDAD,0xEDADEDAD,0xFFFFFFFF,0xFFFFF295,0xB0C781D1,0x81D183E1,0xF295EDAD,0xEDADEDAD,0xEDADF295,0xF295B0C7,0xB0C7ACE9,0xACE9EDAD,0x4A110843,0x08430001,0x294DFFFF,0xFFFFACE9,0xF295EDAD,0xEDADFFFF,0xFFFFFFFF,0xFFFFEDAD,0xF295B0C7,0xB0C7B0C7,0xEDADFFFF,0xFFFFEDAD,0xF295F295,0xF295B0C7,0xB0C783E1,0x83E1FFFF,0xACE918C7,0x18C70001,0x731BFFFF,0xFFFFEDAD,0xF295EDAD,0xEDADFFFF,0xFFFFFFFF,0xFFFFFFFF,0xEDADF295,0xF295EDAD,0xEDADEDAD,0xEDADEDAD,0xF295B0C7,0xB0C7B0C7,0xB0C781D1,0x81D1FFFF,0xFFFF294D,0x294D0001,0x731BFFFF,0xFFFFEDAD,0xF295EDAD,0xEDADFFFF,0xFFFFFFFF,0xFFFFFFFF,0xEDADF295,0xF295EDAD,0xEDADEDAD,0xEDADEDAD,0xF295B0C7,0xB0C7B0C7,0xB0C781D1,0x81D1FFFF,0xFFFF294D,0x294D0001,0x83E1FFFF,0xFFFFFFFF,0xB0C7EDAD,0xEDADEDAD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xEDADEDAD,0xEDADF295,0xF295B0C7,0xB0C7B0C7,0xB0C7731B,0x731BFFFF,0xFFFF18C7,0x18C70001,0x83E1FFFF,0xFFFFEDAD,0xB0C7F295,0xF295EDAD,0xEDADFFFF,0xFFFFFFFF,0xFFFFEDAD,0xEDADEDAD,0xEDADF295,0xF295F295,0xB0C7B0C7,0xB0C7B0C7,0xB0C783E1,0x83E1FFFF,0xEDAD18C7,0x18C70001,0x18C7EDAD,0xEDADFFFF,0xB0C7F295,0xF295F295,0xF295F295,0xF295EDAD,0xEDADEDAD,0xEDADEDAD,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0xB0C783E1,0x83E1FFFF,0xACE90001,0x00010001,0x18C7EDAD,0xEDADFFFF,0xB0C7F295,0xF295F295,0xF295F295,0xF295EDAD,0xEDADEDAD,0xEDADEDAD,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0xB0C783E1,0x83E1FFFF,0xACE90001,0x00010001,0x084383E1,0x83E1EDAD,0x81D1B0C7,0xB0C7B0C7,0xF295F295,0xF295F295,0xF295F295,0xF295F295,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0xB0C7ACE9,0xACE9ACE9,0x4A110001,0x00010001,0x0001294D,0x294DACE9,0xACE9B0C7,0xB0C7B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295F295,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0x731BEDAD,0xEDAD83E1,0x00010001,0x00010001,0x00010001,0x0001731B,0xACE9731B,0x731BB0C7,0xB0C7B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0xB0C781D1,0xACE983E1,0x83E1294D,0x00010001,0x00010001,0x00010001,0x0001731B,0xACE9731B,0x731BB0C7,0xB0C7B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0xB0C781D1,0xACE983E1,0x83E1294D,0x00010001,0x00010001,0x00010001,0x000118C7,0x83E1ACE9,0xACE94A11,0xB0C7B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295F295,0xF295F295,0xF295B0C7,0xB0C7ACE9,0xACE94A11,0x4A1118C7,0x00010001,0x00010001,0x00010001,0x00010843,0x4A1183E1,0x83E1ACE9,0x81D118C7,0x18C7B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295F295,0xB0C7ACE9,0xACE9ACE9,0x731B0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x08434A11,0x4A1183E1,0xACE981D1,0x81D1B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295B0C7,0xACE9EDAD,0xEDAD731B,0x294D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08434A11,0x4A1183E1,0xACE981D1,0x81D1B0C7,0xB0C7B0C7,0xB0C7F295,0xF295F295,0xF295B0C7,0xACE9EDAD,0xEDAD731B,0x294D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294D,0x83E1ACE9,0xACE9731B,0x4A11B0C7,0xB0C7F295,0xB0C781D1,0x81D183E1,0xACE9731B,0x731B18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294D83E1,0x83E1ACE9,0x731B4A11,0x4A11B0C7,0x731BACE9,0xACE9ACE9,0x731B0843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x18C7731B,0xACE983E1,0x83E183E1,0xACE983E1,0x83E1294D,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x18C7731B,0xACE983E1,0x83E183E1,0xACE983E1,0x83E1294D,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x4A1183E1,0x83E183E1,0x731B4A11,0x4A1118C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x18C7294D,0x18C70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dHeardPiece {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x08452109,0x398D398D,0x398D398D,0x08430001,0x00010001,0x00012109,0x21092109,0x398D2109,0x21090845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x08452109,0x398D398D,0x398D398D,0x08430001,0x00010001,0x00012109,0x21092109,0x398D2109,0x21090845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62D77BE1,0x7BE1A52B,0xA52B7BE1,0x7BE17BE1,0x62D72109,0x21090845,0x7BE17BE1,0x7BE1A52B,0x7BE17BE1,0x7BE17BE1,0x62D70843,0x08430001,0x00010001,0x00010001,0x00010001,0x00017BE1,0xA52BA52B,0xA52B4A11,0x398D4A11,0x4A117BE1,0xA52B7BE1,0x7BE17BE1,0xCE317BE1,0x7BE14A11,0x4A114A11,0x4A117BE1,0xA52B7BE1,0x7BE12109,0x00010001,0x00010001,0x000162D7,0x62D7A52B,0xA52B4A11,0x4A114A11,0x398D4A11,0x4A11398D,0x62D7CE31,0xCE31A52B,0x7BE14A11,0x4A114A11,0x398D4A11,0x4A114A11,0x62D7CE31,0xCE317BE1,0x21090001,0x00010001,0x000162D7,0x62D7A52B,0xA52B4A11,0x4A114A11,0x398D4A11,0x4A11398D,0x62D7CE31,0xCE31A52B,0x7BE14A11,0x4A114A11,0x398D4A11,0x4A114A11,0x62D7CE31,0xCE317BE1,0x21090001,0x00010001,0x0843A52B,0xA52BCE31,0x62D74A11,0x4A11398D,0x4A114A11,0x4A11398D,0x4A1162D7,0x62D77BE1,0x4A11398D,0x398D398D,0x4A114A11,0x4A114A11,0x62D7A52B,0xA52BCE31,0x62D70001,0x00010001,0x2109FFFF,0xFFFFCE31,0x7BE14A11,0x4A114A11,0x4A114A11,0x4A114A11,0x398D398D,0x398D4A11,0x398D398D,0x398D4A11,0x4A114A11,0x4A114A11,0x62D7A52B,0xA52BFFFF,0xCE310001,0x00010001,0x4A11FFFF,0xFFFFCE31,0x7BE14A11,0x4A114A11,0x4A114A11,0x4A11398D,0x398D398D,0x398D398D,0x398D398D,0x398D4A11,0x4A114A11,0x4A114A11,0x4A11A52B,0xA52BFFFF,0xFFFF398D,0x398D0001,0x4A11FFFF,0xFFFFCE31,0x7BE14A11,0x4A114A11,0x4A114A11,0x4A11398D,0x398D398D,0x398D398D,0x398D398D,0x398D4A11,0x4A114A11,0x4A114A11,0x4A11A52B,0xA52BFFFF,0xFFFF398D,0x398D0001,0x7BE1FFFF,0xFFFFFFFF,0x7BE162D7,0x62D74A11,0x4A114A11,0x4A11C14B,0xC14B68C7,0x68C768C7,0xC14BC14B,0xC14B68C7,0x4A114A11,0x4A1162D7,0x62D7A52B,0xA52BFFFF,0xFFFF0845,0x08450001,0x4A11FFFF,0xFFFFCE31,0x7BE162D7,0x62D762D7,0x62D7C14B,0xC14BDB19,0xDB19C14B,0xC14BC14B,0xDB19C14B,0xC14B68C7,0x398D62D7,0x62D74A11,0x62D7CE31,0xCE31FFFF,0xCE310001,0x00010001,0x2109CE31,0xCE31FFFF,0x7BE162D7,0x62D762D7,0x4A11C14B,0xC14BDB19,0xDB19DB19,0xDB19DB19,0xC14BC14B,0xC14B68C7,0x68C762D7,0x62D762D7,0x62D7A52B,0xA52BFFFF,0xA52B0001,0x00010001,0x2109CE31,0xCE31FFFF,0x7BE162D7,0x62D762D7,0x4A11C14B,0xC14BDB19,0xDB19DB19,0xDB19DB19,0xC14BC14B,0xC14B68C7,0x68C762D7,0x62D762D7,0x62D7A52B,0xA52BFFFF,0xA52B0001,0x00010001,0x00017BE1,0x7BE1CE31,0x7BE162D7,0x62D762D7,0x62D768C7,0x68C7C14B,0xC14BDB19,0xDB19C14B,0xC14BC14B,0xC14B68C7,0x4A1162D7,0x62D762D7,0x7BE1A52B,0xA52BA52B,0x4A110001,0x00010001,0x00012109,0x2109A52B,0xA52B7BE1,0x7BE14A11,0x62D762D7,0x62D768C7,0x68C7C14B,0xC14BC14B,0xC14BC14B,0xC14B68C7,0x62D762D7,0x62D74A11,0x7BE1CE31,0xCE317BE1,0x00010001,0x00010001,0x00010001,0x00017BE1,0xCE317BE1,0x7BE14A11,0x4A1162D7,0x62D74A11,0x68C768C7,0x68C7C14B,0xC14B68C7,0x68C74A11,0x4A114A11,0x4A117BE1,0xCE317BE1,0x7BE14A11,0x00010001,0x00010001,0x00010001,0x00017BE1,0xCE317BE1,0x7BE14A11,0x4A1162D7,0x62D74A11,0x68C768C7,0x68C7C14B,0xC14B68C7,0x68C74A11,0x4A114A11,0x4A117BE1,0xCE317BE1,0x7BE14A11,0x00010001,0x00010001,0x00010001,0x00010845,0x7BE1CE31,0xCE317BE1,0x4A11398D,0x398D4A11,0x68C768C7,0x68C768C7,0x68C74A11,0x4A114A11,0x398D62D7,0x62D7A52B,0xA52B4A11,0x4A110845,0x00010001,0x00010001,0x00010001,0x00010001,0x21097BE1,0x7BE1A52B,0x62D7398D,0x398D398D,0x398D398D,0x398D68C7,0x398D398D,0x398D398D,0x62D7A52B,0xA52BCE31,0x62D70845,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014A11,0x4A117BE1,0xA52B7BE1,0x7BE1398D,0x398D398D,0x398D2109,0x398D2109,0x210962D7,0xA52BCE31,0xCE3162D7,0x398D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014A11,0x4A117BE1,0xA52B7BE1,0x7BE1398D,0x398D398D,0x398D2109,0x398D2109,0x210962D7,0xA52BCE31,0xCE3162D7,0x398D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014A11,0x7BE1A52B,0xA52B7BE1,0x398D398D,0x398D398D,0x210962D7,0x62D7A52B,0xA52B7BE1,0x7BE12109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x398D7BE1,0x7BE1A52B,0x7BE162D7,0x62D74A11,0xA52BCE31,0xCE31A52B,0x62D7398D,0x398D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x21094A11,0xA52B7BE1,0x7BE1A52B,0xCE317BE1,0x7BE1398D,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x21094A11,0xA52B7BE1,0x7BE1A52B,0xCE317BE1,0x7BE1398D,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x4A117BE1,0x7BE17BE1,0x62D74A11,0x4A110845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x21092109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dHoverBoots {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x41035185,0x51856A05,0x6A056A05,0x51855185,0x51856A05,0x6A058AC7,0x8AC78AC7,0x8AC78AC7,0x51850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x8AC78AC7,0x51855185,0x410328C3,0x18835185,0x8AC78AC7,0x8AC79C13,0x8AC78AC7,0x8AC76A05,0x51850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C31883,0x28C34103,0x41035185,0x518528C3,0x6A056A05,0x6A058AC7,0x6A058AC7,0x8AC76A05,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C35185,0x6A056A05,0x6A056A05,0x518528C3,0x41035185,0x51855185,0x6A056A05,0x8AC78AC7,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x51856A05,0x51855185,0x6A056A05,0x6A054103,0x6A058AC7,0x8AC7C519,0x8AC78AC7,0x8AC76A05,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41036A05,0x6A056A05,0x6A056A05,0x410328C3,0x51858AC7,0xC519C519,0x8AC78AC7,0x8AC78AC7,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18835185,0x8AC78AC7,0x6A054103,0x51854103,0x41036A05,0x8AC78AC7,0x8AC78AC7,0x8AC78AC7,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x41031883,0x18834103,0x188328C3,0x51855185,0x6A056A05,0x6A056A05,0x6A054103,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x410328C3,0x41034103,0x41030841,0x18834103,0x41035185,0x51854103,0x51851883,0x00010001,0x00010841,0x39890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x51854103,0x72CF6A05,0x41030001,0x18834103,0x51855185,0x51856A05,0x6A0528C3,0x00010001,0x000172CF,0x39890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x6A054103,0x520B4103,0x18830841,0x28C34103,0x28C34103,0x51855185,0x6A050841,0x00010001,0x72CFC519,0x39890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x51855185,0x41034103,0x28C30841,0x51855185,0x51856A05,0x6A056A05,0x51850841,0x00013989,0xC519C519,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0x6A0572CF,0x6A055185,0x41031883,0x41036A05,0x8AC772CF,0x72CF6A05,0x51850001,0x00019C13,0xF6E3C519,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C35185,0x6A054103,0x51855185,0x518528C3,0x28C36A05,0x6A058AC7,0x6A056A05,0x6A051883,0x1883F6E3,0xC51972CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x18835185,0x6A058AC7,0x8AC75185,0x41034103,0x72CF5185,0x51855185,0x6A055185,0x51856A05,0x6A054103,0x72CFF6E3,0xC5190001,0x00010001,0x00010001,0x00010001,0x00010001,0x520BC519,0xC5199C13,0x8AC78AC7,0x6A056A05,0x518572CF,0x72CF4103,0x41036A05,0x6A055185,0x51855185,0x5185520B,0x9C13F6E3,0x39890001,0x00010001,0x00010001,0x00010001,0x0001520B,0xC519F6E3,0xF6E3F6E3,0xC51972CF,0x51854103,0x5185520B,0x51856A05,0x8AC76A05,0x8AC75185,0x410372CF,0x72CF9C13,0xC51972CF,0x00010001,0x00010001,0x00010001,0x00010001,0x3989C519,0xF6E3F6E3,0xFFFFF6E3,0xF6E39C13,0x51855185,0x520B72CF,0x6A056A05,0x6A058AC7,0x6A056A05,0x9C13C519,0xC5199C13,0xC519520B,0x00010001,0x00010001,0x00010001,0x00010001,0x9C13C519,0xF6E3FFFF,0xF6E3C519,0x8AC79C13,0x72CF5185,0x9C13C519,0xC519C519,0x9C138AC7,0x6A056A05,0x8AC79C13,0xC519C519,0x72CF0001,0x00010001,0x00010001,0x00010001,0x00011883,0x9C13C519,0xF6E3F6E3,0xF6E39C13,0x8AC772CF,0x72CF72CF,0xC519C519,0xF6E3F6E3,0xC5198AC7,0x6A056A05,0x8AC7C519,0xC519C519,0x6A050001,0x00010001,0x00010001,0x00010001,0x000172CF,0x72CFC519,0xF6E3F6E3,0x520B28C3,0x3989520B,0x72CF9C13,0xF6E3F6E3,0xFFFFF6E3,0xF6E3C519,0x6A056A05,0x72CFC519,0xC5198AC7,0x520B0001,0x00010001,0x00010001,0x00010001,0x00019C13,0x72CF9C13,0x9C139C13,0x28C372CF,0x9C13520B,0x72CFC519,0xF6E3FFFF,0xFFFFF6E3,0xF6E3C519,0xC5196A05,0x8AC7C519,0xC51972CF,0x520B0001,0x00010001,0x00010001,0x00010001,0x000172CF,0xC51972CF,0x9C139C13,0x72CF72CF,0x520B72CF,0x72CFF6E3,0xFFFFFFFF,0xF6E3F6E3,0xC5198AC7,0xC5199C13,0x9C13C519,0x9C1372CF,0x39890001,0x00010001,0x00010001,0x00010001,0x00010001,0x3989520B,0x520B520B,0x520B3989,0x520B72CF,0xC519F6E3,0xFFFFFFFF,0xF6E3F6E3,0xC519C519,0xC519C519,0xC519F6E3,0x9C13520B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x520B72CF,0xC519F6E3,0xFFFFF6E3,0xC519F6E3,0xC5198AC7,0x9C13F6E3,0xC51972CF,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x72CF72CF,0xC519F6E3,0xF6E3F6E3,0x9C136A05,0x72CF9C13,0x9C139C13,0xC5193989,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x9C1372CF,0x9C13C519,0xC519C519,0x9C1372CF,0xC519F6E3,0xC519C519,0x9C130001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39899C13,0x9C13C519,0xC519C519,0xC5199C13,0x9C13C519,0xC519520B,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013989,0x72CF72CF,0x72CF9C13,0x9C1372CF,0x520B3989,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410841,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dHylianShield {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001314F,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x529994ED,0x7BE15299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001314F,0x94EDCE33,0x52997BE1,0x7BE17BE1,0x314F1087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x108794ED,0xCE3394ED,0x52995299,0x52995299,0x7BE17BE1,0x7BE1314F,0x314F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCE3394ED,0xCE337BE1,0x4B334B33,0x31E75299,0x52995299,0x7BE17BE1,0x7BE17BE1,0x7BE1314F,0x314F1087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001CE33,0x94ED94ED,0x52994B33,0x09290929,0x4B334B33,0x4B335299,0x52995299,0x52995299,0x7BE17BE1,0x7BE194ED,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x314F94ED,0xCE33CE33,0x4B334B33,0x4B3394ED,0x09290929,0x09290929,0x31E731E7,0x4B337BE1,0x7BE17BE1,0x7BE194ED,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011087,0xCE33CE33,0xCE33FFFF,0x4B334B33,0xCE334B33,0x089B0929,0x09290929,0x09290929,0x7BE194ED,0x7BE194ED,0x94EDCE33,0x7BE10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017BE1,0xCE33CE33,0xFFFF7BE1,0x94ED94ED,0xFFFFFFFF,0x4B330929,0x092994ED,0x31E70929,0x94ED94ED,0x94ED94ED,0x94EDCE33,0x94ED0001,0x00010001,0x00010001,0x00010001,0x00010001,0x1087FFFF,0xCE33CE33,0xCE3394ED,0x4B334B33,0x0929089B,0xCE3394ED,0xCE330929,0x31E70929,0x31E77BE1,0x94EDCE33,0xCE33CE33,0xFFFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0xCE33CE33,0x7BE17BE1,0x31E74B33,0x4B334B33,0x09290929,0x089B089B,0x089B1087,0x089B089B,0x092931E7,0x529931E7,0x94EDFFFF,0xFFFF314F,0x00010001,0x00010001,0x00010001,0x0001314F,0xFFFF94ED,0x31E74B33,0x09290929,0x09290929,0x0929089B,0x52997BE1,0x089BD689,0xD6895299,0x089B089B,0x089B089B,0xCE33FFFF,0xFFFF7BE1,0x00010001,0x00010001,0x00010001,0x0001CE33,0xCE337BE1,0x4B330929,0x09290929,0x09290929,0x0929D689,0xD689D689,0x089BD689,0xD6895299,0x089B4B33,0x31E7089B,0x4B3394ED,0xFFFFCE33,0x00010001,0x00010001,0x00010001,0x0001CE33,0xCE3394ED,0x4B330929,0x09294B33,0x68D3C90D,0x31E7089B,0xD689D689,0x089B089B,0xD689314F,0x1087CE33,0x089B089B,0x31E794ED,0xFFFFCE33,0x10870001,0x00010001,0x00010001,0x314FFFFF,0xFFFF94ED,0x09290929,0x092931E7,0xC90DC90D,0x68D3089B,0x09291087,0x089B5299,0x52991087,0x4B337BE1,0x089B089B,0x09297BE1,0xCE33FFFF,0x7BE10001,0x00010001,0x00010001,0x7BE1CE33,0xCE33CE33,0xFFFFFFFF,0x092968D3,0xC90DC90D,0x1087089B,0x089B089B,0xD689D689,0xD689089B,0x7BE17BE1,0x089B089B,0x089B4B33,0xCE33FFFF,0x94ED0001,0x00010001,0x00010001,0x94EDFFFF,0xFFFFFFFF,0xCE33FFFF,0x4B330929,0x314FC90D,0x314FC90D,0xC90D089B,0x089BD689,0xD689089B,0x31E7CE33,0x5299089B,0x7BE131E7,0x94EDFFFF,0xCE33314F,0x00010001,0x00010001,0xFFFFFFFF,0xFFFF7BE1,0x089BFFFF,0x4B330929,0x089B089B,0xC90D68D3,0x314F089B,0x089B089B,0x314F1087,0x089B94ED,0x94ED94ED,0x52990929,0x7BE1CE33,0xCE337BE1,0x00010001,0x00010001,0xFFFFFFFF,0xCE3331E7,0x089B31E7,0x089B0929,0x0929C90D,0xC90D68D3,0x68D368D3,0xC90D68D3,0x089B089B,0x0929CE33,0x94ED7BE1,0x089B089B,0x4B3394ED,0xFFFFCE33,0x10870001,0x00010001,0xFFFFFFFF,0xFFFF4B33,0x0929089B,0x52997BE1,0x089B68D3,0x089B314F,0xC90DC90D,0xC90D68D3,0x089B089B,0x089B0929,0x4B3331E7,0x4B334B33,0x7BE17BE1,0x94ED7BE1,0x10870001,0x00010001,0xFFFFFFFF,0xFFFF4B33,0x0929089B,0x7BE1D689,0x5299089B,0x089B1087,0x314FC90D,0x68D3314F,0x09290929,0x4B3394ED,0x94ED94ED,0x4B335299,0x7BE17BE1,0x52991087,0x00010001,0x00010001,0xCE33FFFF,0xFFFF4B33,0x0929089B,0xD689D689,0xD68931E7,0x089B089B,0x089B089B,0x089B089B,0x089B31E7,0x94ED94ED,0x94ED7BE1,0x7BE15299,0x52995299,0x10870001,0x00010001,0x00010001,0x94EDCE33,0xCE3394ED,0x94ED31E7,0x52995299,0x314F089B,0x31E77BE1,0x94ED5299,0x089B089B,0x089B31E7,0xCE337BE1,0x7BE15299,0x52995299,0x314F0001,0x00010001,0x00010001,0x00010001,0x7BE1CE33,0x94ED94ED,0xCE337BE1,0x31E7089B,0x1087089B,0x314F7BE1,0x7BE131E7,0x089B089B,0x4B334B33,0x7BE15299,0x52995299,0x52991087,0x00010001,0x00010001,0x00010001,0x00010001,0x5299CE33,0x7BE17BE1,0x7BE17BE1,0x94ED31E7,0x089B089B,0x31E794ED,0x7BE15299,0x31E74B33,0x4B335299,0x52995299,0x5299314F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x314F94ED,0x7BE17BE1,0x7BE17BE1,0x7BE17BE1,0x94ED4B33,0x94ED7BE1,0x529931E7,0x31E75299,0x52995299,0x52995299,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10877BE1,0x52995299,0x52995299,0x52995299,0x52995299,0x314F5299,0x52995299,0x52995299,0x52995299,0x314F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015299,0x314F5299,0x314F5299,0x52995299,0x52995299,0x52995299,0x52995299,0x52995299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011087,0x1087314F,0x1087314F,0x314F314F,0x314F314F,0x314F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dIronBoots {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x49454945,0x61C592C7,0x61C561C5,0x49453103,0x494561C5,0x92C77A47,0x92C77A47,0x92C77A47,0x61C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x7A4792C7,0x49453103,0x31033103,0x18834945,0x92C792C7,0x92C7C40D,0x92C792C7,0x92C77A47,0x31030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31033103,0x31033103,0x49454945,0x49453103,0x61C561C5,0x7A477A47,0x7A477A47,0x7A477A47,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31033103,0x61C57A47,0x61C561C5,0x61C51883,0x49454945,0x494561C5,0x61C57A47,0x92C77A47,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x494561C5,0x61C561C5,0x61C561C5,0x61C53103,0x61C592C7,0x92C7C40D,0x92C792C7,0x92C77A47,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31037A47,0x7A477A47,0x7A477A47,0x49453103,0x61C592C7,0xC40DC40D,0x92C792C7,0x92C792C7,0x31030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x188361C5,0x7A477A47,0x61C54945,0x31033103,0x494561C5,0x7A47C40D,0x92C792C7,0x92C792C7,0x31030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x31031883,0x1883214B,0x18831883,0x494561C5,0x61C561C5,0x61C561C5,0x61C53103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x31031883,0x31034945,0x31030001,0x18833103,0x49454945,0x49453103,0x49451883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x49454945,0x7A4761C5,0x49450001,0x18833103,0x61C54945,0x61C561C5,0x61C53103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x61C54945,0x61C53103,0x18831883,0x31033103,0x31033103,0x494561C5,0x61C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x49453103,0x31033103,0x31030001,0x494561C5,0x61C561C5,0x61C561C5,0x61C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x61C57A47,0x61C54945,0x31031883,0x310361C5,0x7A4792C7,0x92C761C5,0x61C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x188361C5,0x61C54945,0x494561C5,0x49451883,0x31034945,0x7A477A47,0x7A4761C5,0x61C51883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x00014945,0x7A4792C7,0x7A4761C5,0x31031883,0x00013103,0x49454945,0x61C561C5,0x61C561C5,0x61C53103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3A114299,0x3A1161C5,0x7A477A47,0x61C54945,0x49454945,0x4945214B,0x49457A47,0x61C54945,0x49454945,0x61C54945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013A11,0x214B3A11,0x5B5F5B5F,0x7A4761C5,0x49454945,0x49454945,0x214B61C5,0x7A477A47,0x7A4761C5,0x49453103,0x31033A11,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x214B3A11,0x3A117C69,0xB6777C69,0x3A1161C5,0x49454945,0x49455B5F,0x49457A47,0x7A477A47,0x61C57A47,0x61C561C5,0x49454299,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x3A11214B,0x4299B677,0xB6774299,0x3A11214B,0x49453A11,0x7C694299,0x3A113A11,0x7A477A47,0x7A4761C5,0x61C561C5,0x3A114299,0x214B0001,0x00010001,0x00010001,0x00010001,0x00011883,0x5B5F3A11,0x5B5FFFFF,0x7C694299,0x3A114299,0x3A115B5F,0x3A1161C5,0x5B5F5B5F,0x429961C5,0x61C561C5,0x61C561C5,0x42994299,0x214B0001,0x00010001,0x00010001,0x00010001,0x00014299,0x42993A11,0x5B5F5B5F,0x42994299,0x42994299,0x42993A11,0x3A117C69,0xB6775B5F,0x3A113A11,0x61C561C5,0x61C53A11,0x5B5F5B5F,0x3A110001,0x00010001,0x00010001,0x00010001,0x00013A11,0x42994299,0x42994299,0x5B5F4299,0x42994299,0x5B5F214B,0x5B5FB677,0xB6774299,0x3A113A11,0x3A1161C5,0x61C54299,0x5B5F7C69,0x5B5F1883,0x00010001,0x00010001,0x00010001,0x00011883,0x5B5F214B,0x3A113A11,0x5B5F5B5F,0x42994299,0x3A113A11,0x7C69FFFF,0x7C693A11,0x42993A11,0x5B5F4299,0x3A117C69,0x7C694299,0x3A110001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x214B3A11,0x214B1883,0x5B5F4299,0x42994299,0xB677FFFF,0x5B5F4299,0x42995B5F,0x42995B5F,0x42995B5F,0x4299214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3A114299,0x42994299,0xB6777C69,0x5B5F4299,0x5B5F4299,0x42995B5F,0x5B5F4299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x42994299,0x42994299,0x42994299,0x5B5F5B5F,0x42995B5F,0x5B5F5B5F,0x5B5F3A11,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x5B5F4299,0x3A114299,0x42995B5F,0x42994299,0x42997C69,0x7C695B5F,0x3A110001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18831883,0x214B214B,0x5B5F7C69,0x4299214B,0x3A113A11,0x42990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x214B5B5F,0x3A11214B,0x18831883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dKeadonMask {0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139CB,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B59,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841FFDF,0xF7856B01,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6B01FFFF,0xFFDFCE05,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4201FFDF,0xFFDFCE05,0x42010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x2101FFDF,0xFFFFF785,0xCE052101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1081F785,0xFFFFFFDF,0xF7854201,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B01,0x39CB18C7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841F785,0xFFFFFFDF,0xF785A503,0x21010001,0x00010001,0x00010001,0x00010001,0x42018403,0xF785FFDF,0x6B010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001CE05,0xFFDFFFFF,0xFFDFCE05,0xF785F785,0xA5032101,0x08410001,0x2101A503,0xFFDFFFDF,0xF785F785,0x6B010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A503,0xFFDFFFDF,0xFFDFF785,0xF785F785,0xF785F785,0xA503CE05,0xFFDFFFDF,0xFFDFF785,0xCE05CE05,0x84030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018403,0xFFDFFFDF,0xFFDFF785,0xF785F785,0xF785F785,0xFFDFFFDF,0xFFDFFFDF,0xCE05CE05,0xA5038403,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6B01CE05,0xF785F785,0xF785F785,0xF785F785,0xF785FFDF,0xFFFFFFDF,0xF785CE05,0xCE05A503,0x6B010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018403,0xF785F785,0x8403F785,0xF785F785,0xF785F785,0xF785F785,0xF785F785,0xCE05CE05,0xA5034201,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1081F785,0xF785F785,0x8403CE05,0xF785F785,0xF785F785,0xF785CE05,0xCE05CE05,0xA5038403,0x42010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xF785F785,0xF785F785,0xCE05CE05,0xF785F785,0xF785A503,0x42018403,0x8403CE05,0xA5032101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A503,0xF785F785,0xF785F785,0xA503F785,0xF785F785,0x6B018403,0xCE05CE05,0xCE05CE05,0x84030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1081F785,0xF785F785,0xF785F785,0xF785F785,0xF785A503,0xCE05CE05,0xCE05CE05,0xA503A503,0xA5030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xA503F785,0xF785F785,0xF785F785,0xF785CE05,0xCE05CE05,0xCE05CE05,0xA503A503,0xCE05A503,0x84030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xF785F785,0xF785F785,0xA5036B59,0x4201A503,0xA503A503,0xA503A503,0xA503A503,0xA503A503,0x84030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0xF785F785,0xF785A503,0x42010841,0x10816B01,0x84038403,0x8403A503,0xA503A503,0xA503A503,0x6B010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0xCE05CE05,0xCE058403,0x6B010001,0x39CB8403,0x84038403,0x8403A503,0xA503A503,0xA503A503,0x6B010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8403CE05,0xCE05A503,0x6B014201,0x8403A503,0x84038403,0xA503A503,0xA503A503,0xA5038403,0x21010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1081A503,0x84038403,0x84036B01,0x6B018403,0xA503A503,0xA503A503,0xA503A503,0xA5038403,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014201,0x84038403,0x6B016B01,0x84038403,0xA503A503,0xFFDFA503,0xCE05CE05,0xA5036B01,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x6B018403,0x6B016B01,0x6B016B01,0x84038403,0xA503A503,0xCE056B59,0x84030841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21016B01,0x6B016B01,0x6B016B01,0x84038403,0x84036B59,0x84036B01,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014201,0x6B016B01,0x6B018403,0x6B018403,0x84038403,0x21010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x42016B01,0x6B016B01,0x84036B01,0x6B010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012101,0x42014201,0x42010841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dKeys {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118CB,0x18CB5B63,0x18CB0003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118CB,0x18CB5B63,0x18CB0003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4A9DFFFF,0xFFFFBE37,0x4A9D214F,0x214F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013A17,0xFFFF94F1,0x94F12993,0x4A9D5B63,0x5B63214F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014A9D,0x4A9DFFFF,0x94F1214F,0x214F1087,0x29935B63,0x5B635B63,0x29930003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014A9D,0x4A9DFFFF,0x94F1214F,0x214F1087,0x29935B63,0x5B635B63,0x29930003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5B63FFFF,0xFFFF94F1,0x214F214F,0x214F214F,0x214F2993,0x29934A9D,0x5B632993,0x29930003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011087,0xBE3794F1,0x94F1214F,0x214F18CB,0x18CB0001,0x08453A17,0x3A172993,0x4A9D5B63,0x5B63214F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x3A174A9D,0x4A9D18CB,0x214F0001,0x00010001,0x0001214F,0x214F18CB,0x29935B63,0x5B635B63,0x18CB0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x3A174A9D,0x4A9D18CB,0x214F0001,0x00010001,0x0001214F,0x214F18CB,0x29935B63,0x5B635B63,0x18CB0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x3A174A9D,0x4A9D214F,0x08450001,0x00010001,0x00010001,0x00014A9D,0x7C277C27,0x7C272993,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x29934A9D,0x4A9D2993,0x18CB0001,0x00010001,0x0001214F,0x214FBE37,0xBE373A17,0x3A170845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18CB4A9D,0x4A9D2993,0x5B634A9D,0x4A9D18CB,0x2993BE37,0xBE37BE37,0x29931087,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18CB4A9D,0x4A9D2993,0x5B634A9D,0x4A9D18CB,0x2993BE37,0xBE37BE37,0x29931087,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7C2794F1,0x94F14A9D,0x94F194F1,0x94F1BE37,0xBE37BE37,0xBE373A17,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00037C27,0xFFFF5B63,0x5B6318CB,0x214F2993,0x29934A9D,0x7C272993,0x29931087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000394F1,0x94F1FFFF,0x5B6318CB,0x18CB0001,0x08450845,0x08451087,0x10871087,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000394F1,0x94F1FFFF,0x5B6318CB,0x18CB0001,0x08450845,0x08451087,0x10871087,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x94F1FFFF,0xFFFF5B63,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00037C27,0xFFFF4A9D,0x4A9D1087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017C27,0x7C27FFFF,0x5B63214F,0x214F2993,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017C27,0x7C27FFFF,0x5B63214F,0x214F2993,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x7C27FFFF,0xFFFF5B63,0x18CB214F,0x214F4A9D,0x3A170001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000194F1,0xFFFF5B63,0x5B6318CB,0x18CB3A17,0x3A172993,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x08455B63,0x4A9D18CB,0x18CB4A9D,0x4A9D2993,0x29930845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x08455B63,0x4A9D18CB,0x18CB4A9D,0x4A9D2993,0x29930845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011087,0x08450845,0x0845214F,0x3A170003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dKokiriBoots {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x390361C5,0x61C57247,0x51853903,0x51853903,0x39035185,0x61C592C7,0x72477247,0x92C761C5,0x61C50841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x724792C7,0x51853903,0x390328C3,0x10813903,0x92C792C7,0x92C7AC13,0x92C792C7,0x92C792C7,0x61C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x28C328C3,0x28C328C3,0x39033903,0x51853903,0x61C561C5,0x92C792C7,0x92C792C7,0x92C77247,0x39030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C33903,0x518561C5,0x724761C5,0x61C528C3,0x39033903,0x518561C5,0x518561C5,0x724792C7,0x20830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x518561C5,0x61C561C5,0x61C561C5,0x61C528C3,0x61C592C7,0x92C792C7,0xAC1392C7,0x92C792C7,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39037247,0x724761C5,0x61C57247,0x51852083,0x518592C7,0xAC13AC13,0x92C792C7,0x92C792C7,0x51850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x208361C5,0x92C792C7,0x724761C5,0x208328C3,0x390361C5,0x92C7AC13,0x92C792C7,0x92C792C7,0x61C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x28C31081,0x20831081,0x28C328C3,0x518561C5,0x61C561C5,0x61C592C7,0x724761C5,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x390328C3,0x28C33903,0x39030801,0x10813903,0x39033903,0x39033903,0x390328C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x39035185,0x724761C5,0x39030841,0x10813903,0x518561C5,0x61C561C5,0x61C528C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013903,0x61C55185,0x51855185,0x39030841,0x20833903,0x39033903,0x518561C5,0x61C528C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x51853903,0x28C33903,0x39031081,0x39035185,0x51855185,0x51855185,0x61C52083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08013903,0x61C55185,0x61C55185,0x39030001,0x390361C5,0x724792C7,0xAC1361C5,0x61C52083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x51855185,0x61C561C5,0x51852083,0x20835185,0x92C77247,0x61C561C5,0x61C52083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x390361C5,0x724761C5,0x518528C3,0x20833903,0x39035185,0x518561C5,0x61C561C5,0x61C55185,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015185,0x61C57247,0x92C77247,0x61C55185,0x39033903,0x28C35185,0x51855185,0x51855185,0x61C561C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x518561C5,0x72477247,0x724761C5,0x51853903,0x39035185,0x61C561C5,0x72477247,0x51853903,0x39032083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015185,0x61C57247,0x724792C7,0x61C55185,0x51853903,0x518561C5,0x72477247,0xAC137247,0x61C561C5,0x51851081,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x208361C5,0x7247AC13,0xAC1361C5,0x51853903,0x39035185,0x72477247,0x72477247,0x724792C7,0x724761C5,0x61C528C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x390361C5,0x7247AC13,0x61C55185,0x51853903,0x39037247,0x92C792C7,0x724792C7,0x72477247,0x61C561C5,0x61C528C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C35185,0x51853903,0x51853903,0x51855185,0x51857247,0x61C57247,0x92C77247,0x724761C5,0x61C57247,0x61C53903,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20835185,0x51855185,0x51857247,0x61C53903,0x61C57247,0x92C7AC13,0xAC137247,0x61C561C5,0x72477247,0x61C55185,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08415185,0x72477247,0x61C528C3,0x39033903,0x61C592C7,0xAC13AC13,0x724761C5,0x61C57247,0x61C561C5,0xAC133903,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08410841,0x08410841,0x10813903,0x61C57247,0xAC137247,0x724761C5,0x72477247,0xAC13AC13,0x51850841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x08010801,0x108128C3,0x518561C5,0x61C561C5,0x61C57247,0xAC13AC13,0x72470841,0x08410801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08415185,0x61C57247,0x72477247,0xAC13AC13,0x72471081,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08412083,0x7247AC13,0xAC13AC13,0x724728C3,0x08410841,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x08411081,0x10810841,0x08410841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08010841,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dKokiriEmerald {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x31438345,0x834541C3,0x0A431081,0x10810841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10816283,0x62839449,0x834541C3,0x41C312C3,0x0A4312C3,0x12C312C3,0x12C30841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10816283,0x62839449,0x834541C3,0x41C312C3,0x0A4312C3,0x12C312C3,0x12C30841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x62839449,0x944941C3,0x0A430A43,0x0A430A43,0x0A430A43,0x0A430A43,0x0A430C03,0x0C030181,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011081,0x10819449,0x94493143,0x31430A43,0x0A4312C3,0x12C30A43,0x0A430A43,0x0A430A43,0x0A430A43,0x0A4312C3,0x01810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841C591,0xC591C591,0x314312C3,0x12C312C3,0x0C0312C3,0x12C312C3,0x0A430A43,0x0A4341C3,0x62836283,0x628312C3,0x0C030181,0x01810001,0x00010001,0x00010001,0x00010001,0x00010001,0x0841C591,0xC591C591,0x314312C3,0x12C312C3,0x0C0312C3,0x12C312C3,0x0A430A43,0x0A4341C3,0x62836283,0x628312C3,0x0C030181,0x01810001,0x00010001,0x00010001,0x00010001,0x00010001,0x3143C591,0xC5919449,0x12C312C3,0x12C30C03,0x12C30A43,0x0A430A43,0x12C38345,0x83459449,0x94496283,0x62836283,0x12C30C03,0x0C030181,0x00010001,0x00010001,0x00010001,0x00010001,0x8345C591,0xC5919449,0x12C312C3,0x12C30C03,0x0C030A43,0x0A4312C3,0xC5919449,0x94498345,0x83458345,0x83459449,0x94491643,0x16430181,0x00010001,0x00010001,0x00010001,0x00010841,0xC591C591,0xC5919449,0x0C030C03,0x0C030C03,0x0C030C03,0x0C038345,0x944941C3,0x41C36283,0x12C36283,0x628341C3,0x9449C591,0xC59112C3,0x00010001,0x00010001,0x00010001,0x00010841,0xC591C591,0xC5919449,0x0C030C03,0x0C030C03,0x0C030C03,0x0C038345,0x944941C3,0x41C36283,0x12C36283,0x628341C3,0x9449C591,0xC59112C3,0x00010001,0x00010001,0x00010001,0x00010001,0xC591C591,0xC5919449,0x16431643,0x16430C03,0x0C030C03,0x0C031643,0x62838345,0x83451643,0x16431643,0x164312C3,0x8345C591,0xC5919449,0x00010001,0x00010001,0x00010001,0x00010841,0xC591C591,0xC591C591,0x16431643,0x16431643,0x16431643,0x16430C03,0x3143C591,0xC5919449,0x16431643,0x16431643,0x9449C591,0xC5918345,0x08410001,0x00010001,0x00010001,0x00010001,0x9449C591,0xC591C591,0x16431643,0x16430C03,0x0C030C03,0x0C030C03,0x31436283,0x62839449,0x0C030C03,0x0C031643,0x94499449,0x94496283,0x00010001,0x00010001,0x00010001,0x00010001,0x9449C591,0xC591C591,0x16431643,0x16430C03,0x0C030C03,0x0C030C03,0x31436283,0x62839449,0x0C030C03,0x0C031643,0x94499449,0x94496283,0x00010001,0x00010001,0x00010001,0x00010001,0x41C39449,0x9449C591,0x12C30A43,0x0A430C03,0x0C0312C3,0x12C312C3,0x12C36283,0x628341C3,0x12C30C03,0x0C039449,0xC5918345,0x834541C3,0x00010001,0x00010001,0x00010001,0x00010001,0x08416283,0x6283C591,0x94490A43,0x0A430C03,0x12C30A43,0x0A430181,0x0A430A43,0x0A430A43,0x12C30A43,0x0A439449,0xC5913143,0x31431081,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x3143C591,0xC59112C3,0x12C30A43,0x0A430A43,0x0A430A43,0x01810181,0x01810A43,0x12C312C3,0x12C3C591,0x83453143,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x3143C591,0xC59112C3,0x12C30A43,0x0A430A43,0x0A430A43,0x01810181,0x01810A43,0x12C312C3,0x12C3C591,0x83453143,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018345,0xC5919449,0x94490A43,0x12C30A43,0x0A430A43,0x0A430181,0x01810A43,0x41C3C591,0xC5919449,0x31431081,0x10810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08418345,0xC591C591,0xC5919449,0x41C312C3,0x12C341C3,0x41C36283,0x62836283,0xC5919449,0x944941C3,0x31430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019449,0xC591C591,0xC591C591,0xC5919449,0x94499449,0x9449C591,0xC591C591,0x944941C3,0x41C341C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019449,0xC591C591,0xC591C591,0xC5919449,0x94499449,0x9449C591,0xC591C591,0x944941C3,0x41C341C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x0841C591,0xC591C591,0xC591C591,0xC591C591,0xC591C591,0xC5919449,0x94496283,0x41C36283,0x62830841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013143,0x3143C591,0xC5919449,0x9449C591,0x94499449,0x94498345,0x628341C3,0x41C36283,0x62830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019449,0x94499449,0x94498345,0x83456283,0x628341C3,0x41C341C3,0x83456283,0x62831081,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019449,0x94499449,0x94498345,0x83456283,0x628341C3,0x41C341C3,0x83456283,0x62831081,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62836283,0x628341C3,0x41C33143,0x31436283,0x83456283,0x62836283,0x10810841,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x62836283,0x62838345,0x62836283,0x62833143,0x08410841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10811081,0x10810841,0x08410841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10811081,0x10810841,0x08410841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dKokiriSword {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x108752DD,0x74250001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011087,0x952FFFFF,0xFFFFBE35,0x52DD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFF,0xFFFFFFFF,0x952F952F,0x210B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBE35FFFF,0xFFFFBE35,0x7425952F,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001BE35,0xFFFFFFFF,0xBE3552DD,0x52DD7425,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012883,0x00010001,0x00010001,0x7425FFFF,0xFFFFBE35,0x52DD52DD,0x52DD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1043D513,0x28830001,0x0001210B,0xFFFFFFFF,0xBE3552DD,0x52DD52DD,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xB2895145,0x6A091043,0x1043FFFF,0xFFFF952F,0x52DD52DD,0x52DD1043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x6A096A09,0x6A091087,0xBE35BE35,0x952F52DD,0x52DD52DD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x6A096A09,0x514552DD,0xBE35952F,0x52DD52DD,0x210B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39456A09,0xD513D513,0xD51352DD,0x52DD1087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1043D513,0xB289B289,0xD5136A09,0x210B3945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xB289D513,0xB2895145,0xB2893945,0x6A096A09,0x28830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A09,0xD513B289,0xB289B289,0x51455145,0x6A096A09,0x51450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1043D513,0xB2893945,0x39451043,0x28833945,0x39452883,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28835145,0xD513B289,0x51453945,0x00010001,0x10431043,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A09B289,0x6A095145,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xB2896A09,0x6A093945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28832883,0x39452883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dLens {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x720B7845,0x10030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011003,0xE561C8C7,0x38450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C8C7,0xE561C8C7,0x78450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017845,0xC8C7C8C7,0x78451003,0x00010001,0x00010001,0x00010001,0x10031003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001180B,0x30537845,0x3845180B,0x00010001,0x00010001,0x3845C8C7,0xC8C71003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x180B586B,0xC3F9C3F9,0x89358935,0x89358935,0x586B1003,0x0001E561,0xC8C7C8C7,0x78450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001586B,0xC3F9C3F9,0x8935586B,0x586B586B,0x586B586B,0x586B586B,0x180BC8C7,0xC8C7C8C7,0x78450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52A7C3F9,0x89358935,0x586B586B,0x586B586B,0x586B586B,0x586B586B,0x89353053,0x78457845,0x38450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001586B,0xC3F98935,0x586B52A7,0x52A71117,0x11171117,0x1117586B,0x586B586B,0x586B586B,0x30531003,0x10030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x180BC3F9,0x8935586B,0x52A752A7,0xC3F952A7,0x11171117,0x11171117,0x1117586B,0x586B586B,0x586B180B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x89358935,0x89358935,0x1117FFFF,0xC3F952A7,0x11171117,0x1117180B,0x180B1117,0x586B586B,0x586B3053,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011003,0x89358935,0x586B52A7,0x52A752A7,0x52A71117,0x720B720B,0x78457845,0x180B1117,0x1117586B,0x8935586B,0x180B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001180B,0x8935586B,0x586B1117,0x11171117,0x1117720B,0x78457845,0x78457845,0x180B1117,0x1117586B,0x586B586B,0x180BC8C7,0x78451003,0x00010001,0x00010001,0x00010001,0x00010001,0x00013053,0x8935586B,0x11171117,0x11171117,0x30537845,0x78457845,0x78457845,0x11171117,0x1117586B,0x8935586B,0x7845C8C7,0xC8C7C8C7,0x78451003,0x00010001,0x00010001,0x00010001,0x0001180B,0x586B586B,0x586B1117,0x11171117,0x78457845,0x78457845,0x78453845,0x11171117,0x11178935,0x8935586B,0x7845C8C7,0xC8C7C8C7,0xC8C71003,0x00010001,0x00010001,0x00010001,0x0001180B,0x8935586B,0x586B1117,0x1117180B,0x78457845,0x78457845,0x38451117,0x11171117,0x11178935,0x8935586B,0x30537845,0x78453845,0x00010001,0x00010001,0x00010001,0x00010001,0x0001180B,0x586B586B,0x586B1117,0x11173845,0x78453845,0x78457845,0x11171117,0x52A71117,0x586B8935,0x8935586B,0x180B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x586B586B,0x586B586B,0x1117180B,0x3845180B,0x11171117,0x111752A7,0x52A752A7,0x89358935,0x89353053,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x180B586B,0x586B586B,0x586B1117,0x11171117,0x11171117,0x111752A7,0x52A752A7,0xC3F98935,0x89353053,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001586B,0x8935586B,0x586B586B,0x11171117,0x180B1117,0x111752A7,0xC3F9C3F9,0xC3F98935,0x586B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x586BC3F9,0x586B586B,0x8935586B,0x89358935,0x586B52A7,0xC3F9C3F9,0xC3F9C3F9,0x893552A7,0x10030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10038935,0xC3F98935,0x8935586B,0x586B586B,0x89358935,0x89358935,0xC3F9C3F9,0x89358935,0x586B180B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001180B,0xC3F9FFFF,0x89358935,0x586B180B,0x180B3053,0x586B586B,0x586B586B,0x586B586B,0x586B3053,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3053C3F9,0xFFFF8935,0x8935586B,0x00010001,0x0001180B,0x180B3053,0x30533053,0x3053180B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001720B,0xC3F9FFFF,0x89358935,0x586B180B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1003720B,0xE5618935,0x8935586B,0x30530001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x180B52A7,0xE561720B,0x52A73053,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x180B586B,0x3845720B,0x720B1003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x180B180B,0x180B3845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dLighdMed {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C10841,0x08412901,0x29010841,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C10841,0x08412901,0x29010841,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012901,0x29015245,0x39C339C3,0x39C35245,0x6B055245,0x52455245,0x524518C1,0x18C10841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x39C35245,0x5245A487,0xA48783C3,0x83C36B05,0x83C383C3,0x83C383C3,0xA487A487,0xA4875245,0x18C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012901,0x29015245,0x83C3A487,0xA4875245,0x39C32901,0x290139C3,0x39C339C3,0x39C339C3,0x524583C3,0x83C3A487,0x6B052901,0x29010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012901,0x29015245,0x83C3A487,0xA4875245,0x39C32901,0x290139C3,0x39C339C3,0x39C339C3,0x524583C3,0x83C3A487,0x6B052901,0x29010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B05,0x6B05A487,0x83C339C3,0x39C35245,0x52455245,0x52457B8D,0x52457B8D,0x7B8D6B05,0x524539C3,0x39C383C3,0xA4876B05,0x6B0518C1,0x00010001,0x00010001,0x00010001,0x00010001,0x6B05A487,0xA487A487,0x52455245,0x52457B8D,0x7B8DA487,0xA4875245,0x6B057B8D,0x7B8D7B8D,0x7B8D5245,0x524539C3,0xA48783C3,0x83C35245,0x08410001,0x00010001,0x00010001,0x00015245,0x83C3C5CD,0xC5CD5245,0x7B8D7B8D,0x7B8D7B8D,0xC5CDA487,0xA4876B05,0x6B05A487,0xA4877B8D,0x7B8D7B8D,0x7B8D7B8D,0x6B05A487,0xA48783C3,0x52450001,0x00010001,0x00010001,0x00015245,0x83C3C5CD,0xC5CD5245,0x7B8D7B8D,0x7B8D7B8D,0xC5CDA487,0xA4876B05,0x6B05A487,0xA4877B8D,0x7B8D7B8D,0x7B8D7B8D,0x6B05A487,0xA48783C3,0x52450001,0x00010001,0x00010001,0x000183C3,0xC5CD83C3,0x83C383C3,0x7B8D83C3,0x83C36B05,0xA487C5CD,0xC5CD39C3,0x39C3C5CD,0xC5CDC5CD,0x6B0583C3,0x83C37B8D,0xA487A487,0xA487F747,0x6B050001,0x00010001,0x00010841,0x0841A487,0xF747A487,0xA487A487,0xA4876B05,0x6B0583C3,0x6B05C5CD,0xC5CDF759,0xC5CDF759,0xF7596B05,0x6B056B05,0x6B05A487,0xC5CD83C3,0x83C3F747,0xC5CD18C1,0x18C10001,0x00015245,0x5245F747,0xF747C5CD,0xC5CDF759,0xA4872901,0x290139C3,0x6B05A487,0xA487F759,0xF75983C3,0x83C35245,0x29012901,0x290183C3,0xF759C5CD,0xC5CDF747,0xF7475245,0x52450001,0x00015245,0x5245F747,0xF747C5CD,0xC5CDF759,0xA4872901,0x290139C3,0x6B05A487,0xA487F759,0xF75983C3,0x83C35245,0x29012901,0x290183C3,0xF759C5CD,0xC5CDF747,0xF7475245,0x52450001,0x00015245,0x5245F747,0xF747F747,0xF747F759,0xF759C5CD,0xC5CDA487,0x6B056B05,0x6B05F759,0xC5CD6B05,0x6B056B05,0xA487C5CD,0xC5CDF759,0xF759F759,0xF759F747,0xF7476B05,0x6B050001,0x00015245,0x5245F747,0xF747F747,0xF747F759,0xF759C5CD,0xC5CDC5CD,0xF759F759,0xF759F759,0xF759F759,0xF759F759,0xC5CDC5CD,0xC5CDF759,0xF759F747,0xF747F747,0xF7476B05,0x6B050001,0x000139C3,0x39C3F747,0xF747C5CD,0xC5CDC5CD,0xC5CD6B05,0x6B056B05,0xC5CDF759,0xF759C5CD,0xA487F759,0xF759C5CD,0x6B056B05,0x6B05C5CD,0xF759C5CD,0xC5CDF747,0xF74739C3,0x39C30001,0x000139C3,0x39C3F747,0xF747C5CD,0xC5CDC5CD,0xC5CD6B05,0x6B056B05,0xC5CDF759,0xF759C5CD,0xA487F759,0xF759C5CD,0x6B056B05,0x6B05C5CD,0xF759C5CD,0xC5CDF747,0xF74739C3,0x39C30001,0x000118C1,0x18C1A487,0xF747C5CD,0xC5CD7B8D,0xA4875245,0x52456B05,0xA487C5CD,0xC5CD83C3,0x83C3C5CD,0xC5CDA487,0x52456B05,0x6B05A487,0xA487A487,0xA487F747,0xA4872901,0x29010001,0x00010001,0x000183C3,0xA487A487,0xA4876B05,0x7B8D39C3,0x39C339C3,0xA487A487,0xA4876B05,0x83C3C5CD,0xC5CDA487,0x39C339C3,0x39C37B8D,0x83C383C3,0x83C3C5CD,0x6B050001,0x00010001,0x00010001,0x00012901,0x6B05C5CD,0xC5CD6B05,0x52456B05,0x6B057B8D,0xA487A487,0xA48783C3,0x83C3A487,0xA4877B8D,0x7B8D6B05,0x6B055245,0x6B05C5CD,0xC5CD6B05,0x39C30001,0x00010001,0x00010001,0x00012901,0x6B05C5CD,0xC5CD6B05,0x52456B05,0x6B057B8D,0xA487A487,0xA48783C3,0x83C3A487,0xA4877B8D,0x7B8D6B05,0x6B055245,0x6B05C5CD,0xC5CD6B05,0x39C30001,0x00010001,0x00010001,0x00010001,0x52456B05,0x6B05A487,0x52455245,0x52457B8D,0x7B8D5245,0x524539C3,0x29016B05,0x6B056B05,0x52455245,0x52455245,0xA48783C3,0x83C339C3,0x00010001,0x00010001,0x00010001,0x00010001,0x18C16B05,0x6B0583C3,0x83C36B05,0x6B0539C3,0x39C35245,0x52455245,0x52455245,0x52455245,0x52455245,0x524583C3,0x83C35245,0x524518C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139C3,0x6B05A487,0xA48783C3,0x524539C3,0x39C32901,0x39C339C3,0x39C339C3,0x6B05A487,0xA4876B05,0x52450841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139C3,0x6B05A487,0xA48783C3,0x524539C3,0x39C32901,0x39C339C3,0x39C339C3,0x6B05A487,0xA4876B05,0x52450841,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x29015245,0x524583C3,0x83C36B05,0x6B0583C3,0x6B0583C3,0x83C383C3,0x6B0539C3,0x39C339C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x08412901,0x524539C3,0x39C339C3,0x39C339C3,0x39C32901,0x39C32901,0x29010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08412901,0x290118C1,0x08410841,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08412901,0x290118C1,0x08410841,0x08410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dLullaby {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x81E181E1,0x81E1A269,0xA269A269,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x81E181E1,0x81E1A269,0xA269A269,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x595781E1,0x81E181E1,0xA269A269,0xA2690001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x595781E1,0x81E181E1,0xA269A269,0xA2690001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x595781E1,0x81E181E1,0xA269A269,0xA2690001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x59575957,0x59575957,0x81E181E1,0x81E1A269,0xA269A269,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x59575957,0x59575957,0x81E181E1,0x81E1A269,0xA269A269,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x59575957,0x59575957,0x81E181E1,0x81E1A269,0xA269A269,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x59572089,0x20892089,0x59575957,0x595781E1,0x81E181E1,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59575957,0x59572089,0x20892089,0x59575957,0x595781E1,0x81E181E1,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0x294B294B,0x294B294B,0x00010001,0x59575957,0x59572089,0x20892089,0x59575957,0x595781E1,0x81E181E1,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x0001294B,0xAB0BECDB,0xAB0BAB0B,0xECDBAB0B,0x294B0001,0x59575957,0x59572089,0x20892089,0x00010001,0x000181E1,0x81E181E1,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x294BF7BD,0xF7BDAB0B,0x294B294B,0xAB0BF7BD,0xF7BD294B,0x59575957,0x59572089,0x20892089,0x00010001,0x000181E1,0x81E181E1,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x294B294B,0xF7BDF7BD,0xF7BDF7BD,0xF7BDF7BD,0x294B294B,0x59575957,0x59572089,0x20892089,0x00010001,0x000181E1,0x81E181E1,0x20892089,0x20890001,0x00010001,0x00010001,0x0001294B,0x294BAB0B,0x294BF7BD,0x53B153B1,0xF7BD294B,0xAB0B294B,0x294B5957,0x59572089,0x20892089,0x00010001,0x00015957,0x59575957,0x20892089,0x20890001,0x00010001,0x00010001,0x294BECDB,0x294BAB0B,0xAB0B294B,0xF7BDF7BD,0x294BAB0B,0xAB0B294B,0xECDB294B,0x59572089,0x20892089,0x00010001,0x00015957,0x59575957,0x20892089,0x20890001,0x00010001,0x00010001,0x294BECDB,0x294BAB0B,0x294B294B,0x294B294B,0x294B294B,0xAB0B294B,0xECDB294B,0x59572089,0x20892089,0x00010001,0x00015957,0x59575957,0x20892089,0x20890001,0x00010001,0x00010001,0x294BAB0B,0xECDB294B,0xF7BDF7BD,0xAB0BAB0B,0xF7BDF7BD,0x294BECDB,0xAB0B294B,0x59572089,0x20892089,0x00010001,0x00010001,0x00010001,0x20892089,0x20890001,0x00010001,0x00010001,0x294B294B,0xAB0B294B,0xF7BD294B,0xECDBECDB,0x294BF7BD,0x294BAB0B,0x294B294B,0x59572089,0x20892089,0x00010001,0x00010001,0x00010001,0x20892089,0x20890001,0x00010001,0x00010001,0x294BAB0B,0x294B294B,0xECDB294B,0xECDBECDB,0x294BECDB,0x294B294B,0xAB0B294B,0x59572089,0x20892089,0x00010001,0x00010001,0x00010001,0x20892089,0x20890001,0x00010001,0x0001294B,0x294BAB0B,0xAB0B294B,0xAB0BECDB,0xECDBECDB,0xECDBAB0B,0x294BAB0B,0xAB0B294B,0x294B2089,0x20892089,0x00010001,0x00010001,0x00010001,0x20892089,0x20890001,0x00010001,0x0001294B,0xF7BD294B,0x294BAC7D,0x294B294B,0xAB0BAB0B,0x294B294B,0xAC7D294B,0x294BF7BD,0x294B2089,0x20892089,0x00010001,0x00010001,0x00010001,0x20892089,0x20890001,0x00010001,0x00010001,0x294BECDB,0x294BF7BD,0x294BAC7D,0x294B294B,0xAC7D294B,0xF7BD294B,0xECDB294B,0x20892089,0x20892089,0x00010001,0x00010001,0x00010001,0x20892089,0x20890001,0x00010001,0x0001294B,0xECDBAB0B,0xAB0B294B,0xAC7DF7BD,0xAC7DAC7D,0xF7BDAC7D,0x294BAB0B,0xAB0BECDB,0x294B2089,0x20892089,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0xAB0BAB0B,0x294B294B,0xD319AC7D,0xF7BDF7BD,0xAC7DD319,0x294B294B,0xAB0BAB0B,0x294B2089,0x20892089,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B294B,0xAC7DF7BD,0x294BD319,0xD319D319,0xD319294B,0xF7BDAC7D,0x294B294B,0x20892089,0x20892089,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294BAC7D,0xF7BDF7BD,0xF7BD294B,0xAC7DAC7D,0x294BF7BD,0xF7BDF7BD,0xAC7D294B,0x20892089,0x20892089,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0xAC7DF7BD,0xF7BDF7BD,0x294B294B,0xF7BDF7BD,0xF7BDAC7D,0x294B2089,0x20892089,0x20892089,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294BAC7D,0xAC7DAC7D,0xF7BDF7BD,0xAC7DAC7D,0xAC7D294B,0x20892089,0x20892089,0x20892089,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x294BAC7D,0xAC7DAC7D,0xAC7D294B,0x294B2089,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012089,0x2089294B,0x294B294B,0x294B2089,0x20892089,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012089,0x20892089,0x20892089,0x20892089,0x20892089,0x20892089,0x20890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dMasterSword {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08438C6D,0x8C6D3A21,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001735F,0xFFFFFFFF,0xBDAFBDAF,0x210F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x735FFFFF,0x735F735F,0x735F52A5,0x52A50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018C6D,0xFFFF735F,0x735F735F,0x735F52A5,0x31990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8C6DFFFF,0xBDAFBDAF,0xBDAF735F,0x735F3A21,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018C6D,0xFFFFBDAF,0xBDAFBDAF,0x735F8C6D,0x52A53A21,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x735FFFFF,0x8C6DBDAF,0xBDAFBDAF,0xBDAF52A5,0x3A210001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001735F,0xFFFF735F,0xBDAFBDAF,0xBDAFBDAF,0x52A53199,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x735FFFFF,0x735F8C6D,0xBDAFBDAF,0xBDAF52A5,0x31990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x735FBDAF,0xFFFF735F,0x735F8C6D,0x8C6DBDAF,0x3A213199,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0845BDAF,0x08450001,0x00010001,0x00010845,0xBDAF735F,0x735F735F,0x735F735F,0x8C6D3A21,0x3A210001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3199BDAF,0x8C6D0843,0x00010001,0x00010843,0xFFFF735F,0x735F735F,0x735F735F,0x52A53A21,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52A58C6D,0x8C6D1089,0x00010001,0x00018C6D,0xBDAF8C6D,0x735F735F,0x735F52A5,0x3A210001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52A58C6D,0x52A50845,0x00010001,0x210FFFFF,0xBDAF8C6D,0x735F735F,0x735F8C6D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52A58C6D,0x3A213A21,0x210F1089,0xFFFFBDAF,0xBDAFBDAF,0x8C6D3199,0x3A213199,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3A2152A5,0x52A58C6D,0x8C6DFFFF,0x52A5BDAF,0xBDAF3A21,0x3199210F,0x10890845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08433A21,0x3A2152A5,0x8C6DF70B,0xF70B52A5,0x52A50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011089,0xD37DD37D,0x8C6DF70B,0xF70B3A21,0x210F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xD37DD37D,0xD37D52A5,0x3A213A21,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843735F,0xFFFF3A21,0x8C6D3A21,0x31993A21,0x31990001,0x31990843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x52A5FFFF,0xD37D3199,0x210F3199,0x31993A21,0x52A552A5,0x52A552A5,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000152A5,0xFFFFD37D,0x3A213199,0x08431089,0x210F3A21,0x3A213A21,0x3A213199,0x31990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x8C6DFFFF,0xD37D52A5,0x31990843,0x08430001,0x1089210F,0x210F210F,0x210F1089,0x10890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001210F,0x8C6D8C6D,0x52A53199,0x08430001,0x00010001,0x00010843,0x08430843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013199,0x3A213A21,0x3A210843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x210F210F,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dMinued {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0D030D03,0x0D030E43,0x0E430E43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0D030D03,0x0D030E43,0x0E430E43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410D03,0x0D030D03,0x0E430E43,0x0E430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410D03,0x0D030D03,0x0E430E43,0x0E430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410D03,0x0D030D03,0x0E430E43,0x0E430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410B41,0x0B410B41,0x0D030D03,0x0D030E43,0x0E430E43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410B41,0x0B410B41,0x0D030D03,0x0D030E43,0x0E430E43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410B41,0x0B410B41,0x0D030D03,0x0D030E43,0x0E430E43,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x0B410B41,0x0B410D03,0x0D030D03,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x0B410B41,0x0B410D03,0x0D030D03,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x0B410B41,0x0B410D03,0x0D030D03,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010D03,0x0D030D03,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010D03,0x0D030D03,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010D03,0x0D030D03,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010B41,0x0B410B41,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010B41,0x0B410B41,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010B41,0x0B410B41,0x01410141,0x01410001,0x00010001,0x00010001,0x0E430E43,0x0E430E43,0x0E430E43,0x0E430E43,0x0E430B41,0x0B410B41,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x01410141,0x01410001,0x00010001,0x00010001,0x0E430E43,0x0E430E43,0x0E430E43,0x0E430E43,0x0E430B41,0x0B410B41,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x01410141,0x01410001,0x00010001,0x00010001,0x0E430E43,0x0E430E43,0x0E430E43,0x0E430E43,0x0E430B41,0x0B410B41,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x01410141,0x01410001,0x00010001,0x0E430E43,0x0E430E43,0x0E430D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x01410141,0x01410001,0x00010001,0x0E430E43,0x0E430E43,0x0E430D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x01410141,0x01410001,0x00010001,0x0E430E43,0x0E430E43,0x0E430D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x01410141,0x01410001,0x00010001,0x0E430E43,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030B41,0x0B410B41,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0E430E43,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030B41,0x0B410B41,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0E430E43,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030D03,0x0D030B41,0x0B410B41,0x0B410B41,0x0B410141,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x01410141,0x01410141,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x01410141,0x01410141,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x0B410B41,0x01410141,0x01410141,0x01410141,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x01410141,0x01410141,0x01410141,0x01410141,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x01410141,0x01410141,0x01410141,0x01410141,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010141,0x01410141,0x01410141,0x01410141,0x01410141,0x01410141,0x01410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dMirrorShield {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012001,0x50852001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x50855085,0x50855085,0x70853843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20015085,0x50855085,0x38435085,0x38435085,0x70852001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015085,0x50855085,0x50855085,0x50853843,0x50853843,0x50855085,0x50852001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012001,0x70855085,0x50855085,0x50856B5F,0x846741D1,0x38435085,0x38435085,0x50855085,0x50852001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x38437085,0x50855085,0x50855085,0x9D2F8467,0x9D2F8467,0x6B5F41D1,0x50853843,0x50855085,0x50857085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20015085,0x50855085,0x50855085,0x5A979D2F,0x9D2F9D2F,0x9D2F9D2F,0x84678467,0x846741D1,0x50853843,0x50857085,0x70850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015085,0x70855085,0x50855085,0x50858467,0x9D2F9D2F,0x5A970001,0x5A976B5F,0x41D15A97,0x41D141D1,0x6B5FA085,0x70855085,0xA0852001,0x00010001,0x00010001,0x00010001,0x00012001,0x70855085,0x50855085,0x50855A97,0x9D2F9D2F,0x9D2F6B5F,0x846741D1,0x00018467,0x41D10001,0x00010001,0x5A976B5F,0x70857085,0x70857085,0x00010001,0x00010001,0x00010001,0x38437085,0x50855085,0x50855085,0x84679D2F,0x9D2F9D2F,0x9D2F0001,0x00018467,0x00016B5F,0x6B5F0001,0x00010001,0x41D18467,0x70857085,0x7085A085,0x20010001,0x00010001,0x00012001,0x70855085,0x50855085,0x6B5F9D2F,0x9D2F9D2F,0x9D2F41D1,0x9D2F5A97,0x5A978467,0x00016B5F,0x5A970001,0x00010001,0x5A979D2F,0x5A977085,0x7085A085,0x50850001,0x00010001,0x00017085,0xA0857085,0xA0858467,0x9D2F8467,0x9D2FC675,0xFFFF8467,0x00015A97,0x5A9718C9,0x00016B5F,0x84676B5F,0x6B5F6B5F,0x6B5FC675,0x9D2FA085,0xA085A085,0xA0852001,0x00010001,0x00017085,0xF0C7A085,0xA0858467,0x6B5F41D1,0xC675C675,0xFFFFFFFF,0x6B5F41D1,0x000118C9,0x00010001,0x5A979D2F,0x9D2F9D2F,0xFFFFFFFF,0xFFFFA085,0xA085A085,0xA0857085,0x00010001,0x00017085,0xF0C7A085,0xF0C79D2F,0x6B5F6B5F,0x9D2F5A97,0xFFFF9D2F,0x84679D2F,0xC675C675,0x5A970001,0x00010001,0x18C90001,0x8467FFFF,0xFFFFC675,0xA085F0C7,0xA085A085,0x00010001,0x00017085,0xF0C7F0C7,0xF0C7C675,0x84676B5F,0x84676B5F,0xC6759D2F,0x00010001,0x000141D1,0xFFFF18C9,0x5A97FFFF,0xC6759D2F,0x41D1FFFF,0xC6758467,0x70857085,0x70857085,0x00010001,0x0001A085,0xF0C7F0C7,0xF0C7FFFF,0x6B5F6B5F,0xC67541D1,0xC675FFFF,0x00010001,0x00010001,0xFFFF18C9,0x84675A97,0x00018467,0x9D2FC675,0xC6757085,0xA0857085,0x70850001,0x00010001,0x0001A085,0xF0C7F0C7,0xF0C7FFFF,0x41D18467,0xFFFF6B5F,0x5A97FFFF,0x00010001,0x000118C9,0xC67541D1,0x5A975A97,0x18C99D2F,0x9D2FC675,0x5A97A085,0x7085A085,0x20010001,0x00010001,0x0001F0C7,0xF0C7F0C7,0xF0C7FFFF,0x5A979D2F,0xFFFF9D2F,0x41D1C675,0x18C90001,0x00010001,0x84675A97,0x00015A97,0x84679D2F,0x9D2F6B5F,0xA0855085,0x70857085,0x00010001,0x00010001,0x0001F0C7,0xF0C7F0C7,0xF0C7FFFF,0x41D141D1,0x6B5F18C9,0x8467C675,0xC6758467,0x9D2F8467,0x6B5FC675,0x6B5F5A97,0x84678467,0x84677085,0x50857085,0xA0850001,0x00010001,0x00010001,0x0001F0C7,0xF0C7F0C7,0xF0C7FFFF,0xC6755A97,0x6B5F9D2F,0xC6759D2F,0x18C941D1,0x84678467,0xC675C675,0x9D2F8467,0x84678467,0x5A977085,0x7085A085,0x38430001,0x00010001,0x00010001,0x0001F0C7,0xF0C7F0C7,0xF0C7FFFF,0xC675C675,0x846741D1,0x84670001,0x5A975A97,0x18C95A97,0x6B5F9D2F,0x9D2F8467,0x84676B5F,0x70857085,0x70855085,0x00010001,0x00010001,0x00010001,0x0001F0C7,0xF0C7F0C7,0xF0C7FFFF,0x18C90001,0x00016B5F,0x5A9718C9,0x84678467,0x6B5F5A97,0x6B5F8467,0x9D2F8467,0x6B5FA085,0x50857085,0x70850001,0x00010001,0x00010001,0x00010001,0x2001F0C7,0xF0C7F0C7,0xF0C7C675,0x00010001,0x00016B5F,0x41D141D1,0x5A975A97,0x41D16B5F,0x5A975A97,0x5A978467,0xA0855085,0x5085A085,0x38430001,0x00010001,0x00010001,0x00010001,0x2001F0C7,0xF0C7A085,0x84678467,0x00010001,0x18C96B5F,0x6B5F18C9,0x18C918C9,0x18C941D1,0x5A975A97,0x84678467,0x70855085,0x70857085,0x00010001,0x00010001,0x00010001,0x00010001,0x3843F0C7,0xA085A085,0xF0C78467,0x6B5F8467,0x84676B5F,0x6B5F6B5F,0x6B5F6B5F,0x6B5F6B5F,0x6B5F6B5F,0x6B5FA085,0x50855085,0xA0850001,0x00010001,0x00010001,0x00010001,0x00010001,0x3843F0C7,0xA0857085,0xA0855A97,0x5A975A97,0x41D15A97,0x508541D1,0x41D15085,0x50855085,0x50855085,0x70855085,0x5085A085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3843A085,0x70857085,0x50853843,0x38435085,0x50853843,0x38433843,0x38433843,0x38433843,0x38433843,0x38435085,0x70857085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5085A085,0x70853843,0x38433843,0x38433843,0x38433843,0x38433843,0x38433843,0x38433843,0x38433843,0x38435085,0x70850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x38437085,0x38433843,0x38433843,0x38433843,0x38433843,0x38435085,0x70855085,0x70855085,0x50855085,0x38433843,0x20010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20012001,0x20013843,0x20013843,0x20012001,0x20012001,0x38432001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dOcarinaFairy {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18853989,0x420B20C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x524DA499,0xA49983D5,0x83D583D5,0x29470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x6B11A499,0xA499A499,0x83D583D5,0x6B116B11,0x420B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013989,0x6B11A499,0xA49983D5,0x6B1183D5,0x83D583D5,0x6B11524D,0x29470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x83D5A499,0xA499A499,0x83D50001,0x00016B11,0x6B116B11,0x524D524D,0x18850001,0x188583D5,0x83D53989,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x83D5A499,0xA499A499,0x524D420B,0x6B1120C5,0x00016B11,0x6B11524D,0x524D3989,0x00010001,0x524D83D5,0x83D583D5,0x83D5420B,0x08430001,0x00010001,0x00010001,0x00010001,0x6B11A499,0xA499A499,0xA4996B11,0x00010001,0x6B1183D5,0x6B116B11,0x524D524D,0x420B0843,0x00010001,0x20C56B11,0x83D56B11,0x6B1183D5,0x83D53989,0x08430001,0x00010843,0x3989A499,0xA499A499,0xA499420B,0x524D83D5,0x20C520C5,0x83D56B11,0x6B11524D,0x524D524D,0x29470001,0x00010001,0x000120C5,0x6B116B11,0x13091309,0x6B116B11,0x83D5A499,0xA499A499,0xA499A499,0xA499A499,0x6B110001,0x000183D5,0x83D583D5,0x6B116B11,0x524D524D,0x524D420B,0x00010001,0x00010001,0x00010001,0x39896B11,0x6B111309,0x13091309,0x3595A499,0xA499A499,0xA499A499,0xA499A499,0x83D520C5,0x20C583D5,0x83D56B11,0x6B11524D,0x524D524D,0x524D0843,0x00010001,0x00010001,0x00010001,0x00012947,0x524D524D,0x13093595,0xC6A7A499,0xA499A499,0xA499C6A7,0xC6A7A499,0x83D583D5,0x83D56B11,0x6B116B11,0x524D524D,0x524D524D,0x18850001,0x00010001,0x00010001,0x00010001,0x00010001,0x39896B11,0x13093595,0xA499A499,0xA499A499,0xC6A7C6A7,0x83D583D5,0x83D583D5,0x83D56B11,0x6B11524D,0x524D524D,0x524D3989,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843524D,0x83D583D5,0xA499A499,0xA499C6A7,0xC6A783D5,0x83D583D5,0x83D56B11,0x6B116B11,0x524D524D,0x524D524D,0x524D0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001420B,0x83D5A499,0xA499A499,0xA499A499,0x83D583D5,0x83D583D5,0x6B116B11,0x6B11524D,0x524D524D,0x524D420B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C5,0x83D583D5,0xA49983D5,0xA49983D5,0x83D583D5,0x3989524D,0x6B11524D,0x18853989,0x524D524D,0x420B0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x83D5A499,0x83D583D5,0x83D583D5,0x83D56B11,0x00010001,0x524D2947,0x00011885,0x524D524D,0x29470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C5,0x83D583D5,0x83D583D5,0x83D583D5,0x83D56B11,0x08431885,0x6B11420B,0x18853989,0x524D2947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x83D583D5,0x83D583D5,0x83D56B11,0x6B116B11,0x6B116B11,0x6B11524D,0x524D524D,0x39890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x524D6B11,0x6B116B11,0x6B110843,0x524D524D,0x00011885,0x420B524D,0x524D420B,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x29476B11,0x6B116B11,0x18850001,0x29473989,0x00010001,0x524D524D,0x39890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013989,0x420B524D,0x398920C5,0x420B524D,0x3989420B,0x524D3989,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x2947420B,0x420B420B,0x420B524D,0x524D524D,0x18850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C5,0x3989420B,0x524D420B,0x39890843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08430843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dOcarinaTime {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x108718C9,0x18C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843214F,0x52A37C37,0x7C377C37,0x52A30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x214F52A3,0x7C379D3F,0x9D3F7C37,0x7C37636D,0x214F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x214F7C37,0x9D3F9D3F,0x9D3F9D3F,0x7C377C37,0x636D636D,0x18C90001,0x000118C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x31D97C37,0x9D3F636D,0x52A39D3F,0x9D3F7C37,0x636D636D,0x636D421D,0x00010001,0x636DBE3D,0x7C3718C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x214F7C37,0x9D3F9D3F,0x9D3F18C9,0x084352A3,0x7C377C37,0x636D636D,0x52A3214F,0x00010001,0x31D99D3F,0x9D3F7C37,0x421D0845,0x00010001,0x00010001,0x00010001,0x00010001,0x1087636D,0x9D3F9D3F,0x9D3FBE3D,0x9D3F31D9,0x1087636D,0x636D636D,0x636D52A3,0x421D0845,0x00010001,0x1087636D,0x9D3F9D3F,0x7C37636D,0x10870001,0x00010001,0x00010001,0x0843421D,0x7C379D3F,0x9D3FBE3D,0xBE3D52A3,0x9D3F7C37,0x7C377C37,0x7C37636D,0x52A352A3,0x421D0001,0x00010001,0x000131D9,0x636D9D3F,0x9D3F7C37,0x636D31D9,0x18C90843,0x00010845,0x636D9D3F,0x9D3F636D,0xBE3DBE3D,0x31D90001,0x31D97C37,0x7C37636D,0x636D52A3,0x52A3421D,0x08430001,0x00010001,0x00010845,0x52A3636D,0x9D3F7C37,0x421D421D,0x52A38C65,0x52A37C37,0x9D3F9D3F,0x52A30843,0x31D9BE3D,0x52A31087,0x421D7C37,0x7C37636D,0x52A3421D,0x421D31D9,0x00010001,0x00010001,0x00010001,0x108752A3,0x636DBE3D,0x8C65421D,0x421D8C65,0x7C379D3F,0xBE3DBE3D,0x52A30001,0x214F9D3F,0x9D3F636D,0x9D3F7C37,0x636D52A3,0x421D421D,0x421D1087,0x00010001,0x00010001,0x00010001,0x0001214F,0x214F8C65,0xBE3D8C65,0x8C657C37,0x9D3FBE3D,0xBE3DFFFF,0xBE3D7C37,0xBE3D9D3F,0x7C377C37,0x7C3752A3,0x52A3421D,0x421D421D,0x214F0001,0x00010001,0x00010001,0x00010001,0x00010843,0x18C98C65,0xBE3DBE3D,0x7C379D3F,0xBE3DBE3D,0xFFFFFFFF,0xBE3D9D3F,0x9D3F9D3F,0x7C37636D,0x636D421D,0x31D9421D,0x31D9421D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x421D8C65,0x8C658C65,0x9D3FBE3D,0xBE3DFFFF,0xFFFFBE3D,0x9D3F9D3F,0x9D3F7C37,0x7C37636D,0x421D421D,0x31D9421D,0x421D0845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C98C65,0x7C379D3F,0xBE3DBE3D,0xFFFFBE3D,0xBE3D9D3F,0x9D3F9D3F,0x7C3752A3,0x52A331D9,0x31D931D9,0x31D9421D,0x214F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017C37,0x9D3F9D3F,0xBE3DBE3D,0xBE3DBE3D,0x9D3F7C37,0x31D9421D,0x52A352A3,0x421D421D,0x31D931D9,0x421D421D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31D99D3F,0x9D3FBE3D,0x7C37214F,0x52A39D3F,0x9D3F1087,0x000131D9,0x421D421D,0x52A331D9,0x31D931D9,0x421D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011087,0x9D3F9D3F,0x9D3FBE3D,0x52A30001,0x10879D3F,0x7C37214F,0x214F52A3,0x52A3421D,0x421D31D9,0x31D9421D,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000152A3,0x9D3F9D3F,0x9D3FBE3D,0x7C3731D9,0x52A3636D,0x52A3421D,0x52A3421D,0x31D931D9,0x31D931D9,0x421D1087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08457C37,0x9D3F9D3F,0xBE3D9D3F,0x9D3F636D,0x636D421D,0x421D31D9,0x31D931D9,0x31D931D9,0x31D9421D,0x18C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C99D3F,0x9D3F9D3F,0x9D3F7C37,0x636D52A3,0x421D1087,0x0845214F,0x31D931D9,0x31D931D9,0x421D0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x636D9D3F,0x9D3F7C37,0x636D0845,0x084331D9,0x31D918C9,0x0001214F,0x31D931D9,0x31D931D9,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52A37C37,0x636D636D,0x52A318C9,0x0001421D,0x31D9421D,0x31D931D9,0x31D931D9,0x214F0845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x421D636D,0x52A352A3,0x421D421D,0x52A331D9,0x31D931D9,0x31D931D9,0x214F18C9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C9421D,0x421D31D9,0x31D931D9,0x31D931D9,0x31D931D9,0x214F0845,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C9,0x214F31D9,0x31D931D9,0x31D9214F,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08451087,0x10870845,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dOddMedicine {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x10411041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x49454945,0x61C97A49,0x61C930C5,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C5,0x494561C9,0x61C9930B,0xAB8DAB8D,0xAB8D7A49,0x30C51883,0x10410841,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08414945,0x61C97A49,0x930B930B,0x930BAB8D,0xAB8DD40D,0xD40DD40D,0xAB8D930B,0xAB8D930B,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C561C9,0x7A49930B,0x930B930B,0x930BAB8D,0xAB8DD40D,0xD40DAB8D,0x930BAB8D,0xAB8DAB8D,0x930B61C9,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x7A49930B,0x7A49930B,0x930B930B,0x930B930B,0xAB8DD40D,0xD40DAB8D,0xAB8DAB8D,0x930B930B,0x930B930B,0x930B1883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C5,0xAB8DAB8D,0xAB8D930B,0x930B7A49,0x61C97A49,0x930BAB8D,0xAB8D930B,0xAB8D930B,0x930B930B,0x930BAB8D,0xAB8DD40D,0x30C50841,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C5,0xAB8D930B,0x930B7A49,0x7A4961C9,0x61C961C9,0x7A497A49,0x7A497A49,0x930B7A49,0x7A49930B,0x930BAB8D,0xAB8DD40D,0xAB8D7A49,0x49450841,0x00010001,0x00010001,0x00010001,0x00017A49,0x7A497A49,0x7A497A49,0x7A4961C9,0x494561C9,0x930B930B,0xD991930B,0x7A49930B,0x930BAB8D,0x930B930B,0xAB8DAB8D,0xAB8DAB8D,0x930B61C9,0x00010001,0x00010001,0x00010001,0x0001AB8D,0x930B930B,0x7A497A49,0x61C961C9,0xAB8DD991,0xD40DD40D,0xD991D991,0xD991D40D,0xAB8D930B,0xAB8DAB8D,0xAB8DAB8D,0xAB8DAB8D,0xAB8D1883,0x00010001,0x00010001,0x00010001,0x30C5AB8D,0xAB8DAB8D,0x930B7A49,0x7A49930B,0xFD1FFD1F,0xFD1FFD1F,0xFFFFFD1F,0xD991D40D,0xD991930B,0x930B930B,0xAB8DD40D,0xAB8DD40D,0xAB8D0841,0x00010001,0x00010001,0x00010001,0x7A49AB8D,0xAB8D930B,0xAB8DAB8D,0x61C9D40D,0xFD1FFD1F,0xFD1FFD1F,0xD40DD991,0xD40DD40D,0xD991D991,0x7A49AB8D,0xAB8DD40D,0xD40DD40D,0xAB8D0001,0x00010001,0x00010001,0x000130C5,0x930B930B,0x7A497A49,0x7A497A49,0xD991D40D,0xD991FD1F,0xFD1FFD1F,0xD40DD991,0xD40DD991,0xD991D991,0x7A49930B,0xAB8DAB8D,0xD40DD40D,0x7A490001,0x00010001,0x00010001,0x0001AB8D,0xAB8D930B,0x7A494945,0x61C961C9,0xD991D991,0xD991FFFF,0xFD1FD40D,0xD40DD991,0xD991D991,0xD40DD40D,0x61C9AB8D,0xAB8DD40D,0xAB8DD40D,0x10410001,0x00010001,0x00010001,0x1041AB8D,0xAB8D930B,0x7A497A49,0x61C961C9,0xD40DD991,0xD991D40D,0xD991D991,0xD991D991,0xD991D991,0xD40D7A49,0x7A49AB8D,0xAB8DAB8D,0xD40D930B,0x00010001,0x00010001,0x00010001,0x4945AB8D,0x930BAB8D,0x930BAB8D,0x930B930B,0xD991D40D,0xD991D991,0xD991D991,0xD991D991,0xD40DD991,0x7A494945,0xAB8DD40D,0xAB8DAB8D,0xD40D7A49,0x00010001,0x00010001,0x00010001,0x61C9AB8D,0x930BAB8D,0xAB8DAB8D,0x930B7A49,0xD991D40D,0xD99161C9,0xD991930B,0xD991D991,0xD991D991,0x61C961C9,0xD40DD40D,0xD40DAB8D,0xAB8D0001,0x00010001,0x00010001,0x00010001,0x930BAB8D,0xAB8DD40D,0xD40DAB8D,0x930B7A49,0xAB8DD40D,0xD991D991,0x61C9D991,0x930B7A49,0xD99130C5,0x4945930B,0xD40DD40D,0xD40DD40D,0x7A490001,0x00010001,0x00010001,0x00011883,0xAB8DD40D,0xD40DD40D,0xD40DD40D,0xAB8DAB8D,0xAB8D930B,0x7A49D991,0x7A49930B,0x7A494945,0x49454945,0x930BAB8D,0xAB8DD40D,0xD40DD40D,0x49450841,0x00010001,0x00010001,0x00014945,0x7A49930B,0xAB8DD40D,0xAB8DAB8D,0xD40DD40D,0x7A49930B,0x930B7A49,0x930B7A49,0x7A497A49,0x7A497A49,0x930B930B,0x930BAB8D,0xAB8DAB8D,0x08410001,0x00010001,0x00010001,0x00017A49,0x7A49930B,0xAB8DAB8D,0xAB8DD40D,0xAB8D930B,0x61C97A49,0x930BD40D,0xAB8DAB8D,0xD40DAB8D,0x7A497A49,0x61C97A49,0x7A497A49,0x930B30C5,0x00010001,0x00010001,0x00010001,0x104161C9,0x61C97A49,0x930BAB8D,0xAB8DAB8D,0xAB8D7A49,0x61C97A49,0xAB8DAB8D,0x930BD40D,0xD40DAB8D,0x930B61C9,0x61C961C9,0x61C961C9,0x61C90001,0x00010001,0x00010001,0x00010001,0x08411041,0x30C561C9,0x930B930B,0x930BAB8D,0x930B4945,0x61C97A49,0x930B930B,0xAB8DAB8D,0xAB8DAB8D,0x930B61C9,0x61C961C9,0x61C97A49,0x61C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18834945,0x7A49930B,0x61C961C9,0x7A49930B,0x930B930B,0xAB8DAB8D,0x930B7A49,0x7A497A49,0x61C97A49,0x7A497A49,0x61C90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C5,0x18837A49,0x7A497A49,0x930B930B,0xAB8D930B,0x930B930B,0x7A497A49,0x930B7A49,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C530C5,0x61C97A49,0x930B930B,0x930B1883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dOddMushroom {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20434103,0x41034103,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043C053,0xF11BF11B,0xEB09C1CD,0xC053984D,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0xF11BEB09,0xCC9BEB09,0xFE65EB09,0xC1CDC053,0x984D2043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001EB09,0xF11BCC9B,0xFE65FE65,0xFE65EB09,0xEB09C1CD,0xC1CD7945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x984DF11B,0xF11BFFFF,0xFFFFFFFF,0xFE65EB09,0xC053C053,0xC053984D,0x60470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0xF11BF11B,0xF11BFE65,0xFFFFFE65,0xCC9BEB09,0xC053C053,0xC053984D,0x60472043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043EB09,0xEB09EB09,0xF11BF11B,0xF11BCC9B,0xEB09EB09,0xC1CD984D,0x984D984D,0x60474103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437945,0xEB09EB09,0xEB09EB09,0xF11BF11B,0xF11BF11B,0xEB09EB09,0xC1CDC1CD,0x984D7945,0x60474103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017945,0xEB09EB09,0xEB09EB09,0xEB09EB09,0xF11BF11B,0xC053C1CD,0xC1CDEB09,0xC1CD7945,0x79457945,0x79454103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7945C1CD,0xC053EB09,0xEB09FE65,0xFE65EB09,0xF11BF11B,0xF11BF11B,0xC053C1CD,0xEB09C1CD,0x79457B0D,0x62056205,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016047,0xF11BF11B,0xF11BF11B,0xFFFFFFFF,0xFFFFFFFF,0xFE65F11B,0xF11BF11B,0xC053984D,0x7945EB09,0x7B0D7945,0x62052043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C053,0xF11BF11B,0xF11BCC9B,0xFE65FE65,0xFFFFFFFF,0xFE65F11B,0xF11BF11B,0xF11BC053,0xC0537945,0x7B0D7945,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043C1CD,0xC1CDC1CD,0xC1CDF11B,0xEB09FE65,0xFE65FE65,0xCC9BEB09,0xF11BF11B,0xC053C053,0xC053984D,0x984D7945,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437945,0x984D984D,0xC053C053,0xC053C1CD,0xEB09EB09,0xEB09EB09,0xEB09C1CD,0xC053C053,0x984D984D,0x984D984D,0x60472043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016047,0x60476047,0x6047984D,0x984D984D,0x7945C1CD,0x7B0DC1CD,0x984DC1CD,0xC1CDC1CD,0xC1CD984D,0x984D6047,0x60476047,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x41036047,0x60476047,0x60476047,0x60477945,0x79457945,0x7945C053,0xC053F11B,0xC1CDC1CD,0x79457945,0x60476047,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20434103,0x41036205,0x41036047,0x60476047,0x79457945,0x79457945,0x984DC1CD,0xCC9BF11B,0xC1CD984D,0x79457945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x41034103,0x60474103,0x41034103,0x41034103,0x79457945,0x79456047,0x984D7B0D,0xC053984D,0x79457945,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0x41034103,0x41036205,0x62056205,0x41034103,0x79457945,0x6205984D,0x7945984D,0x984D7945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCC9BFE65,0xFFFF7B0D,0x62057B0D,0x7B0D4103,0x41036205,0x62056205,0x7B0D6205,0x79457945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016205,0xFE65FFFF,0xFFFFFE65,0xCC9B7B0D,0x7B0D4103,0x79454103,0x79456205,0x7B0D7B0D,0x7B0D4103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043FE65,0xFE65FFFF,0xFFFFFE65,0xCC9B7B0D,0x7B0D4103,0x62056205,0x62057945,0x79457945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCC9BFE65,0xFFFFFFFF,0xFE65CC9B,0xCC9B7B0D,0x62050001,0x20432043,0x41032043,0x20432043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0xFE65FFFF,0xFFFFFFFF,0xFE65CC9B,0xCC9B7B0D,0x62050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016205,0xCC9BFE65,0xFE65FE65,0xCC9BCC9B,0x7B0D7B0D,0x7B0D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0xCC9BCC9B,0xCC9BCC9B,0xCC9BCC9B,0xCC9B7B0D,0x62050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437B0D,0x7B0D7B0D,0x7B0DCC9B,0xCC9B7B0D,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62057B0D,0x7B0D7B0D,0x7B0D7B0D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41036205,0x62050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dPoacherSaw {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20434103,0x41034103,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043C053,0xF11BF11B,0xEB09C1CD,0xC053984D,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0xF11BEB09,0xCC9BEB09,0xFE65EB09,0xC1CDC053,0x984D2043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001EB09,0xF11BCC9B,0xFE65FE65,0xFE65EB09,0xEB09C1CD,0xC1CD7945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x984DF11B,0xF11BFFFF,0xFFFFFFFF,0xFE65EB09,0xC053C053,0xC053984D,0x60470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0xF11BF11B,0xF11BFE65,0xFFFFFE65,0xCC9BEB09,0xC053C053,0xC053984D,0x60472043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043EB09,0xEB09EB09,0xF11BF11B,0xF11BCC9B,0xEB09EB09,0xC1CD984D,0x984D984D,0x60474103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437945,0xEB09EB09,0xEB09EB09,0xF11BF11B,0xF11BF11B,0xEB09EB09,0xC1CDC1CD,0x984D7945,0x60474103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017945,0xEB09EB09,0xEB09EB09,0xEB09EB09,0xF11BF11B,0xC053C1CD,0xC1CDEB09,0xC1CD7945,0x79457945,0x79454103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7945C1CD,0xC053EB09,0xEB09FE65,0xFE65EB09,0xF11BF11B,0xF11BF11B,0xC053C1CD,0xEB09C1CD,0x79457B0D,0x62056205,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016047,0xF11BF11B,0xF11BF11B,0xFFFFFFFF,0xFFFFFFFF,0xFE65F11B,0xF11BF11B,0xC053984D,0x7945EB09,0x7B0D7945,0x62052043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C053,0xF11BF11B,0xF11BCC9B,0xFE65FE65,0xFFFFFFFF,0xFE65F11B,0xF11BF11B,0xF11BC053,0xC0537945,0x7B0D7945,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043C1CD,0xC1CDC1CD,0xC1CDF11B,0xEB09FE65,0xFE65FE65,0xCC9BEB09,0xF11BF11B,0xC053C053,0xC053984D,0x984D7945,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437945,0x984D984D,0xC053C053,0xC053C1CD,0xEB09EB09,0xEB09EB09,0xEB09C1CD,0xC053C053,0x984D984D,0x984D984D,0x60472043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016047,0x60476047,0x6047984D,0x984D984D,0x7945C1CD,0x7B0DC1CD,0x984DC1CD,0xC1CDC1CD,0xC1CD984D,0x984D6047,0x60476047,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x41036047,0x60476047,0x60476047,0x60477945,0x79457945,0x7945C053,0xC053F11B,0xC1CDC1CD,0x79457945,0x60476047,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20434103,0x41036205,0x41036047,0x60476047,0x79457945,0x79457945,0x984DC1CD,0xCC9BF11B,0xC1CD984D,0x79457945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x41034103,0x60474103,0x41034103,0x41034103,0x79457945,0x79456047,0x984D7B0D,0xC053984D,0x79457945,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0x41034103,0x41036205,0x62056205,0x41034103,0x79457945,0x6205984D,0x7945984D,0x984D7945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCC9BFE65,0xFFFF7B0D,0x62057B0D,0x7B0D4103,0x41036205,0x62056205,0x7B0D6205,0x79457945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016205,0xFE65FFFF,0xFFFFFE65,0xCC9B7B0D,0x7B0D4103,0x79454103,0x79456205,0x7B0D7B0D,0x7B0D4103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2043FE65,0xFE65FFFF,0xFFFFFE65,0xCC9B7B0D,0x7B0D4103,0x62056205,0x62057945,0x79457945,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCC9BFE65,0xFFFFFFFF,0xFE65CC9B,0xCC9B7B0D,0x62050001,0x20432043,0x41032043,0x20432043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0xFE65FFFF,0xFFFFFFFF,0xFE65CC9B,0xCC9B7B0D,0x62050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016205,0xCC9BFE65,0xFE65FE65,0xCC9BCC9B,0x7B0D7B0D,0x7B0D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014103,0xCC9BCC9B,0xCC9BCC9B,0xCC9BCC9B,0xCC9B7B0D,0x62050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437B0D,0x7B0D7B0D,0x7B0DCC9B,0xCC9B7B0D,0x41030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62057B0D,0x7B0D7B0D,0x7B0D7B0D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41036205,0x62050001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dPockedCucco {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xB0015843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3001B001,0x30013001,0xB001B001,0x30015843,0x30010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5843B001,0xB001B001,0xB001B001,0xB001B001,0xB0010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3001B001,0xB001B001,0xA5298AC7,0xB001B001,0xB0010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0x63191083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015843,0x8AC7FFFF,0xFFFFFFFF,0xC631B001,0x30010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC631A529,0xA529C631,0x63190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0xFFFFC631,0x4211C631,0xC631A529,0x63190001,0x00010001,0x00010001,0x00010001,0x0001A529,0x63198421,0x84218421,0xC6314211,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0xC631A529,0x00018421,0xC631A529,0x8AC71083,0x00010001,0x00010001,0x00010001,0x10836319,0xA529A529,0xA529A529,0xA529A529,0x10830001,0x00010001,0x00010001,0x00010001,0x00016319,0xC6318421,0x00014211,0xA529A529,0xC401C401,0x10830001,0x00010001,0x00010001,0x21096319,0xA529A529,0xA529A529,0xA529A529,0x42110001,0x00010001,0x00010001,0x00010001,0x0001C631,0xA529A529,0x42116319,0x8421C401,0xC401C401,0x8AC70001,0x00010001,0x00010001,0x42118421,0xA529A529,0xA529A529,0xA529A529,0xA5290001,0x00010001,0x00010001,0x00010001,0x0001C631,0xA529A529,0x84216319,0x8AC78AC7,0x8AC78AC7,0x8AC73101,0x00010001,0x00010001,0x63198421,0xA529A529,0xA529A529,0xA529A529,0xA5294211,0x00010001,0x00010001,0x00010001,0x0001C631,0xA5298421,0x84218421,0x63193001,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0x8421A529,0xA529A529,0xA529A529,0xA529A529,0x00010001,0x00010001,0x00010001,0x0001C631,0xA5298421,0x84218421,0x58433001,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0xA529A529,0xA529A529,0xA529A529,0xA529A529,0x42110001,0x00010001,0x00010001,0x1083C631,0xC631A529,0x84216319,0x58435843,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0x8421A529,0xA529A529,0xA529A529,0xA529A529,0xA5290001,0x00010001,0x00010001,0x1083C631,0xC631C631,0x84218421,0x5843B001,0x00010001,0x00010001,0x00010001,0x00010001,0x6319A529,0xA529A529,0xA529A529,0x8421FFFF,0xFFFFC631,0xC6318421,0x00010001,0x00010001,0x4211FFFF,0xC631C631,0xA5298421,0x63195843,0x00010001,0x00010001,0x00010001,0x00010001,0x4211A529,0xA529A529,0xA529A529,0x8421FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC631,0xA5296319,0xFFFFC631,0xC631C631,0xA529A529,0x84211083,0x00010001,0x00010001,0x00010001,0x00010001,0x2109A529,0xA529A529,0xA529A529,0xA529FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC631C631,0xC631C631,0xC631A529,0x84212109,0x00010001,0x00010001,0x00010001,0x00010001,0x21098421,0xA529A529,0xA5298421,0xA529FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC631FFFF,0xC631C631,0xC631C631,0x84214211,0x00010001,0x00010001,0x00010001,0x00010001,0x00018421,0xA529A529,0xA5298421,0xA529FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC631,0xFFFFC631,0xC631C631,0xC631C631,0xA5298421,0x10830001,0x00010001,0x00010001,0x00010001,0x00016319,0xA529A529,0x84216319,0xC631C631,0xFFFFC631,0xFFFFFFFF,0xFFFFC631,0xFFFFC631,0xC631C631,0xC631C631,0xC631A529,0xA5298421,0x10830001,0x00010001,0x00010001,0x00010001,0x00012109,0xA529A529,0x63196319,0xC631C631,0xC631FFFF,0xFFFFFFFF,0xC631C631,0xC631C631,0xA529A529,0xC631C631,0xA529C631,0xA529A529,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x8421A529,0x84214211,0xC631C631,0xA529C631,0xC631A529,0xA529A529,0xC631C631,0x6319C631,0xC631C631,0xA529A529,0xA529A529,0x42110001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109A529,0x63194211,0xC631C631,0xC631A529,0x8421A529,0xC631A529,0xC6316319,0x6319C631,0xC631A529,0xA529A529,0xA5298421,0x63190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0x63196319,0xA529C631,0xA5298421,0x84218421,0xA529C631,0x84216319,0x8421A529,0xA529A529,0xA529A529,0xA5298421,0x63190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x63196319,0x6319C631,0xC631C631,0xA529A529,0xC6318421,0x63196319,0x8421A529,0xA529A529,0x84218421,0x84218421,0x42110001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10836319,0x21096319,0x84218421,0xC631A529,0x42116319,0x63196319,0x84218421,0x84218421,0x84218421,0x84216319,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x00010001,0x10832109,0x21092109,0x63196319,0x63196319,0x63198421,0x63198421,0x63198421,0x63191083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10834211,0x42114211,0x42116319,0x63194211,0x42114211,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10831083,0x31011083,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013101,0x31013101,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dPockedEgg {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x49877BDB,0x7BDB2109,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987FFFF,0xFFFFFFFF,0xC62DC62D,0x9CE32109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017BDB,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC62D,0xC62D9CE3,0x49870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x2109FFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC62D,0xC62D9CE3,0x9CE31885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC62D,0xC62D9CE3,0x9CE37BDB,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC62DC62D,0xC62D9CE3,0x9CE37BDB,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001C62D,0xC62DFFFF,0xFFFFFFFF,0xFFFFFFFF,0xC62DC62D,0xC62D9CE3,0x9CE37BDB,0x6A490801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1041C62D,0xFFFFC62D,0xFFFFFFFF,0xFFFFC62D,0xC62DC62D,0x9CE39CE3,0x7BDB7BDB,0x7BDB1885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109C62D,0xC62DC62D,0xFFFFC62D,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0x9CE37BDB,0x7BDB2109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4987C62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0x7BDB7BDB,0x7BDB4987,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x4987C62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0x7BDB7BDB,0x7BDB6A49,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x49879CE3,0xC62DC62D,0xC62DC62D,0xC62D9CE3,0xC62DFFFF,0xC62DC62D,0x9CE37BDB,0x7BDB4987,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49879CE3,0x9CE39CE3,0xC62D9CE3,0x9CE3C62D,0xC62DC62D,0xFFFFC62D,0x7BDB7BDB,0x7BDB7BDB,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10414987,0x6A499CE3,0x9CE39CE3,0x9CE3C62D,0x9CE39CE3,0xC62DFFFF,0xC62DC62D,0x9CE37BDB,0x7BDB1885,0x31030801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014987,0x8B09D4CF,0x8B097BDB,0x9CE39CE3,0x9CE39CE3,0x9CE39CE3,0x9CE3C62D,0xC62D9CE3,0x9CE37BDB,0x7BDB3103,0x49873103,0x31030801,0x00010001,0x00010001,0x00010001,0x00010001,0xD4CFABCD,0x6A498B09,0xD4CF6A49,0x7BDB7BDB,0x9CE37BDB,0x9CE37BDB,0x7BDBC62D,0xC62D9CE3,0x7BDB7BDB,0x21094987,0x49874987,0x49876A49,0x08010001,0x00010001,0x00010001,0x00010001,0x3103D4CF,0xABCD8B09,0xABCDD4CF,0xABCD7BDB,0x7BDB7BDB,0x7BDB7BDB,0x7BDB6A49,0x7BDB6A49,0x7BDB6A49,0x49878B09,0x6A493103,0x6A493103,0x00010001,0x00010001,0x00010001,0x00010001,0x8B098B09,0xD4CF8B09,0x6A498B09,0x8B09ABCD,0xD4CFABCD,0xABCD8B09,0xABCD7BDB,0x8B098B09,0x8B094987,0x6A494987,0x49878B09,0x8B094987,0x18850001,0x00010001,0x00010001,0x00010801,0x8B096A49,0xABCDD4CF,0xD4CF8B09,0xABCDABCD,0x8B096A49,0x49876A49,0x49874987,0x8B098B09,0x49878B09,0x8B09ABCD,0x6A498B09,0xABCD3103,0x08010001,0x00010001,0x00010001,0x00010801,0x49876A49,0x8B09ABCD,0xABCDD4CF,0xD4CFABCD,0x8B098B09,0xD4CFABCD,0xD4CFABCD,0x8B094987,0x8B09ABCD,0x8B093103,0x3103ABCD,0x6A493103,0x10410001,0x00010001,0x00010001,0x00010001,0x4987ABCD,0x6A496A49,0x49874987,0xABCDABCD,0xABCD8B09,0x8B098B09,0xD4CFABCD,0xD4CFABCD,0xABCD8B09,0x31038B09,0xABCD6A49,0x8B094987,0x08010001,0x00010001,0x00010001,0x00010001,0x10413103,0x31036A49,0xABCDD4CF,0xABCD6A49,0x6A494987,0xABCD6A49,0x6A496A49,0x8B098B09,0x49874987,0x8B09ABCD,0x6A496A49,0x31031041,0x00010001,0x00010001,0x00010001,0x00010001,0x08010801,0x08010801,0x4987ABCD,0x6A498B09,0x8B098B09,0xD4CFABCD,0xABCDABCD,0x8B094987,0x31034987,0x6A494987,0x31033103,0x10410801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A49,0x8B09ABCD,0x8B098B09,0x8B096A49,0x6A496A49,0x8B091041,0x08013103,0x49870801,0x08010801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08010001,0x00014987,0x31030001,0x00011041,0x31030001,0x00010001,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dPrelude {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC587C587,0xC587F709,0xF709F709,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xC587C587,0xC587F709,0xF709F709,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C5C587,0xC587C587,0xF709F709,0xF7090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C5C587,0xC587C587,0xF709F709,0xF7090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C5C587,0xC587C587,0xF709F709,0xF7090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C583C5,0x83C583C5,0xC587C587,0xC587F709,0xF709F709,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C583C5,0x83C583C5,0xC587C587,0xC587F709,0xF709F709,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C583C5,0x83C583C5,0xC587C587,0xC587F709,0xF709F709,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x83C583C5,0x83C5C587,0xC587C587,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x83C583C5,0x83C5C587,0xC587C587,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x83C583C5,0x83C5C587,0xC587C587,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x0001C587,0xC587C587,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x0001C587,0xC587C587,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x0001C587,0xC587C587,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x000183C5,0x83C583C5,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x000183C5,0x83C583C5,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x000183C5,0x83C583C5,0x39833983,0x39830001,0x00010001,0x00010001,0xF709F709,0xF709F709,0xF709F709,0xF709F709,0xF70983C5,0x83C583C5,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0xF709F709,0xF709F709,0xF709F709,0xF709F709,0xF70983C5,0x83C583C5,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0xF709F709,0xF709F709,0xF709F709,0xF709F709,0xF70983C5,0x83C583C5,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0xF709F709,0xF709F709,0xF709C587,0xC587C587,0xC587C587,0xC587C587,0xC587C587,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0xF709F709,0xF709F709,0xF709C587,0xC587C587,0xC587C587,0xC587C587,0xC587C587,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0xF709F709,0xF709F709,0xF709C587,0xC587C587,0xC587C587,0xC587C587,0xC587C587,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0xF709F709,0xC587C587,0xC587C587,0xC587C587,0xC587C587,0xC58783C5,0x83C583C5,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xF709F709,0xC587C587,0xC587C587,0xC587C587,0xC587C587,0xC58783C5,0x83C583C5,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xF709F709,0xC587C587,0xC587C587,0xC587C587,0xC587C587,0xC58783C5,0x83C583C5,0x83C583C5,0x83C53983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x39833983,0x39833983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x39833983,0x39833983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x83C583C5,0x39833983,0x39833983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013983,0x39833983,0x39833983,0x39833983,0x39833983,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013983,0x39833983,0x39833983,0x39833983,0x39833983,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013983,0x39833983,0x39833983,0x39833983,0x39833983,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dPrescripdion {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x318F1909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x84678467,0x52991909,0x10850843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x84678467,0x846773E3,0x84678467,0x73E35299,0x52991909,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x84678467,0x73E38467,0x84678467,0x84678467,0x84678467,0x8467635F,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011909,0x84678467,0x84678467,0x73E3635F,0x73E38467,0x84678467,0x8CEB8467,0x8467635F,0x318F1909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014213,0x84678CEB,0x73E38467,0x8467318F,0x318F4213,0x635F8467,0x84678467,0x84678CEB,0x8CEB8CEB,0x73E30843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018CEB,0x8CEB8467,0x8CEB8CEB,0x635F4213,0x73E3635F,0x4213318F,0x4213635F,0x8CEB8CEB,0x8CEB8CEB,0x8CEB5299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08438CEB,0x8CEB8467,0x84678467,0x421373E3,0x8CEBA32F,0xA32F8467,0x73E3318F,0x73E38467,0x84678CEB,0x8CEB5299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x19098CEB,0x84678467,0x846773E3,0x42138CEB,0xC8F5C8F5,0xA32F8467,0x73E3318F,0x84678CEB,0x8CEB8CEB,0x84674213,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8CEB8CEB,0x8CEB8CEB,0x8CEB4213,0x635F8467,0xA32FC8F5,0xC8F5A32F,0x52995299,0x8CEB8467,0x84678CEB,0x73E30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011909,0x8CEB8467,0x8CEB8467,0x8467318F,0x8CEB8CEB,0xC8F5A32F,0x84678CEB,0x318F73E3,0x84678CEB,0x8CEB8CEB,0x52990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018CEB,0x8CEB8467,0x8CEB8CEB,0x84674213,0x318F5299,0x84678CEB,0x8CEB73E3,0x42138CEB,0x8CEB8CEB,0x8CEB8CEB,0x318F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x19098CEB,0x84678467,0x84678CEB,0x8CEB8CEB,0x8467635F,0x42134213,0x52995299,0x635F8CEB,0x8CEB8CEB,0x8CEB8467,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x84678467,0x84678467,0x73E34213,0x529973E3,0x84678CEB,0x8CEB73E3,0x635F4213,0x84678CEB,0x8CEB8CEB,0x8CEB5299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x84678467,0x73E373E3,0x73E38467,0x5299635F,0x318F635F,0x635F8CEB,0x8CEB8CEB,0x8CEB8CEB,0x8CEB8CEB,0x8CEB318F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011909,0x73E373E3,0x635F5299,0x635F8467,0x73E3635F,0x5299635F,0x421373E3,0x635F8467,0x8CEB8CEB,0x8CEB8CEB,0x84670001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011909,0x73E373E3,0x635F4213,0x52995299,0x84678467,0x73E3635F,0x635F5299,0x635F73E3,0x8CEB8467,0x8CEB8CEB,0x52990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015299,0x73E373E3,0x73E373E3,0x73E35299,0x73E35299,0x5299635F,0x73E38467,0x635F73E3,0x73E38467,0x84678467,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018467,0x73E373E3,0x635F635F,0x84678467,0x8467635F,0x635F635F,0x42135299,0x421373E3,0x84678467,0x84675299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x19098467,0x846773E3,0x73E35299,0x42135299,0x635F635F,0x635F73E3,0x635F635F,0x4213635F,0x846773E3,0x73E34213,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x84678467,0x84678467,0x8CEB8467,0x8CEB73E3,0x635F635F,0x318F635F,0x8CEB8467,0x73E38467,0x73E38467,0x73E31909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1909318F,0x635F8CEB,0x8CEB8CEB,0x8CEB8CEB,0x8CEB8467,0x73E373E3,0x42134213,0x84678467,0x8CEB8467,0x84671909,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10855299,0x84678CEB,0x8CEB8CEB,0x8CEB8CEB,0x8CEB8467,0x8CEB635F,0x84678CEB,0x8CEB8467,0x84670001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843318F,0x4213635F,0x73E38CEB,0x8CEB8CEB,0x84678CEB,0x84678CEB,0x84678CEB,0x73E30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085318F,0x73E38467,0x8CEB8CEB,0x8CEB8CEB,0x8CEB8CEB,0x52990001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001318F,0x73E38CEB,0x8CEB8CEB,0x8CEB8CEB,0x318F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085635F,0x84678CEB,0x8CEB73E3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085635F,0x84675299,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dQuiver30 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49459247,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016209,0x8B4D9247,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x62098B4D,0x8B4DA459,0x31490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0xA4598B4D,0xA459EE65,0xA45930C3,0x30C31841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016209,0xA459A459,0xEE65A459,0x62099247,0x92474945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001A459,0xEE65EE65,0xA4598B4D,0x8B4D8B4D,0x62090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10836209,0xEE65A459,0xA459A459,0x8B4D8B4D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C3EE65,0xA4596209,0xA459A459,0x62090841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08410001,0x00011083,0xEE65A459,0x31493149,0x31491083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019247,0xB2C930C3,0x20C3EE65,0xA45920C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x92479247,0xB2C99247,0x8B4D8B4D,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016209,0x9247B2C9,0x92479247,0x924720C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4945B2C9,0xB2C99247,0x92479247,0xB2C96209,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014945,0x6209B2C9,0x92479247,0x9247B2C9,0xB2C96209,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49456209,0xA4598B4D,0x62099247,0xB2C9B2C9,0x49454945,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x6209A459,0xB2C96209,0x4945B2C9,0xB2C94945,0x49450841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C36209,0xA459B2C9,0xB2C9B2C9,0x62096209,0x49454945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x6209A459,0xB2C9B2C9,0xB2C9B2C9,0x620930C3,0x30C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C36209,0xA459A459,0x49459247,0xB2C96209,0x30C320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x6209A459,0x8B4D4945,0x49456209,0x620930C3,0x30C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18416209,0x8B4DA459,0x494530C3,0x62096209,0x20C330C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x62098B4D,0xA4594945,0x49456209,0x620930C3,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18419247,0xB2C98B4D,0x49454945,0x62096209,0x20C320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x9247B2C9,0x92476209,0x62096209,0x62093149,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019247,0xB2C99247,0x92479247,0xB2C96209,0x20C320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18416209,0x92479247,0x9247B2C9,0x924730C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C34945,0x49459247,0xB2C99247,0x494520C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x49454945,0x92474945,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x184120C3,0x20C31841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dQuiver40 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41456A07,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A07,0x8B4B8B4B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x520D8B4B,0x8B4BA417,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0xA4178B4B,0xA417E6B1,0x8B4B30C3,0x30C31043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001520D,0xA417AD69,0xE6B1A417,0x6A078B4B,0x8B4B4145,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017BDF,0xAD69E6B1,0xA4178B4B,0x8B4B8B4B,0x6A070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015AD7,0xE6B1A417,0x8B4BA417,0x8B4B8B4B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C5E6B1,0xA4176A07,0xA417A417,0x520D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x10430001,0x00011043,0xAD698B4B,0x41452949,0x29491043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017BDF,0x5AD72949,0x30C3E6B1,0xA41730C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x5AD77BDF,0xFFFF7BDF,0x7BDF8B4B,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015AD7,0x7BDFFFFF,0xE6B1E6B1,0xAD695AD7,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5AD77BDF,0xE6B1E6B1,0xE6B1AD69,0x7BDFAD69,0xAD690001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x520DE6B1,0xE6B1FFFF,0xAD697BDF,0xAD695AD7,0x7BDF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41456A07,0xA4177BDF,0xE6B1AD69,0x7BDF7BDF,0x5AD75AD7,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x6A07A417,0x5AD76A07,0x520D7BDF,0x7BDF5AD7,0x5AD70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41456A07,0xA417AD69,0x7BDF7BDF,0x520D5AD7,0x5AD77BDF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x6A07A417,0xAD69AD69,0xAD69AD69,0x520D30C3,0x294920C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C36A07,0xA417A417,0x41455AD7,0x520D520D,0x30C330C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011043,0x6A07A417,0x8B4B30C3,0x4145520D,0x520D30C3,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10436A07,0x8B4BA417,0x41454145,0x520D520D,0x30C330C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C5,0x6A075AD7,0xA4174145,0x4145520D,0x520D30C3,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C57BDF,0xAD69A417,0x41454145,0x520D520D,0x30C330C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C5,0x7BDFAD69,0xFFFFAD69,0x520D520D,0x520D30C3,0x20C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015AD7,0xAD69FFFF,0xE6B1AD69,0x7BDF520D,0x30C320C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C55AD7,0xE6B1E6B1,0xAD697BDF,0x7BDF520D,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C34145,0x7BDFAD69,0x7BDF7BDF,0x5AD72949,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x30C34145,0x5AD75AD7,0x20C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104330C3,0x30C32949,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dQuiver50 {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49457B4D,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001628B,0x7B4D7B4D,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5A097B4D,0x7B4DB517,0x31030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x9C157B4D,0xB517E65D,0x9C153103,0x31031841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015A09,0x9C15E65D,0xE65D9C15,0x5A097B4D,0x7B4D4945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019C15,0xB517E65D,0xB5177B4D,0x7B4D7B4D,0x49450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001628B,0xFFFF9C15,0x9C159C15,0x7B4D7B4D,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C3E65D,0x9C15628B,0x9C159C15,0x5A090841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x08410001,0x00011083,0xE65D9C15,0x31493149,0x31491083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B4D,0x7B4D3103,0x3149E65D,0x9C1520C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x9C157B4D,0xE65D7B4D,0x7B4D9C15,0x20C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001628B,0x7B4DE65D,0xB517E65D,0xB5175A09,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5A097B4D,0xB517B517,0xE65DB517,0x7B4DB517,0x9C150001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014945,0x628BB517,0xE65DE65D,0xB5177B4D,0x9C155A09,0x9C150001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x49455A09,0xB5179C15,0xE65DB517,0x7B4D9C15,0x5A09628B,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x5A099C15,0x7B4D4945,0x49457B4D,0x9C15628B,0x628B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3103628B,0xB517B517,0x7B4D7B4D,0x628B628B,0x4945628B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x5A099C15,0xB517B517,0x9C15B517,0x5A093103,0x314920C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31035A09,0x9C159C15,0x4945628B,0x5A095A09,0x310320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x5A09B517,0x7B4D4945,0x49455A09,0x5A093103,0x31030841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10835A09,0x7B4D9C15,0x49454945,0x5A095A09,0x314920C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x5A097B4D,0x9C154945,0x49455A09,0x5A093103,0x31030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C37B4D,0x9C159C15,0x49454945,0x5A095A09,0x310320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x7B4D9C15,0xE65DB517,0x5A095A09,0x5A093103,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00017B4D,0x9C15E65D,0xE65DB517,0x7B4D5A09,0x310320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C34945,0xE65DE65D,0x9C159C15,0x628B5A09,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C34945,0x7B4DB517,0x7B4D7B4D,0x628B3149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013103,0x31033103,0x7B4D628B,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C33103,0x20C320C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSariaSong {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1C4F1C4F,0x1C4F2593,0x25932593,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1C4F1C4F,0x1C4F2593,0x25932593,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B1C4F,0x1C4F1C4F,0x25932593,0x25930001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B1C4F,0x1C4F1C4F,0x25932593,0x25930001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B1C4F,0x1C4F1C4F,0x25932593,0x25930001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B130B,0x130B130B,0x1C4F1C4F,0x1C4F2593,0x25932593,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B130B,0x130B130B,0x1C4F1C4F,0x1C4F2593,0x25932593,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B130B,0x130B130B,0x1C4F1C4F,0x1C4F2593,0x25932593,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x130B130B,0x130B0945,0x09450945,0x130B130B,0x130B1C4F,0x1C4F1C4F,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x294B0001,0x0001294B,0x294B0001,0x130B130B,0x130B0945,0x09450945,0x130B130B,0x130B1C4F,0x1C4F1C4F,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B048F,0x048F294B,0x294B048F,0x048F294B,0x130B130B,0x130B0945,0x09450945,0x130B130B,0x130B1C4F,0x1C4F1C4F,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x0001294B,0x048F8E8D,0x048F048F,0x048F048F,0x8E8D048F,0x294B130B,0x130B0945,0x09450945,0x00010001,0x00011C4F,0x1C4F1C4F,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x294B048F,0x048FF7BD,0x8E8D8E8D,0x8E8D8E8D,0xF7BD048F,0x048F294B,0x130B0945,0x09450945,0x00010001,0x00011C4F,0x1C4F1C4F,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x294B048F,0x048F048F,0xF7BDF7BD,0xF7BDF7BD,0x048F048F,0x048F294B,0x130B0945,0x09450945,0x00010001,0x00011C4F,0x1C4F1C4F,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x294B048F,0x8E8D048F,0x048F048F,0x048F048F,0x048F8E8D,0x048F294B,0x130B0945,0x09450945,0x00010001,0x0001130B,0x130B130B,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0x048F8E8D,0x048F294B,0x294B048F,0x048F294B,0x294B048F,0x8E8D048F,0x294B0945,0x09450945,0x00010001,0x0001130B,0x130B130B,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0x048F048F,0x294BA2C9,0xA2C9294B,0x294BA2C9,0xA2C9294B,0x048F048F,0x294B0945,0x09450945,0x00010001,0x0001130B,0x130B130B,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0x048F048F,0x294BECDB,0x294BECDB,0xECDB294B,0xECDB294B,0x048F048F,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0x048F048F,0x294BECDB,0x294BECDB,0xECDB294B,0xECDB294B,0x048F048F,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x294B048F,0x294BA2C9,0xECDBECDB,0xECDBECDB,0xA2C9294B,0x048F294B,0x09450945,0x09450945,0x00010001,0x00010001,0x00010001,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x294B294B,0x294B294B,0xA2C9A2C9,0xA2C9A2C9,0x294B294B,0x294B294B,0x09450945,0x09450945,0x00010001,0x00010001,0x00010001,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0xF7BD294B,0xF7BDF7BD,0x294B294B,0x294B294B,0xF7BDF7BD,0x294BF7BD,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0xF7BD294B,0x294BF7BD,0x294BEE91,0xEE91294B,0xF7BD294B,0x294BF7BD,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x09450945,0x09450001,0x00010001,0x00010001,0x0001294B,0x294BA2C9,0x294B8E8D,0xF7BD294B,0x294BF7BD,0x8E8D294B,0xA2C9294B,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0xA2C9ECDB,0xECDB294B,0x8E8D8E8D,0x8E8D8E8D,0x294BECDB,0xECDBA2C9,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294BA2C9,0xECDB294B,0x294B294B,0x294B294B,0x294BECDB,0xA2C9294B,0x09450945,0x09450945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x048F294B,0x294B8E8D,0x048F048F,0x048F048F,0x8E8D294B,0x294B048F,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x048F048F,0x8E8D294B,0x048F048F,0x048F048F,0x294B8E8D,0x048F048F,0x294B0945,0x09450945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B048F,0x294B048F,0x048F8E8D,0x8E8D048F,0x048F294B,0x048F294B,0x09450945,0x09450945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294B,0x294B294B,0x048F048F,0x048F048F,0x294B294B,0x294B0945,0x09450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010945,0x09450945,0x294B294B,0x294B294B,0x09450945,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010945,0x09450945,0x09450945,0x09450945,0x09450945,0x09450945,0x09450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSerenade {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0C330C33,0x0C330CFF,0x0CFF0CFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0C330C33,0x0C330CFF,0x0CFF0CFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30C33,0x0C330C33,0x0CFF0CFF,0x0CFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30C33,0x0C330C33,0x0CFF0CFF,0x0CFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30C33,0x0C330C33,0x0CFF0CFF,0x0CFF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0C330C33,0x0C330CFF,0x0CFF0CFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0C330C33,0x0C330CFF,0x0CFF0CFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0C330C33,0x0C330CFF,0x0CFF0CFF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x0AA30AA3,0x0AA30C33,0x0C330C33,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x0AA30AA3,0x0AA30C33,0x0C330C33,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x0AA30AA3,0x0AA30C33,0x0C330C33,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010C33,0x0C330C33,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010C33,0x0C330C33,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010C33,0x0C330C33,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010AA3,0x0AA30AA3,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010AA3,0x0AA30AA3,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010AA3,0x0AA30AA3,0x010F010F,0x010F0001,0x00010001,0x00010001,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0AA3,0x0AA30AA3,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x010F010F,0x010F0001,0x00010001,0x00010001,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0AA3,0x0AA30AA3,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x010F010F,0x010F0001,0x00010001,0x00010001,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0AA3,0x0AA30AA3,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x010F010F,0x010F0001,0x00010001,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x010F010F,0x010F0001,0x00010001,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x010F010F,0x010F0001,0x00010001,0x0CFF0CFF,0x0CFF0CFF,0x0CFF0C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x010F010F,0x010F0001,0x00010001,0x0CFF0CFF,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330AA3,0x0AA30AA3,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0CFF0CFF,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330AA3,0x0AA30AA3,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0CFF0CFF,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330C33,0x0C330AA3,0x0AA30AA3,0x0AA30AA3,0x0AA3010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x010F010F,0x010F010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x010F010F,0x010F010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x0AA30AA3,0x010F010F,0x010F010F,0x010F010F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001010F,0x010F010F,0x010F010F,0x010F010F,0x010F010F,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001010F,0x010F010F,0x010F010F,0x010F010F,0x010F010F,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001010F,0x010F010F,0x010F010F,0x010F010F,0x010F010F,0x010F010F,0x010F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dShadowMed {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10071007,0x1007204B,0x10071007,0x10071007,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10071007,0x1007204B,0x10071007,0x10071007,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001204B,0x204B204B,0x204B2851,0x28514095,0x28512851,0x28512851,0x204B1007,0x10070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010803,0x204B2851,0x285150DB,0x50DB4095,0x40954095,0x409550DB,0x50DB50DB,0x68DF50DB,0x50DB2851,0x10070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011007,0x10072851,0x50DB68DF,0x68DF2851,0x204B2851,0x28512851,0x28512851,0x2851204B,0x285168DF,0x68DF50DB,0x40951007,0x10070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011007,0x10072851,0x50DB68DF,0x68DF2851,0x204B2851,0x28512851,0x28512851,0x2851204B,0x285168DF,0x68DF50DB,0x40951007,0x10070001,0x00010001,0x00010001,0x00010001,0x00010001,0x10074095,0x409568DF,0x50DB2851,0x28514095,0x4095595D,0x595D50DB,0x4095595D,0x595D50DB,0x40952851,0x285150DB,0x50DB4095,0x40951007,0x00010001,0x00010001,0x00010001,0x00010001,0x409550DB,0x50DB50DB,0x285150DB,0x50DB595D,0x81678167,0x81672851,0x2851595D,0x595D595D,0x595D50DB,0x50DB2851,0x409568DF,0x68DF4095,0x08030001,0x00010001,0x00010001,0x00012851,0x50DB8167,0x81672851,0x595D595D,0x595D8167,0x922B8167,0x816768DF,0x68DF8167,0x81678167,0x8167595D,0x595D50DB,0x409568DF,0x68DF50DB,0x204B0001,0x00010001,0x00010001,0x00012851,0x50DB8167,0x81672851,0x595D595D,0x595D8167,0x922B8167,0x816768DF,0x68DF8167,0x81678167,0x8167595D,0x595D50DB,0x409568DF,0x68DF50DB,0x204B0001,0x00010001,0x00010001,0x000168DF,0x816768DF,0x68DF50DB,0x8167922B,0x922B922B,0x922B8167,0x81672851,0x204B595D,0x595D922B,0x922B922B,0x922B922B,0x595D50DB,0x50DB8167,0x50DB0001,0x00010001,0x00010803,0x080368DF,0xD17150DB,0x50DB922B,0x922B922B,0x922B922B,0x81678167,0x8167595D,0x81678167,0x8167922B,0x8167922B,0x922B922B,0x922B68DF,0x68DF8167,0x81671007,0x10070001,0x00011007,0x10078167,0xD1718167,0x8167D2F7,0xD2F7D2F7,0xD2F7922B,0x40952851,0x28512851,0x204B2851,0x28514095,0x922BF47D,0xF47DD2F7,0xD2F78167,0x8167D171,0x81672851,0x28510001,0x00011007,0x10078167,0xD1718167,0x8167D2F7,0xD2F7D2F7,0xD2F7922B,0x40952851,0x28512851,0x204B2851,0x28514095,0x922BF47D,0xF47DD2F7,0xD2F78167,0x8167D171,0x81672851,0x28510001,0x00014095,0x4095D171,0xD171D2F7,0xD2F7F47D,0xF47DF47D,0xF47DF47D,0x816768DF,0x68DF68DF,0x68DF8167,0x816750DB,0xF47DF47D,0xF47DF47D,0xF47DD2F7,0xD2F7D171,0xD17168DF,0x68DF0001,0x000150DB,0x50DBD171,0xD171D2F7,0xD2F7F47D,0xF47D922B,0x922B922B,0x922B4095,0x40958167,0x816750DB,0x50DB8167,0x922B922B,0x922BF47D,0xF47DD2F7,0xD2F7D171,0xD17168DF,0x68DF0001,0x0001204B,0x204B8167,0xD17168DF,0x68DF922B,0x922B4095,0x409550DB,0x68DF595D,0x595D50DB,0x50DB4095,0x40958167,0x40954095,0x40958167,0x922B8167,0x8167D171,0x81672851,0x28510001,0x0001204B,0x204B8167,0xD17168DF,0x68DF922B,0x922B4095,0x409550DB,0x68DF595D,0x595D50DB,0x50DB4095,0x40958167,0x40954095,0x40958167,0x922B8167,0x8167D171,0x81672851,0x28510001,0x00010803,0x080368DF,0x816768DF,0x68DF8167,0x816768DF,0x68DF50DB,0x68DF922B,0x922B4095,0x2851922B,0x922B8167,0x50DB50DB,0x50DB8167,0x922B68DF,0x68DF8167,0x68DF0803,0x08030001,0x00010803,0x08032851,0x816768DF,0x68DF50DB,0x595D2851,0x28512851,0x595D922B,0x922B50DB,0x4095922B,0x922B595D,0x28512851,0x2851595D,0x50DB68DF,0x68DF8167,0x50DB0001,0x00010001,0x00010001,0x0001204B,0x40958167,0x81674095,0x50DB50DB,0x50DB595D,0x922B8167,0x8167595D,0x8167595D,0x595D595D,0x595D595D,0x595D4095,0x40958167,0x81674095,0x204B0001,0x00010001,0x00010001,0x0001204B,0x40958167,0x81674095,0x50DB50DB,0x50DB595D,0x922B8167,0x8167595D,0x8167595D,0x595D595D,0x595D595D,0x595D4095,0x40958167,0x81674095,0x204B0001,0x00010001,0x00010001,0x00010001,0x285150DB,0x50DB68DF,0x40954095,0x4095595D,0x595D595D,0x595D595D,0x595D595D,0x595D595D,0x40954095,0x40954095,0x50DB50DB,0x50DB204B,0x00010001,0x00010001,0x00010001,0x00010001,0x08032851,0x285150DB,0x50DB50DB,0x50DB204B,0x40954095,0x40954095,0x40954095,0x40954095,0x28512851,0x285150DB,0x50DB2851,0x28510001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012851,0x409568DF,0x68DF50DB,0x2851204B,0x204B2851,0x204B204B,0x204B2851,0x285168DF,0x68DF4095,0x28510803,0x08030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012851,0x409568DF,0x68DF50DB,0x2851204B,0x204B2851,0x204B204B,0x204B2851,0x285168DF,0x68DF4095,0x28510803,0x08030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010803,0x204B2851,0x28514095,0x68DF50DB,0x50DB4095,0x50DB68DF,0x68DF68DF,0x2851204B,0x204B204B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011007,0x10071007,0x2851204B,0x204B2851,0x204B204B,0x204B204B,0x28511007,0x10070001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08030001,0x00011007,0x08030001,0x00010803,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08030001,0x00011007,0x08030001,0x00010803,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSilverGaundleds {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x58C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011843,0xCB119187,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1843CB11,0x91879187,0x18439187,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011843,0x318F9187,0x58C39187,0x9187CB11,0x91870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18430001,0x1843318F,0x52D74211,0x318F318F,0xCB119187,0x91871843,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x58C3C8C3,0xC8C358C3,0x318F8CE9,0x6B5B52D7,0x4211318F,0x918758C3,0x58C39187,0xCB111843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18439187,0xCB116B5B,0x8CE9BE31,0x7C2352D7,0x42114211,0x58C39187,0x9187CB11,0x918758C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001CB11,0xCB1152D7,0xBE318CE9,0x7C236B5B,0x421158C3,0x918758C3,0x918758C3,0x58C31843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000158C3,0x6B5B7C23,0x8CE97C23,0x421158C3,0x58C3C8C3,0x9187318F,0x318F9187,0x91879187,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019187,0x4211FFFF,0xBE31C8C3,0x58C358C3,0xC8C3C8C3,0x318F8CE9,0x7C236B5B,0xCB11CB11,0x58C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0x6B5BFFFF,0xFFFFC8C3,0xC8C3C8C3,0xC8C3C8C3,0xFFFFFFFF,0xBE317C23,0x918758C3,0x58C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18434211,0xBE317C23,0xBE31C8C3,0x58C3C8C3,0xC8C3CB11,0xBE31BE31,0xBE316B5B,0x42111843,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001318F,0x318F52D7,0x52D752D7,0x8CE97C23,0x58C358C3,0xC8C36B5B,0x7C237C23,0x52D752D7,0x42111843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x318F6B5B,0x52D74211,0x6B5B7C23,0x8CE96B5B,0x52D752D7,0x52D76B5B,0x6B5B6B5B,0x4211318F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21094211,0x52D77C23,0x6B5B6B5B,0x6B5B52D7,0x6B5B52D7,0x52D752D7,0x421152D7,0x6B5B318F,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014211,0x52D74211,0x42118CE9,0xBE318CE9,0x8CE96B5B,0x4211318F,0x318F4211,0x4211318F,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x318F52D7,0x7C2352D7,0x6B5B8CE9,0xFFFFFFFF,0xFFFFFFFF,0x4211318F,0x318F318F,0x21091843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210952D7,0x52D752D7,0x8CE97C23,0x7C237C23,0xFFFFFFFF,0xFFFFBE31,0x52D78CE9,0x42110001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6B5B6B5B,0x52D752D7,0x8CE9BE31,0xBE3152D7,0x7C237C23,0xBE31BE31,0x7C236B5B,0x318F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18434211,0x52D77C23,0x52D76B5B,0x8CE9FFFF,0xFFFFFFFF,0xBE318CE9,0x318F4211,0x42112109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011843,0xCB119187,0x52D78CE9,0x7C237C23,0x6B5BFFFF,0xFFFFFFFF,0xFFFF6B5B,0x52D78CE9,0x318F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18439187,0x91879187,0x52D7BE31,0xBE31BE31,0x52D76B5B,0x8CE9BE31,0xBE31BE31,0x7C236B5B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18431843,0xC8C3CB11,0x52D7BE31,0xFFFFFFFF,0xBE318CE9,0x6B5B318F,0x421152D7,0x52D71843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x58C3CB11,0xCB118CE9,0xFFFFFFFF,0xFFFFFFFF,0xBE3152D7,0x7C23318F,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000158C3,0x58C352D7,0x7C238CE9,0xBE31BE31,0xFFFF6B5B,0x7C234211,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x58C358C3,0x318F4211,0x421152D7,0x6B5B6B5B,0x42111843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019187,0x58C358C3,0x58C32109,0x318F2109,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x58C358C3,0x58C358C3,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x184358C3,0x58C31843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x58C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSilverScale {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0047008B,0x00CF008B,0x008B0047,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0003008B,0x01510919,0x01510151,0x01510151,0x00CF00CF,0x0151008B,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001008B,0x015119DD,0x09190919,0x09190919,0x01510151,0x01510151,0x00CF00CF,0x00CF00CF,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x01510919,0x091919DD,0x19DD0919,0x19DD19DD,0x19DD0919,0x01510151,0x015100CF,0x00CF00CF,0x00CF008B,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010919,0x19DD19DD,0x19DD19DD,0x19DD19DD,0x19DD19DD,0x19DD19DD,0x01510151,0x015100CF,0x00CF00CF,0x008B00CF,0x00470003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x09190919,0x19DD19DD,0x19DD21EF,0x52E96BB1,0x6BB152E9,0x52E919DD,0x19DD0151,0x015100CF,0x00CF00CF,0x008B00CF,0x00CF008B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010151,0x09190919,0x19DD21EF,0x21EF6BB1,0x6BB16BB1,0x6BB16BB1,0x52E919DD,0x19DD0919,0x01510151,0x00CF008B,0x00CF008B,0x00CF008B,0x008B0001,0x00010001,0x00010001,0x00010001,0x008B0919,0x091919DD,0x112352E9,0x6BB16BB1,0x6BB194B7,0x94B76BB1,0x52E952E9,0x19DD19DD,0x015100CF,0x00CF00CF,0x008B00CF,0x008B00CF,0x008B0047,0x00010001,0x00010001,0x00010001,0x01510919,0x09191123,0x21EF52E9,0x6BB194B7,0x94B794B7,0x94B794B7,0x94B76BB1,0x52E952E9,0x52E952E9,0x52E919DD,0x0151008B,0x00CF00CF,0x00CF00CF,0x00030001,0x00010001,0x00010047,0x01510919,0x091919DD,0x52E96BB1,0x6BB1C5FD,0xFFFFC5FD,0x94B794B7,0x94B76BB1,0x52E952E9,0x52E96BB1,0x52E952E9,0x19DD00CF,0x00CF008B,0x00CF00CF,0x00470001,0x00010001,0x000100CF,0x09190919,0x091919DD,0x21EF6BB1,0xFFFFFFFF,0xFFFFC5FD,0x94B794B7,0x6BB16BB1,0x6BB152E9,0x52E952E9,0x52E952E9,0x52E900CF,0x00CF00CF,0x00CF00CF,0x00CF0001,0x00010001,0x00010919,0x01510919,0x091919DD,0x52E9FFFF,0xFFFFFFFF,0xFFFFC5FD,0xC5FD94B7,0x94B76BB1,0x6BB152E9,0x52E952E9,0x52E952E9,0x19DD00CF,0x00CF0151,0x015100CF,0x00CF0047,0x00010001,0x00010151,0x01510151,0x091919DD,0x6BB1C5FD,0xFFFFFFFF,0xFFFFFFFF,0xC5FD94B7,0x94B794B7,0x6BB16BB1,0x52E952E9,0x52E952E9,0x19DD00CF,0x00CF0151,0x00CF00CF,0x00CF008B,0x00010001,0x000300CF,0x01510151,0x09190919,0x6BB194B7,0xC5FDFFFF,0xFFFFFFFF,0xFFFFC5FD,0xC5FD94B7,0x6BB16BB1,0x6BB152E9,0x52E952E9,0x09190919,0x015100CF,0x09190919,0x00CF008B,0x00010001,0x00470151,0x01510151,0x01510151,0x19DD94B7,0x94B7C5FD,0xFFFFFFFF,0xFFFFFFFF,0xC5FDC5FD,0x94B794B7,0x6BB16BB1,0x52E952E9,0x09190919,0x09190919,0x00CF0919,0x0919008B,0x00010001,0x00030151,0x01510151,0x015100CF,0x01516BB1,0x6BB1C5FD,0xC5FDFFFF,0xFFFFFFFF,0xFFFFC5FD,0x94B794B7,0x6BB16BB1,0x6BB119DD,0x09190919,0x09190919,0x09190919,0x0919008B,0x00010001,0x000300CF,0x00CF0151,0x00CF0151,0x01510919,0x6BB194B7,0xC5FDC5FD,0xFFFFFFFF,0xFFFFFFFF,0xC5FD94B7,0x94B76BB1,0x6BB119DD,0x112319DD,0x11230919,0x09190919,0x0919008B,0x00010001,0x000300CF,0x00CF0151,0x015100CF,0x00CF00CF,0x52E994B7,0xC5FDC5FD,0xC5FDFFFF,0xFFFFFFFF,0xFFFFC5FD,0xC5FD94B7,0x52E91123,0x21EF1123,0x11231123,0x11230919,0x11230003,0x00010001,0x0001008B,0x00CF0151,0x00CF00CF,0x00CF0151,0x008B52E9,0x6BB194B7,0xC5FDC5FD,0xFFFFFFFF,0xFFFFFFFF,0xC5FD94B7,0x21EF21EF,0x21EF1123,0x11231123,0x11231123,0x09190001,0x00010001,0x00010003,0x00CF0151,0x015100CF,0x008B008B,0x01510047,0x52E96BB1,0x94B7C5FD,0xFFFFFFFF,0xFFFFFFFF,0xFFFF6BB1,0x21EF52E9,0x21EF21EF,0x21EF1123,0x11231123,0x09190001,0x00010001,0x00010001,0x00CF008B,0x008B008B,0x00CF0151,0x00CF008B,0x015152E9,0x6BB194B7,0xC5FDFFFF,0xFFFFFFFF,0xC5FD21EF,0x21EF21EF,0x21EF21EF,0x21EF1123,0x11231123,0x008B0001,0x00010001,0x00010001,0x008B0151,0x015100CF,0x00CF0151,0x00CF00CF,0x00CF008B,0x52E952E9,0x94B7C5FD,0xFFFFC5FD,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x21EF1123,0x00010001,0x00010001,0x00010001,0x0001008B,0x008B00CF,0x00CF00CF,0x01510151,0x00CF0151,0x015152E9,0x52E994B7,0xC5FD21EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x11230047,0x00010001,0x00010001,0x00010001,0x00010003,0x00CF00CF,0x008B00CF,0x00CF00CF,0x00CF0919,0x09190919,0x19DD19DD,0x112321EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x09190003,0x00010001,0x00010001,0x00010001,0x00010001,0x004700CF,0x00CF00CF,0x00CF00CF,0x09190151,0x09190919,0x11231123,0x112321EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x21EF1123,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00CF00CF,0x00CF0151,0x09190919,0x09190919,0x11231123,0x112321EF,0x21EF21EF,0x21EF21EF,0x21EF21EF,0x11230001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004700CF,0x00CF00CF,0x00CF0919,0x09190919,0x11231123,0x11231123,0x21EF21EF,0x21EF21EF,0x21EF0919,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00CF00CF,0x09190919,0x09190919,0x11231123,0x112321EF,0x112321EF,0x21EF1123,0x00470003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x008B00CF,0x09191123,0x11231123,0x11231123,0x112300CF,0x00470003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x0047008B,0x00470003,0x00010003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSpiridMed {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10411041,0x10411841,0x18411041,0x10411841,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10411041,0x10411841,0x18411041,0x10411841,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C1,0x28C128C1,0x28C13901,0x39014941,0x59C159C1,0x59C14941,0x494128C1,0x28C10801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x28C13901,0x39017241,0x59C159C1,0x59C14941,0x59C14941,0x49417241,0x92C192C1,0x92C14941,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x18413901,0x59C192C1,0x92C13901,0x28C128C1,0x28C14941,0x39013901,0x39013901,0x390159C1,0x59C192C1,0x72411841,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011841,0x18413901,0x59C192C1,0x92C13901,0x28C128C1,0x28C14941,0x39013901,0x39013901,0x390159C1,0x59C192C1,0x72411841,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x000159C1,0x59C17241,0x59C13901,0x390159C1,0x59C17241,0x72414941,0x72417241,0x724159C1,0x59C13901,0x39014941,0x92C159C1,0x59C11841,0x00010001,0x00010001,0x00010001,0x00010001,0x59C17241,0x72417241,0x49417241,0x72417241,0x59C14941,0x49417241,0x92C192C1,0x92C192C1,0x724159C1,0x59C13901,0x724192C1,0x92C159C1,0x08010001,0x00010001,0x00010001,0x00013901,0x59C1BB81,0xBB814941,0x72417241,0x72414941,0x72417241,0x7241BB81,0xBB817241,0x724159C1,0x72417241,0x72417241,0x494192C1,0x92C17241,0x39010001,0x00010001,0x00010001,0x00013901,0x59C1BB81,0xBB814941,0x72417241,0x72414941,0x72417241,0x7241BB81,0xBB817241,0x724159C1,0x72417241,0x72417241,0x494192C1,0x92C17241,0x39010001,0x00010001,0x00010001,0x000159C1,0x92C159C1,0x59C17241,0x92C17241,0x72414941,0xBB81ED03,0xED03ED03,0x72413901,0x390128C1,0x28C13901,0x39017241,0x724159C1,0x59C192C1,0x59C10801,0x08010001,0x00010801,0x080192C1,0xBB817241,0x7241BB81,0xBB8159C1,0x59C159C1,0xBB81ED03,0xED03ED03,0x724159C1,0x59C159C1,0x92C14941,0x494192C1,0xBB817241,0x7241BB81,0x92C11841,0x18410001,0x00014941,0x4941BB81,0xED0392C1,0x92C1ED03,0xBB8159C1,0x59C17241,0x7241ED03,0xED03FF43,0xBB81BB81,0xBB81BB81,0xBB8192C1,0x92C1BB81,0xED03BB81,0xBB81BB81,0xBB8159C1,0x59C10001,0x00014941,0x4941BB81,0xED0392C1,0x92C1ED03,0xBB8159C1,0x59C17241,0x7241ED03,0xED03FF43,0xBB81BB81,0xBB81BB81,0xBB8192C1,0x92C1BB81,0xED03BB81,0xBB81BB81,0xBB8159C1,0x59C10001,0x00014941,0x4941ED03,0xED03ED03,0xED03FF43,0xBB817241,0x72417241,0x724159C1,0x59C1ED03,0x72414941,0x49414941,0x7241BB81,0xBB81ED03,0xFF43ED03,0xED03ED03,0xED0359C1,0x59C10001,0x000159C1,0x59C1ED03,0xED03ED03,0xED03FF43,0xED03BB81,0xBB8192C1,0x92C159C1,0x59C159C1,0xBB8159C1,0x59C14941,0x59C159C1,0x59C192C1,0xFF43ED03,0xED03ED03,0xED037241,0x72410801,0x000128C1,0x28C192C1,0xBB8192C1,0x92C1ED03,0x92C192C1,0x92C1BB81,0xBB81BB81,0xBB81BB81,0xED03ED03,0xED0359C1,0x49414941,0x494192C1,0xED03BB81,0xBB81BB81,0xBB8159C1,0x59C10001,0x000128C1,0x28C192C1,0xBB8192C1,0x92C1ED03,0x92C192C1,0x92C1BB81,0xBB81BB81,0xBB81BB81,0xED03ED03,0xED0359C1,0x49414941,0x494192C1,0xED03BB81,0xBB81BB81,0xBB8159C1,0x59C10001,0x08011041,0x104192C1,0xBB817241,0x724192C1,0x92C13901,0x39013901,0x49414941,0x49414941,0xED03ED03,0xED03BB81,0x59C13901,0x3901BB81,0xBB8192C1,0x92C1BB81,0x724128C1,0x28C10001,0x00010801,0x08014941,0x92C192C1,0x92C17241,0x72413901,0x390128C1,0x184128C1,0x28C14941,0xBB81BB81,0xBB81BB81,0x39014941,0x494192C1,0x724159C1,0x59C1BB81,0x59C10001,0x00010001,0x00010001,0x000128C1,0x59C192C1,0x92C159C1,0x59C17241,0x724159C1,0x724192C1,0x92C1BB81,0x92C17241,0x724159C1,0x39017241,0x724159C1,0x494192C1,0x92C14941,0x28C10801,0x08010001,0x00010001,0x000128C1,0x59C192C1,0x92C159C1,0x59C17241,0x724159C1,0x724192C1,0x92C1BB81,0x92C17241,0x724159C1,0x39017241,0x724159C1,0x494192C1,0x92C14941,0x28C10801,0x08010001,0x00010001,0x00010801,0x49417241,0x72417241,0x494159C1,0x59C17241,0x724192C1,0x92C192C1,0x59C14941,0x49414941,0x59C159C1,0x59C159C1,0x724159C1,0x59C13901,0x00010001,0x00010001,0x00010001,0x00010001,0x08013901,0x39017241,0x59C159C1,0x59C14941,0x494159C1,0x59C159C1,0x494159C1,0x59C159C1,0x39013901,0x390159C1,0x72414941,0x49410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x10413901,0x59C192C1,0x92C192C1,0x59C14941,0x49413901,0x390128C1,0x28C13901,0x49417241,0x72414941,0x39010801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x10413901,0x59C192C1,0x92C192C1,0x59C14941,0x49413901,0x390128C1,0x28C13901,0x49417241,0x72414941,0x39010801,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x28C13901,0x390159C1,0x72417241,0x72417241,0x72417241,0x72417241,0x59C13901,0x390128C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x10411841,0x390128C1,0x28C13901,0x390128C1,0x28C11841,0x28C11841,0x18410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08010801,0x08011041,0x10410801,0x08010801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08010801,0x08011041,0x10410801,0x08010801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSdormsSong {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7C677C67,0x7C679D6F,0x9D6F9D6F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7C677C67,0x7C679D6F,0x9D6F9D6F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB7C67,0x7C677C67,0x9D6F9D6F,0x9D6F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB7C67,0x7C677C67,0x9D6F9D6F,0x9D6F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB7C67,0x7C677C67,0x9D6F9D6F,0x9D6F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB52DB,0x52DB52DB,0x7C677C67,0x7C679D6F,0x9D6F9D6F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB52DB,0x52DB52DB,0x7C677C67,0x7C679D6F,0x9D6F9D6F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB52DB,0x52DB52DB,0x7C677C67,0x7C679D6F,0x9D6F9D6F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB214B,0x214B214B,0x52DB52DB,0x52DB7C67,0x7C677C67,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB214B,0x214B214B,0x52DB52DB,0x52DB7C67,0x7C677C67,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x52DB52DB,0x52DB214B,0x214B214B,0x52DB52DB,0x52DB7C67,0x7C677C67,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x21492149,0x21490001,0x52DB52DB,0x52DB214B,0x214B214B,0x00010001,0x00017C67,0x7C677C67,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x21492149,0x21492149,0x52DB52DB,0x52DB214B,0x214B214B,0x00010001,0x00017C67,0x7C677C67,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0x21492149,0x52DB52DB,0x52DB214B,0x214B214B,0x00010001,0x00017C67,0x7C677C67,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0x21492149,0x52DB52DB,0x52DB214B,0x214B214B,0x00010001,0x000152DB,0x52DB52DB,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x2149FE4D,0xFE4DFE4D,0x21492149,0x52DB52DB,0x52DB214B,0x214B214B,0x00010001,0x000152DB,0x52DB52DB,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x2149FE4D,0xFE4DFE4D,0x21492149,0x52DB52DB,0x52DB214B,0x214B214B,0x00010001,0x000152DB,0x52DB52DB,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0xFE4DFE4D,0x21492149,0x21492149,0x2149214B,0x214B214B,0x00010001,0x00010001,0x00010001,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0xFE4DFE4D,0x21492149,0x21492149,0x21492149,0x2149214B,0x00010001,0x00010001,0x00010001,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00012149,0x2149FE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4D2149,0x21492149,0x00010001,0x00010001,0x00010001,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00012149,0x2149FE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0x21492149,0x00010001,0x00010001,0x00010001,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0x21492149,0x00010001,0x00010001,0x00010001,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4D2149,0x21492149,0x00010001,0x00010001,0x00010001,0x214B214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x21492149,0x2149FE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4DFE4D,0xFE4D2149,0x2149214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012149,0x21492149,0x21492149,0x21492149,0xFE4DFE4D,0xFE4DFE4D,0x21492149,0x214B214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0x21492149,0x21492149,0xFE4DFE4D,0xFE4DFE4D,0x21492149,0x214B214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0xFE4D2149,0x2149214B,0x214B214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0xFE4D2149,0x2149214B,0x214B214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0x21492149,0x214B214B,0x214B214B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xFE4DFE4D,0x21492149,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0x21492149,0x2149214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x214B2149,0x21492149,0x2149214B,0x214B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSunSong {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCDC7CDC7,0xCDC7FF47,0xFF47FF47,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xCDC7CDC7,0xCDC7FF47,0xFF47FF47,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC5CDC7,0xCDC7CDC7,0xFF47FF47,0xFF470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC5CDC7,0xCDC7CDC7,0xFF47FF47,0xFF470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC5CDC7,0xCDC7CDC7,0xFF47FF47,0xFF470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC58BC5,0x8BC58BC5,0xCDC7CDC7,0xCDC7FF47,0xFF47FF47,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC58BC5,0x8BC58BC5,0xCDC7CDC7,0xCDC7FF47,0xFF47FF47,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC58BC5,0x8BC58BC5,0xCDC7CDC7,0xCDC7FF47,0xFF47FF47,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x8BC58BC5,0x8BC5CDC7,0xCDC7CDC7,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x8BC58BC5,0x8BC5CDC7,0xCDC7CDC7,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x8BC58BC5,0x8BC5CDC7,0xCDC7CDC7,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x00010001,0x0001CDC7,0xCDC7CDC7,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x00010001,0x0001CDC7,0xCDC7CDC7,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x00010001,0x0001CDC7,0xCDC7CDC7,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x00010001,0x00018BC5,0x8BC58BC5,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21012101,0x00010001,0x8BC58BC5,0x8BC53983,0x39833983,0x00010001,0x00018BC5,0x8BC58BC5,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012101,0xFF47B505,0x21010001,0x8BC58BC5,0x8BC53983,0x39833983,0x00010001,0x00018BC5,0x8BC58BC5,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00012101,0x21010001,0x00012101,0xFF47B505,0x21018BC5,0x8BC52101,0x21013983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x2101FF47,0xFF472101,0x00012101,0xB505B505,0x21018BC5,0x2101FF47,0xB5052101,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x2101FF47,0xFF47B505,0x21012101,0x21012101,0x21012101,0xFF47B505,0xB5052101,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00012101,0xB505B505,0x2101FF47,0xFF47B505,0xB5052101,0xB505B505,0x21013983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x21012101,0xFF47FF47,0xFF47B505,0xB505B505,0x21012101,0x39833983,0x39833983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0x00012101,0x21012101,0x2101FF47,0xFF47FF47,0xFF47FF47,0xB505B505,0xB5052101,0x21012101,0x21013983,0x00010001,0x00010001,0x00010001,0x39833983,0x39830001,0x00010001,0x00010001,0x2101FF47,0xFF47B505,0x2101FF47,0xFF47FF47,0xFF47FF47,0xB505B505,0xB5052101,0xB505B505,0xB5052101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2101B505,0xB505B505,0x2101FF47,0xFF47FF47,0xFF47FF47,0xB505B505,0xB5052101,0xB505B505,0xB5052101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012101,0x21012101,0x2101B505,0xFF47FF47,0xFF47B505,0xB505B505,0xB5052101,0x21012101,0x21013983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21012101,0xB505B505,0xB505B505,0xB505B505,0x21012101,0x39833983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012101,0xB505B505,0x2101B505,0xB505B505,0xB5052101,0xB505B505,0x21013983,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2101FF47,0xB505B505,0x21012101,0x21012101,0x21012101,0xB505B505,0xB5052101,0x39833983,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2101FF47,0xB5052101,0x39832101,0xFF47B505,0x21013983,0x2101B505,0xB5052101,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012101,0x21013983,0x39832101,0xFF47B505,0x21013983,0x39832101,0x21010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013983,0x39833983,0x39832101,0xB505B505,0x21013983,0x39833983,0x39830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dSongTime {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2C732C73,0x2C73357F,0x357F357F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2C732C73,0x2C73357F,0x357F357F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B232C73,0x2C732C73,0x357F357F,0x357F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B232C73,0x2C732C73,0x357F357F,0x357F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B232C73,0x2C732C73,0x357F357F,0x357F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B231B23,0x1B231B23,0x2C732C73,0x2C73357F,0x357F357F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B231B23,0x1B231B23,0x2C732C73,0x2C73357F,0x357F357F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B231B23,0x1B231B23,0x2C732C73,0x2C73357F,0x357F357F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B23094F,0x094F094F,0x1B231B23,0x1B232C73,0x2C732C73,0x094F094F,0x094F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B23094F,0x094F094F,0x1B231B23,0x1B232C73,0x2C732C73,0x094F094F,0x094F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B231B23,0x1B23094F,0x094F094F,0x1B231B23,0x1B232C73,0x2C732C73,0x094F094F,0x094F0001,0x00010001,0x00010001,0x21492149,0x21492149,0x21492149,0x21492149,0x21492149,0x21492149,0x1B231B23,0x1B23094F,0x094F094F,0x00010001,0x00012C73,0x2C732C73,0x094F094F,0x094F0001,0x00010001,0x00010001,0x21492149,0x21492149,0x21492149,0x21492149,0x21492149,0x21492149,0x1B231B23,0x1B23094F,0x094F094F,0x00010001,0x00012C73,0x2C732C73,0x094F094F,0x094F0001,0x00010001,0x00010001,0x21492149,0x21492149,0x21492149,0x21492149,0x21492149,0x21492149,0x1B231B23,0x1B23094F,0x094F094F,0x00010001,0x00012C73,0x2C732C73,0x094F094F,0x094F0001,0x00010001,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x21492149,0x2149094F,0x094F094F,0x00010001,0x00011B23,0x1B231B23,0x094F094F,0x094F0001,0x00010001,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x21492149,0x2149094F,0x094F094F,0x00010001,0x00011B23,0x1B231B23,0x094F094F,0x094F0001,0x21492149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x21492149,0x2149094F,0x094F094F,0x00010001,0x00011B23,0x1B231B23,0x094F094F,0x094F0001,0x21492149,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x094F094F,0x094F0001,0x21492149,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x094F094F,0x094F0001,0x21492149,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x094F094F,0x094F0001,0x21492149,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x094F094F,0x094F0001,0x21492109,0xB5ADCE73,0xCE73CE73,0xCE732149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x094F094F,0x094F0001,0x21492109,0xB5ADCE73,0xCE73CE73,0xCE732149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x094F094F,0x094F0001,0x21492109,0xB5ADCE73,0xCE73CE73,0xCE732149,0x21492149,0x21492149,0x21492149,0x21492149,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492109,0xB5ADCE73,0xCE73CE73,0xCE732149,0x21492149,0x21492149,0x21492149,0x21492149,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21491907,0xB5ADCE73,0xCE73CE73,0xCE732149,0x21492149,0x21492149,0x21492149,0x21492149,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21491907,0xB5ADCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21491907,0xB5ADCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0xB5ADCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE732149,0x21492149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00412149,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x21492149,0x21490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x21492149,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x21492149,0x21490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x21492149,0x298B298B,0x298B298B,0x298B298B,0x298B298B,0x298B298B,0x298B298B,0x21492149,0x21490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dMaskTrudh {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x398DD673,0xD6739D6B,0x398D0843,0x00010001,0x1085398D,0x9D6BD673,0xD6739D6B,0x398D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08431085,0xFFFFFFFF,0xFFFFE843,0xD673D673,0xD673D673,0xFFFFFFFF,0xD673EA11,0xAB15D673,0x73DF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019D6B,0xFFFFFFFF,0xFFFFECA3,0xEA11D673,0xFFFFFFFF,0xFFFFD673,0xEA11ECA3,0xECA3D673,0x9D6B73DF,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1043EA11,0xFFFFFFFF,0xECA3ECA3,0xD673ECA3,0xFFFFFFFF,0xD673EA11,0xFFFFECA3,0xD673D673,0x9D6B9D6B,0x73DF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4001FFFF,0xFFFFFFFF,0xECA3ECA3,0xEA11ECA3,0xD673FFFF,0xEA11EA11,0xECA3ECA3,0x9D6BD673,0xD673D673,0x9D6B9D6B,0x398D0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x9D6BFFFF,0xFFFFFFFF,0xECA3ECA3,0xFFFFFFFF,0xD673ECA3,0xD673FFFF,0xD673EA11,0xD673FFFF,0xFFFFFFFF,0xD6739D6B,0xECA39D6B,0x73DF398D,0x08430001,0x00010001,0x00010001,0x00010001,0xD673D673,0xFFFFFFFF,0xFFFFECA3,0xEA11E843,0xEA11EA11,0xE843E843,0xEA11FFFF,0xFFFFECA3,0xEA11ECA3,0xECA3EA11,0xECA3D673,0xD6739D6B,0x73DF0001,0x00010001,0x00010001,0x00010001,0xD673ECA3,0xEA11D673,0xEA11ECA3,0xD673D673,0xE843E843,0xE843E843,0xEA11EA11,0xECA3D673,0xEA11FFFF,0xECA3ECA3,0xD6739D6B,0x9D6B9D6B,0x9D6B1085,0x00010001,0x00010001,0x00010001,0xEA11EA11,0xEA11E843,0xFFFFFFFF,0xFFFFE843,0xAB15AB15,0xAB15AB15,0xEA11ECA3,0xE843D673,0xECA3EA11,0xEA11D673,0xD673D673,0x9D6B9D6B,0x73DF398D,0x00010001,0x00010001,0x00010843,0xEA11FFFF,0xECA3EA11,0xFFFFFFFF,0xECA3E843,0xECA3E843,0x9043AB15,0xE843FFFF,0xECA3E843,0xD673ECA3,0xD673D673,0x9D6B9D6B,0xAB15AB15,0x73DF398D,0x00010001,0x00010001,0x00011085,0xD673FFFF,0xD673E843,0xD673FFFF,0xECA3EA11,0xECA3AB15,0xAB15ECA3,0xE843D673,0xFFFFE843,0xECA3D673,0x9D6B9D6B,0x9D6B9D6B,0xAB15AB15,0x73DF0001,0x00010001,0x00010001,0x00011085,0xD673ECA3,0xFFFFECA3,0xEA11D673,0xECA3EA11,0xAB15ECA3,0xECA3AB15,0xE843FFFF,0xFFFFECA3,0xEA119D6B,0x9D6BD673,0x9D6B9D6B,0x73DF9043,0x10430001,0x00010001,0x00010001,0x00010843,0xD673EA11,0xFFFFFFFF,0xEA11EA11,0xD673ECA3,0xEA11AB15,0xE843EA11,0xFFFFFFFF,0xD673D673,0xE843EA11,0xAB15AB15,0x9D6B9D6B,0x73DF398D,0x00010001,0x00010001,0x00010001,0x00010843,0xD673E843,0xD673FFFF,0xFFFFECA3,0xE843ECA3,0xECA3D673,0xD673FFFF,0xFFFFECA3,0xAB15E843,0xE843AB15,0xAB15AB15,0x9D6B73DF,0x73DF4001,0x10430001,0x00010001,0x00010001,0x00010843,0xD673E843,0xE843FFFF,0xFFFFFFFF,0xECA3EA11,0xE843E843,0xEA11E843,0xE843E843,0xEA11ECA3,0x9D6B9D6B,0xECA39043,0xAB15AB15,0x40010001,0x00010001,0x00010001,0x00010001,0x00010001,0x9D6B9043,0xE843EA11,0xD673FFFF,0xECA39043,0xECA3D673,0xECA3D673,0xD673D673,0x9D6B9D6B,0xD6739D6B,0x9D6BAB15,0x9043398D,0x10430001,0x00010001,0x00010001,0x00010001,0x00010001,0x73DF9043,0x9043E843,0xEA11D673,0xAB150001,0xECA3FFFF,0xFFFFD673,0xD6739D6B,0xD673AB15,0xAB159D6B,0x9D6B9D6B,0x73DF1043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x73DF398D,0x00019043,0xE843E843,0x40014001,0xECA3ECA3,0xECA39D6B,0xAB15AB15,0xEA11E843,0x9D6B9D6B,0x9D6B73DF,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x398DEA11,0x00010001,0x4001E843,0x10439043,0xE843E843,0xE843E843,0xE843E843,0x9043AB15,0x9D6B9D6B,0x73DF0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843AB15,0x40010001,0x00014001,0xE8439043,0x90439043,0x90439043,0x40011043,0xEA119D6B,0x9D6B73DF,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08439D6B,0x90431043,0x00010001,0x10430001,0x00010001,0x00010001,0x9043AB15,0x9D6B9D6B,0x73DF1085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843398D,0xEA114001,0x00010001,0x00010001,0x00010001,0x40019043,0xAB159D6B,0x9D6B73DF,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x9D6BEA11,0x90431043,0x00010001,0x40019043,0xE8439D6B,0x9D6B9D6B,0x73DF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x73DF73DF,0xE843E843,0xE843E843,0xAB15AB15,0x9D6B9D6B,0x73DF398D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x104373DF,0x9D6BAB15,0xAB1573DF,0x9D6B9D6B,0x73DF73DF,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08431085,0x73DF73DF,0x73DF73DF,0x73DF73DF,0x398D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x0843398D,0x398D398D,0x10850843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x08430843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dWaderMed {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00470047,0x004708CD,0x08CD0003,0x00030003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00470047,0x004708CD,0x08CD0003,0x00030003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010047,0x00471111,0x11111155,0x1155199B,0x11551155,0x11551155,0x11110047,0x00470003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x08CD1155,0x1155199B,0x199B199B,0x199B1155,0x199B1155,0x1155199B,0x12231223,0x12231111,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010047,0x00471111,0x199B1223,0x12231111,0x08CD1111,0x11111111,0x11111111,0x11111111,0x11111223,0x12231223,0x199B0047,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010047,0x00471111,0x199B1223,0x12231111,0x08CD1111,0x11111111,0x11111111,0x11111111,0x11111223,0x12231223,0x199B0047,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00031111,0x11111223,0x199B1111,0x11111155,0x2A5D2A5D,0x2A5D2A5D,0x2A5D2A5D,0x2A5D2A5D,0x11551111,0x11111155,0x199B1155,0x11550047,0x00010001,0x00010001,0x00010001,0x00010001,0x1111199B,0x199B1223,0x11552A5D,0x2A5D2A5D,0x3AE73AE7,0x3AE71111,0x11552A5D,0x2A5D3AE7,0x3AE7199B,0x199B1155,0x199B199B,0x199B1111,0x00030001,0x00010001,0x00010001,0x00010047,0x11551AAB,0x1AAB1111,0x2A5D3AE7,0x3AE73AE7,0x54B31AAB,0x1AAB1223,0x12231AAB,0x1AAB3AE7,0x3AE73AE7,0x3AE72A5D,0x11111223,0x1223199B,0x11110001,0x00010001,0x00010001,0x00010047,0x11551AAB,0x1AAB1111,0x2A5D3AE7,0x3AE73AE7,0x54B31AAB,0x1AAB1223,0x12231AAB,0x1AAB3AE7,0x3AE73AE7,0x3AE72A5D,0x11111223,0x1223199B,0x11110001,0x00010001,0x00010001,0x00011155,0x12231223,0x12231223,0x3AE7199B,0x199B199B,0x3AE71AAB,0x1AAB1223,0x1AAB1AAB,0x1AAB3AE7,0x199B199B,0x199B3AE7,0x199B199B,0x199B1AAB,0x199B0003,0x00030001,0x00010003,0x0003199B,0x1AAB1223,0x12233AE7,0x3AE7199B,0x199B1155,0x199B1223,0x12231155,0x11113AE7,0x3AE71111,0x199B1223,0x12231AAB,0x54B31155,0x11551AAB,0x12230047,0x00470001,0x00010047,0x00471223,0x1B751AAB,0x1AAB54B3,0x54B31155,0x11551111,0x199B1223,0x12232A5D,0x2A5D1223,0x1223199B,0x11551155,0x115554B3,0x54B31AAB,0x1AAB1AAB,0x1AAB1111,0x11110001,0x00010047,0x00471223,0x1B751AAB,0x1AAB54B3,0x54B31155,0x11551111,0x199B1223,0x12232A5D,0x2A5D1223,0x1223199B,0x11551155,0x115554B3,0x54B31AAB,0x1AAB1AAB,0x1AAB1111,0x11110001,0x00011111,0x11111B75,0x1B7554B3,0x54B3867D,0x867D54B3,0x54B32A5D,0x2A5D199B,0x199B54B3,0x54B32A5D,0x2A5D2A5D,0x2A5D54B3,0x54B3867D,0x867D54B3,0x54B31B75,0x1B751155,0x11550001,0x000108CD,0x08CD1B75,0x1B751B75,0x1B75867D,0x867D54B3,0x54B31155,0x2A5D2A5D,0x2A5D3AE7,0x54B31155,0x11552A5D,0x2A5D54B3,0x54B3867D,0x867D1B75,0x1B751B75,0x1B75199B,0x199B0001,0x00010047,0x00471223,0x1B753AE7,0x3AE754B3,0x54B31155,0x1155199B,0x2A5D1223,0x12232A5D,0x2A5D3AE7,0x3AE7199B,0x12231155,0x115554B3,0x54B33AE7,0x3AE71AAB,0x1AAB1111,0x11110001,0x00010047,0x00471223,0x1B753AE7,0x3AE754B3,0x54B31155,0x1155199B,0x2A5D1223,0x12232A5D,0x2A5D3AE7,0x3AE7199B,0x12231155,0x115554B3,0x54B33AE7,0x3AE71AAB,0x1AAB1111,0x11110001,0x00010003,0x0003199B,0x1AAB1223,0x12232A5D,0x3AE71155,0x11551155,0x08CD3AE7,0x3AE71111,0x199B2A5D,0x2A5D08CD,0x1111199B,0x199B3AE7,0x3AE7199B,0x199B1AAB,0x199B08CD,0x08CD0001,0x00010001,0x000108CD,0x12231223,0x1223199B,0x2A5D1155,0x11551111,0x3AE71AAB,0x1AAB1AAB,0x1AAB1B75,0x1B753AE7,0x11551155,0x11552A5D,0x199B199B,0x199B1AAB,0x11550001,0x00010001,0x00010001,0x00010003,0x11111223,0x12231155,0x199B2A5D,0x2A5D3AE7,0x3AE71223,0x12231155,0x199B1223,0x12232A5D,0x2A5D2A5D,0x2A5D199B,0x11111223,0x1223199B,0x00470001,0x00010001,0x00010001,0x00010003,0x11111223,0x12231155,0x199B2A5D,0x2A5D3AE7,0x3AE71223,0x12231155,0x199B1223,0x12232A5D,0x2A5D2A5D,0x2A5D199B,0x11111223,0x1223199B,0x00470001,0x00010001,0x00010001,0x00010001,0x08CD199B,0x199B199B,0x11111155,0x11552A5D,0x2A5D2A5D,0x2A5D1111,0x08CD2A5D,0x2A5D2A5D,0x2A5D1155,0x11551111,0x1223199B,0x199B08CD,0x00010001,0x00010001,0x00010001,0x00010001,0x000108CD,0x08CD199B,0x199B1155,0x11551155,0x11551155,0x11551155,0x11552A5D,0x2A5D1155,0x11551155,0x1155199B,0x12231111,0x11110047,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x000308CD,0x11551223,0x1223199B,0x111108CD,0x08CD1111,0x11551111,0x11111155,0x11551223,0x12231111,0x11110003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x000308CD,0x11551223,0x1223199B,0x111108CD,0x08CD1111,0x11551111,0x11111155,0x11551223,0x12231111,0x11110003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08CD08CD,0x08CD199B,0x199B199B,0x199B199B,0x199B199B,0x199B1223,0x115508CD,0x08CD08CD,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00030047,0x08CD08CD,0x08CD08CD,0x08CD08CD,0x08CD08CD,0x08CD0047,0x00470001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00030003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00030003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dZoraSapphire {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0845BD51,0xBD516A85,0x09190919,0x09190919,0x09198BC9,0x8BC98BC9,0x31450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0845BD51,0xBD516A85,0x09190919,0x09190919,0x09198BC9,0x8BC98BC9,0x31450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xBD515203,0x520309E9,0x091909E9,0x09E90919,0x091929D5,0x29D58BC9,0x8BC90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x08453145,0x31451881,0x18810845,0xBD515203,0x520309E9,0x09E909E9,0x09E909E9,0x09E90AF9,0x0AF95203,0xBD511881,0x18811881,0x31453145,0x31450845,0x00010001,0x00010001,0x18816A85,0x6A858BC9,0x31458BC9,0x8BC96A85,0xBD51641F,0x641F0AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF9639B,0xBD518BC9,0x8BC98BC9,0x6A855203,0x52038BC9,0x31450001,0x00010001,0x18816A85,0x6A858BC9,0x31458BC9,0x8BC96A85,0xBD51641F,0x641F0AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF9639B,0xBD518BC9,0x8BC98BC9,0x6A855203,0x52038BC9,0x31450001,0x00010001,0x8BC9BD51,0xBD51BD51,0xBD51BD51,0xBD51BD51,0xBD51BD51,0xBD5109E9,0x09E909E9,0x09E90919,0x09E909E9,0x09E9BD51,0xBD51BD51,0xBD51BD51,0xBD51BD51,0xBD51BD51,0x8BC90001,0x00010001,0x31456A85,0x6A856A85,0x6A856A85,0x6A856A85,0x8BC9BD51,0xBD5129D5,0x09190919,0x09190919,0x091929D5,0x29D5BD51,0x8BC98BC9,0x8BC95203,0x6A856A85,0x6A856A85,0x52030001,0x00010001,0x18816A85,0x6A858BC9,0x8BC95203,0x52031881,0x6A85BD51,0xBD518BC9,0x29D50919,0x09190919,0x29D5BD51,0xBD51BD51,0x52031881,0x18815203,0x8BC98BC9,0x8BC95203,0x18810001,0x00010001,0x18816A85,0x6A858BC9,0x8BC95203,0x52031881,0x6A85BD51,0xBD518BC9,0x29D50919,0x09190919,0x29D5BD51,0xBD51BD51,0x52031881,0x18815203,0x8BC98BC9,0x8BC95203,0x18810001,0x00010001,0x00011881,0x18815203,0x8BC95203,0x52038BC9,0x8BC98BC9,0x8BC9BD51,0xBD518BC9,0x8BC98BC9,0xBD51BD51,0xBD51BD51,0x6A856A85,0x6A856A85,0x6A856A85,0x6A851881,0x00010001,0x00010001,0x00010001,0x00011881,0x8BC96A85,0x6A855203,0x52036A85,0x6A858BC9,0xBD51BD51,0xBD51BD51,0xBD518BC9,0x8BC95203,0x31456A85,0x6A856A85,0x8BC91881,0x18810001,0x00010001,0x00010001,0x00011881,0x1881BD51,0x6A856A85,0x6A8529D5,0x29D55203,0x52035203,0x8BC9BD51,0xBD51BD51,0x8BC93145,0x31456A85,0x29D529D5,0x29D56A85,0x6A858BC9,0x8BC93145,0x00010001,0x00010001,0x00011881,0x1881BD51,0x6A856A85,0x6A8529D5,0x29D55203,0x52035203,0x8BC9BD51,0xBD51BD51,0x8BC93145,0x31456A85,0x29D529D5,0x29D56A85,0x6A858BC9,0x8BC93145,0x00010001,0x00010001,0x0001BD51,0xBD515203,0x09190919,0x09190919,0x09190919,0x09193145,0x5203BD51,0xBD518BC9,0x52033145,0x31450919,0x09190919,0x09190919,0x09E96A85,0x6A85BD51,0x18810001,0x00010001,0x31458BC9,0x8BC929D5,0x09E909E9,0x09E90919,0x091909E9,0x09E909E9,0x6A858BC9,0x8BC9BD51,0x520309E9,0x09E909E9,0x09E90919,0x091909E9,0x09E93145,0x3145BD51,0x31450001,0x00010001,0x00013145,0x31450AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x8BC9BD51,0xBD51BD51,0x8BC90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF909E9,0x09E95203,0x00010001,0x00010001,0x00013145,0x31450AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x8BC9BD51,0xBD51BD51,0x8BC90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF90AF9,0x0AF909E9,0x09E95203,0x00010001,0x00010001,0x00010001,0x000109E9,0x09E909E9,0x09E909E9,0x09E909E9,0x09E90AF9,0xBD518BC9,0x8BC9BD51,0xBD510AF9,0x0AF909E9,0x09E909E9,0x09E909E9,0x09E909E9,0x09E90001,0x00010001,0x00010001,0x00010001,0x00010845,0x09190919,0x09190919,0x09190919,0x0919639B,0xBD518BC9,0x8BC98BC9,0xBD5129D5,0x29D50919,0x09190919,0x09190919,0x09190919,0x09190001,0x00010001,0x00010001,0x00010001,0x00010845,0x08450919,0x09190919,0x09190919,0x0919BD51,0xBD511881,0x18815203,0xBD518BC9,0x8BC90919,0x09190919,0x09190919,0x09190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010845,0x08450919,0x09190919,0x09190919,0x0919BD51,0xBD511881,0x18815203,0xBD518BC9,0x8BC90919,0x09190919,0x09190919,0x09190001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08458BC9,0x8BC96A85,0x8BC98BC9,0x8BC98BC9,0x52033145,0x31453145,0x6A858BC9,0x8BC98BC9,0x6A858BC9,0x8BC98BC9,0x31450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015203,0x52038BC9,0x6A855203,0x52038BC9,0x6A856A85,0x6A855203,0x8BC96A85,0x6A855203,0x6A858BC9,0x8BC96A85,0x08450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018BC9,0xBD51BD51,0xBD51BD51,0xBD518BC9,0x8BC90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018BC9,0xBD51BD51,0xBD51BD51,0xBD518BC9,0x8BC90001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00015203,0x6A856A85,0x6A856A85,0x6A855203,0x52030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A858BC9,0x8BC98BC9,0x52030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18816A85,0x6A855203,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18816A85,0x6A855203,0x18810001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dZoraTunic {0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C1,0x59838A43,0x8A438A43,0x598330C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C1,0x59838A43,0x8A438A43,0x598330C1,0x59830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C1,0x8A438A43,0x8A438A43,0x30C15983,0x598330C1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004B009B,0x00E38A43,0x8A438A43,0x8A438A43,0x30C15983,0x5983012D,0x012D004B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00930093,0x009B009B,0x00E32957,0x8A438A43,0x8A435983,0x30C130C1,0x2957012D,0x012D012D,0x009B004B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001004B,0x00E3012D,0x012D012D,0x009B009B,0x009B00E3,0x009B8A43,0x8A435983,0x30C12957,0x012D012D,0x012D012D,0x012D012D,0x012D00E3,0x00930001,0x00010001,0x00010001,0x0001009B,0x012D012D,0x012D012D,0x012D012D,0x009B009B,0x009B00E3,0x00E32957,0x598330C1,0x004B012D,0x012D012D,0x012D012D,0x012D012D,0x012D012D,0x012D012D,0x00E3004B,0x00010001,0x000100E3,0x012D012D,0x012D012D,0x012D012D,0x009B009B,0x009B00E3,0x00E3009B,0x59835983,0x2957012D,0x012D012D,0x012D012D,0x00E300E3,0x012D012D,0x012D012D,0x012D0001,0x00010001,0x00010093,0x012D012D,0x012D012D,0x012D012D,0x009B009B,0x009B009B,0x009B4A9B,0x8A4330C1,0xAD29012D,0x00E3012D,0x00E300E3,0x00E300E3,0x00E300E3,0x00E3012D,0x0093004B,0x00010001,0x00010093,0x012D012D,0x012D012D,0x00E300E3,0x009B0093,0x009B00E3,0x00E34A9B,0xAD29FFFF,0xAD2900E3,0x012D012D,0x012D00E3,0x009B009B,0x009B00E3,0x00E300E3,0x0093004B,0x00010001,0x00010093,0x009B00E3,0x00E300E3,0x00E300E3,0x00930093,0x009B009B,0x00E34A9B,0x4A9B5983,0xAD294A9B,0x00E300E3,0x00E300E3,0x009B009B,0x009B009B,0x009B009B,0x009B004B,0x00010001,0x0001004B,0x009B009B,0x009B009B,0x009B009B,0x004B0093,0x009B009B,0x00E300E3,0x59838A43,0x012D012D,0x012D012D,0x00E300E3,0x009B0093,0x00930093,0x0093009B,0x009B0001,0x00010001,0x00010001,0x00930093,0x004B004B,0x004B004B,0x004B0093,0x009B009B,0x009B4A9B,0xAD29AD29,0xAD29012D,0x00E300E3,0x00E300E3,0x0093004B,0x004B004B,0x004B009B,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004B0093,0x0093009B,0x009B4A9B,0x4A9BAD29,0xAD29012D,0x00E300E3,0x00E300E3,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004B004B,0x009B009B,0x00E3009B,0x009B2957,0x00E34A9B,0x00E3012D,0x00E3009B,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004B0093,0x009B009B,0x29574A9B,0x9491AD29,0x9491012D,0x012D00E3,0x00E300E3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C15983,0x59835983,0x9491EF4F,0xEF4FEF4F,0xEF4FEF4F,0x94918A43,0x8A438A43,0x30C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C130C1,0x30C15983,0x8A439491,0xEF4FEF4F,0xEF4F9491,0x8A438A43,0x8A438A43,0x30C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010093,0x004B2957,0x29575983,0x94919491,0x94912957,0x29572957,0x29572957,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004B009B,0x009B00E3,0x00E3012D,0x00E3009B,0x00E3012D,0x012D012D,0x012D00E3,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0093009B,0x009B00E3,0x00E300E3,0x009B009B,0x012D012D,0x012D012D,0x012D012D,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0093009B,0x009B00E3,0x00E3012D,0x009B0093,0x00E3012D,0x012D012D,0x012D012D,0x009B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0093009B,0x00E300E3,0x00E300E3,0x009B009B,0x00E3012D,0x012D012D,0x012D012D,0x009B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x004B009B,0x00E300E3,0x00E300E3,0x00E3009B,0x009B012D,0x012D012D,0x012D00E3,0x00930001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00930093,0x009B0093,0x009B009B,0x004B009B,0x009B0093,0x004B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001}
-#define dRedBox {0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000AC,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000C5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF0000D2,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF000017,0xFF0000D2,0xFF000015,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFF000099,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000CF,0xFF0000AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000}
-#define dLongBlackBox {0x00000000,0x0000001C,0x0000005C,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005C,0x0000001C,0x00000000,0x00000000,0x000000A6,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000A5,0x00000000,0x00000000,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x00000000,0x00000000,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x00000000,0x00000000,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x00000000,0x00000000,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x00000000,0x00000000,0x000000A6,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000BF,0x000000A5,0x00000000,0x00000000,0x0000001C,0x0000005C,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005F,0x0000005C,0x0000001C,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000}
-#define dDpad3 {0xFFFEFFFE,0xFFFE39CF,0x39CF39CF,0x294B294B,0x294B294B,0x18C718C7,0x00011085,0x39CFCE73,0x9CE71085,0x08434A53,0x5AD7294B,0x00019CE7,0xFFFF0001,0xFFFF9CE7,0x294BFFFF,0x294B294B,0x294B294B,0xFFFF0001,0x9CE7FFFF,0x0001EF7B,0xFFFF0001,0x10855AD7,0x5AD70843,0x18C79CE7,0xCE7339CF,0x10850001,0x108518C7,0x294B294B,0x294B1085,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x39CF294B,0x39CF39CF,0x39CF39CF,0x18C71085,0x0001294B,0x9CE76B5B,0x084339CF,0x4A5339CF,0x00016B5B,0xCE730001,0xFFFF9CE7,0x294B294B,0xCE73FFFF,0xFFFF294B,0xFFFF0001,0x6B5BFFFF,0x0001FFFF,0xFFFF0001,0x294B5AD7,0x39CF0001,0x6B5BCE73,0x18C70001,0x108518C7,0x294B294B,0x39CF294B,0x294B1085,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x4A5339CF,0x4A5339CF,0x4A5339CF,0x4A535AD7,0x39CF39CF,0x294B0001,0x18C718C7,0x08434A53,0x5AD75AD7,0x10851085,0x18C70001,0x0843294B,0x10850843,0x18C718C7,0x08430001,0x10850001,0x18C71085,0x00011085,0x10850001,0x4A535AD7,0x4A530843,0x10851085,0x0001294B,0x39CF39CF,0x294B39CF,0x294B294B,0x18C70843,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x39CF4A53,0x4A5339CF,0x4A534A53,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x39CF39CF,0x5AD76B5B,0x6B5B6B5B,0x5AD74A53,0x294B4A53,0x39CF294B,0x39CF4A53,0x39CF18C7,0x39CF4A53,0x294B39CF,0x39CF39CF,0x4A5339CF,0x39CF4A53,0x4A535AD7,0x5AD74A53,0x39CF294B,0x39CF4A53,0x4A5339CF,0x39CF39CF,0x294B18C7,0x10850001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x294B294B,0x294B294B,0x294B294B,0x39CF39CF,0x5AD75AD7,0x5AD76B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x4A534A53,0x4A534A53,0x4A534A53,0x39CF39CF,0x39CF39CF,0x294B1085,0x08430001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x10850843,0x08430843,0x08430843,0x00010001,0x00010001,0x08430843,0x10851085,0x10851085,0x10851085,0x294B39CF,0x5AD76B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x39CF294B,0x18C70001,0x10850001,0x08430843,0x08430001,0x00010001,0x00010001,0x00010001,0x08430001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x4A536B5B,0x6B5B6B5B,0x5AD76B5B,0x5AD75AD7,0x6B5B5AD7,0x5AD75AD7,0x5AD74A53,0x294B0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x4A536B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843294B,0x5AD76B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x39CF5AD7,0x6B5B6B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD739CF,0x08430001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x4A535AD7,0x4A5339CF,0x10850001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE6B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x4A535AD7,0x5AD739CF,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x4A534A53,0x4A535AD7,0x4A53294B,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE6B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x39CF39CF,0x39CF4A53,0x4A534A53,0x4A5339CF,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x0001FFFE,0xFFFE0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x6B5B6B5B,0x5AD70001,0x00010001,0xFFFEFFFE,0x00010001,0x00010001,0xFFFE5AD7,0x6B5B5AD7,0x5AD75AD7,0x5AD74A53,0x294B1085,0x108518C7,0x4A534A53,0x4A53294B,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x9CE7EF7B,0xCE739CE7,0xEF7BCE73,0x00010001,0x00010001,0x00019CE7,0x9CE70001,0x0001294B,0x18C7294B,0x4A5339CF,0x18C718C7,0x10850001,0x00010843,0x1085294B,0x294B18C7,0x00010001,0x0001FFFE,0xFFFEFFFE,0x0001FFFE,0xFFFEFFFE,0x000139CF,0xFFFFEF7B,0x00010001,0x0001CE73,0x9CE70001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00016B5B,0xFFFF5AD7,0x00010001,0x00014A53,0x00010001,0x00010001,0x0001CE73,0xCE730001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0x00010001,0xCE73FFFF,0x5AD70001,0x0001EF7B,0x18C70001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001EF7B,0xEF7B0001,0x00010001,0x00010001,0x5AD79CE7,0xCE73CE73,0x9CE7FFFF,0xEF7BCE73,0x5AD7CE73,0xCE739CE7,0x00016B5B,0xCE73CE73,0x9CE79CE7,0x39CFCE73,0xCE73CE73,0x294B9CE7,0x9CE79CE7,0xCE739CE7,0x00010001,0x9CE70001,0x0001FFFE,0x00010001,0x6B5BFFFF,0xCE730001,0x6B5BCE73,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001FFFF,0xCE730001,0x0001FFFE,0x00010001,0xCE739CE7,0x5AD7FFFF,0x9CE7CE73,0xCE73294B,0xEF7B9CE7,0x294BFFFF,0x9CE7FFFF,0x9CE739CF,0xEF7BCE73,0xEF7BCE73,0x0001CE73,0xEF7BCE73,0xFFFF9CE7,0xCE73FFFF,0x39CF5AD7,0xCE730001,0x0001FFFE,0xFFFE0001,0x0843EF7B,0xEF7B294B,0xCE736B5B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001FFFF,0xEF7B0001,0x0001FFFE,0x00010001,0x294B9CE7,0xCE73FFFF,0x9CE7CE73,0xEF7B6B5B,0xFFFFEF7B,0xCE73FFFF,0xFFFFFFFF,0x294B0001,0xCE73FFFF,0xFFFF5AD7,0x00019CE7,0xFFFFFFFF,0xCE730001,0x39CFFFFF,0x9CE7CE73,0x6B5B0001,0x0001FFFE,0xFFFE0001,0x00019CE7,0xFFFF9CE7,0xEF7B0001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001CE73,0xFFFF39CF,0x00010001,0x00010001,0xEF7BCE73,0x294BFFFF,0x9CE7CE73,0xCE736B5B,0xFFFF9CE7,0x00010001,0x9CE7FFFF,0x6B5B294B,0xEF7BFFFF,0xFFFF9CE7,0x00019CE7,0xFFFFEF7B,0xCE730843,0x0001CE73,0xFFFFEF7B,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0x0001294B,0xFFFFEF7B,0xCE730001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x000139CF,0xFFFFEF7B,0x5AD7294B,0x9CE7EF7B,0xFFFFEF7B,0x9CE7FFFF,0xCE739CE7,0xFFFF6B5B,0xEF7BEF7B,0x6B5BCE73,0x9CE7EF7B,0xEF7BCE73,0xFFFFCE73,0xEF7BCE73,0x294BCE73,0xEF7BCE73,0xCE730001,0x000139CF,0xFFFF9CE7,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xCE73FFFF,0x4A530001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x18C79CE7,0xCE73CE73,0x9CE76B5B,0x6B5BCE73,0x9CE79CE7,0x9CE70843,0x9CE79CE7,0x294B9CE7,0xCE739CE7,0x00010001,0x6B5B294B,0xFFFF9CE7,0x294B9CE7,0xCE739CE7,0x18C79CE7,0x9CE70001,0x0001294B,0xEF7B294B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x4A53CE73,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019CE7,0x6B5B9CE7,0xFFFF18C7,0x00010001,0x00010001,0x00010001,0x000139CF,0x9CE7CE73,0x6B5B0001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x0001FFFE,0xFFFE0001,0xFFFE0001,0xFFFEFFFE,0x0001FFFE,0xFFFE294B,0x18C7294B,0x00019CE7,0x9CE79CE7,0x4A530001,0x108518C7,0x10851085,0x10850001,0x00010001,0x6B5B5AD7,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x39CF294B,0x00010001,0x00010001,0x00010843,0x18C718C7,0x18C71085,0x08430001,0x00010001,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x10850843,0x08430001,0x00010001,0x08430843,0x08430843,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE}
-#define dDpad2 {0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE5AD7,0x4A534A53,0x39CF4A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A53FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x4A534A53,0x4A5339CF,0x4A5339CF,0x4A5339CF,0x4A534A53,0x4A534A53,0x4A5339CF,0x18C70843,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x4A5339CF,0x294B294B,0x294B39CF,0x39CF39CF,0x4A534A53,0x4A53294B,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A5339CF,0x294B294B,0x294B294B,0x294B294B,0x39CF39CF,0x39CF4A53,0x4A53294B,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x6B5B6B5B,0x5AD70001,0x00010001,0xFFFEFFFE,0x00010001,0x00010001,0xFFFE39CF,0x4A5339CF,0x294B18C7,0x18C718C7,0x39CF294B,0x294B39CF,0x39CF39CF,0x4A53294B,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x9CE7EF7B,0xCE739CE7,0xEF7BCE73,0x00010001,0x00010001,0x00019CE7,0x9CE70001,0x000118C7,0x084318C7,0x10851085,0x10851085,0x10851085,0x18C71085,0x1085294B,0x294B18C7,0x00010001,0x0001FFFE,0xFFFEFFFE,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xCE735AD7,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00016B5B,0xFFFF5AD7,0x00010001,0x00014A53,0x00010001,0x00010001,0x0001CE73,0xCE730001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0x00015AD7,0xFFFFCE73,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001EF7B,0xEF7B0001,0x00010001,0x00010001,0x5AD79CE7,0xCE73CE73,0x9CE7FFFF,0xEF7BCE73,0x5AD7CE73,0xCE739CE7,0x00016B5B,0xCE73CE73,0x9CE79CE7,0x39CFCE73,0xCE73CE73,0x294B9CE7,0x9CE79CE7,0xCE739CE7,0x00010001,0x9CE70001,0x0001FFFE,0xFFFE0001,0x0001CE73,0xEF7BFFFF,0x294B0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001FFFF,0xCE730001,0x0001FFFE,0x00010001,0xCE739CE7,0x5AD7FFFF,0x9CE7CE73,0xCE73294B,0xEF7B9CE7,0x294BFFFF,0x9CE7FFFF,0x9CE739CF,0xEF7BCE73,0xEF7BCE73,0x0001CE73,0xEF7BCE73,0xFFFF9CE7,0xCE73FFFF,0x39CF5AD7,0xCE730001,0x0001FFFE,0xFFFE0001,0x0001EF7B,0x9CE7FFFF,0x9CE70001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001FFFF,0xEF7B0001,0x0001FFFE,0x00010001,0x294B9CE7,0xCE73FFFF,0x9CE7CE73,0xEF7B6B5B,0xFFFFEF7B,0xCE73FFFF,0xFFFFFFFF,0x294B0001,0xCE73FFFF,0xFFFF5AD7,0x00019CE7,0xFFFFFFFF,0xCE730001,0x39CFFFFF,0x9CE7CE73,0x6B5B0001,0x0001FFFE,0xFFFE0001,0x6B5BCE73,0x18C7EF7B,0xEF7B0001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001CE73,0xFFFF39CF,0x00010001,0x00010001,0xEF7BCE73,0x294BFFFF,0x9CE7CE73,0xCE736B5B,0xFFFF9CE7,0x00010001,0x9CE7FFFF,0x6B5B294B,0xEF7BFFFF,0xFFFF9CE7,0x00019CE7,0xFFFFEF7B,0xCE730843,0x0001CE73,0xFFFFEF7B,0x00010001,0xFFFEFFFE,0x00010001,0xCE736B5B,0x0001CE73,0xFFFF6B5B,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x000139CF,0xFFFFEF7B,0x5AD7294B,0x9CE7EF7B,0xFFFFEF7B,0x9CE7FFFF,0xCE739CE7,0xFFFF6B5B,0xEF7BEF7B,0x6B5BCE73,0x9CE7EF7B,0xEF7BCE73,0xFFFFCE73,0xEF7BCE73,0x294BCE73,0xEF7BCE73,0xCE730001,0x000139CF,0xFFFF9CE7,0x00010001,0xFFFEFFFE,0x0001294B,0xFFFF0001,0x00015AD7,0xFFFFCE73,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x18C79CE7,0xCE73CE73,0x9CE76B5B,0x6B5BCE73,0x9CE79CE7,0x9CE70843,0x9CE79CE7,0x294B9CE7,0xCE739CE7,0x00010001,0x6B5B294B,0xFFFF9CE7,0x294B9CE7,0xCE739CE7,0x18C79CE7,0x9CE70001,0x0001294B,0xEF7B294B,0x0001FFFE,0xFFFEFFFE,0x08436B5B,0xCE730001,0x00010001,0xEF7BFFFF,0x39CF0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019CE7,0x6B5B9CE7,0xFFFF18C7,0x00010001,0x00010001,0x00010001,0x000139CF,0x9CE7CE73,0x6B5B0001,0x0001FFFE,0xFFFEFFFE,0x00010843,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x0001FFFE,0xFFFE0001,0xFFFE0001,0xFFFEFFFE,0x0001FFFE,0xFFFE294B,0x1085294B,0x00019CE7,0x9CE79CE7,0x4A530001,0x108518C7,0x18C739CF,0x5AD7294B,0x00010001,0x6B5B5AD7,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x0001FFFE,0xFFFE0001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A5339CF,0x00010001,0x00010001,0x00011085,0x39CF4A53,0x5AD76B5B,0x5AD74A53,0x10850001,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x39CF294B,0x294B294B,0x39CF5AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B4A53,0x10850001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x39CF4A53,0x39CF4A53,0x4A535AD7,0x4A535AD7,0x5AD76B5B,0x6B5B4A53,0x10850001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE5AD7,0x5AD74A53,0x4A534A53,0x4A534A53,0x4A535AD7,0x4A535AD7,0x5AD76B5B,0x6B5B4A53,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x5AD75AD7,0x5AD74A53,0x4A5339CF,0x4A534A53,0x5AD75AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B4A53,0x10850001,0x0001294B,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A5339CF,0x4A534A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A535AD7,0x5AD75AD7,0x6B5B5AD7,0x5AD74A53,0x4A534A53,0x4A534A53,0x5AD75AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B5AD7,0x294B18C7,0x294B4A53,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD7FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x4A534A53,0x5AD75AD7,0x5AD75AD7,0x4A534A53,0x4A535AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x5AD74A53,0x4A535AD7,0x5AD75AD7,0x5AD75AD7,0x5AD76B5B,0x5AD76B5B,0x5AD74A53,0x5AD75AD7,0x6B5B6B5B,0x6B5B5AD7,0x6B5B5AD7,0x6B5B5AD7,0x5AD75AD7,0x6B5B5AD7,0x5AD76B5B,0x5AD74A53,0x294BFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x5AD75AD7,0x4A534A53,0x4A5339CF,0x39CF39CF,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD739CF,0x10850001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x4A534A53,0x4A53294B,0x294B294B,0x294B39CF,0x4A534A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A535AD7,0x39CF18C7,0x00011085,0x294B39CF,0x4A535AD7,0x5AD75AD7,0x5AD75AD7,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x4A5318C7,0x08430001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x4A534A53,0x294B294B,0x18C718C7,0x294B294B,0x294B39CF,0x39CF39CF,0x39CF39CF,0x4A534A53,0x4A5339CF,0x000118C7,0x294B0001,0x10851085,0x08434A53,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x4A5339CF,0x39CF294B,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x39CF294B,0x18C718C7,0x18C7294B,0x294B294B,0x294B39CF,0x39CF294B,0x18C718C7,0x294B4A53,0x39CF18C7,0x08439CE7,0xFFFF0001,0xCE739CE7,0x0001294B,0x10850843,0x294B294B,0x1085294B,0x18C7294B,0x294B1085,0x294B5AD7,0x5AD75AD7,0x5AD74A53,0x39CF294B,0x39CF5AD7,0x5AD75AD7,0x4A534A53,0x4A534A53,0x39CF18C7,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE294B,0x39CF294B,0x294B18C7,0x18C718C7,0x18C718C7,0x294B39CF,0x18C70001,0x294B294B,0x000139CF,0x4A53294B,0x00019CE7,0xFFFF294B,0xFFFFCE73,0x39CF18C7,0xFFFFFFFF,0x18C718C7,0x39CFFFFF,0xFFFF1085,0xFFFFFFFF,0x10850843,0x5AD75AD7,0x5AD70843,0x294B294B,0x0001294B,0x4A534A53,0x4A534A53,0x4A5339CF,0x294B18C7,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x39CF39CF,0x18C718C7,0x18C71085,0x00010843,0x18C70843,0x00014A53,0xCE735AD7,0x000139CF,0x4A53294B,0x00019CE7,0xFFFFFFFF,0xFFFFFFFF,0x9CE7FFFF,0x294B294B,0xFFFF294B,0xFFFFFFFF,0xFFFF9CE7,0xCE73FFFF,0x9CE70001,0x294B5AD7,0x4A530001,0x5AD7CE73,0x4A530001,0x1085294B,0x294B39CF,0x39CF39CF,0x294B18C7,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x39CF39CF,0x294B294B,0x18C70001,0x00010001,0x00011085,0x5AD7CE73,0x9CE70843,0x10854A53,0x4A53294B,0x00019CE7,0xFFFF0843,0xFFFF9CE7,0x294BFFFF,0xFFFFFFFF,0xFFFF294B,0xFFFF4A53,0xCE73FFFF,0x4A53FFFF,0xFFFF0001,0x18C75AD7,0x5AD71085,0x10859CE7,0xCE736B5B,0x10850843,0x108518C7,0x39CF39CF,0x294B18C7,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dDpad1 {0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE5AD7,0x4A534A53,0x4A5339CF,0x4A534A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A53FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x4A534A53,0x4A5339CF,0x4A534A53,0x39CF4A53,0x4A534A53,0x4A534A53,0x4A5339CF,0x18C70843,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x4A5339CF,0x294B294B,0x294B39CF,0x39CF39CF,0x39CF4A53,0x4A53294B,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x294B18C7,0x294B294B,0x39CF294B,0x294B0843,0x00010001,0x18C7294B,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x294B6B5B,0x6B5B39CF,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x39CF39CF,0x294B18C7,0x18C718C7,0x294B294B,0x08430001,0x6B5B39CF,0x000118C7,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001A529,0xFFFFA529,0xA529FFFF,0xA5290001,0x00010001,0x00010001,0x0001FFFE,0x00010843,0x18C718C7,0x08430843,0x08430843,0x18C718C7,0x00016B5B,0xFFFFCE73,0x00010843,0x0001A529,0xFFFFA529,0x00010001,0x00010001,0xFFFE0001,0xFFFE0001,0x0001FFFE,0x0001FFFE,0xFFFE0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xA529FFFF,0x5AD70001,0x00016B5B,0xFFFFA529,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B5B,0xFFFFFFFF,0x294B0001,0x0001EF7B,0xFFFFA529,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xEF7BEF7B,0x00010001,0x00010001,0xEF7BEF7B,0xA529CE73,0xA529CE73,0x6B5B0001,0xA529CE73,0xCE735AD7,0xA529CE73,0xA529CE73,0x6B5B0001,0x00016B5B,0xCE73FFFF,0xA5290001,0x6B5BEF7B,0xFFFFA529,0x5AD7CE73,0xCE73A529,0x39CFCE73,0xA529CE73,0xCE735AD7,0xCE735AD7,0x39CFCE73,0x5AD70001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xFFFFCE73,0x00010001,0x00010001,0xCE73FFFF,0xCE73FFFF,0x6B5BCE73,0xFFFFCE73,0xEF7B294B,0xA529FFFF,0xCE73EF7B,0x6B5BFFFF,0xEF7B0001,0x00016B5B,0xA529EF7B,0xCE730001,0xCE73A529,0xFFFFA529,0xFFFFA529,0x294BFFFF,0xCE73FFFF,0xA529CE73,0xFFFFCE73,0xFFFF6B5B,0x6B5BFFFF,0x6B5B0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xFFFFEF7B,0x00010001,0x00010001,0xCE73FFFF,0xCE73CE73,0x08436B5B,0xFFFFFFFF,0xEF7BCE73,0xEF7BFFFF,0xFFFFCE73,0x0843A529,0xFFFF0001,0x00016B5B,0xA5296B5B,0xFFFF6B5B,0xEF7B6B5B,0xFFFFCE73,0xFFFFEF7B,0xCE73FFFF,0xFFFFFFFF,0x6B5B18C7,0xFFFFCE73,0xFFFF6B5B,0x6B5BFFFF,0x6B5B0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xA529FFFF,0x39CF0001,0x00010001,0xFFFFCE73,0xEF7BCE73,0x00016B5B,0xFFFFFFFF,0xFFFF0001,0x00010001,0xCE73CE73,0x0001A529,0xFFFF0001,0x00016B5B,0xA529294B,0xFFFFFFFF,0x6B5B6B5B,0xFFFFCE73,0xFFFFA529,0x00010001,0x6B5BFFFF,0x6B5B0001,0xFFFFCE73,0xFFFF5AD7,0x6B5BFFFF,0x6B5B0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x4A53FFFF,0xEF7B39CF,0x294BCE73,0xEF7B5AD7,0xCE73EF7B,0x39CFCE73,0xFFFF6B5B,0xFFFFCE73,0xA529EF7B,0xEF7BCE73,0x0001A529,0xFFFF0001,0x00016B5B,0xA5290001,0xCE73FFFF,0x294B6B5B,0xFFFFA529,0xEF7BEF7B,0x6B5BCE73,0xCE73FFFF,0x6B5B0001,0xFFFFCE73,0xFFFFEF7B,0xCE73FFFF,0x6B5B0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001294B,0xA529CE73,0xCE73A529,0x39CF0001,0xCE73EF7B,0xA529A529,0x5AD70001,0x6B5BCE73,0xA5295AD7,0x6B5BA529,0x00016B5B,0xA5290001,0x000139CF,0x6B5B0843,0x4A536B5B,0x000139CF,0xA5296B5B,0x294BA529,0xCE73A529,0x39CFA529,0x39CF0001,0xA5296B5B,0xA529A529,0x6B5BA529,0x39CF0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0xCE73CE73,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08430843,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0xCE73A529,0x00010001,0xFFFEFFFE,0xFFFE18C7,0x294B294B,0x294B294B,0x39CF294B,0x294B39CF,0x4A5339CF,0x39CF5AD7,0x5AD739CF,0x08430001,0x0001FFFE,0xFFFE0001,0x0001FFFE,0xFFFE0001,0xFFFEFFFE,0x0001FFFE,0xFFFE0001,0xFFFE0001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x4A5339CF,0x4A534A53,0x4A534A53,0x5AD75AD7,0x5AD76B5B,0x6B5B4A53,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x39CF4A53,0x39CF4A53,0x4A535AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B4A53,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE5AD7,0x5AD74A53,0x4A5339CF,0x4A534A53,0x4A535AD7,0x4A535AD7,0x5AD76B5B,0x6B5B4A53,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x5AD75AD7,0x5AD74A53,0x4A534A53,0x4A534A53,0x5AD75AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B4A53,0x08430001,0x0001294B,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A5339CF,0x4A534A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A535AD7,0x5AD75AD7,0x6B5B5AD7,0x5AD74A53,0x4A534A53,0x4A534A53,0x5AD74A53,0x5AD75AD7,0x5AD75AD7,0x6B5B5AD7,0x294B18C7,0x294B4A53,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD7FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x4A534A53,0x4A534A53,0x4A5339CF,0x4A534A53,0x4A534A53,0x4A535AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x4A534A53,0x4A535AD7,0x5AD75AD7,0x5AD75AD7,0x5AD76B5B,0x6B5B5AD7,0x5AD74A53,0x5AD75AD7,0x6B5B6B5B,0x6B5B5AD7,0x6B5B5AD7,0x6B5B5AD7,0x5AD75AD7,0x6B5B5AD7,0x5AD76B5B,0x5AD74A53,0x294BFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x5AD75AD7,0x4A5339CF,0x39CF294B,0x39CF4A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A534A53,0x4A535AD7,0x5AD75AD7,0x4A534A53,0x4A5339CF,0x4A535AD7,0x5AD75AD7,0x4A53294B,0x4A536B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B6B5B,0x6B5B5AD7,0x6B5B4A53,0x4A534A53,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD739CF,0x4A5318C7,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x39CF18C7,0x08430001,0x00010001,0x084318C7,0x294B294B,0x08430001,0x0843294B,0x4A534A53,0x4A534A53,0x4A53294B,0x18C70001,0x00010001,0x000118C7,0x5AD7294B,0x00010001,0x000118C7,0x39CF39CF,0x5AD76B5B,0x6B5B6B5B,0x6B5B5AD7,0x4A53294B,0x08430001,0x00010001,0x18C7294B,0x5AD75AD7,0x5AD739CF,0x294B39CF,0x39CF6B5B,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE294B,0x00010001,0x00016B5B,0x6B5B5AD7,0x00010001,0x18C70001,0x08430001,0x00010843,0x39CF39CF,0x4A5339CF,0x294B0001,0x00010001,0x294B6B5B,0x5AD70001,0x39CF0001,0x294BA529,0x39CF0001,0x00010001,0x000118C7,0x6B5B6B5B,0x5AD74A53,0x00010001,0x00016B5B,0x6B5B5AD7,0x00010001,0x294B0001,0x00015AD7,0x6B5B6B5B,0x4A53294B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0843,0x0001A529,0xEF7BA529,0xA529EF7B,0xCE730001,0x08430843,0x39CFFFFF,0x6B5B0001,0x39CF39CF,0x4A534A53,0x08430001,0xCE73FFFF,0xA529CE73,0xA5290001,0x294B0001,0x6B5BFFFF,0xCE73CE73,0x39CFA529,0x5AD70001,0x5AD75AD7,0x5AD70843,0x0001A529,0xEF7BA529,0xA529EF7B,0xCE730001,0x18C70001,0xA529EF7B,0xCE73EF7B,0xEF7B6B5B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x6B5BFFFF,0x6B5B0001,0x00010001,0x4A530001,0x08430843,0x294BFFFF,0x6B5B0001,0x39CF4A53,0x4A534A53,0x18C70001,0xCE73FFFF,0x00010001,0x00010001,0x00010001,0x6B5BFFFF,0xA529A529,0x6B5BFFFF,0x6B5B0001,0x18C74A53,0x294B0001,0x6B5BFFFF,0x6B5B0001,0x00010001,0x4A530001,0x18C70001,0xA529FFFF,0x5AD70001,0xEF7BEF7B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xEF7BEF7B,0x00010001,0x08430001,0x00010001,0x00010843,0x39CFFFFF,0x6B5B0001,0x00014A53,0x4A534A53,0x18C70001,0xCE73FFFF,0x00010001,0x0001294B,0xA529CE73,0xCE73FFFF,0xA529CE73,0xEF7BFFFF,0xEF7B5AD7,0x00015AD7,0x18C70001,0xEF7BEF7B,0x00010001,0x00010001,0x00010001,0x08430001,0xA529FFFF,0x6B5B0001,0xEF7BEF7B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xFFFFCE73,0x00010843,0x18C70001,0x00010001,0x00010843,0x294BFFFF,0x6B5B0001,0x00014A53,0x4A534A53,0x18C70001,0xCE73FFFF,0xCE73EF7B,0x6B5BCE73,0xEF7B294B,0xA529FFFF,0xCE73FFFF,0x6B5BFFFF,0x6B5B0001,0x18C75AD7,0x00010001,0xFFFFCE73,0x00010001,0x00010001,0x00010001,0x00010001,0xA529FFFF,0xCE73CE73,0xFFFF6B5B,0x0001FFFE,0xFFFEFFFE}
-#define dDpad0 {0xFFFEFFFE,0x00010001,0xFFFFEF7B,0x00010843,0x18C70001,0x0001A529,0xA5295AD7,0x294BFFFF,0x6B5B0001,0x00014A53,0x5AD75AD7,0x18C70001,0xCE73FFFF,0x00010001,0x0001FFFF,0xA5290001,0x6B5BFFFF,0xCE73FFFF,0x6B5BFFFF,0x5AD70001,0x4A535AD7,0x00010001,0xFFFFEF7B,0x00010001,0x00010001,0x0001A529,0xA529A529,0xCE73FFFF,0xEF7BFFFF,0x6B5B0843,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xCE73FFFF,0x39CF0001,0x00010001,0x000139CF,0x39CF4A53,0x294BFFFF,0x6B5B0001,0x294B39CF,0x4A535AD7,0x18C70001,0xCE73FFFF,0x00010001,0x0001FFFF,0xA5290001,0x6B5BFFFF,0xCE73FFFF,0x6B5BFFFF,0x6B5B0001,0x18C74A53,0x18C70001,0xCE73FFFF,0x39CF0001,0x00010001,0x0001A529,0xA529A529,0xA529FFFF,0x6B5BFFFF,0xCE730001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x39CFEF7B,0xEF7B5AD7,0x294BA529,0xEF7B0001,0x00010843,0x39CFFFFF,0xA5296B5B,0x6B5B294B,0x4A535AD7,0x18C70843,0xCE73FFFF,0x6B5B6B5B,0x6B5BEF7B,0xFFFF6B5B,0xEF7BFFFF,0xCE73FFFF,0x39CFFFFF,0xA5295AD7,0x00014A53,0x294B0001,0x39CFEF7B,0xEF7B5AD7,0x294BA529,0xEF7B0001,0x00010001,0xA529FFFF,0x6B5B6B5B,0xFFFFCE73,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE18C7,0x0001294B,0xA529CE73,0xCE73A529,0x6B5B0001,0x294B0001,0x39CFA529,0xA529A529,0x6B5B294B,0x4A536B5B,0x39CF0001,0xA529A529,0xA529A529,0xA5295AD7,0xA529CE73,0xA529A529,0xA529A529,0x00015AD7,0xA52939CF,0x00015AD7,0x5AD718C7,0x0001294B,0xA529CE73,0xCE73A529,0x6B5B0001,0x18C70001,0x6B5BA529,0x4A530843,0x6B5BCE73,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x18C70001,0x00010001,0x00010001,0x00010843,0x5AD70843,0x00010001,0x00010001,0x18C74A53,0x6B5B6B5B,0x5AD70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x18C75AD7,0x5AD74A53,0x18C70001,0x00010001,0x00010001,0x00010843,0x39CF0843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE39CF,0x294B294B,0x18C70843,0x084318C7,0x294B39CF,0x39CF39CF,0x39CF294B,0x294B294B,0x294B4A53,0x4A534A53,0x5AD74A53,0x4A5339CF,0x39CF39CF,0x39CF4A53,0x294B294B,0x39CF294B,0x39CF294B,0x4A5339CF,0x294B39CF,0x4A534A53,0x39CF39CF,0x39CF294B,0x18C70843,0x08430843,0x18C7294B,0x18C718C7,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x08430001,0x00010843,0x08430843,0x00010001,0x00010001,0x00010001,0x08430843,0x08430843,0x08430843,0x294B39CF,0x5AD76B5B,0x6B5B6B5B,0x5AD76B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x39CF294B,0x18C70001,0x08430001,0x00010843,0x08430001,0x00010001,0x00010001,0x08430001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x4A536B5B,0x6B5B6B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x294B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x4A536B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0843294B,0x5AD76B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD76B5B,0x5AD75AD7,0x5AD75AD7,0x5AD739CF,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x39CF5AD7,0x6B5B6B5B,0x6B5B6B5B,0x5AD75AD7,0x5AD75AD7,0x4A535AD7,0x5AD75AD7,0x5AD739CF,0x08430001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE6B5B,0x6B5B6B5B,0x6B5B5AD7,0x5AD75AD7,0x5AD75AD7,0x5AD75AD7,0x5AD74A53,0x5AD739CF,0x08430001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE6B5B,0x6B5B6B5B,0x39CF4A53,0x4A535AD7,0x5AD75AD7,0x5AD75AD7,0x4A535AD7,0x5AD739CF,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE5AD7,0x294B0843,0x00010001,0x000118C7,0x294B5AD7,0x39CF18C7,0x000118C7,0x08430001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x6B5B6B5B,0x5AD70001,0x000118C7,0x0843294B,0x08430001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0xA529EF7B,0xA529A529,0xEF7BCE73,0x00010001,0x294B39CF,0xEF7BCE73,0xCE73FFFF,0xCE73294B,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00016B5B,0xFFFF6B5B,0x00010843,0x00014A53,0x00010001,0x18C739CF,0xCE734A53,0x000139CF,0xEF7BCE73,0x0843FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001EF7B,0xEF7B0001,0x0843294B,0x08430001,0x00010001,0x18C739CF,0xCE7339CF,0x00010001,0xA529CE73,0x4A53FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001FFFF,0xCE730001,0x18C75AD7,0x39CF0001,0x00010001,0x0843294B,0xEF7B39CF,0x00010001,0x5AD7FFFF,0x4A53FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001EF7B,0xEF7B0001,0x084339CF,0x294B0001,0xA529A529,0x6B5B39CF,0xEF7B39CF,0x00010001,0x6B5BEF7B,0x4A53FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x0001CE73,0xFFFF39CF,0x00010001,0x00010001,0x6B5B5AD7,0x4A5339CF,0xFFFF39CF,0x18C70001,0xCE73EF7B,0x39CFFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x000139CF,0xFFFFEF7B,0x5AD7294B,0xA529EF7B,0x00010843,0x18C739CF,0xFFFFA529,0x5AD7CE73,0xFFFF6B5B,0x39CFFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x18C7A529,0xCE73CE73,0xA5296B5B,0x00010843,0x00014A53,0xA529A529,0xA529A529,0x39CF0001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE18C7,0x00010001,0x00010001,0x00010001,0x084339CF,0x08430001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE5AD7,0x4A53294B,0x18C70843,0x294B294B,0x4A5339CF,0x39CF294B,0x18C70843,0x08430001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE4A53,0x39CF294B,0x294B294B,0x18C7294B,0x18C7294B,0x18C718C7,0x18C70843,0x08430001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x08430843,0x00010001,0x08430843,0x08430843,0x08430843,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE,0xFFFEFFFE}
-#define dBlackBox {0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000018,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000036,0x00000012,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000006C,0x000000CA,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000C7,0x00000056,0x00000000,0x00000000,0x00000000,0x00000000,0x0000003B,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CA,0x0000001F,0x00000000,0x00000000,0x00000000,0x00000070,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000051,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000078,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x00000076,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x00000054,0x00000000,0x00000000,0x00000000,0x0000005A,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x0000003E,0x00000000,0x00000000,0x00000000,0x0000000D,0x000000B4,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x000000CC,0x0000009A,0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000012,0x0000006F,0x00000092,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000096,0x00000090,0x00000062,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000}
-#define dDekuStick {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30C30001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000182CF,0x6A491883,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x414582CF,0x41455987,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x30C30001,0x00010001,0x00010001,0x00014145,0x82CF5987,0x598730C3,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x59870841,0x00010001,0x00010001,0x104182CF,0x6A495987,0x41450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x598730C3,0x00010001,0x00010841,0x6A4982CF,0x6A494145,0x30C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x41454145,0x00010001,0x084182CF,0x82CF5987,0x598730C3,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41456A49,0x084130C3,0x82CFA3D7,0x59875987,0x59871883,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A495987,0x4145A3D7,0xA3D75987,0x59874145,0x6A495987,0x41455987,0x08410001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x59876A49,0xA3D782CF,0x59874145,0x41455987,0x41454145,0x414530C3,0x18830001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000130C3,0x82CF82CF,0x6A495987,0x41454145,0x41451041,0x104101C1,0x03010081,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5987A3D7,0x82CF6A49,0x41454145,0x414530C3,0x00010001,0x01C10301,0x03010301,0x00810001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016A49,0xA3D782CF,0x59874145,0x414530C3,0x30C30841,0x00010001,0x01C10301,0x03010301,0x01C10001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A49A3D7,0x6A495987,0x414530C3,0x30C31041,0x00010001,0x00010001,0x01C10301,0x03010301,0x01C10001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084182CF,0xA3D76A49,0x59874145,0x414530C3,0x00010001,0x00010001,0x00010001,0x000101C1,0x03010301,0x00810001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010841,0x6A49A3D7,0x82CF5987,0x41454145,0x41450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00810001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x104182CF,0xA3D76A49,0x59874145,0x41454145,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011883,0x82CFA3D7,0x6A494145,0x59874145,0x6A495987,0x59875987,0x41451041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x30C382CF,0xA3D76A49,0x41455987,0x30C34145,0x41454145,0x414530C3,0x59875987,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011883,0x82CFA3D7,0x6A495987,0x414530C3,0x30C31041,0x10411041,0x18831883,0x30C31883,0x10410001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x08416A49,0x82CF6A49,0x59874145,0x414530C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x82CFA3D7,0x6A495987,0x41454145,0x30C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00016A49,0x82CF6A49,0x59874145,0x414530C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x414582CF,0x6A495987,0x598730C3,0x30C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE1041,0x6A4982CF,0x59875987,0x41454145,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x00015987,0x6A495987,0x59874145,0x30C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x188382CF,0x59876A49,0x414530C3,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x08415987,0x59874145,0x30C31883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x41454145,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00011883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dDekuNuts {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x30854907,0x594981CD,0x59494907,0x30851043,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010801,0x4907B315,0x9A51B315,0x9A519A51,0x81CD9A51,0x81CD81CD,0x59491043,0x308581CD,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x204381CD,0x81CD9A51,0xB3159A51,0x9A519A51,0x81CD81CD,0x81CD718B,0x718B718B,0x718B9A51,0x49070001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00014907,0x81CD9A51,0xD45FD45F,0xD45FD45F,0xB3159A51,0x718B9A51,0x9A51718B,0x594981CD,0x9A51718B,0x08010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x30859A51,0xB315B315,0xD45FFE2D,0xFE2DFE2D,0xD45FB315,0x9A5181CD,0x718B718B,0x718BDB8F,0xDB8F718B,0x10430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010801,0x9A519A51,0xB315D45F,0xFE2DFE2D,0xFE2DD45F,0xD45FD45F,0xB3159A51,0x81CD81CD,0xB315DB8F,0x81CD4907,0x10430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00015949,0x9A519A51,0xB315D45F,0xFE2DFE2D,0xD45FB315,0xB315B315,0x9A5181CD,0x81CD9A51,0xDB8FB315,0x49074907,0x10430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x204381CD,0x718BB315,0xB315D45F,0xD45FD45F,0xD45F9A51,0x81CD9A51,0x9A519A51,0xB315DB8F,0xDB8F5949,0x49074907,0x20430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x718B9A51,0x81CDB315,0xB315B315,0xD45FD45F,0x9A51B315,0x9A51B315,0xB315B315,0xD45FDB8F,0x9A514907,0x49074907,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011043,0x81CD9A51,0x81CD9A51,0xB31581CD,0x9A51B315,0x81CD81CD,0xB3159A51,0x9A51B315,0xDB8FB315,0x59495949,0x49073085,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00014907,0x81CD718B,0x81CD9A51,0x9A51718B,0x718B9A51,0x9A5181CD,0xB315D45F,0xB315DB8F,0xD45F81CD,0x81CD4907,0x30852043,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0001718B,0x81CD81CD,0x718B718B,0x81CD718B,0x718B81CD,0x9A5181CD,0xB315FE2D,0xDB8FDB8F,0x9A515949,0x59494907,0x49070001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0001718B,0x718B81CD,0x718B4907,0x718B81CD,0x5949718B,0xB315B315,0xD45FDB8F,0xDB8F81CD,0x59493085,0x49074907,0x08010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00015949,0x718B5949,0x718B4907,0x594981CD,0x81CD9A51,0xB315DB8F,0xDB8FDB8F,0x59495949,0x49074907,0x49073085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00015949,0x718B4907,0x718B718B,0x5949B315,0x81CDDB8F,0xDB8FDB8F,0x9A515949,0x718B4907,0x49074907,0x49070001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00014907,0x718B5949,0x81CD9A51,0x81CD81CD,0xDB8FDB8F,0x9A515949,0x30853085,0x49074907,0x30853085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x30855949,0x49075949,0x718B718B,0xDB8FDB8F,0xDB8F5949,0x49075949,0x59494907,0x49073085,0x30850001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x08010001,0x00012043,0x9A51DB8F,0x81CD4907,0x49074907,0x30853085,0x30854907,0x30850801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x000181CD,0x59492043,0x30853085,0x49074907,0x30853085,0x20430801,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010801,0x00010001,0x00012043,0x10431043,0x08010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dBombs {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0003AD1F,0xAD1F0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x18D1FFFF,0xAD1F18D1,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0xAD1FAD1F,0xAD1F6B43,0x18C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6B43BD85,0xAD1FAD1F,0xAD1FAD1F,0xBD856B43,0x18C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B43,0xBD85BD85,0xBD85AD1F,0xBD85BD85,0xBD85BD85,0x6B430001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B43,0xBD85BD85,0xBD85BD85,0xBD85BD85,0x6B436B43,0x18C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010003,0x21176B43,0xBD856B43,0xBD856B43,0x6B436B43,0x6B436B43,0x6B432117,0x00030001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00034AA9,0x4AA973B5,0xAD1FBD85,0x6B436B43,0x6B436B43,0x6B432117,0x2117319F,0x21170849,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010003,0x4AA94AA9,0x73B573B5,0x73B5A57D,0xA57DAD1F,0x73B54AA9,0x4AA9319F,0x319F2117,0x21172117,0x08490001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00034AA9,0x4AA973B5,0x73B5A57D,0xA57DA57D,0xA57D73B5,0x73B54AA9,0x4AA9319F,0x319F319F,0x21172117,0x18D10003,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21174AA9,0x73B573B5,0xA57DA57D,0xFFFFFFFF,0xA57DA57D,0x73B54AA9,0x4AA9319F,0x319F319F,0x21172117,0x18D10849,0x00030001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010003,0x4AA94AA9,0x73B573B5,0xA57DFFFF,0xFFFFFFFF,0xA57DA57D,0x73B54AA9,0x4AA9319F,0x319F2117,0x21172117,0x18D118D1,0x00030001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118D1,0x4AA94AA9,0x73B573B5,0xA57DFFFF,0xA57DFFFF,0xA57D73B5,0x4AA94AA9,0x319F319F,0x319F319F,0x21172117,0x18D118D1,0x08490001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0001319F,0x4AA94AA9,0x4AA973B5,0xA57DA57D,0xA57DA57D,0x73B573B5,0x4AA94AA9,0x319F319F,0x21172117,0x211718D1,0x18D118D1,0x18D10003,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0003319F,0x319F4AA9,0x4AA973B5,0x73B573B5,0x73B573B5,0x73B54AA9,0x4AA9319F,0x319F319F,0x21172117,0x211718D1,0x18D118D1,0x08490849,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0849319F,0x4AA94AA9,0x4AA94AA9,0x4AA94AA9,0x73B54AA9,0x4AA94AA9,0x319F319F,0x319F2117,0x21172117,0x18D118D1,0x18D118D1,0x18D10849,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0849319F,0x319F319F,0x319F4AA9,0x4AA94AA9,0x4AA94AA9,0x4AA9319F,0x319F319F,0x319F2117,0x21172117,0x18D118D1,0x18D118D1,0x18D10849,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00032117,0x319F319F,0x4AA9319F,0x319F319F,0x319F319F,0x319F319F,0x319F319F,0x21172117,0x211718D1,0x18D118D1,0x18D10849,0x18D10003,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012117,0x319F319F,0x319F319F,0x319F319F,0x319F319F,0x319F2117,0x21172117,0x21172117,0x211718D1,0x18D118D1,0x18D118D1,0x18D10849,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118D1,0x21172117,0x319F2117,0x319F319F,0x21172117,0x21172117,0x21172117,0x21172117,0x18D12117,0x18D118D1,0x18D118D1,0x18D10001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010849,0x21172117,0x21172117,0x21172117,0x21172117,0x21172117,0x21172117,0x21172117,0x211718D1,0x18D118D1,0x18D118D1,0x08490001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18D12117,0x21172117,0x21172117,0x21172117,0x21172117,0x21172117,0x18D12117,0x211718D1,0x18D118D1,0x18D118D1,0x00030001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x000318D1,0x18D118D1,0x18D12117,0x18D118D1,0x18D118D1,0x18D118D1,0x211718D1,0x18D118D1,0x18D118D1,0x18D10849,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010849,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D12117,0x18D118D1,0x18D118D1,0x08490001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x084918D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x00030001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010003,0x18D10849,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x18D10001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010849,0x18D118D1,0x18D118D1,0x18D118D1,0x18D118D1,0x08490003,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00010849,0x00030849,0x08490003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dBow {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x108341CD,0x941F941F,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41CD941F,0x941F941F,0x941FD629,0x6AD30001,0xFFFE8041,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001941F,0xD62912B7,0x941F941F,0xD629FFFF,0x41CD0001,0x1083E843,0x38C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x000138C3,0x38C35985,0x7A4738C3,0x38C31083,0x08D70001,0x0001941F,0x941F6AD3,0x6AD31083,0xFFFFD629,0x00010001,0x8041E843,0xE8431083,0x941F1083,0x41CD0001,0x00011083,0x38C37A47,0x7A47D38B,0xD38B7A47,0x7A477A47,0x6AD312B7,0x12B70001,0x000141CD,0x941F7A47,0x38C3941F,0xFFFF6AD3,0x00010001,0x8041E843,0xE843D38B,0xD6296AD3,0xD6296AD3,0x7A47D38B,0xD38BD38B,0x7A475985,0x59855985,0x7A475985,0x12B712B7,0x08D70001,0x6AD3D629,0xD62941CD,0x41CDFFFF,0xD62941CD,0x00010001,0x38C3E843,0xE843D38B,0xD6296AD3,0xD6297A47,0x7A477A47,0x38C35985,0x38C35985,0x38C338C3,0x41CD12B7,0x12B76AD3,0xD38B38C3,0xD629FFFF,0x941F41CD,0x38C341CD,0x941F0001,0x0001FFFE,0x000138C3,0x8041941F,0x6AD36AD3,0x941F5985,0x598538C3,0x59855985,0x41CD38C3,0x38C341CD,0x12B712B7,0x41CDD38B,0xD38BD38B,0xD62941CD,0x41CD0001,0x00011083,0x10830001,0x0001FFFE,0x00010001,0x1083941F,0x41CD941F,0x6AD341CD,0x598538C3,0x10831083,0x00010001,0x000112B7,0x12B708D7,0xD38BD38B,0xD38BD629,0x6AD35985,0x10830001,0x10830001,0x00010001,0x0001FFFE,0x00010001,0x10836AD3,0x41CD6AD3,0x41CD1083,0x00010001,0x00010001,0x00010001,0x00011083,0x08D70001,0x5985D38B,0xD6297A47,0xD38BD38B,0x598512B7,0x12B70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x108341CD,0x941F6AD3,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x7A47D629,0x7A47D38B,0xD38BD38B,0x12B712B7,0x08D70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011083,0x6AD3D629,0x6AD30001,0x00010001,0x00010001,0x00010001,0x000141CD,0xD6296AD3,0x5985D38B,0xD38B12B7,0x12B708D7,0x38C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x10836AD3,0xD62941CD,0x00010001,0x00010001,0x00010001,0x1083D629,0x7A470001,0x00015985,0x12B712B7,0x08D738C3,0x38C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011083,0x6AD3D629,0x6AD30001,0x00010001,0x00011083,0xD6297A47,0x00010001,0x000112B7,0x12B708D7,0x7A475985,0x38C31083,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x1083941F,0xD62941CD,0x00010001,0x1083D629,0x7A470001,0x00010001,0x08D708D7,0x41CD5985,0x7A475985,0x38C31083,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x941FD629,0x41CD38C3,0xD6297A47,0x10830001,0x00010001,0x00011083,0x38C37A47,0x7A4738C3,0x38C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001941F,0xD629D629,0x7A470001,0x00010001,0x00010001,0x00010001,0x10837A47,0x7A475985,0x38C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141CD,0xD6297A47,0x6AD31083,0x00010001,0x00010001,0x00010001,0x38C37A47,0x7A4738C3,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x5985D629,0x59856AD3,0xD6296AD3,0x00010001,0x00010001,0x00010001,0x59857A47,0x598538C3,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x000141CD,0x6AD36AD3,0xD6297A47,0x10831083,0x941FD629,0x41CD0001,0x00010001,0x00011083,0x7A477A47,0x598538C3,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x41CD6AD3,0x941FD629,0x6AD31083,0x00010001,0x0001941F,0xD62941CD,0x00010001,0x00011083,0x7A477A47,0x59851083,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x10837A47,0x7A476AD3,0xD6297A47,0x941F41CD,0x00010001,0x00010001,0x941FD629,0x6AD30001,0x000138C3,0xD38B5985,0x38C31083,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00015985,0x7A477A47,0x7A47D629,0x7A47941F,0x941F1083,0x00010001,0x00010001,0x10836AD3,0xD6296AD3,0x00015985,0x7A475985,0x59856AD3,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x10835985,0x59857A47,0xD6297A47,0x7A477A47,0x41CD0001,0x00010001,0x00010001,0x00010001,0x941FD629,0x6AD3941F,0xD629941F,0x941F41CD,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0001D629,0x7A477A47,0x7A476AD3,0x10830001,0x00010001,0x00010001,0x00010001,0x00016AD3,0xD629941F,0x941F6AD3,0x41CD41CD,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x41CD7A47,0x41CD7A47,0x7A4738C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AD36AD3,0x941F941F,0xD6296AD3,0x41CD0001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x38C37A47,0x59850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6AD3941F,0x941F6AD3,0x41CD41CD,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00018041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000141CD,0x80418041,0x80418041,0x80411083,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x38C38041,0x80418041,0xE843E843,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000138C3,0x38C338C3,0x38C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10831083,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dFireArrow {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20430001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x91890001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013149,0x91892043,0x00012043,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20437309,0x73093149,0xE5699353,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x73097309,0x7309BC59,0xBC597309,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013149,0x73097309,0x9353BC59,0xBC597309,0x91896147,0x20430001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019353,0x9353BC59,0xBC59BC59,0x73097309,0x73096147,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31499353,0xBC59BC59,0xBC597309,0x73097309,0x20430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3149BC59,0xBC59BC59,0x93539353,0x73090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3149BC59,0xBC59BC59,0x93539353,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00016843,0x40432043,0x20432043,0x00010001,0x00010001,0x00010001,0x9353BC59,0xBC599353,0x93530001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x68436843,0x68436843,0x40434043,0x40434043,0x20432043,0x00019353,0xBC593149,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0xA8C56843,0x68436843,0x40434043,0x40434043,0x40434043,0x9353BC59,0x91890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0001A8C5,0x68436843,0x68436843,0x40434043,0x40434043,0x40436147,0xBC599353,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x2043A8C5,0x40436843,0x40434043,0x68436843,0x40434043,0x6843BC59,0x9353A8C5,0xA8C50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0xA8C56843,0x68434043,0x68436843,0xA8C56843,0x4043FFFF,0xDB9FBC59,0x9189A8C5,0xE1092043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00016843,0xA8C56843,0x6843A8C5,0xA8C5A8C5,0x9353A8C5,0xBC59E569,0xFFFFBC59,0x9189A8C5,0xE1096843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001E109,0xA8C5E109,0xE109E109,0xE109DB9F,0xDB9FDB9F,0xE569FFFF,0xDB9FDB9F,0xE109A8C5,0xE1096843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001A8C5,0xE109E109,0xE109E109,0xE109E569,0xE5699353,0xE109BC59,0xDB9FE109,0xA8C5A8C5,0xE109A8C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x2043E109,0xA8C5E109,0xA8C5E109,0xDB9FE569,0xDB9F9189,0x9189A8C5,0xDB9FE109,0xA8C5E109,0xE109A8C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001E109,0xE109A8C5,0xA8C5A8C5,0xDB9FE569,0x93539189,0xA8C5E109,0xE569E109,0xE109E109,0xE109E109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001E109,0xE109A8C5,0x68436843,0xE569E569,0x91896147,0x9189E109,0x9189DB9F,0xA8C5A8C5,0xE109E109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001E109,0x68434043,0x40436147,0xE5699353,0x61476147,0x61479189,0xA8C5A8C5,0xE109A8C5,0xE109E109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001E109,0x68434043,0x40439189,0x93536147,0x40434043,0x6147A8C5,0xE109A8C5,0xE109A8C5,0xE109E109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001A8C5,0x68436843,0x40436147,0x61474043,0x40434043,0x40436843,0xE109A8C5,0xE109A8C5,0xE109E109,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001A8C5,0x68434043,0x40434043,0x40434043,0x40432043,0x20432043,0x6843A8C5,0xA8C56843,0x4043A8C5,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x68434043,0x40432043,0x40432043,0x20434043,0x20434043,0x20436843,0x68434043,0x40430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00014043,0x20434043,0x40432043,0x20432043,0x40434043,0x40436843,0x40432043,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x20432043,0x40434043,0x68436843,0x68434043,0xA8C56843,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012043,0x20430001,0x20430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dDin {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20CD3191,0x10870001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20CD20CD,0x20CD3191,0x20CD3191,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120CD,0x319139E5,0x39E541D7,0x319141D7,0x31913191,0x31910001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20CD41D7,0x39E539E5,0x39E541D7,0x319141D7,0x41D741D7,0x41D73191,0x31910001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00011087,0x41D739E5,0x39E539E5,0x39E539E5,0x7BAD41D7,0x41D741D7,0x39E541D7,0x31913191,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x108741D7,0x39E539E5,0x39E539E5,0x39E539E5,0x7BAD7BAD,0x39E541D7,0x39E539E5,0x629F3191,0x41D73191,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x20CD20CD,0x39E539E5,0x39E539E5,0x39E539E5,0x7BAD7BAD,0x7BAD7BAD,0x39E541D7,0x39E5629F,0x41D741D7,0x319141D7,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x629F41D7,0x39E539E5,0x39E539E5,0x7BAD7BAD,0x7BAD629F,0x629F7BAD,0x39E57BAD,0x629F41D7,0x41D741D7,0x41D741D7,0x31910001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0xB52F7BAD,0x39E539E5,0x39E57BAD,0x7BAD7BAD,0x629FC415,0xC415629F,0x7BAD7BAD,0x629F41D7,0x41D741D7,0x41D741D7,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0xFFFFFFFF,0x7BAD39E5,0x39E57BAD,0x7BAD7BAD,0xC415FE0B,0xC4157BAD,0x7BAD629F,0x629F41D7,0x41D741D7,0x41D77BAD,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010843,0xFFFFFFFF,0xB52F7BAD,0x7BAD7BAD,0x7BADC415,0xFE0BFE0B,0xC415C415,0xC415629F,0x629F41D7,0x629F629F,0x7BAD7BAD,0x31910001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00011087,0xFFFFFFFF,0xFFFFB52F,0x7BAD7BAD,0xC415FE0B,0xFE0BFE0B,0xC415C415,0xC4157BAD,0x629F7BAD,0x7BAD7BAD,0x7BAD7BAD,0x31910001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000120CD,0xFFFFFFFF,0xFFFFFFFF,0x7BADB52F,0xFE0BFE0B,0xFE0BFE0B,0xFE0BC415,0xC415C415,0xB52F7BAD,0x7BAD7BAD,0x7BADB52F,0x41D70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000120CD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFB52F,0xFE0BFE0B,0xFE0BFE0B,0xC415FE0B,0xC415B52F,0xB52FB52F,0xB52F7BAD,0x7BADB52F,0x20CD0001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000141D7,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFE0BFE0B,0xFE0BFE0B,0xFE0BFE0B,0xFE0BC415,0xB52FB52F,0xB52FB52F,0x7BADB52F,0x10870001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001629F,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFE0BFE0B,0xFE0BFE0B,0xFE0BFE0B,0xC415B52F,0xB52FB52F,0xB52FB52F,0x7BADB52F,0x08430001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00017BAD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFE0BFE0B,0xFE0BFE0B,0xFE0BFE0B,0xC415B52F,0xB52FB52F,0xB52FB52F,0x7BADB52F,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001629F,0xFFFFFFFF,0xFFFFFFFF,0xFFFFC415,0xFE0BFE0B,0xFE0BFE0B,0xFE0BFE0B,0xFE0BB52F,0xB52FB52F,0xB52F7BAD,0x7BAD7BAD,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001B52F,0xFFFFFFFF,0xFFFFFFFF,0xC415629F,0xFE0BFE0B,0xFE0BFE0B,0xFE0BC415,0xB52FB52F,0xB52FB52F,0x7BAD7BAD,0x7BAD7BAD,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001B52F,0xFFFFFFFF,0xFFFFB52F,0x629F41D7,0xC415FE0B,0xC415C415,0x31913191,0x41D77BAD,0x7BAD7BAD,0x7BAD7BAD,0xB52F7BAD,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001B52F,0xFFFFFFFF,0xFFFF629F,0x41D73191,0x629FC415,0x629F629F,0x629F41D7,0x31913191,0x41D77BAD,0x7BAD7BAD,0x7BAD629F,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFFFFFF,0x7BAD629F,0x31913191,0x629F629F,0x629F629F,0x629F629F,0x41D741D7,0x629F39E5,0x39E57BAD,0x7BAD7BAD,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFFB52F,0x629F3191,0x319141D7,0x629F629F,0x629F629F,0x629F629F,0x41D741D7,0x41D739E5,0x39E539E5,0x41D70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x1087FFFF,0xFFFF7BAD,0x629F3191,0x319141D7,0x629F629F,0x629F41D7,0x41D73191,0x41D739E5,0x39E520CD,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0843FFFF,0xB52F629F,0x31913191,0x3191629F,0x629F39E5,0x41D741D7,0x41D739E5,0x20CD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x1087B52F,0x629F3191,0x20CD3191,0x319139E5,0x41D741D7,0x41D73191,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x3191B52F,0x31913191,0x319120CD,0x41D741D7,0x20CD0843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x08433191,0x20CD20CD,0x20CD20CD,0x10870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x08431087,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dSlingshot {0xFFFEFFFE,0x00015041,0x50419883,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE1843,0x9883D8C3,0xD8C39883,0x50410841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x5041D8C3,0xD8C3D8C3,0xD8C3D8C3,0x98830841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x00019883,0xD8C3D8C3,0xD8C39883,0x98839351,0xAC5B9351,0xAC5B2905,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE1843,0x9883D8C3,0xD8C3D8C3,0x98836291,0xAC5BAC5B,0xAC5BAC5B,0xAC5B0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0841,0x9883D8C3,0xD8C3D8C3,0x98835041,0x08410841,0x08412905,0x62916291,0x08410001,0x00010001,0x00010001,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x18439883,0x98839883,0x49852905,0x00010001,0x08410841,0x2905AC5B,0x49850001,0x00010001,0x18439883,0xD8C30841,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00012905,0x498561C7,0x61C74985,0x18430001,0x00010001,0x0001AC5B,0x62910001,0x00015041,0xD8C3D5A5,0xD5A59883,0x08410001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x498561C7,0x61C74985,0x29050001,0x00010001,0x0001AC5B,0x62910001,0xD8C3D8C3,0xD5A5AC5B,0xD8C3D8C3,0x50410001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x290561C7,0x61C74985,0x49850841,0x00010001,0x0001AC5B,0x629182C5,0xD5A5D5A5,0xD8C3D8C3,0xD8C3D8C3,0x98830001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x18434985,0x61C74985,0x49851843,0x00010001,0x08419351,0xD5A5D5A5,0xD8C3D8C3,0xD8C3D8C3,0xD8C39883,0x98830841,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00014985,0x61C761C7,0x61C74985,0x290561C7,0xD5A5D5A5,0xAC5B61C7,0x62919883,0x98839883,0x98839883,0x50410841,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011843,0x61C761C7,0x498561C7,0xAC5BD5A5,0xAC5B61C7,0x61C761C7,0x629161C7,0x98835041,0x61C7AC5B,0xAC5B2905,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x498561C7,0x61C7AC5B,0xAC5B82C5,0x61C761C7,0x62914985,0x29050001,0x00010001,0x00016291,0xD5A5D5A5,0x62910001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x504161C7,0x61C761C7,0x498561C7,0x62914985,0x49850001,0x00010001,0x00010001,0x00010841,0x2905AC5B,0xD5A56291,0x08410001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x61C79351,0x61C761C7,0x629161C7,0x93516291,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x6291D5A5,0xAC5B0841,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x82C56291,0x61C761C7,0x61C72905,0xD5A56291,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012905,0xAC5BAC5B,0x18430001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012905,0x935161C7,0x61C761C7,0x29056291,0xAC5B2905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x2905D5A5,0x62910001,0x0001FFFE,0xFFFE0001,0x00010001,0x61C782C5,0x935161C7,0x62914985,0x0001AC5B,0xD5A50841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08416291,0xAC5B0841,0x0001FFFE,0xFFFE0001,0x00012905,0x9351AC5B,0x82C54985,0x498561C7,0x0001AC5B,0xD5A50001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012905,0xD5A52905,0x0001FFFE,0xFFFE0001,0x00014985,0x61C782C5,0x82C582C5,0x82C52905,0x0001AC5B,0xD5A52905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012905,0xD5A50841,0x00010001,0xFFFE0001,0x18439351,0xAC5B82C5,0x61C74985,0x61C74985,0x00016291,0xD5A5AC5B,0x08410001,0x00010001,0x00012905,0x08410001,0x00010001,0x29050841,0x00012905,0xD5A50841,0x00010001,0xFFFE0001,0x290561C7,0x82C582C5,0x82C582C5,0x29050841,0x00010001,0xD5A5D5A5,0x62910001,0x00010001,0x084182C5,0x49851843,0x084182C5,0x82C561C7,0x0001AC5B,0xAC5B0001,0x00010001,0xFFFE0841,0x82C5AC5B,0x93514985,0x49854985,0x61C70001,0x00010001,0x0841AC5B,0xD5A59351,0x08410001,0x29054985,0x498582C5,0x82C582C5,0x82C59351,0x6291D5A5,0x29050001,0x00010001,0xFFFE0841,0x61C782C5,0x82C582C5,0x82C54985,0x18430001,0x00010001,0x00010841,0xAC5BD5A5,0xAC5B6291,0x49854985,0x498582C5,0x82C582C5,0x82C59351,0xD5A5AC5B,0x08410001,0x00010001,0xFFFE82C5,0xAC5B9351,0x61C74985,0x61C761C7,0x18430001,0x00010001,0x00010001,0x00012905,0xAC5BAC5B,0x82C561C7,0xAC5B9351,0xAC5BD5A5,0xAC5B82C5,0x93510841,0x00010001,0x0001FFFE,0xFFFE1843,0x82C582C5,0x82C582C5,0x49851843,0x00010001,0x00010001,0x00010001,0x00010001,0x00016291,0x82C54985,0xAC5BAC5B,0xAC5BAC5B,0x935182C5,0x29050001,0x00010001,0x0001FFFE,0xFFFE1843,0x61C74985,0x498561C7,0x61C72905,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08414985,0x498582C5,0x82C582C5,0x82C582C5,0x18430001,0x00010001,0x0001FFFE,0xFFFE1843,0x498561C7,0x61C72905,0x18430001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08414985,0x49854985,0x498582C5,0x82C54985,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x08412905,0x49850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011843,0x00010001,0x00012905,0x49851843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dBombchu {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000108CF,0x11150001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x084708CF,0x08CF0847,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x19591115,0x08CF0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084708CF,0x11151959,0x19591115,0x08CF0001,0x00010001,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00011115,0x195908CF,0x08CF0001,0x00010001,0x00010001,0x00010001,0x08CF1959,0x19591959,0x19591959,0x111508CF,0x08470001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x08472A23,0x11151115,0x08470001,0x51C38AC1,0x8AC120C3,0x19591959,0x19591959,0x19591115,0x11151115,0x11150847,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x2A231959,0x195908CF,0xB449F743,0xF743F743,0x4A0F2A23,0x19591959,0x19591115,0x11151115,0x11151115,0x08CF0847,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00012A23,0x19591959,0x1115B449,0xF743F743,0xB4492A23,0x19591959,0x19591115,0x11151115,0x11151115,0x11151115,0x08470847,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x08472A23,0x2A2308CF,0x4A0FF743,0xF743B449,0x2A231959,0x19591959,0x11151959,0x11151115,0x11151115,0x11150847,0x08470001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2A232A23,0x195908CF,0xF743F743,0xB4495BAF,0x2A231959,0x19591115,0x11151115,0x11151115,0x111508CF,0x08CF0847,0x08470001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000108CF,0x2A235BAF,0x2A234A0F,0xF743B449,0x5BAF2A23,0x19591959,0x19591115,0x11151115,0x11151115,0x111508CF,0x08470847,0x084720C3,0x51C320C3,0x0001FFFE,0xFFFE0001,0x00010001,0x00011959,0x5BAF5BAF,0x2A232A23,0x5BAF95FB,0x5BAF2A23,0x19591959,0x11151115,0x11151115,0x11151115,0x08CF08CF,0x08470847,0x8AC18AC1,0x51C30001,0x0001FFFE,0xFFFE0001,0x00010001,0x08472A23,0x5BAF5BAF,0x95FB95FB,0x95FB95FB,0x5BAF1959,0x19591115,0x11151115,0x11151115,0x111508CF,0x08CF0847,0x084751C3,0x8AC151C3,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x4A0F2A23,0x2A2395FB,0x95FB95FB,0x95FB5BAF,0x2A231959,0x11151115,0x11151115,0x11151115,0x08CF08CF,0x08CF0847,0x084751C3,0x20C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0xB4492A23,0x2A2395FB,0x95FB95FB,0x5BAF2A23,0x19591959,0x11151115,0x11151115,0x111508CF,0x08CF08CF,0x08470847,0x20C351C3,0x51C30001,0x00010001,0x0001FFFE,0xFFFE0001,0x000151C3,0xB4494A0F,0x5BAF95FB,0x5BAF5BAF,0xB449B449,0x51C308CF,0x11151115,0x111508CF,0x08CF08CF,0x08CF08CF,0x08470847,0x51C38AC1,0x51C320C3,0x00010001,0x0001FFFE,0xFFFE0001,0x000151C3,0xB4495BAF,0x5BAF5BAF,0x2A23F743,0xB4498AC1,0x51C308CF,0x11151115,0x08CF1115,0x08CF08CF,0x08CF0847,0x084720C3,0x8AC18AC1,0x8AC151C3,0x00010001,0x0001FFFE,0xFFFE0001,0x000151C3,0x8AC12A23,0x5BAF2A23,0xB449B449,0xB4498AC1,0x20C31115,0x111508CF,0x111508CF,0x08CF08CF,0x08CF0847,0x084751C3,0x8AC18AC1,0x8AC151C3,0x20C30001,0x0001FFFE,0xFFFE0001,0x00010847,0x2A232A23,0x2A232A23,0xB449B449,0xB4498AC1,0x08CF1115,0x11151115,0x08CF1115,0x11151115,0x08CF0847,0x08478AC1,0x8AC18AC1,0x8AC18AC1,0x00010001,0x0001FFFE,0xFFFE0001,0x4A0F5BAF,0x2A232A23,0x2A231959,0x4A0F8AC1,0x51C308CF,0x19591115,0x11151115,0x11151115,0x111508CF,0x08470847,0x51C38AC1,0x8AC18AC1,0x51C30001,0x00010001,0x0001FFFE,0xFFFE20C3,0x4A0F4A0F,0x8AC14A0F,0x11151115,0x11152A23,0x2A235BAF,0x2A232A23,0x19591115,0x11151115,0x08CF0847,0x084720C3,0x8AC18AC1,0x20C30001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x20C35BAF,0x8AC151C3,0x51C395FB,0x95FB95FB,0x5BAF5BAF,0x4A0F1115,0x19591115,0x08CF0847,0x08470847,0x08470847,0x20C30001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x20C351C3,0x20C35BAF,0x5BAF2A23,0x2A234A0F,0x2A232A23,0x08CF0847,0x08470847,0x08470847,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010847,0x08474A0F,0x4A0F95FB,0x5BAF95FB,0x4A0F0847,0x00010847,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x20C320C3,0x000120C3,0x4A0F4A0F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dHookshot {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011089,0x3A0F2949,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011089,0x3A0F52D7,0x8C338C33,0xAD6B2949,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00013A0F,0x741F8C33,0x8C338C33,0x8C33AD6B,0x3A0F0001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000152D7,0x8C338C33,0x8C338C33,0x8C338C33,0xAD6B2949,0x52D70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001741F,0xAD6BAD6B,0xAD6BAD6B,0xAD6BAD6B,0x3A0F2949,0x52D70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x10890001,0x52D7AD6B,0x741FAD6B,0xAD6BAD6B,0x3A0F2949,0x3A0F0001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018C51,0x3AED299F,0x10893A0F,0x741FAD6B,0x741F8C51,0x29493A0F,0x3A0F0001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x3A0FC613,0xAD6B5DFD,0x741F2949,0x3A0F52D7,0x52D7AD6B,0x29493A0F,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011089,0x2113741F,0x5DFD5DFD,0x5DFD5DFD,0x29492949,0x52D7AD6B,0x29493A0F,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012113,0x3AED299F,0x299F3AED,0x5DFDC613,0xC6135DFD,0x3AED1089,0x3A0FAD6B,0x29492949,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x1089299F,0x3AED8C33,0x8C333AED,0x3AED3A0F,0x8C513AED,0x5DFD3AED,0x0001AD6B,0x29490001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x21133AED,0x3AED8C33,0xFFFF741F,0x3AED52D7,0x3AED3AED,0x741F299F,0x10891089,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x29493A0F,0x2113299F,0x3AED8C33,0x8C33FFFF,0x3AED299F,0x3AED52D7,0xC6138C51,0x10890001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x0001741F,0x741F52D7,0x29492113,0x299F8C33,0x8C338C33,0x8C333AED,0x299F2949,0x3A0F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000152D7,0x741F741F,0x52D72949,0x21132113,0x2113299F,0x3AED3AED,0x3AED3AED,0x299F1089,0x10890001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x52D7741F,0x52D71089,0x00010001,0x10892113,0x21132113,0x299F299F,0x299F299F,0x299F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000152D7,0x741F3A0F,0x00010001,0x00010001,0x00012113,0x21132113,0x2113299F,0x299F2113,0x10890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000152D7,0x741F3A0F,0x00010001,0x00010001,0x00010001,0x21132113,0x29492113,0x21132113,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00012949,0x299F52D7,0x52D70001,0x00010001,0x00010001,0x00010001,0x3A0F3A0F,0x10890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x10898C51,0xC6132949,0x00010001,0x00010001,0x00012949,0x3A0F2949,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00013A0F,0x8C518C51,0x10890001,0x00010001,0x000152D7,0x741F3A0F,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x3A0F8C51,0xC6132949,0x00010001,0x1089741F,0x741F0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00013A0F,0x8C51741F,0x52D70001,0x52D7741F,0x29490001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x294952D7,0x52D7AD6B,0x741F52D7,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x10891089,0x52D7741F,0x52D70001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x10892949,0x10890001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dLongshot {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010887,0x208D4213,0x74217421,0x74210001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294D69E1,0x74218CF1,0x8CF18CF1,0xAB718CF1,0x42130001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014213,0xC6738CF1,0x8CF18CF1,0x8CF1AB71,0x8CF18CF1,0x8CF1294D,0x294D0001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x294DC673,0x8CF18CF1,0x8CF18CF1,0x8CF18CF1,0x8CF1C673,0x4213294D,0x42130001,0x00010001,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001294D,0xC673FFFF,0xFFFFC673,0xC673C673,0xC6736355,0x294D294D,0x294D0001,0x00010001,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010887,0xBDD77421,0x8CF1C673,0xC6734213,0x294D4213,0x294D0001,0x00010001,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010887,0x08870001,0x0001208D,0x42137421,0x7421C673,0xBDD74213,0x294D294D,0x00010001,0x00010001,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08876355,0x23AD23AD,0x294D294D,0x42137421,0x63556355,0xC6734213,0x294D6355,0x00010001,0x00010001,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x4213BDD7,0xBDD78CF1,0xC673294D,0x294D294D,0x294D8CF1,0xC6734213,0x294D208D,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010887,0x294D6355,0x8CF123AD,0xC6738CF1,0x294D0887,0x08876355,0xC6736355,0x42130001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010887,0x49190887,0x294D23AD,0x8CF1BDD7,0xBDD7C673,0x8CF1294D,0x00010001,0xC6736355,0x63550001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08874919,0x69E169E1,0x491923AD,0x23AD6355,0xBDD723AD,0x23AD23AD,0x08870001,0x63557421,0x08870001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010887,0x49194919,0x69E1AB71,0xC6734919,0x4213294D,0x23AD23AD,0x742123AD,0x42130001,0x00014213,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x294D208D,0x491969E1,0x69E1AB71,0xFFFFC673,0x49194213,0x23AD4213,0xBDD76355,0x08870001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x63557421,0x7421294D,0x208D4919,0x69E1AB71,0xAB71AB71,0xAB714919,0x294D294D,0x6355294D,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x42137421,0x74217421,0x4213294D,0x208D208D,0x69E169E1,0x69E169E1,0x69E14919,0x208D294D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00016355,0x74217421,0x6355294D,0x0887208D,0x208D208D,0x208D4919,0x49194919,0x49194919,0x208D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x63557421,0x6355294D,0x00010001,0x0001208D,0x208D208D,0x208D208D,0x49194919,0x4919208D,0x208D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x08877421,0x74214213,0x00010001,0x00010001,0x00010001,0x208D208D,0x208D208D,0x208D208D,0x208D208D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x294D7421,0x7421208D,0x00010001,0x00010001,0x00010001,0x0887208D,0x208D208D,0x294D208D,0x08870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x00014213,0x42138CF1,0x08870001,0x00010001,0x00010001,0x00010001,0x0001294D,0x4213294D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x0001294D,0x294D7421,0xBDD70887,0x00010001,0x00010001,0x00010001,0x08874213,0x63550887,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x294D6355,0xBDD7BDD7,0x08870001,0x00010001,0x00010001,0x42137421,0x63550001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001294D,0x6355BDD7,0xBDD70001,0x00010001,0x00010887,0x74217421,0x08870001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x294D6355,0xBDD77421,0x00010001,0x00016355,0x74214213,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x0887294D,0x6355BDD7,0x8CF10887,0x42137421,0x74210001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x294D4213,0x4213C673,0x74217421,0x294D0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010887,0x42137421,0x74214213,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x0001294D,0x294D0887,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dIceArrow {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18830001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x69870001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016987,0x69871883,0x00011883,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18837B09,0x7B096987,0xB49B739B,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x7B097B09,0x7B09B49B,0xB49B7B09,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012949,0x7B097B09,0x7B09B49B,0xB49B7B09,0x69876987,0x18830001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1883739B,0x739BB49B,0xB49BB49B,0x7B097B09,0x7B096987,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2949739B,0xB49BB49B,0xB49B7B09,0x7B097B09,0x18830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2949B49B,0xB49BB49B,0x7B09739B,0x7B091883,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x2949B49B,0xB49BB49B,0xB49B7B09,0x18830001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010957,0x095708CF,0x00450045,0x00010001,0x00010001,0x00010001,0x7B09B49B,0xB49B739B,0x739B0045,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x09571A1D,0x1A1D0957,0x09570957,0x09570957,0x08CF0045,0x00457B09,0xB49B6987,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010045,0x1B6B1A1D,0x09571A1D,0x095708CF,0x08CF0957,0x09570957,0x739BB49B,0x739B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011A1D,0x1A1D0957,0x09570957,0x09570957,0x095708CF,0x09571A1D,0xB49B739B,0x18830001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x08CF1B6B,0x09571A1D,0x09570957,0x1A1D0957,0x09570957,0x1A1DB49B,0x739B1A1D,0x1B6B0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010045,0x1A1D1A1D,0x1A1D0957,0x09571A1D,0x1B6B0957,0x0957FFFF,0xB49B739B,0x739B1B6B,0x1B6B0045,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00011A1D,0x1B6B0957,0x1A1D1B6B,0x1B6B1B6B,0x1B6B1B6B,0x9DB59DB5,0xFFFF9DB5,0x1A1D1B6B,0x2CF90957,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00451B6B,0x1B6B2CF9,0x2CF91B6B,0x1B6B9DB5,0x9DB51B6B,0xFFFFFFFF,0x9DB59DB5,0x1B6B1B6B,0x2CF91A1D,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00451B6B,0x1B6B2CF9,0x2CF92CF9,0x2CF99DB5,0x9DB5739B,0x739B9DB5,0x9DB52CF9,0x1B6B1B6B,0x2CF91B6B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00452CF9,0x1B6B1B6B,0x1B6B2CF9,0x9DB59DB5,0x9DB5739B,0x1A1D1A1D,0x9DB52CF9,0x1B6B2CF9,0x2CF91B6B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00012CF9,0x1B6B1B6B,0x1B6B1B6B,0x9DB59DB5,0x739B1A1D,0x739B1B6B,0x9DB52CF9,0x1B6B1B6B,0x2CF92CF9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00012CF9,0x2CF91B6B,0x09570957,0x9DB5FFFF,0x29491A1D,0x1A1D1B6B,0x1A1D9DB5,0x1B6B1B6B,0x2CF92CF9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00452CF9,0x09570957,0x09571A1D,0x9DB5739B,0x1A1D2949,0x1A1D1A1D,0x1B6B1B6B,0x1B6B1B6B,0x2CF92CF9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00012CF9,0x1A1D0957,0x09571A1D,0x739B1A1D,0x29490957,0x1A1D1B6B,0x1B6B1B6B,0x1B6B1B6B,0x2CF92CF9,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00011B6B,0x1A1D0957,0x08CF1A1D,0x739B08CF,0x09570957,0x09571A1D,0x2CF91B6B,0x1B6B1B6B,0x2CF92CF9,0x00450001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00011B6B,0x1A1D0957,0x095708CF,0x08CF08CF,0x08CF08CF,0x08CF08CF,0x09571B6B,0x1B6B0957,0x09571B6B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010045,0x095708CF,0x08CF08CF,0x08CF08CF,0x08CF08CF,0x08CF08CF,0x08CF0957,0x1A1D0957,0x08CF0045,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000108CF,0x08CF08CF,0x08CF08CF,0x08CF08CF,0x08CF08CF,0x09571A1D,0x095708CF,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x004508CF,0x09570957,0x09570957,0x09570957,0x1A1D1A1D,0x00450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x004508CF,0x00450045,0x00450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dFarore {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000110C7,0x10C731D1,0x214D0001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x214D31D1,0x214D214D,0x214D214D,0x31D10041,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001214D,0x214D42E5,0x3A5931D1,0x31D13A59,0x31D131D1,0x31D10041,0x00410001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010041,0x31D13A59,0x42E542E5,0x42E53A59,0x31D13A59,0x3A5931D1,0x31D131D1,0x31D10041,0x00410041,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x0001214D,0x3A5942E5,0x42E542E5,0x42E542E5,0x42E53A59,0x3A593A59,0x3A593A59,0x31D131D1,0x31D10081,0x00410041,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010041,0x10C742E5,0x42E542E5,0x42E542E5,0x42E55BE5,0x42E57CE9,0x42E53A59,0x3A5942E5,0x4B5531D1,0x31D131D1,0x31D10081,0x00410041,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x214D214D,0x42E542E5,0x42E542E5,0x42E57CE9,0x5BE57CE9,0x7CE95BE5,0x3A5942E5,0x42E55BE5,0x31D14B55,0x31D131D1,0x4B550081,0x00410041,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x7CE93A59,0x42E542E5,0x42E542E5,0x5BE57CE9,0x7CE97CE9,0x42E57CE9,0x42E55BE5,0x5BE54B55,0x4B5531D1,0x31D14B55,0x31D10041,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x9E6B7CE9,0x42E542E5,0x42E57CE9,0x7CE97CE9,0x7CE97CE9,0x7CE95BE5,0x5BE57CE9,0x4B554B55,0x31D14B55,0x31D14B55,0x3A590041,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0xFFFFFFFF,0x7CE942E5,0x7CE97CE9,0x7CE97CE9,0x7CE97CE9,0x7CE94D57,0x4D574B55,0x4B554B55,0x4B554B55,0x4B557CE9,0x3A590081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x004110C7,0xFFFFFFFF,0x9E6B5BE5,0x7CE97CE9,0x7CE97CE9,0x7CE97FD9,0x7FD97FD9,0x4D574D57,0x4B554B55,0x4B554B55,0x5BE57CE9,0x31D10081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x000110C7,0xFFFFFFFF,0xFFFF9E6B,0x7CE97CE9,0x7CE97CE9,0x7CE97FD9,0x7FD97FD9,0x7FD94D57,0x4D574D57,0x5BE57CE9,0x5BE57CE9,0x31D10081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x0001214D,0xFFFFFFFF,0xFFFFFFFF,0x9E6B7CE9,0x7CE97FD9,0x4D577FD9,0x7FD97FD9,0x7FD97FD9,0x9E6B9E6B,0x4D575BE5,0x7CE99E6B,0x31D10081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x0041214D,0xFFFFFFFF,0xFFFFFFFF,0x9E6B7CE9,0x7FD94D57,0x7FD97FD9,0x7FD97FD9,0x7FD97FD9,0x7FD99E6B,0x9E6B7CE9,0x5BE59E6B,0x31D10081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00414B55,0xFFFFFFFF,0xFFFFFFFF,0xFFFF9E6B,0x4D577FD9,0x7FD97FD9,0x7FD97FD9,0x7FD97FD9,0x9E6B9E6B,0x9E6B9E6B,0x9E6B9E6B,0x10C70081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00014B55,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0x4D577FD9,0x7FD97FD9,0x7FD97FD9,0x7FD99E6B,0x7FD99E6B,0x9E6B9E6B,0x7CE99E6B,0x00410081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00017CE9,0xFFFFFFFF,0xFFFFFFFF,0xFFFF9E6B,0x4D577FD9,0x7FD97FD9,0x7FD97FD9,0x7FD99E6B,0x9E6B9E6B,0x9E6B7CE9,0x7CE99E6B,0x00410081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00415BE5,0xFFFFFFFF,0xFFFFFFFF,0xFFFF4D57,0x4D574D57,0x7FD97FD9,0x7FD97FD9,0x7FD97FD9,0x9E6B9E6B,0x9E6B7CE9,0x7CE97CE9,0x00810081,0x00810041,0x00010001,0x0001FFFE,0xFFFE0001,0x00019E6B,0xFFFFFFFF,0xFFFFFFFF,0x7CE94D57,0x4D574D57,0x4D574D57,0x4D577FD9,0x9E6B9E6B,0x9E6B7CE9,0x7CE97CE9,0x7CE97CE9,0x00810081,0x00810001,0x00010001,0x0001FFFE,0xFFFE0001,0x00019E6B,0xFFFFFFFF,0xFFFF9E6B,0x5BE54B55,0x4B554D57,0x4D574D57,0x4B5531D1,0x4B554D57,0x9E6B7CE9,0x7CE97CE9,0x7CE97CE9,0x00010081,0x00810001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFFFFFF,0xFFFF5BE5,0x4B553A59,0x4D574D57,0x4B554D57,0x4B554B55,0x4B5531D1,0x3A595BE5,0x5BE57CE9,0x7CE95BE5,0x00410081,0x00810001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFFFFFF,0x7CE95BE5,0x31D13A59,0x42E55BE5,0x5BE542E5,0x5BE55BE5,0x3A593A59,0x4B553A59,0x3A5942E5,0x7CE95BE5,0x00810081,0x00410001,0x00010001,0x0001FFFE,0xFFFE0001,0x0041FFFF,0xFFFF9E6B,0x5BE531D1,0x31D14B55,0x5BE55BE5,0x4B555BE5,0x4B5542E5,0x3A593A59,0x3A5942E5,0x3A5942E5,0x31D110C7,0x00810081,0x00410001,0x00010001,0x0001FFFE,0xFFFE0001,0x10C7FFFF,0xFFFF7CE9,0x42E531D1,0x31D142E5,0x5BE542E5,0x5BE542E5,0x3A593A59,0x3A5942E5,0x42E5214D,0x214D0041,0x00010041,0x00410081,0x00410001,0x00010001,0x0001FFFE,0xFFFE0001,0x10C7FFFF,0x9E6B42E5,0x31D131D1,0x31D15BE5,0x5BE54B55,0x3A593A59,0x42E53A59,0x214D0081,0x00810081,0x00810081,0x00810081,0x00810041,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x214D9E6B,0x5BE53A59,0x31D131D1,0x31D142E5,0x3A593A59,0x42E5214D,0x214D0081,0x00810081,0x00810081,0x00810081,0x00810041,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x31D17CE9,0x31D1214D,0x31D1214D,0x3A593A59,0x214D10C7,0x00810081,0x00810081,0x00810081,0x00810081,0x00410041,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x004131D1,0x214D214D,0x214D214D,0x10C70081,0x00810081,0x00810081,0x00810081,0x00810081,0x00410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010041,0x10C710C7,0x00410081,0x00810041,0x00810081,0x00810081,0x00810041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010041,0x00410041,0x00410081,0x00810041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00410041,0x00010041,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dBoomerang {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x10411041,0x41052083,0x71C771C7,0x71C771C7,0x1B031B03,0x9A899A89,0x1B031B03,0x9A899A89,0x9A899A89,0x9A899A89,0x71C79A89,0x71C74105,0x00010001,0x00010001,0x0001FFFE,0xFFFE71C7,0xE59DE59D,0xE59DE59D,0xE59DE59D,0xE59D3D8B,0x3D8BD38F,0xD38F3D8B,0x3D8BD38F,0xD38FD38F,0xD38FD38F,0xD38FE59D,0xE59D9A89,0x9A899A89,0x9A891041,0x00010001,0x0001FFFE,0xFFFE4105,0x9A899A89,0x9A89D38F,0xD38FD38F,0x3D8B3D8B,0xD38FD38F,0x3D8B3D8B,0xE59DE59D,0xE59DE59D,0xE59DE59D,0xE59DE59D,0x9A89F083,0xF0839A89,0xE59D08C1,0x00010001,0x0001FFFE,0xFFFE0001,0x00012083,0x20834105,0x410571C7,0x09C11B03,0x9A899A89,0x3D8B71C7,0xD38FD38F,0xD38FD38F,0xE59DE59D,0xE59D9A89,0xF083F083,0xF083F083,0xE59D4105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x10412083,0x20832083,0x09C109C1,0x410571C7,0x09C11B03,0x71C79A89,0x9A899A89,0x9A89D38F,0xE59DF083,0xF083F083,0xF083D38F,0xE59D71C7,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010081,0x20832083,0x09C12083,0x41054105,0x410571C7,0x71C7D38F,0xE59DF083,0xF083F083,0xF083E59D,0xD38F4105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x008108C1,0x41054105,0x41054105,0x4105E59D,0xD38FF083,0xF083D38F,0xE59D9A89,0x41054105,0x00810001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20831041,0x20839A89,0x9A89D38F,0xE59D9A89,0x71C771C7,0x71C74105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x008108C1,0x9A8971C7,0x71C79A89,0x9A89D38F,0x71C74105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x71C79A89,0x9A899A89,0x9A89D38F,0x71C771C7,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41059A89,0x9A899A89,0x9A89D38F,0x71C771C7,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00019A89,0x71C79A89,0x9A89D38F,0x71C771C7,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000171C7,0x9A899A89,0x9A89D38F,0x71C709C1,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00014105,0x9A899A89,0x9A899A89,0x1B0309C1,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000108C1,0x1B031B03,0x1B033D8B,0x1B0371C7,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x1B031B03,0x1B031B03,0x9A894105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x71C79A89,0x9A89D38F,0x71C709C1,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x41059A89,0x9A899A89,0x1B0309C1,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00811B03,0x1B031B03,0x1B034105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011B03,0x1B0371C7,0x9A894105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000171C7,0x9A899A89,0x9A894105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x9A899A89,0x9A894105,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x9A899A89,0x9A892083,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x71C79A89,0x9A892083,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20839A89,0x9A892083,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x208371C7,0x71C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012083,0x20830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011041,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dHammer {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x08430001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210B39CF,0x6B5F210B,0x00010001,0x000184A9,0x84A984A9,0x6B5F0843,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x39CF5255,0x6B5F6B5F,0x6B5F6B5F,0xA5B11885,0x00010001,0x210BA5B1,0xA5B184A9,0xA5B11885,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x210B6B5F,0x84A96B5F,0x6B5F6B5F,0x6B5F6B5F,0x525584A9,0xA5B1210B,0x00010843,0x84A9A5B1,0x6B5F6B5F,0x84A939CF,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x210BA5B1,0x84A984A9,0x84A984A9,0x84A984A9,0x84A96B5F,0xA5B1210B,0x000184A9,0xA5B1A5B1,0x525539CF,0x525539CF,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x39CFA5B1,0xA5B1A5B1,0xA5B1A5B1,0xA5B1A5B1,0x52555255,0x84A9A5B1,0x84A984A9,0xA5B15255,0x39CF39CF,0x39CF0001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x000184A9,0x84A9A5B1,0xA5B1A5B1,0x6B5F5255,0x52556B5F,0xA5B184A9,0xA5B1A5B1,0x52555255,0x52551885,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00016B5F,0x6B5F6B5F,0x6B5F5255,0x39CF5255,0x5255A5B1,0xA5B184A9,0x84A96B5F,0x5255210B,0x210B6B5F,0x52556B5F,0x210B0001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00016B5F,0x6B5F5255,0x525539CF,0x39CF5255,0x84A9A5B1,0xA5B184A9,0x84A96B5F,0x84A984A9,0x84A96B5F,0x6B5F84A9,0x84A939CF,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00015255,0x6B5F5255,0x210B39CF,0x39CF5255,0x525584A9,0xA5B1A5B1,0x84A96B5F,0x84A96B5F,0x6B5F6B5F,0x6B5F6B5F,0x84A9A5B1,0x210BFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x0001210B,0x6B5F5255,0x210B210B,0x39CF5255,0x6B5F6B5F,0x6B5F84A9,0x84A984A9,0x6B5F6B5F,0x6B5F6B5F,0x84A984A9,0x84A984A9,0xA5B1210B,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x6B5F210B,0x39CF1885,0x6B5FA5B1,0xA5B16B5F,0x52556B5F,0x84A984A9,0x84A984A9,0x84A984A9,0x84A984A9,0x84A984A9,0x84A95255,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x39CF39CF,0x000184A9,0xA5B1A5B1,0x6B5F5255,0x525584A9,0xA5B184A9,0x84A9A5B1,0xA5B1A5B1,0xA5B184A9,0x84A984A9,0x84A9FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x5255A5B1,0xA5B16B5F,0x52551885,0x84A9A5B1,0x84A9A5B1,0xA5B1A5B1,0xA5B1A5B1,0xA5B1A5B1,0xA5B16B5F,0x1885FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00016B5F,0xA5B1A5B1,0x6B5F5255,0x210B1885,0xA5B1A5B1,0xA5B1A5B1,0x6B5F84A9,0xA5B1A5B1,0xA5B1A5B1,0x6B5F1885,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x6189C45B,0xA5B16B5F,0x52550843,0x000139CF,0xA5B1A5B1,0x6B5F5255,0x6B5F6B5F,0x6B5FA5B1,0xA5B15255,0x18850001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x0001720B,0xC45B8A8D,0x61895255,0x08430001,0x00015255,0xA5B16B5F,0x52555255,0x52555255,0x6B5F6B5F,0x52550001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x6189C45B,0x720B6189,0x49470843,0x00010001,0x000139CF,0x6B5F5255,0x52555255,0x52555255,0x52555255,0x18850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00014947,0xC45B8A8D,0x61894947,0x08430001,0x00010001,0x00010001,0x39CF5255,0x39CF5255,0x39CF5255,0x52551885,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x6189C45B,0x8A8D6189,0x49471885,0x00010001,0x00010001,0x00010001,0x18855255,0x525539CF,0x525539CF,0x08430001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00016189,0xC45B8A8D,0x49474947,0x00010001,0x00010001,0x00010001,0x00010001,0x00011885,0x52555255,0x52551885,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x4947C45B,0x720B6189,0x61891885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x188539CF,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00014947,0xC45B720B,0x61894947,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x4947C45B,0x8A8D6189,0x49470843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE720B,0xC45B8A8D,0x61894947,0x18850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x4947C45B,0x720B6189,0x49470843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0x08434947,0x49474947,0x18850001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE1885,0x18851885,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dLightArrows {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18410001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010841,0x79450001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139C3,0x79451841,0x000118C1,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x29437307,0x730739C3,0x8BCD8BCD,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x73077307,0x7307B50B,0xD6235285,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x000139C3,0x8BCD7307,0x8BCDD623,0x8BCD7945,0x79457945,0x18410001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00018BCD,0x8BCDB50B,0xB50BD623,0x73077307,0x73077945,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C1D623,0x8BCDB50B,0xD6237307,0x73077307,0x29430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39C3D623,0x8BCDD623,0x8BCD8BCD,0x8BCD1841,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001D623,0x8BCDD623,0x8BCD8BCD,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00015285,0x29432943,0x18C10001,0x08410001,0x00010001,0x00010841,0xB50BB50B,0x8BCD8BCD,0x52850001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x52857307,0x528539C3,0x294339C3,0x39C32943,0x294318C1,0x0001B50B,0xD6237945,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x73075285,0x52857307,0x39C339C3,0x294339C3,0x39C339C3,0xB50BB50B,0x79450001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00017307,0x73075285,0x52855285,0x39C35285,0x39C339C3,0x39C37307,0xB50BB50B,0x18C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x18C17307,0x52855285,0x39C339C3,0x52855285,0x39C339C3,0x5285B50B,0x8BCD8BCD,0x8BCD0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010841,0xB50B5285,0x528539C3,0x52857307,0x73075285,0x39C3D623,0xD623B50B,0x73078BCD,0xB50B0841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00017307,0x73075285,0x52858BCD,0xB50B8BCD,0xB50B8BCD,0xD623D623,0xFFFFD623,0x5285B50B,0xEF075285,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001B50B,0xB50BB50B,0xEF07EF07,0xB50BD623,0xD623D623,0xD623FFFF,0xD623D623,0xB50BB50B,0xEF077307,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0841B50B,0xEF07EF07,0xEF07EF07,0xB50BD623,0xD6238BCD,0xB50BEF07,0xD623EF07,0xB50BB50B,0xEF078BCD,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0841EF07,0xB50BB50B,0xB50BEF07,0xD623D623,0xD6238BCD,0x8BCD8BCD,0xD623EF07,0xB50BB50B,0xEF07B50B,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0841EF07,0xB50BB50B,0xB50B7307,0xD623D623,0xB50B7307,0x8BCDB50B,0xD623EF07,0x8BCDB50B,0xEF07EF07,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001EF07,0xEF077307,0x52857307,0xD623D623,0x52855285,0x8BCDB50B,0x7307D623,0xB50BB50B,0xEF07EF07,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0841EF07,0x528539C3,0x39C38BCD,0xD6238BCD,0x52855285,0x52858BCD,0xB50B7307,0xB50BB50B,0xEF07EF07,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001EF07,0x730739C3,0x39C38BCD,0x8BCD5285,0x39C339C3,0x52858BCD,0xB50BB50B,0xB50BB50B,0xEF07EF07,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001B50B,0x730739C3,0x39C339C3,0x528539C3,0x528539C3,0x39C35285,0xEF07B50B,0xB50BB50B,0xB50BEF07,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001B50B,0x730739C3,0x39C339C3,0x29432943,0x29432943,0x29432943,0x5285B50B,0x73075285,0x39C37307,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010841,0x52852943,0x29432943,0x29432943,0x29432943,0x29432943,0x29435285,0x730739C3,0x29430841,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x084118C1,0x39C32943,0x29432943,0x18C12943,0x29432943,0x39C37307,0x39C32943,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C118C1,0x294339C3,0x39C35285,0x528539C3,0x73077307,0x08410001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010841,0x18C12943,0x18C118C1,0x18C10001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dNayru {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00030003,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00030003,0x00030001,0x00010001,0x00010001,0x00010003,0x18CB39E1,0x18CB0001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00030003,0x00030001,0x00010001,0x18CB0097,0x29572957,0x29572957,0x29570001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010003,0x00030003,0x00030049,0x39E13A7B,0x3A7B39E1,0x295739E1,0x29572957,0x29570001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010049,0x39E13A7B,0x3A7B3A7B,0x3A7B39E1,0x39E12957,0x39E139E1,0x39E12957,0x29570001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00030097,0x52AB3A7B,0x3A7B3A7B,0x3A7B3A7B,0x3A7B39E1,0x39E152AB,0x52AB39E1,0x29572957,0x39E10001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010003,0x009739E1,0x3A7B3A7B,0x3A7B3A7B,0x3A7B63FF,0x63FF63FF,0x52AB39E1,0x39E13A7B,0x39E139E1,0x39E139E1,0x29570001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00492957,0x3A7B3A7B,0x3A7B3A7B,0x3A7B63FF,0x63FF63FF,0x63FF3A7B,0x39E152AB,0x3A7B52AB,0x39E139E1,0x39E139E1,0x39E10003,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x52AB39E1,0x3A7B3A7B,0x3A7B3A7B,0x3A7B63FF,0x63FF63FF,0x63FF3A7B,0x52AB3A7B,0x52AB52AB,0x39E139E1,0x39E139E1,0x29570003,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x957D63FF,0x3A7B3A7B,0x3A7B63FF,0x63FF63FF,0x63FF577F,0x63FF63FF,0x63FF63FF,0x52AB52AB,0x39E152AB,0x39E139E1,0x29570003,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0xFFFFFFFF,0x3A7B3A7B,0x63FF3A7B,0x63FF63FF,0x577F63FF,0x63FF63FF,0x63FF52AB,0x52AB52AB,0x52AB39E1,0x39E1957D,0x39E10001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000118CB,0xFFFFFFFF,0x957D63FF,0x3A7B63FF,0x63FF63FF,0x957D577F,0x63FF63FF,0x63FF52AB,0x52AB52AB,0x52AB52AB,0x63FF63FF,0x29570001,0x00030001,0x00010001,0x0001FFFE,0xFFFE0001,0x000118CB,0xFFFFFFFF,0xFFFF957D,0x63FF63FF,0x63FF577F,0x577F577F,0x577F9FBF,0x957D957D,0x63FF63FF,0x63FF63FF,0x63FF957D,0x29570001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x000118CB,0xFFFFFFFF,0xFFFFFFFF,0x63FF957D,0x577F577F,0x577F9FBF,0x9FBF9FBF,0x9FBF957D,0x957D63FF,0x63FF63FF,0x63FF957D,0x29570003,0x00030003,0x00010001,0x0001FFFE,0x00030003,0x000339E1,0xFFFFFFFF,0xFFFFFFFF,0x9FBF577F,0x577F577F,0x577F9FBF,0x9FBF9FBF,0x9FBF957D,0x957D957D,0x957D63FF,0x63FF957D,0x29570049,0x00490003,0x00010001,0x0001FFFE,0x00490049,0x0049957D,0xFFFFFFFF,0xFFFFFFFF,0xFFFF9FBF,0x577F577F,0x9FBF9FBF,0x9FBF9FBF,0x9FBF9FBF,0x9FBF957D,0x957D957D,0x957D957D,0x29570097,0x00970049,0x00030001,0x0001FFFE,0x00490049,0x0097957D,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0x577F9FBF,0x9FBF9FBF,0x9FBF9FBF,0x9FBF9FBF,0x9FBF9FBF,0x957D957D,0x957D957D,0x00970097,0x00970049,0x00030003,0x0003FFFE,0x00490003,0x0001957D,0xFFFFFFFF,0xFFFFFFFF,0xFFFF9FBF,0x577F577F,0x9FBF9FBF,0x9FBF9FBF,0x9FBF957D,0x957D957D,0x957D957D,0x957D957D,0x00970097,0x00490049,0x00010001,0x0001FFFE,0xFFFE0001,0x000152AB,0xFFFFFFFF,0xFFFFFFFF,0x9FBF3A7B,0x63FF577F,0x577F577F,0x9FBF9FBF,0x9FBF957D,0x957D957D,0x957D63FF,0x63FF957D,0x00490049,0x00490003,0x00010001,0x0001FFFE,0xFFFE0001,0x0001957D,0xFFFFFFFF,0xFFFFFFFF,0x63FF63FF,0x63FF3A7B,0x577F577F,0x63FF63FF,0x957D957D,0x957D957D,0x63FF63FF,0x957D63FF,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001957D,0xFFFFFFFF,0xFFFF957D,0x63FF3A7B,0x3A7B63FF,0x577F577F,0x3A7B3A7B,0x3A7B63FF,0x957D63FF,0x63FF957D,0x63FF52AB,0x00010003,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFFFFFF,0xFFFF63FF,0x3A7B52AB,0x3A7B63FF,0x577F577F,0x3A7B3A7B,0x3A7B3A7B,0x3A7B63FF,0x63FF63FF,0x957D52AB,0x00010003,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFFFFFF,0x63FF3A7B,0x39E10129,0x63FF3A7B,0x63FF577F,0x63FF3A7B,0x3A7B39E1,0x3A7B3A7B,0x3A7B3A7B,0x63FF52AB,0x00030001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0001FFFF,0xFFFF957D,0x63FF39E1,0x39E152AB,0x63FF3A7B,0x577F63FF,0x3A7B3A7B,0x3A7B0129,0x3A7B0129,0x3A7B3A7B,0x39E118CB,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0003FFFF,0xFFFF957D,0x52AB2957,0x29573A7B,0x3A7B63FF,0x63FF63FF,0x3A7B3A7B,0x01293A7B,0x3A7B39E1,0x18CB0001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x0003FFFF,0x957D52AB,0x29572957,0x295763FF,0x3A7B63FF,0x3A7B3A7B,0x3A7B0129,0x39E118CB,0x00490003,0x00030003,0x00030001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x18CB957D,0x52AB39E1,0x29572957,0x39E152AB,0x3A7B3A7B,0x3A7B3A7B,0x01290049,0x00030003,0x00010003,0x00010003,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x2957957D,0x29572957,0x29572957,0x012952AB,0x00970129,0x01290129,0x00970049,0x00030001,0x00030003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00012957,0x295718CB,0x29572957,0x18CB0003,0x00490097,0x01290129,0x01290049,0x00030001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00030003,0x00010001,0x00010003,0x00490097,0x01290129,0x00970003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00490097,0x00030049,0x00030003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00490049,0x00030003,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dEmptyBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x31033943,0x41876207,0x51C54185,0x39451883,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x9B47B40F,0xB4539BCD,0x83097AC9,0x5A057AC7,0x29030001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011883,0x938DA413,0x938F9B8F,0x7ACB8B4D,0x83097B0B,0x29030001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x6A8B9C15,0xA459AC9B,0x83518B93,0x830F7289,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C72109,0x21094211,0x5AD7941B,0x7B53834F,0x7B0F6AD1,0x628D420F,0x39CF318D,0x210918C7,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x294B318D,0x42117BDF,0x8C63A4E3,0x83D76ACF,0x628F7311,0x5A4B318D,0x294B294B,0x21092109,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C72109,0x294B318D,0x318D39CD,0x41CB524D,0x520D524F,0x63198421,0x84216319,0x318D2109,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010843,0x1085294B,0x2109398B,0x318B398B,0x318B398B,0x41CD294B,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x2109294B,0x21092109,0x21092109,0x21092109,0x18C71085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C7,0x2109294B,0x21092109,0x21092109,0x210918C7,0x18C71085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109318D,0x318D39CF,0x4A53318D,0x21092109,0x21092109,0x18C71085,0x08430001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x10855295,0x52955295,0x421139CF,0x421139CF,0x318D294B,0x318D318D,0x294B2109,0x18C70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x42115295,0x4A535AD7,0x63196B5B,0x5AD739CF,0x294B294B,0x294B294B,0x294B294B,0x210918C7,0x10850001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x084339CF,0x4A535295,0x8421BDEF,0xC631BDEF,0x94A54A53,0x294B2109,0x21092109,0x21092109,0x21092109,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x210939CF,0x42116319,0xB5ADC631,0xC631C631,0xAD6B4211,0x294B2109,0x21092109,0x21092109,0x21092109,0x18C718C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x294B39CF,0x42115295,0xB5ADC631,0xC631BDEF,0x6B5B318D,0x21092109,0x21092109,0x21092109,0x21092109,0x210918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x318D318D,0x39CF4211,0x6B5B94A5,0x8C635AD7,0x318D294B,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x318D318D,0x318D318D,0x39CF4211,0x4211318D,0x294B2109,0x21092109,0x21092109,0x21092109,0x2109294B,0x21092109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x294B318D,0x318D294B,0x294B318D,0x318D294B,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x294B318D,0x318D294B,0x294B294B,0x294B2109,0x21092109,0x21092109,0x21092109,0x21092109,0x2109294B,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x294B318D,0x294B294B,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x2109294B,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B318D,0x294B294B,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x2109294B,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B318D,0x294B2109,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x21092109,0x2109294B,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x294B294B,0x294B2109,0x21092109,0x21092109,0x21092109,0x21092109,0x2109294B,0x294B2109,0x2109294B,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x2109294B,0x294B2109,0x21092109,0x21092109,0x21092109,0x21092109,0x294B318D,0x318D294B,0x294B294B,0x294B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x2109294B,0x294B2109,0x21092109,0x21092109,0x21092109,0x294B4211,0x63197BDF,0x529539CF,0x294B294B,0x294B2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294B,0x294B294B,0x294B294B,0x294B294B,0x294B294B,0x294B318D,0x42116319,0x5AD74211,0x421139CF,0x294B2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294B,0x294B294B,0x294B318D,0x318D318D,0x318D318D,0x318D318D,0x39CF4211,0x52955295,0x4A53318D,0x294B2109,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x10852109,0x21092109,0x294B294B,0x294B294B,0x318D294B,0x294B318D,0x42118421,0xAD6BB5AD,0x7BDF39CF,0x294B2109,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C718C7,0x21092109,0x21092109,0x294B294B,0x294B318D,0x52957BDF,0x8421739D,0x4A53294B,0x21090843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010843,0x00010843,0x00010001,0x08430001,0x00010001,0x00010001,0x00010843,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dFairyBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x210949C5,0x49C549C5,0x49C549C5,0x49C51083,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x834D834D,0x8BDF834D,0x834D834D,0x49C5834D,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x834D834D,0x834D834D,0x834D834D,0x834D834D,0x21090001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x834D8BDF,0x8BDF8BDF,0x834D834D,0x834D49C5,0x10830001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x21092109,0x21095213,0x52138BDF,0x834D834D,0x834D834D,0x52135213,0x398F398F,0x21092109,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011083,0x294B398F,0x52138BDF,0x8BDF8BDF,0x8BDF834D,0x5213834D,0x49C5398F,0x294B294B,0x21092109,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x21092109,0x294B398F,0x398F5213,0x49C55213,0x49C55213,0x6A1B8BDF,0x8BDF6A1B,0x294B294B,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00011083,0x1083294B,0x294B49C5,0x294B49C5,0x398F49C5,0x398F294B,0x21092109,0x21091083,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x2109294B,0x21092109,0x21092109,0x21092109,0x21091083,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x2109294B,0x2109294B,0x21092109,0x21092109,0x21091083,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x294B398F,0x294B398F,0x5213294B,0x294B294B,0x21092109,0x21091083,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x10835213,0x52135213,0x5213398F,0x5213398F,0x398F294B,0x398F398F,0x294B294B,0x21091083,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011083,0x52135213,0x52136A1B,0x8BDF8BDF,0x6A1B5213,0x398F398F,0x398F398F,0x294B294B,0x21092109,0x10830001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x0001398F,0x52135213,0x8BDFE5AF,0xE5AFE5AF,0x8BDF6A1B,0x52135213,0x398F398F,0x294B294B,0x294B2109,0x21091083,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109398F,0x52136A1B,0xE5AFE5AF,0xE5AFFFFF,0xE5AFA2A5,0x6A1B6A1B,0x6A1B5213,0x398F294B,0x294B294B,0x21092109,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x294B398F,0x52135213,0xE5AFE5AF,0xFFFFE5AF,0xD36FA2A5,0xA2A5A2A5,0xA2A56A1B,0x6A1B398F,0x398F294B,0x21092109,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011083,0x294B398F,0x398F5213,0x8BDFE5AF,0xD36FD36F,0xD36FD36F,0xD36FD36F,0xD36FA2A5,0x6A1B6A1B,0x398F398F,0x294B2109,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011083,0x398F398F,0x398F5213,0x6A1BA2A5,0xD36FD36F,0xE5AFE5AF,0xE5AFE5AF,0xE5AFD36F,0xA2A56A1B,0x5213398F,0x294B294B,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294B398F,0x398F398F,0x6A1BA2A5,0xD36FE5AF,0xE5AFFFE1,0xFFE1FFE1,0xE5AFD36F,0xD36FA2A5,0x6A1B398F,0x398F2109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294B398F,0x398F5213,0x6A1BA2A5,0xD36FE5AF,0xFFE1FFE1,0xFFE1FFE1,0xFFE1E5AF,0xD36FA2A5,0x6A1B398F,0x398F294B,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294B398F,0x398F5213,0x6A1BA2A5,0xD36FE5AF,0xFFE1FFE1,0xFFE1FFE1,0xFFE1E5AF,0xD36FA2A5,0x6A1B5213,0x398F294B,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011083,0x294B398F,0x398F398F,0x6A1BA2A5,0xD36FE5AF,0xFFE1FFE1,0xFFE1FFE1,0xFFE1E5AF,0xD36FA2A5,0x6A1B398F,0x398F294B,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011083,0x294B398F,0x398F398F,0x6A1BA2A5,0xD36FE5AF,0xE5AFFFE1,0xFFE1FFE1,0xE5AFE5AF,0xD36FA2A5,0x6A1B398F,0x398F294B,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294B294B,0x398F398F,0x52136A1B,0xA2A5D36F,0xE5AFE5AF,0xE5AFE5AF,0xE5AFD36F,0xA2A56A1B,0x5213398F,0x398F2109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011083,0x2109294B,0x398F294B,0x398F6A1B,0x6A1BA2A5,0xD36FD36F,0xD36FD36F,0xD36FD36F,0xA2A56A1B,0x398F398F,0x294B294B,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x294B294B,0x294B294B,0x398F398F,0x6A1B6A1B,0xA2A5A2A5,0xA2A5D36F,0xD36FD36F,0x6A1B6A1B,0x398F398F,0x294B2109,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294B,0x294B294B,0x398F398F,0x52135213,0x6A1B6A1B,0x6A1B6A1B,0x6A1B8BDF,0x8BDF5213,0x5213398F,0x294B294B,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294B,0x294B294B,0x294B398F,0x398F5213,0x52135213,0x52135213,0x6A1B5213,0x6A1B6A1B,0x5213398F,0x294B2109,0x10830001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x10832109,0x2109294B,0x294B294B,0x398F398F,0x398F398F,0x398F5213,0x52138BDF,0xE5AFE5AF,0x8BDF398F,0x294B2109,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011083,0x21092109,0x21092109,0x2109294B,0x294B294B,0x398F398F,0x52138BDF,0x8BDF6A1B,0x5213294B,0x21091083,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011083,0x00010001,0x10830001,0x00010001,0x00010001,0x10831083,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dRedBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C34149,0x8311614B,0x41494149,0x28C328C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x83118311,0x83118311,0x83118311,0x614B5A4F,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x83118311,0x9C1F8311,0x83118311,0x83118311,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x83118311,0x83118311,0x83118311,0x83118311,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x2109294B,0x294B398D,0x5A4F8311,0x83118311,0x83118311,0x5A4F398D,0x398D294B,0x21091085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011085,0x294B294B,0x5A4F9C1F,0x9C1F9C1F,0x9C1F5A4F,0x5A4F8311,0x5A4F398D,0x294B294B,0x294B2109,0x10850001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x21092109,0x294B294B,0x398D294B,0x398D5A4F,0x5A4F5A4F,0x83119C1F,0x9C1F5A4F,0x294B294B,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010843,0x1085294B,0x294B398D,0x398D294B,0x294B398D,0x398D294B,0x294B2109,0x10851085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08432109,0x2109294B,0x21092109,0x21092109,0x21092109,0x21091085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08432109,0x2109294B,0x21092109,0x21092109,0x21092109,0x10851085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109398D,0x398D398D,0x294B294B,0x294B2109,0x21092109,0x21091085,0x08430001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x0843294B,0x5A4F5A4F,0x614B5A4F,0x5A4F398D,0x398D4149,0x4149614B,0x4149294B,0x10851085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x398D398D,0x5A4F8311,0x83118311,0x5A4F398D,0x41494149,0x41494149,0x614B614B,0x294B2109,0x08430001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x0001294B,0x398D5A4F,0x9C1FC5AD,0xC5ADC5AD,0x9C1F5A4F,0x294B2109,0x294B2109,0x294B294B,0x41492109,0x21090843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109398D,0x614B9C1F,0xC5ADC5AD,0xC5ADC5AD,0xC5AD398D,0x294B294B,0x21092109,0x21092109,0x41494149,0x21091085,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x294B398D,0x614B5A4F,0xC5ADC5AD,0xFFFFC5AD,0x8311398D,0x4149294B,0x41494149,0x41494149,0x4149614B,0x21092109,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x294B398D,0x5A4FA109,0x9C1FC5AD,0xC5AD9C1F,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0x614B614B,0x28C32109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B398D,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109614B,0x41492109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294B614B,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109614B,0xA109614B,0x614B2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B614B,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109614B,0x614B2109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B614B,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0x614B614B,0x614B2109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B614B,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA1094149,0x614B2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B614B,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109614B,0x614B2109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x294B4149,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109614B,0x614B2109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x294B4149,0x614BA109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0x614B614B,0x41492109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x2109294B,0x614B614B,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109A109,0xA109614B,0x41492109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294B,0x41494149,0x614B614B,0x614B614B,0x614B614B,0x614B614B,0xA1099C1F,0x9C1F5A4F,0x614B614B,0x294B2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294B,0x294B294B,0x294B294B,0x41494149,0x41494149,0x41494149,0x398D4149,0x5A4F5A4F,0x5A4F294B,0x294B2109,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x10852109,0x2109294B,0x294B294B,0x294B294B,0x294B294B,0x398D398D,0x5A4F9C1F,0xC5ADC5AD,0x8311398D,0x21092109,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x10852109,0x2109294B,0x294B294B,0x4149294B,0x294B398D,0x5A4F9C1F,0x9C1F5A4F,0x398D294B,0x21090843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08430001,0x00010001,0x00010843,0x00010843,0x08430001,0x08431085,0x08430001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dGreenBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x28C3318B,0x834D528F,0x318B28C3,0x28C328C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x834D834D,0x834D834D,0x834D834D,0x528F528F,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000128C3,0x834D834D,0x8C5F834D,0x834D834D,0x834D834D,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x834D834D,0x8C5F834D,0x834D834D,0x834D834D,0x28C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C7318B,0x2149318B,0x528F6B99,0x834D834D,0x528F834D,0x528F528F,0x318B318B,0x18C70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x000118C7,0x2149318B,0x528F8C5F,0x8C5F8C5F,0x6B99834D,0x528F834D,0x528F318B,0x318B2149,0x21492149,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C72149,0x2149318B,0x318B318B,0x318B528F,0x528F528F,0x6B998C5F,0x8C5F528F,0x318B2149,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010843,0x08432149,0x2149318B,0x318B318B,0x318B318B,0x318B318B,0x214918C7,0x18C70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x21492149,0x18C718C7,0x18C718C7,0x214918C7,0x18C70843,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x18C72149,0x21492149,0x214918C7,0x214918C7,0x18C70843,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C7318B,0x318B318B,0x21492149,0x214918C7,0x214918C7,0x18C718C7,0x08430001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x08432149,0x528F528F,0x2A8B528F,0x528F318B,0x318B318B,0x2A8B2A8B,0x2A8B2149,0x18C70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x318B318B,0x528F4451,0x6B996B99,0x528F318B,0x318B318B,0x318B318B,0x318B2A8B,0x18C718C7,0x08430001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x0001318B,0x318B528F,0x8C5FB62D,0xB62DB62D,0x8C5F528F,0x21492149,0x18C72149,0x21492149,0x2A8B18C7,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C7318B,0x528F6B99,0xB62DB62D,0xB62DB62D,0xB62D528F,0x21492149,0x214918C7,0x214918C7,0x21492149,0x18C718C7,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2149318B,0x2349528F,0xB62DB62D,0xFFFFB62D,0x6B992149,0x2A8B2149,0x2A8B2149,0x21492149,0x21492A8B,0x18C718C7,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x318B318B,0x2A8B4451,0x8C5FB62D,0xB62D4451,0x44512349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x214918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x318B318B,0x2A8B2349,0x44514451,0x44514451,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x21492149,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x318B2A8B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B18C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21492A8B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B2149,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21492A8B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B18C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x318B2A8B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B2149,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x21492A8B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B18C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21492A8B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B2149,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x2149318B,0x2A8B2349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492349,0x23492A8B,0x2A8B18C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21492149,0x2A8B2A8B,0x23492349,0x23492349,0x23492349,0x23492349,0x23494451,0x44514451,0x23492A8B,0x21492149,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21492149,0x2A8B2A8B,0x2A8B2A8B,0x2A8B2A8B,0x2A8B2A8B,0x2A8B2A8B,0x44514451,0x44512A8B,0x2A8B2A8B,0x21492149,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C72149,0x21492149,0x2149318B,0x318B318B,0x318B318B,0x318B318B,0x318B318B,0x528F528F,0x528F318B,0x214918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x084318C7,0x21492149,0x21492149,0x318B2149,0x318B2149,0x318B318B,0x528F8C5F,0xB62DB62D,0x6B99318B,0x214918C7,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C718C7,0x21492149,0x21492149,0x2149318B,0x2149318B,0x528F6B99,0x6B996B99,0x318B2149,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010843,0x00010843,0x00010001,0x08430001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dBlueBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C35209,0x830D5209,0x520920C3,0x20C320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x830D830D,0x830D830D,0x830D830D,0x52095209,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x830D830D,0x83DD830D,0x830D830D,0x830D830D,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x830D830D,0x83DD830D,0x83DD830D,0x830D830D,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x2109294D,0x294D294D,0x4A5583DD,0x830D830D,0x830D83DD,0x52094A55,0x294D294D,0x21090845,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00012109,0x2109294D,0x4A5583DD,0x83DD83DD,0x83DD830D,0x5209830D,0x5209294D,0x294D294D,0x21092109,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x21092109,0x294D4A55,0x294D294D,0x52094A55,0x52094A55,0x83DD83DD,0x83DD4A55,0x294D2109,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08452109,0x21095209,0x294D294D,0x294D5209,0x294D294D,0x294D2109,0x21090845,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08452109,0x21092109,0x21092109,0x21092109,0x21092109,0x21090845,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00012109,0x2109294D,0x21092109,0x21092109,0x21092109,0x21090845,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109294D,0x4A554A55,0x294D294D,0x21092109,0x21092109,0x21090845,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x0001294D,0x4A552967,0x29672967,0x4A55294D,0x294D2957,0x29572967,0x2957294D,0x21090845,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x294D4A55,0x296783DD,0x83DD83DD,0x4A552957,0x29572957,0x29572957,0x29672967,0x21092109,0x08450001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x0001294D,0x294D2967,0xAD73AD73,0xAD73AD73,0x83DD4A55,0x294D2109,0x21092109,0x21092957,0x29572109,0x21090845,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294D,0x296783DD,0xAD73AD73,0xAD73AD73,0xAD734A55,0x294D2109,0x21092109,0x21092109,0x29572957,0x21090845,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x294D4A55,0x29674A55,0xAD73AD73,0xFFFFAD73,0x83DD294D,0x2957294D,0x2957294D,0x29572957,0x29572967,0x21092109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010845,0x294D294D,0x2967213F,0xAD73AD73,0xAD73213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x21092109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010845,0x294D2957,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x29572109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294D2967,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x29672109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010845,0x294D2967,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x29672109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x294D2967,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x29672109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010845,0x294D2967,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2957,0x29672109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010845,0x21092967,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x29672109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00012109,0x21092967,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2957,0x29672109,0x21090001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010845,0x21092957,0x2967213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2967,0x29572109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294D,0x29672967,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F213F,0x213F2957,0x29572109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109294D,0x29572967,0x29672967,0x29672967,0x29672967,0x29672967,0x2967AD73,0x83DD2967,0x29672967,0x294D2109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21092109,0x294D294D,0x294D294D,0x29572957,0x29572957,0x29572957,0x29572957,0x29574A55,0x4A55294D,0x21092109,0x08450001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x08452109,0x21092109,0x294D294D,0x294D294D,0x294D294D,0x294D294D,0x4A5583DD,0xAD73AD73,0x83DD294D,0x21092109,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010845,0x21092109,0x2109294D,0x294D294D,0x294D294D,0x294D2957,0x4A5583DD,0x83DD83DD,0x294D294D,0x21090001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x08450001,0x00010001,0x00010845,0x00010845,0x00010845,0x08450001,0x08450001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dMilkBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x39453945,0x394572CB,0x39453945,0x39451085,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x93D193D1,0x93D193D1,0x72CB72CB,0x72CB72CB,0x39450001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x93D193D1,0x93D193D1,0x72CB72CB,0x72CB72CB,0x39450001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x72CB93D1,0x93D193D1,0x93D193D1,0x72CB72CB,0x08430001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C718C7,0x2109318D,0x318D93D1,0x6B5B93D1,0x72CB72CB,0x72CB318D,0x318D318D,0x18C71085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x2109318D,0x318D4A53,0x8C638C63,0x72CB72CB,0x4A5372CB,0x4A53318D,0x21092109,0x210918C7,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C72109,0x2109318D,0x2109318D,0x318D4A53,0x72CB4A53,0x318D6B5B,0x6B5B4A53,0x21092109,0x18C70001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x10852109,0x2109318D,0x318D3945,0x21093945,0x318D318D,0x18C718C7,0x10851085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x18C72109,0x18C718C7,0x21092109,0x210918C7,0x18C71085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x084318C7,0x21092109,0x210918C7,0x210918C7,0x18C718C7,0x18C71085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x2109318D,0x4A53318D,0x21092109,0x18C72109,0x2109318D,0x21091085,0x08430001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x1085318D,0x4A536B5B,0x8C636B5B,0x4A534A53,0x4A534A53,0x4A536B5B,0x6B5B318D,0x18C70843,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x318D318D,0x8C636B5B,0x6B5B4A53,0x4A534A53,0x318D4A53,0x4A534A53,0x6B5B6B5B,0x318D18C7,0x10850001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x08432109,0x318D6B5B,0x6B5B8C63,0xCE738C63,0x318D2109,0x21092109,0x21092109,0x21094A53,0x6B5B318D,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C7318D,0x4A538C63,0x6B5BCE73,0xCE73CE73,0x4A532109,0x21092109,0x21092109,0x210918C7,0x4A534A53,0x18C71085,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21094A53,0x8C634A53,0x6B5BCE73,0xCE738C63,0x6B5B4A53,0x4A534A53,0x4A53318D,0x4A53318D,0x318D6B5B,0x210918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010843,0x318D318D,0x8C63CE73,0xCE73FFFF,0xCE73FFFF,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x4A5318C7,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21094A53,0x8C63CE73,0xCE73CE73,0xFFFFCE73,0xFFFFCE73,0xFFFFCE73,0xCE73CE73,0xCE73CE73,0x8C638C63,0x4A5318C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x318D6B5B,0x8C63CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C63CE73,0xCE736B5B,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21098C63,0x8C6319BD,0x19BDFFFF,0x19BD19BD,0xCE7319BD,0xFFFF19BD,0xCE73CE73,0x19BD8C63,0x19BD19BD,0x8C6318C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C7,0x21098C63,0x8C6319BD,0x19BDCE73,0x19BD19BD,0xCE7319BD,0xCE7319BD,0xCE73CE73,0x19BD19BD,0x19BD6B5B,0x8C6318C7,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x8C6319BD,0x19BD19BD,0x19BD19BD,0xCE7319BD,0xCE7319BD,0xCE73CE73,0x19BD19BD,0x19BD8C63,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x6B5B19BD,0x19BD19BD,0x19BD19BD,0xCE7319BD,0xCE7319BD,0xCE73CE73,0x19BD8C63,0x19BD6B5B,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x72CB19BD,0xCE7319BD,0x8C6319BD,0xCE7319BD,0xCE7319BD,0x19BD19BD,0x19BDCE73,0x19BD19BD,0x6B5B2109,0x18C70001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x21096B5B,0x6B5BCE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE736B5B,0x4A532109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x2109318D,0x8C638C63,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0xCE73CE73,0x8C636B5B,0x4A532109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x21092109,0x6B5B4A53,0x6B5B6B5B,0x6B5B8C63,0x8C638C63,0x6B5B8C63,0x8C63CE73,0x8C636B5B,0x6B5B6B5B,0x318D2109,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C72109,0x318D318D,0x318D318D,0x4A534A53,0x318D4A53,0x4A534A53,0x318D318D,0x4A534A53,0x318D2109,0x210918C7,0x08430001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x108518C7,0x21092109,0x21092109,0x318D2109,0x318D318D,0x318D318D,0x318D4A53,0x6B5B8C63,0x318D2109,0x210918C7,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010843,0x18C718C7,0x318D318D,0x2109318D,0x318D318D,0x318D318D,0x4A536B5B,0x6B5B6B5B,0x318D2109,0x18C70843,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x00010001,0x00010001,0x00011085,0x10850843,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
-#define dFishBottle {0xFFFEFFFE,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x20C3318D,0x830D5A4F,0x318D20C3,0x20C320C3,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x830D830D,0x830D830D,0x830D830D,0x5A4F5A4F,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000120C3,0x830D830D,0x830D830D,0x830D830D,0x830D830D,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x830D830D,0x7BE1830D,0x7BE1830D,0x830D830D,0x20C30001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C9318D,0x210D18C9,0x318D830D,0x5A4F830D,0x5A4F830D,0x5A4F318D,0x318D210D,0x18C91085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x000118C9,0x210D318D,0x318D7BE1,0x7BE17BE1,0x5A4F5A4F,0x5A4F830D,0x5A4F318D,0x210D210D,0x18C918C9,0x18C90001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x18C918C9,0x18C9210D,0x318D318D,0x318D5A4F,0x5A4F5A4F,0x5A4F5A4F,0x7BE1318D,0x318D210D,0x18C90001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x1085210D,0x20C3318D,0x318D20C3,0x318D318D,0x318D318D,0x210D18C9,0x10851085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x108518C9,0x18C9210D,0x20C3210D,0x18C918C9,0x18C918C9,0x18C91085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x000118C9,0x18C9318D,0x18C918C9,0x18C918C9,0x18C918C9,0x18C91085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x18C9318D,0x29DB318D,0x210D210D,0x210D18C9,0x210D210D,0x210D1085,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x1085210D,0x29DB42A9,0x42A929DB,0x29DB318D,0x318D29DB,0x29DB42A9,0x19A9210D,0x18C91085,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00011085,0x318D29DB,0x42A942A9,0x29DB29DB,0x29DB29DB,0x29DB29DB,0x29DB29DB,0x19A919A9,0x210D18C9,0x10850001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x0001318D,0x318D42A9,0x42A97BE1,0x9D2B9D2B,0x318D318D,0x18C918C9,0x18C918C9,0x18C929DB,0x19A9210D,0x18C90001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C9318D,0x42A922BB,0x7BE1FFFF,0xFFFFFFFF,0x7BE119A9,0x29DB29DB,0x19A919A9,0x29DB19A9,0x19A929DB,0x18C918C9,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x210D318D,0x22BB42A9,0x22BB9D2B,0x9D2B9D2B,0x22BB22BB,0x22BB22BB,0x22BB22BB,0x22BB22BB,0x19A919A9,0x18C918C9,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x318D318D,0x42A922BB,0x22BB22BB,0x22BB19A9,0x19A929DB,0x19A922BB,0x22BB22BB,0x22BB22BB,0x22BB22BB,0x210D18C9,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x210D29DB,0x42A922BB,0x22BB22BB,0x19A919A9,0x19A919A9,0x19A919A9,0x22BB22BB,0x22BB22BB,0x22BB22BB,0x29DB18C9,0x18C90001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C9,0x318D19A9,0x22BB22BB,0x19A942A9,0x42A919A9,0x19A919A9,0x19A929DB,0x29DB22BB,0x22BB22BB,0x22BB22BB,0x19A918C9,0x18C90001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C9,0x210D19A9,0x22BB22BB,0x42A99D2B,0xFFFF7BE1,0x42A942A9,0x29DB29DB,0x29DB29DB,0x22BB22BB,0x42A942A9,0x19A9210D,0x18C90001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x000118C9,0x18C919A9,0x22BB7BE1,0x5A4F1085,0x9D2B9D2B,0x7BE17BE1,0x7BE17BE1,0x7BE15A4F,0x42A99D2B,0x9D2B42A9,0x22BB18C9,0x18C90001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x18C919A9,0x22BB7BE1,0x318D5A4F,0xFFFF9D2B,0x7BE17BE1,0x7BE17BE1,0x7BE17BE1,0x7BE19D2B,0x7BE17BE1,0x19A918C9,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C919A9,0x42A95A4F,0x5A4F7BE1,0x7BE17BE1,0x9D2B9D2B,0x9D2B9D2B,0x9D2B9D2B,0x9D2B7BE1,0x9D2B9D2B,0x19A918C9,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x18C919A9,0x19A929DB,0x7BE17BE1,0x7BE17BE1,0x9D2B9D2B,0x9D2B9D2B,0x9D2B9D2B,0x22BB22BB,0x9D2B9D2B,0x19A91085,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00011085,0x108529DB,0x19A922BB,0x19A929DB,0x7BE19D2B,0x9D2B9D2B,0x9D2B9D2B,0x42A922BB,0x22BB22BB,0x22BB7BE1,0x29DB1085,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x18C9210D,0x19A922BB,0x22BB22BB,0x19A929DB,0x42A942A9,0x42A922BB,0x22BB22BB,0x22BB22BB,0x22BB19A9,0x29DB1085,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x108518C9,0x19A919A9,0x19A919A9,0x19A919A9,0x19A922BB,0x19A919A9,0x19A942A9,0x19A919A9,0x19A919A9,0x10851085,0x10850001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x10851085,0x108518C9,0x18C9210D,0x210D210D,0x29DB210D,0x210D210D,0x210D210D,0x210D210D,0x210D210D,0x18C91085,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x10851085,0x10851085,0x10851085,0x10851085,0x10851085,0x10851085,0x18C929DB,0x7BE17BE1,0x318D210D,0x210D18C9,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x10851085,0x18C9210D,0x18C9210D,0x18C918C9,0x210D210D,0x29DB5A4F,0x7BE15A4F,0x318D210D,0x18C90001,0x00010001,0x00010001,0x0001FFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00011085,0x00010001,0x00010001,0x10851085,0x10851085,0x10850001,0x00010001,0x00010001,0x00010001,0x00010001,0xFFFEFFFE,0xFFFEFFFE,0xFFFE0001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x0001FFFE,0xFFFEFFFE}
+typedef struct {
+	uint32_t offset; // Into AllTextures, from the start of its header
+	uint16_t width;
+	uint16_t height;
+	uint8_t fmt;
+	uint8_t bitsiz;
+	uint16_t tlut; // Texture holding the TLUT of a CI texture, NO_TLUT otherwise
+	uint8_t tint[3]; // Prim color for I and IA textures
+	uint8_t source; // TEXTURE_SOURCE_
+} textureInfo_t;
 
-#ifdef hardware
-uint32_t tKokiriTunic[]=dKokiriTunic;
-//uint32_t tAdultWallet[]=dAdultWallet;
-//uint32_t tAgony[]=dAgony;
-//uint32_t tBeans[]=dBeans;
-uint32_t tBiggoron[]=dBiggoron;
-//uint32_t tBolero[]=dBolero;
-//uint32_t tBombBag20[]=dBombBag20;
-//uint32_t tBombBag30[]=dBombBag30;
-//uint32_t tBombBag40[]=dBombBag40;
-//uint32_t tBossKey[]=dBossKey;
-//uint32_t tBigPoeBottle[]=dBigPoeBottle;
-//uint32_t tBugsBottle[]=dBugsBottle;
-//uint32_t tBottleMilkHalf[]=dBottleMilkHalf;
-//uint32_t tBottlePoe[]=dBottlePoe;
-//uint32_t tBrokenBiggoron[]=dBrokenBiggoron;
-//uint32_t tSkullMask[]=dSkullMask;
-//uint32_t tSOLDOUT[]=dSOLDOUT;
-//uint32_t tSpookyMask[]=dSpookyMask;
-//uint32_t tWeirdEgg[]=dWeirdEgg;
-//uint32_t tZeldaLetter[]=dZeldaLetter;
-//uint32_t tZoraMask[]=dZoraMask;
-//uint32_t tBulletBag30[]=dBulletBag30;
-//uint32_t tBulletBag40[]=dBulletBag40;
-//uint32_t tBulletBag50[]=dBulletBag50;
-//uint32_t tBunnyHood[]=dBunnyHood;
-//uint32_t tClaimCheck[]=dClaimCheck;
-//uint32_t tCojiro[]=dCojiro;
-//uint32_t tCompass[]=dCompass;
-//uint32_t tCucco[]=dCucco;
-//uint32_t tDefaultSong[]=dDefaultSong;
-uint32_t tDekuShield[]=dDekuShield;
-//uint32_t tDungeonMap[]=dDungeonMap;
-//uint32_t tEponaSong[]=dEponaSong;
-//uint32_t tEyedrops[]=dEyedrops;
-//uint32_t tFireMed[]=dFireMed;
-//uint32_t tForestMed[]=dForestMed;
-//uint32_t tFrog[]=dFrog;
-//uint32_t tGerudoCard[]=dGerudoCard;
-//uint32_t tGerudoMask[]=dGerudoMask;
-//uint32_t tGiantWallet[]=dGiantWallet;
-//uint32_t tGoldGauntlet[]=dGoldGauntlet;
-//uint32_t tGoldenScale[]=dGoldenScale;
-//uint32_t tGoldSkulltula[]=dGoldSkulltula;
-//uint32_t tGoronBracelet[]=dGoronBracelet;
-//uint32_t tGoronMask[]=dGoronMask;
-//uint32_t tGoronRuby[]=dGoronRuby;
-uint32_t tGoronTunic[]=dGoronTunic;
-//uint32_t tHeartContainer[]=dHeartContainer;
-//uint32_t tHeartPiece[]=dHeartPiece;
-uint32_t tHoverBoots[]=dHoverBoots;
-uint32_t tHylianShield[]=dHylianShield;
-uint32_t tIronBoots[]=dIronBoots;
-//uint32_t tKeatonMask[]=dKeatonMask;
-//uint32_t tKeys[]=dKeys;
-uint32_t tKokiriBoots[]=dKokiriBoots;
-//uint32_t tKokiriEmerald[]=dKokiriEmerald;
-uint32_t tKokiriSword[]=dKokiriSword;
-//uint32_t tLens[]=dLens;
-//uint32_t tLightMed[]=dLightMed;
-//uint32_t tLullaby[]=dLullaby;
-uint32_t tMasterSword[]=dMasterSword;
-//uint32_t tMinuet[]=dMinuet;
-uint32_t tMirrorShield[]=dMirrorShield;
-//uint32_t tOcarinaFairy[]=dOcarinaFairy;
-uint32_t tOcarinaTime[]=dOcarinaTime;
-//uint32_t tOddMedicine[]=dOddMedicine;
-//uint32_t tOddMushroom[]=dOddMushroom;
-//uint32_t tPoacherSaw[]=dPoacherSaw;
-//uint32_t tPocketCucco[]=dPocketCucco;
-//uint32_t tPocketEgg[]=dPocketEgg;
-//uint32_t tPrelude[]=dPrelude;
-//uint32_t tPrescription[]=dPrescription;
-//uint32_t tQuiver30[]=dQuiver30;
-//uint32_t tQuiver40[]=dQuiver40;
-//uint32_t tQuiver50[]=dQuiver50;
-//uint32_t tSariaSong[]=dSariaSong;
-//uint32_t tSerenade[]=dSerenade;
-//uint32_t tShadowMed[]=dShadowMed;
-//uint32_t tSilverGauntlets[]=dSilverGauntlets;
-//uint32_t tSilverScale[]=dSilverScale;
-//uint32_t tSpiritMed[]=dSpiritMed;
-//uint32_t tStormsSong[]=dStormsSong;
-//uint32_t tSunSong[]=dSunSong;
-//uint32_t tSongTime[]=dSongTime;
-//uint32_t tMaskTruth[]=dMaskTruth;
-//uint32_t tWaterMed[]=dWaterMed;
-//uint32_t tZoraSapphire[]=dZoraSapphire;
-uint32_t tZoraTunic[]=dZoraTunic;
-uint32_t tRedBox[]=dRedBox;
-uint32_t tLongBlackBox[]=dLongBlackBox;
-uint32_t tDpad3[]=dDpad3;
-uint32_t tDpad2[]=dDpad2;
-uint32_t tDpad1[]=dDpad1;
-uint32_t tDpad0[]=dDpad0;
-uint32_t tBlackBox[]=dBlackBox;
-uint32_t tDekuStick[]=dDekuStick;
-uint32_t tDekuNuts[]=dDekuNuts;
-uint32_t tBombs[]=dBombs;
-uint32_t tBow[]=dBow;
-uint32_t tFireArrow[]=dFireArrow;
-uint32_t tDin[]=dDin;
-uint32_t tSlingshot[]=dSlingshot;
-uint32_t tBombchu[]=dBombchu;
-uint32_t tHookshot[]=dHookshot;
-uint32_t tLongshot[]=dLongshot;
-uint32_t tIceArrow[]=dIceArrow;
-uint32_t tFarore[]=dFarore;
-uint32_t tBoomerang[]=dBoomerang;
-uint32_t tHammer[]=dHammer;
-uint32_t tLightArrows[]=dLightArrows;
-uint32_t tNayru[]=dNayru;
-uint32_t tEmptyBottle[]=dEmptyBottle;
-//uint32_t tFairyBottle[]=dFairyBottle;
-//uint32_t tRedBottle[]=dRedBottle;
-//uint32_t tGreenBottle[]=dGreenBottle;
-//uint32_t tBlueBottle[]=dBlueBottle;
-//uint32_t tMilkBottle[]=dMilkBottle;
-//uint32_t tFishBottle[]=dFishBottle;
+#define TEXTURE_SOURCE_PACK 0
+#define TEXTURE_SOURCE_ROM_ICONS 1 // Atlas page built from icon_item_static, not in AllTextures
 
-#else
+#define TEX_DPAD 0
+#define TEX_DPAD_BASE_BOTTOM 1
+#define TEX_DPAD_BASE_TOP 2
+#define TEX_DPAD_TOP 3
+#define TEX_LONGBLAC 4
+#define TEX_RED 5
+#define TEX_DPAD_TLUT 6
+#define TEX_DPAD_BASE_BOTTOM_TLUT 7
+#define TEX_DPAD_BASE_TOP_TLUT 8
+#define TEX_DPAD_TOP_TLUT 9
+#define TEX_ATLAS_PROJECTILE_0 10
+#define TEX_ATLAS_PROJECTILE_TLUT 11
+#define TEX_ATLAS_PROJECTILE_TLUT_GREYED 12
+#define TEX_ATLAS_PROJECTILE_TLUT_HIGHLIGHTED 13
+#define TEX_ATLAS_WEAPON_0 14
+#define TEX_ATLAS_WEAPON_TLUT 15
+#define TEX_ATLAS_WEAPON_TLUT_GREYED 16
+#define TEX_ATLAS_WEAPON_TLUT_HIGHLIGHTED 17
+#define TEX_ATLAS_ARMOR_0 18
+#define TEX_ATLAS_ARMOR_TLUT 19
+#define TEX_ATLAS_ARMOR_TLUT_GREYED 20
+#define TEX_ATLAS_ARMOR_TLUT_HIGHLIGHTED 21
+#define TEX_ATLAS_HAND_0 22
+#define TEX_ATLAS_HAND_TLUT 23
+#define TEX_ATLAS_HAND_TLUT_GREYED 24
+#define TEX_ATLAS_HAND_TLUT_HIGHLIGHTED 25
+#define TEX_ATLAS_MAGIC_0 26
+#define TEX_ATLAS_MAGIC_TLUT 27
+#define TEX_ATLAS_MAGIC_TLUT_GREYED 28
+#define TEX_ATLAS_MAGIC_TLUT_HIGHLIGHTED 29
+#define TEX_ATLAS_BOTTLE_0 30
+#define TEX_ATLAS_BOTTLE_TLUT 31
+#define TEX_ATLAS_BOTTLE_TLUT_GREYED 32
+#define TEX_ATLAS_BOTTLE_TLUT_HIGHLIGHTED 33
+#define TEX_BLUE_POTION 34
+#define TEX_BOMB 35
+#define TEX_BOMBCHU 36
+#define TEX_BOOMERANG 37
+#define TEX_BOTTLED_FAIRY 38
+#define TEX_BOTTLES_BIG_POE 39
+#define TEX_BOTTLES_BLUE_FIRE 40
+#define TEX_BOTTLES_BLUE_POTION 41
+#define TEX_BOTTLES_BOTTLED_FAIRY 42
+#define TEX_BOTTLES_BUG 43
+#define TEX_BOTTLES_EMPTY_BOTTLE 44
+#define TEX_BOTTLES_FISH 45
+#define TEX_BOTTLES_GREEN_POTION 46
+#define TEX_BOTTLES_MILK_FULL 47
+#define TEX_BOTTLES_MILK_HALF 48
+#define TEX_BOTTLES_POE 49
+#define TEX_BOTTLES_RED_POTION 50
+#define TEX_BOTTLES_RUTOS_LETTER 51
+#define TEX_CLOTHING_GORON_TUNIC 52
+#define TEX_CLOTHING_HOVER_BOOTS 53
+#define TEX_CLOTHING_IRON_BOOTS 54
+#define TEX_CLOTHING_KOKIRI_BOOTS 55
+#define TEX_CLOTHING_KOKIRI_TUNIC 56
+#define TEX_CLOTHING_ZORA_TUNIC 57
+#define TEX_DEKU_NUT 58
+#define TEX_DINS_FIRE 59
+#define TEX_DUNGEON_BOSS_KEY 60
+#define TEX_DUNGEON_COMPASS 61
+#define TEX_DUNGEON_DUNGEON_MAP 62
+#define TEX_DUNGEON_SMALL_KEY 63
+#define TEX_EMPTY_BOTTLE 64
+#define TEX_EQUIPMENT_BIGGORON_SWORD 65
+#define TEX_EQUIPMENT_DEKU_SHIELD 66
+#define TEX_EQUIPMENT_GIANTS_KNIFE_BROKEN 67
+#define TEX_EQUIPMENT_HYLIAN_SHIELD 68
+#define TEX_EQUIPMENT_KOKIRI_SWORD 69
+#define TEX_EQUIPMENT_MASTER_SWORD 70
+#define TEX_EQUIPMENT_MIRROR_SHIELD 71
+#define TEX_FAIRY_BOW 72
+#define TEX_FAIRY_SLINGSHOT 73
+#define TEX_FARORES_WIND 74
+#define TEX_FIRE_ARROW 75
+#define TEX_FISH 76
+#define TEX_GREEN_POTION 77
+#define TEX_HAND_BOMB 78
+#define TEX_HAND_BOMBCHU 79
+#define TEX_HAND_DEKU_NUT 80
+#define TEX_HAND_MEGATON_HAMMER 81
+#define TEX_HAND_DEKUSTICK 82
+#define TEX_HOOKSHOT 83
+#define TEX_ICE_ARROW 84
+#define TEX_ITEM 85
+#define TEX_LIGHT_ARROW 86
+#define TEX_LONGSHOT 87
+#define TEX_MAGIC_DINS_FIRE 88
+#define TEX_MAGIC_FARORES_WIND 89
+#define TEX_MAGIC_NAYRUS_LOVE 90
+#define TEX_MEGATON_HAMMER 91
+#define TEX_MILK_FULL 92
+#define TEX_NAYRUS_LOVE 93
+#define TEX_OTHER_BUNNY_HOOD 94
+#define TEX_OTHER_CLAIM_CHECK 95
+#define TEX_OTHER_COJIRO 96
+#define TEX_OTHER_CUCCO 97
+#define TEX_OTHER_EYE_BALL_FROG 98
+#define TEX_OTHER_EYE_DROPS 99
+#define TEX_OTHER_FAIRY_OCARINA 100
+#define TEX_OTHER_GERUDO_MASK 101
+#define TEX_OTHER_GORON_MASK 102
+#define TEX_OTHER_GORONS_SWORD_BROKEN 103
+#define TEX_OTHER_KEATON_MASK 104
+#define TEX_OTHER_LENS_OF_TRUTH 105
+#define TEX_OTHER_MAGIC_BEANS 106
+#define TEX_OTHER_MASK_OF_TRUTH 107
+#define TEX_OTHER_OCARINA_OF_TIME 108
+#define TEX_OTHER_ODD_MUSHROOM 109
+#define TEX_OTHER_ODD_POTION 110
+#define TEX_OTHER_POACHERS_SAW 111
+#define TEX_OTHER_POCKET_CUCCO 112
+#define TEX_OTHER_POCKET_EGG 113
+#define TEX_OTHER_PRESCRIPTION 114
+#define TEX_OTHER_SOLD_OUT 115
+#define TEX_OTHER_SKULL_MASK 116
+#define TEX_OTHER_SPOOKY_MASK 117
+#define TEX_OTHER_WEIRD_EGG 118
+#define TEX_OTHER_ZELDAS_LETTER 119
+#define TEX_OTHER_ZORA_MASK 120
+#define TEX_PROJECTILE_BOOMERANG 121
+#define TEX_PROJECTILE_FAIRY_BOW 122
+#define TEX_PROJECTILE_FAIRY_SLINGSHOT 123
+#define TEX_PROJECTILE_FIRE_ARROW 124
+#define TEX_PROJECTILE_HOOKSHOT 125
+#define TEX_PROJECTILE_ICE_ARROW 126
+#define TEX_PROJECTILE_LIGHT_ARROW 127
+#define TEX_PROJECTILE_LONGSHOT 128
+#define TEX_QUEST_FIRE_MEDALLION 129
+#define TEX_QUEST_FOREST_MEDALLION 130
+#define TEX_QUEST_GERUDOS_CARD 131
+#define TEX_QUEST_GOLD_SKULLTULA 132
+#define TEX_QUEST_GORONS_RUBY 133
+#define TEX_QUEST_HEART_CONTAINER 134
+#define TEX_QUEST_KOKIRIS_EMERALD 135
+#define TEX_QUEST_LIGHT_MEDALLION 136
+#define TEX_QUEST_PIECE_OF_HEART 137
+#define TEX_QUEST_SHADOW_MEDALLION 138
+#define TEX_QUEST_SPIRIT_MEDALLION 139
+#define TEX_QUEST_STONE_OF_AGONY 140
+#define TEX_QUEST_WATER_MEDALLION 141
+#define TEX_QUEST_ZORAS_SAPPHIRE 142
+#define TEX_RED_POTION 143
+#define TEX_SONGS_BOLERO 144
+#define TEX_SONGS_MINUET 145
+#define TEX_SONGS_PRELUDE 146
+#define TEX_SONGS_SERENADE 147
+#define TEX_SONGS_SHADOW 148
+#define TEX_SONGS_SPIRIT 149
+#define TEX_SONGS_ZELDATILE 150
+#define TEX_SONGS_TILE146 151
+#define TEX_SONGS_TILEEPONA 152
+#define TEX_SONGS_TILESARIA 153
+#define TEX_SONGS_TILESTORMS 154
+#define TEX_SONGS_TILESUN 155
+#define TEX_SONGS_TILETIME 156
+#define TEX_UPGRADES_ADULTS_WALLET 157
+#define TEX_UPGRADES_BOMB_BAG_20 158
+#define TEX_UPGRADES_BOMB_BAG_30 159
+#define TEX_UPGRADES_BOMB_BAG_40 160
+#define TEX_UPGRADES_BULLET_BAG_30 161
+#define TEX_UPGRADES_BULLET_BAG_40 162
+#define TEX_UPGRADES_BULLET_BAG_50 163
+#define TEX_UPGRADES_GIANTS_WALLET 164
+#define TEX_UPGRADES_GOLDEN_GAUNTLETS 165
+#define TEX_UPGRADES_GOLDEN_SCALE 166
+#define TEX_UPGRADES_GORONS_BRACELET 167
+#define TEX_UPGRADES_QUIVER_30 168
+#define TEX_UPGRADES_QUIVER_40 169
+#define TEX_UPGRADES_QUIVER_50 170
+#define TEX_UPGRADES_SILVER_GAUNTLETS 171
+#define TEX_UPGRADES_SILVER_SCALE 172
+#define TEX_BLACK 173
+#define TEX_DEKUSTICK 174
+#define TEX_DPAD_BOTTOM 175
+#define TEX_OPEN 176
+#define TEX_WHITE 177
+#define TEX_BLUE_POTION_TLUT 178
+#define TEX_BOMB_TLUT 179
+#define TEX_BOMBCHU_TLUT 180
+#define TEX_BOOMERANG_TLUT 181
+#define TEX_BOTTLED_FAIRY_TLUT 182
+#define TEX_BOTTLES_BIG_POE_TLUT 183
+#define TEX_BOTTLES_BLUE_FIRE_TLUT 184
+#define TEX_BOTTLES_BLUE_POTION_TLUT 185
+#define TEX_BOTTLES_BOTTLED_FAIRY_TLUT 186
+#define TEX_BOTTLES_BUG_TLUT 187
+#define TEX_BOTTLES_EMPTY_BOTTLE_TLUT 188
+#define TEX_BOTTLES_FISH_TLUT 189
+#define TEX_BOTTLES_GREEN_POTION_TLUT 190
+#define TEX_BOTTLES_MILK_FULL_TLUT 191
+#define TEX_BOTTLES_MILK_HALF_TLUT 192
+#define TEX_BOTTLES_POE_TLUT 193
+#define TEX_BOTTLES_RED_POTION_TLUT 194
+#define TEX_BOTTLES_RUTOS_LETTER_TLUT 195
+#define TEX_CLOTHING_GORON_TUNIC_TLUT 196
+#define TEX_CLOTHING_HOVER_BOOTS_TLUT 197
+#define TEX_CLOTHING_IRON_BOOTS_TLUT 198
+#define TEX_CLOTHING_KOKIRI_BOOTS_TLUT 199
+#define TEX_CLOTHING_KOKIRI_TUNIC_TLUT 200
+#define TEX_CLOTHING_ZORA_TUNIC_TLUT 201
+#define TEX_DEKU_NUT_TLUT 202
+#define TEX_DINS_FIRE_TLUT 203
+#define TEX_DUNGEON_BOSS_KEY_TLUT 204
+#define TEX_DUNGEON_COMPASS_TLUT 205
+#define TEX_DUNGEON_DUNGEON_MAP_TLUT 206
+#define TEX_DUNGEON_SMALL_KEY_TLUT 207
+#define TEX_EMPTY_BOTTLE_TLUT 208
+#define TEX_EQUIPMENT_BIGGORON_SWORD_TLUT 209
+#define TEX_EQUIPMENT_DEKU_SHIELD_TLUT 210
+#define TEX_EQUIPMENT_GIANTS_KNIFE_BROKEN_TLUT 211
+#define TEX_EQUIPMENT_HYLIAN_SHIELD_TLUT 212
+#define TEX_EQUIPMENT_KOKIRI_SWORD_TLUT 213
+#define TEX_EQUIPMENT_MASTER_SWORD_TLUT 214
+#define TEX_EQUIPMENT_MIRROR_SHIELD_TLUT 215
+#define TEX_FAIRY_BOW_TLUT 216
+#define TEX_FAIRY_SLINGSHOT_TLUT 217
+#define TEX_FARORES_WIND_TLUT 218
+#define TEX_FIRE_ARROW_TLUT 219
+#define TEX_FISH_TLUT 220
+#define TEX_GREEN_POTION_TLUT 221
+#define TEX_HAND_BOMB_TLUT 222
+#define TEX_HAND_BOMBCHU_TLUT 223
+#define TEX_HAND_DEKU_NUT_TLUT 224
+#define TEX_HAND_MEGATON_HAMMER_TLUT 225
+#define TEX_HAND_DEKUSTICK_TLUT 226
+#define TEX_HOOKSHOT_TLUT 227
+#define TEX_ICE_ARROW_TLUT 228
+#define TEX_ITEM_TLUT 229
+#define TEX_LIGHT_ARROW_TLUT 230
+#define TEX_LONGSHOT_TLUT 231
+#define TEX_MAGIC_DINS_FIRE_TLUT 232
+#define TEX_MAGIC_FARORES_WIND_TLUT 233
+#define TEX_MAGIC_NAYRUS_LOVE_TLUT 234
+#define TEX_MEGATON_HAMMER_TLUT 235
+#define TEX_MILK_FULL_TLUT 236
+#define TEX_NAYRUS_LOVE_TLUT 237
+#define TEX_OTHER_BUNNY_HOOD_TLUT 238
+#define TEX_OTHER_CLAIM_CHECK_TLUT 239
+#define TEX_OTHER_COJIRO_TLUT 240
+#define TEX_OTHER_CUCCO_TLUT 241
+#define TEX_OTHER_EYE_BALL_FROG_TLUT 242
+#define TEX_OTHER_EYE_DROPS_TLUT 243
+#define TEX_OTHER_FAIRY_OCARINA_TLUT 244
+#define TEX_OTHER_GERUDO_MASK_TLUT 245
+#define TEX_OTHER_GORON_MASK_TLUT 246
+#define TEX_OTHER_GORONS_SWORD_BROKEN_TLUT 247
+#define TEX_OTHER_KEATON_MASK_TLUT 248
+#define TEX_OTHER_LENS_OF_TRUTH_TLUT 249
+#define TEX_OTHER_MAGIC_BEANS_TLUT 250
+#define TEX_OTHER_MASK_OF_TRUTH_TLUT 251
+#define TEX_OTHER_OCARINA_OF_TIME_TLUT 252
+#define TEX_OTHER_ODD_MUSHROOM_TLUT 253
+#define TEX_OTHER_ODD_POTION_TLUT 254
+#define TEX_OTHER_POACHERS_SAW_TLUT 255
+#define TEX_OTHER_POCKET_CUCCO_TLUT 256
+#define TEX_OTHER_POCKET_EGG_TLUT 257
+#define TEX_OTHER_PRESCRIPTION_TLUT 258
+#define TEX_OTHER_SOLD_OUT_TLUT 259
+#define TEX_OTHER_SKULL_MASK_TLUT 260
+#define TEX_OTHER_SPOOKY_MASK_TLUT 261
+#define TEX_OTHER_WEIRD_EGG_TLUT 262
+#define TEX_OTHER_ZELDAS_LETTER_TLUT 263
+#define TEX_OTHER_ZORA_MASK_TLUT 264
+#define TEX_PROJECTILE_BOOMERANG_TLUT 265
+#define TEX_PROJECTILE_FAIRY_BOW_TLUT 266
+#define TEX_PROJECTILE_FAIRY_SLINGSHOT_TLUT 267
+#define TEX_PROJECTILE_FIRE_ARROW_TLUT 268
+#define TEX_PROJECTILE_HOOKSHOT_TLUT 269
+#define TEX_PROJECTILE_ICE_ARROW_TLUT 270
+#define TEX_PROJECTILE_LIGHT_ARROW_TLUT 271
+#define TEX_PROJECTILE_LONGSHOT_TLUT 272
+#define TEX_QUEST_FIRE_MEDALLION_TLUT 273
+#define TEX_QUEST_FOREST_MEDALLION_TLUT 274
+#define TEX_QUEST_GERUDOS_CARD_TLUT 275
+#define TEX_QUEST_GOLD_SKULLTULA_TLUT 276
+#define TEX_QUEST_GORONS_RUBY_TLUT 277
+#define TEX_QUEST_HEART_CONTAINER_TLUT 278
+#define TEX_QUEST_KOKIRIS_EMERALD_TLUT 279
+#define TEX_QUEST_LIGHT_MEDALLION_TLUT 280
+#define TEX_QUEST_PIECE_OF_HEART_TLUT 281
+#define TEX_QUEST_SHADOW_MEDALLION_TLUT 282
+#define TEX_QUEST_SPIRIT_MEDALLION_TLUT 283
+#define TEX_QUEST_STONE_OF_AGONY_TLUT 284
+#define TEX_QUEST_WATER_MEDALLION_TLUT 285
+#define TEX_QUEST_ZORAS_SAPPHIRE_TLUT 286
+#define TEX_RED_POTION_TLUT 287
+#define TEX_SONGS_BOLERO_TLUT 288
+#define TEX_SONGS_MINUET_TLUT 289
+#define TEX_SONGS_PRELUDE_TLUT 290
+#define TEX_SONGS_SERENADE_TLUT 291
+#define TEX_SONGS_SHADOW_TLUT 292
+#define TEX_SONGS_SPIRIT_TLUT 293
+#define TEX_SONGS_ZELDATILE_TLUT 294
+#define TEX_SONGS_TILE146_TLUT 295
+#define TEX_SONGS_TILEEPONA_TLUT 296
+#define TEX_SONGS_TILESARIA_TLUT 297
+#define TEX_SONGS_TILESTORMS_TLUT 298
+#define TEX_SONGS_TILESUN_TLUT 299
+#define TEX_SONGS_TILETIME_TLUT 300
+#define TEX_UPGRADES_ADULTS_WALLET_TLUT 301
+#define TEX_UPGRADES_BOMB_BAG_20_TLUT 302
+#define TEX_UPGRADES_BOMB_BAG_30_TLUT 303
+#define TEX_UPGRADES_BOMB_BAG_40_TLUT 304
+#define TEX_UPGRADES_BULLET_BAG_30_TLUT 305
+#define TEX_UPGRADES_BULLET_BAG_40_TLUT 306
+#define TEX_UPGRADES_BULLET_BAG_50_TLUT 307
+#define TEX_UPGRADES_GIANTS_WALLET_TLUT 308
+#define TEX_UPGRADES_GOLDEN_GAUNTLETS_TLUT 309
+#define TEX_UPGRADES_GOLDEN_SCALE_TLUT 310
+#define TEX_UPGRADES_GORONS_BRACELET_TLUT 311
+#define TEX_UPGRADES_QUIVER_30_TLUT 312
+#define TEX_UPGRADES_QUIVER_40_TLUT 313
+#define TEX_UPGRADES_QUIVER_50_TLUT 314
+#define TEX_UPGRADES_SILVER_GAUNTLETS_TLUT 315
+#define TEX_UPGRADES_SILVER_SCALE_TLUT 316
+#define TEX_DEKUSTICK_TLUT 317
+#define TEX_DPAD_BOTTOM_TLUT 318
+#define TEX_OPEN_TLUT 319
+#define TEX_BLUE_POTION_16 320
+#define TEX_BOMB_16 321
+#define TEX_BOMBCHU_16 322
+#define TEX_BOOMERANG_16 323
+#define TEX_BOTTLED_FAIRY_16 324
+#define TEX_BOTTLES_BIG_POE_16 325
+#define TEX_BOTTLES_BLUE_FIRE_16 326
+#define TEX_BOTTLES_BLUE_POTION_16 327
+#define TEX_BOTTLES_BOTTLED_FAIRY_16 328
+#define TEX_BOTTLES_BUG_16 329
+#define TEX_BOTTLES_EMPTY_BOTTLE_16 330
+#define TEX_BOTTLES_FISH_16 331
+#define TEX_BOTTLES_GREEN_POTION_16 332
+#define TEX_BOTTLES_MILK_FULL_16 333
+#define TEX_BOTTLES_MILK_HALF_16 334
+#define TEX_BOTTLES_POE_16 335
+#define TEX_BOTTLES_RED_POTION_16 336
+#define TEX_BOTTLES_RUTOS_LETTER_16 337
+#define TEX_CLOTHING_GORON_TUNIC_16 338
+#define TEX_CLOTHING_HOVER_BOOTS_16 339
+#define TEX_CLOTHING_IRON_BOOTS_16 340
+#define TEX_CLOTHING_KOKIRI_BOOTS_16 341
+#define TEX_CLOTHING_KOKIRI_TUNIC_16 342
+#define TEX_CLOTHING_ZORA_TUNIC_16 343
+#define TEX_DEKU_NUT_16 344
+#define TEX_DINS_FIRE_16 345
+#define TEX_DUNGEON_BOSS_KEY_16 346
+#define TEX_DUNGEON_COMPASS_16 347
+#define TEX_DUNGEON_DUNGEON_MAP_16 348
+#define TEX_DUNGEON_SMALL_KEY_16 349
+#define TEX_EMPTY_BOTTLE_16 350
+#define TEX_EQUIPMENT_BIGGORON_SWORD_16 351
+#define TEX_EQUIPMENT_DEKU_SHIELD_16 352
+#define TEX_EQUIPMENT_GIANTS_KNIFE_BROKEN_16 353
+#define TEX_EQUIPMENT_HYLIAN_SHIELD_16 354
+#define TEX_EQUIPMENT_KOKIRI_SWORD_16 355
+#define TEX_EQUIPMENT_MASTER_SWORD_16 356
+#define TEX_EQUIPMENT_MIRROR_SHIELD_16 357
+#define TEX_FAIRY_BOW_16 358
+#define TEX_FAIRY_SLINGSHOT_16 359
+#define TEX_FARORES_WIND_16 360
+#define TEX_FIRE_ARROW_16 361
+#define TEX_FISH_16 362
+#define TEX_GREEN_POTION_16 363
+#define TEX_HAND_BOMB_16 364
+#define TEX_HAND_BOMBCHU_16 365
+#define TEX_HAND_DEKU_NUT_16 366
+#define TEX_HAND_MEGATON_HAMMER_16 367
+#define TEX_HAND_DEKUSTICK_16 368
+#define TEX_HOOKSHOT_16 369
+#define TEX_ICE_ARROW_16 370
+#define TEX_LIGHT_ARROW_16 371
+#define TEX_LONGSHOT_16 372
+#define TEX_MAGIC_DINS_FIRE_16 373
+#define TEX_MAGIC_FARORES_WIND_16 374
+#define TEX_MAGIC_NAYRUS_LOVE_16 375
+#define TEX_MEGATON_HAMMER_16 376
+#define TEX_MILK_FULL_16 377
+#define TEX_NAYRUS_LOVE_16 378
+#define TEX_OTHER_BUNNY_HOOD_16 379
+#define TEX_OTHER_CLAIM_CHECK_16 380
+#define TEX_OTHER_COJIRO_16 381
+#define TEX_OTHER_CUCCO_16 382
+#define TEX_OTHER_EYE_BALL_FROG_16 383
+#define TEX_OTHER_EYE_DROPS_16 384
+#define TEX_OTHER_FAIRY_OCARINA_16 385
+#define TEX_OTHER_GERUDO_MASK_16 386
+#define TEX_OTHER_GORON_MASK_16 387
+#define TEX_OTHER_GORONS_SWORD_BROKEN_16 388
+#define TEX_OTHER_KEATON_MASK_16 389
+#define TEX_OTHER_LENS_OF_TRUTH_16 390
+#define TEX_OTHER_MAGIC_BEANS_16 391
+#define TEX_OTHER_MASK_OF_TRUTH_16 392
+#define TEX_OTHER_OCARINA_OF_TIME_16 393
+#define TEX_OTHER_ODD_MUSHROOM_16 394
+#define TEX_OTHER_ODD_POTION_16 395
+#define TEX_OTHER_POACHERS_SAW_16 396
+#define TEX_OTHER_POCKET_CUCCO_16 397
+#define TEX_OTHER_POCKET_EGG_16 398
+#define TEX_OTHER_PRESCRIPTION_16 399
+#define TEX_OTHER_SOLD_OUT_16 400
+#define TEX_OTHER_SKULL_MASK_16 401
+#define TEX_OTHER_SPOOKY_MASK_16 402
+#define TEX_OTHER_WEIRD_EGG_16 403
+#define TEX_OTHER_ZELDAS_LETTER_16 404
+#define TEX_OTHER_ZORA_MASK_16 405
+#define TEX_PROJECTILE_BOOMERANG_16 406
+#define TEX_PROJECTILE_FAIRY_BOW_16 407
+#define TEX_PROJECTILE_FAIRY_SLINGSHOT_16 408
+#define TEX_PROJECTILE_FIRE_ARROW_16 409
+#define TEX_PROJECTILE_HOOKSHOT_16 410
+#define TEX_PROJECTILE_ICE_ARROW_16 411
+#define TEX_PROJECTILE_LIGHT_ARROW_16 412
+#define TEX_PROJECTILE_LONGSHOT_16 413
+#define TEX_QUEST_FIRE_MEDALLION_16 414
+#define TEX_QUEST_FOREST_MEDALLION_16 415
+#define TEX_QUEST_GERUDOS_CARD_16 416
+#define TEX_QUEST_GOLD_SKULLTULA_16 417
+#define TEX_QUEST_GORONS_RUBY_16 418
+#define TEX_QUEST_HEART_CONTAINER_16 419
+#define TEX_QUEST_KOKIRIS_EMERALD_16 420
+#define TEX_QUEST_LIGHT_MEDALLION_16 421
+#define TEX_QUEST_PIECE_OF_HEART_16 422
+#define TEX_QUEST_SHADOW_MEDALLION_16 423
+#define TEX_QUEST_SPIRIT_MEDALLION_16 424
+#define TEX_QUEST_STONE_OF_AGONY_16 425
+#define TEX_QUEST_WATER_MEDALLION_16 426
+#define TEX_QUEST_ZORAS_SAPPHIRE_16 427
+#define TEX_RED_POTION_16 428
+#define TEX_SONGS_BOLERO_16 429
+#define TEX_SONGS_MINUET_16 430
+#define TEX_SONGS_PRELUDE_16 431
+#define TEX_SONGS_SERENADE_16 432
+#define TEX_SONGS_SHADOW_16 433
+#define TEX_SONGS_SPIRIT_16 434
+#define TEX_SONGS_ZELDATILE_16 435
+#define TEX_SONGS_TILE146_16 436
+#define TEX_SONGS_TILEEPONA_16 437
+#define TEX_SONGS_TILESARIA_16 438
+#define TEX_SONGS_TILESTORMS_16 439
+#define TEX_SONGS_TILESUN_16 440
+#define TEX_SONGS_TILETIME_16 441
+#define TEX_UPGRADES_ADULTS_WALLET_16 442
+#define TEX_UPGRADES_BOMB_BAG_20_16 443
+#define TEX_UPGRADES_BOMB_BAG_30_16 444
+#define TEX_UPGRADES_BOMB_BAG_40_16 445
+#define TEX_UPGRADES_BULLET_BAG_30_16 446
+#define TEX_UPGRADES_BULLET_BAG_40_16 447
+#define TEX_UPGRADES_BULLET_BAG_50_16 448
+#define TEX_UPGRADES_GIANTS_WALLET_16 449
+#define TEX_UPGRADES_GOLDEN_GAUNTLETS_16 450
+#define TEX_UPGRADES_GOLDEN_SCALE_16 451
+#define TEX_UPGRADES_GORONS_BRACELET_16 452
+#define TEX_UPGRADES_QUIVER_30_16 453
+#define TEX_UPGRADES_QUIVER_40_16 454
+#define TEX_UPGRADES_QUIVER_50_16 455
+#define TEX_UPGRADES_SILVER_GAUNTLETS_16 456
+#define TEX_UPGRADES_SILVER_SCALE_16 457
+#define TEX_BLACK_16 458
+#define TEX_DEKUSTICK_16 459
+#define TEX_WHITE_16 460
 
-uint32_t* tKokiriTunic = (uint32_t*)(mallocStartAddr + 2048);
-uint32_t* tAdultWallet = (uint32_t*)(mallocStartAddr + 4096);
-uint32_t* tAgony = (uint32_t*)(mallocStartAddr + 6144);
-uint32_t* tBeans = (uint32_t*)(mallocStartAddr + 8192);
-uint32_t* tBiggoron = (uint32_t*)(mallocStartAddr + 10240);
-uint32_t* tBolero = (uint32_t*)(mallocStartAddr + 12288);
-uint32_t* tBombBag20 = (uint32_t*)(mallocStartAddr + 14336);
-uint32_t* tBombBag30 = (uint32_t*)(mallocStartAddr + 16384);
-uint32_t* tBombBag40 = (uint32_t*)(mallocStartAddr + 18432);
-uint32_t* tBossKey = (uint32_t*)(mallocStartAddr + 20480);
-uint32_t* tBigPoeBottle = (uint32_t*)(mallocStartAddr + 22528);
-uint32_t* tBugsBottle = (uint32_t*)(mallocStartAddr + 24576);
-uint32_t* tBottleMilkHalf = (uint32_t*)(mallocStartAddr + 26624);
-uint32_t* tBottlePoe = (uint32_t*)(mallocStartAddr + 28672);
-uint32_t* tBrokenBiggoron = (uint32_t*)(mallocStartAddr + 30720);
-uint32_t* tSkullMask = (uint32_t*)(mallocStartAddr + 32768);
-uint32_t* tSOLDOUT = (uint32_t*)(mallocStartAddr + 34816);
-uint32_t* tSpookyMask = (uint32_t*)(mallocStartAddr + 36864);
-uint32_t* tWeirdEgg = (uint32_t*)(mallocStartAddr + 38912);
-uint32_t* tZeldaLetter = (uint32_t*)(mallocStartAddr + 40960);
-uint32_t* tZoraMask = (uint32_t*)(mallocStartAddr + 43008);
-uint32_t* tBulletBag30 = (uint32_t*)(mallocStartAddr + 45056);
-uint32_t* tBulletBag40 = (uint32_t*)(mallocStartAddr + 47104);
-uint32_t* tBulletBag50 = (uint32_t*)(mallocStartAddr + 49152);
-uint32_t* tBunnyHood = (uint32_t*)(mallocStartAddr + 51200);
-uint32_t* tClaimCheck = (uint32_t*)(mallocStartAddr + 53248);
-uint32_t* tCojiro = (uint32_t*)(mallocStartAddr + 55296);
-uint32_t* tCompass = (uint32_t*)(mallocStartAddr + 57344);
-uint32_t* tCucco = (uint32_t*)(mallocStartAddr + 59392);
-uint32_t* tDefaultSong = (uint32_t*)(mallocStartAddr + 61440);
-uint32_t* tDekuShield = (uint32_t*)(mallocStartAddr + 63488);
-uint32_t* tDungeonMap = (uint32_t*)(mallocStartAddr + 65536);
-uint32_t* tEponaSong = (uint32_t*)(mallocStartAddr + 67584);
-uint32_t* tEyedrops = (uint32_t*)(mallocStartAddr + 69632);
-uint32_t* tFireMed = (uint32_t*)(mallocStartAddr + 71680);
-uint32_t* tForestMed = (uint32_t*)(mallocStartAddr + 73728);
-uint32_t* tFrog = (uint32_t*)(mallocStartAddr + 75776);
-uint32_t* tGerudoCard = (uint32_t*)(mallocStartAddr + 77824);
-uint32_t* tGerudoMask = (uint32_t*)(mallocStartAddr + 79872);
-uint32_t* tGiantWallet = (uint32_t*)(mallocStartAddr + 81920);
-uint32_t* tGoldGauntlet = (uint32_t*)(mallocStartAddr + 83968);
-uint32_t* tGoldenScale = (uint32_t*)(mallocStartAddr + 86016);
-uint32_t* tGoldSkulltula = (uint32_t*)(mallocStartAddr + 88064);
-uint32_t* tGoronBracelet = (uint32_t*)(mallocStartAddr + 90112);
-uint32_t* tGoronMask = (uint32_t*)(mallocStartAddr + 92160);
-uint32_t* tGoronRuby = (uint32_t*)(mallocStartAddr + 94208);
-uint32_t* tGoronTunic = (uint32_t*)(mallocStartAddr + 96256);
-uint32_t* tHeartContainer = (uint32_t*)(mallocStartAddr + 98304);
-uint32_t* tHeartPiece = (uint32_t*)(mallocStartAddr + 100352);
-uint32_t* tHoverBoots = (uint32_t*)(mallocStartAddr + 102400);
-uint32_t* tHylianShield = (uint32_t*)(mallocStartAddr + 104448);
-uint32_t* tIronBoots = (uint32_t*)(mallocStartAddr + 106496);
-uint32_t* tKeatonMask = (uint32_t*)(mallocStartAddr + 108544);
-uint32_t* tKeys = (uint32_t*)(mallocStartAddr + 110592);
-uint32_t* tKokiriBoots = (uint32_t*)(mallocStartAddr + 112640);
-uint32_t* tKokiriEmerald = (uint32_t*)(mallocStartAddr + 114688);
-uint32_t* tKokiriSword = (uint32_t*)(mallocStartAddr + 116736);
-uint32_t* tLens = (uint32_t*)(mallocStartAddr + 118784);
-uint32_t* tLightMed = (uint32_t*)(mallocStartAddr + 120832);
-uint32_t* tLullaby = (uint32_t*)(mallocStartAddr + 122880);
-uint32_t* tMasterSword = (uint32_t*)(mallocStartAddr + 124928);
-uint32_t* tMinuet = (uint32_t*)(mallocStartAddr + 126976);
-uint32_t* tMirrorShield = (uint32_t*)(mallocStartAddr + 129024);
-uint32_t* tOcarinaFairy = (uint32_t*)(mallocStartAddr + 131072);
-uint32_t* tOcarinaTime = (uint32_t*)(mallocStartAddr + 133120);
-uint32_t* tOddMushroom = (uint32_t*)(mallocStartAddr + 135168);
-uint32_t* tPoacherSaw = (uint32_t*)(mallocStartAddr + 137216);
-uint32_t* tPocketCucco = (uint32_t*)(mallocStartAddr + 139264);
-uint32_t* tPocketEgg = (uint32_t*)(mallocStartAddr + 141312);
-uint32_t* tPrelude = (uint32_t*)(mallocStartAddr + 143360);
-uint32_t* tPrescription = (uint32_t*)(mallocStartAddr + 145408);
-uint32_t* tQuiver30 = (uint32_t*)(mallocStartAddr + 147456);
-uint32_t* tQuiver40 = (uint32_t*)(mallocStartAddr + 149504);
-uint32_t* tQuiver50 = (uint32_t*)(mallocStartAddr + 151552);
-uint32_t* tSariaSong = (uint32_t*)(mallocStartAddr + 153600);
-uint32_t* tSerenade = (uint32_t*)(mallocStartAddr + 155648);
-uint32_t* tShadowMed = (uint32_t*)(mallocStartAddr + 157696);
-uint32_t* tSilverGauntlets = (uint32_t*)(mallocStartAddr + 159744);
-uint32_t* tSilverScale = (uint32_t*)(mallocStartAddr + 161792);
-uint32_t* tSpiritMed = (uint32_t*)(mallocStartAddr + 163840);
-uint32_t* tStormsSong = (uint32_t*)(mallocStartAddr + 165888);
-uint32_t* tSunSong = (uint32_t*)(mallocStartAddr + 167936);
-uint32_t* tSongTime = (uint32_t*)(mallocStartAddr + 169984);
-uint32_t* tMaskTruth = (uint32_t*)(mallocStartAddr + 172032);
-uint32_t* tWaterMed = (uint32_t*)(mallocStartAddr + 174080);
-uint32_t* tZoraSapphire = (uint32_t*)(mallocStartAddr + 176128);
-uint32_t* tZoraTunic = (uint32_t*)(mallocStartAddr + 178176);
-uint32_t* tRedBox = (uint32_t*)(mallocStartAddr + 180224);
-uint32_t* tLongBlackBox = (uint32_t*)(mallocStartAddr + 182272);
-uint32_t* tDpad3 = (uint32_t*)(mallocStartAddr + 184320);
-uint32_t* tDpad2 = (uint32_t*)(mallocStartAddr + 186368);
-uint32_t* tDpad1 = (uint32_t*)(mallocStartAddr + 188416);
-uint32_t* tDpad0 = (uint32_t*)(mallocStartAddr + 190464);
-uint32_t* tBlackBox = (uint32_t*)(mallocStartAddr + 192512);
-uint32_t* tDekuStick = (uint32_t*)(mallocStartAddr + 194560);
-uint32_t* tDekuNuts = (uint32_t*)(mallocStartAddr + 196608);
-uint32_t* tBombs = (uint32_t*)(mallocStartAddr + 198656);
-uint32_t* tBow = (uint32_t*)(mallocStartAddr + 200704);
-uint32_t* tFireArrow = (uint32_t*)(mallocStartAddr + 202752);
-uint32_t* tDin = (uint32_t*)(mallocStartAddr + 204800);
-uint32_t* tSlingshot = (uint32_t*)(mallocStartAddr + 206848);
-uint32_t* tBombchu = (uint32_t*)(mallocStartAddr + 208896);
-uint32_t* tHookshot = (uint32_t*)(mallocStartAddr + 210944);
-uint32_t* tLongshot = (uint32_t*)(mallocStartAddr + 212992);
-uint32_t* tIceArrow = (uint32_t*)(mallocStartAddr + 215040);
-uint32_t* tFarore = (uint32_t*)(mallocStartAddr + 217088);
-uint32_t* tBoomerang = (uint32_t*)(mallocStartAddr + 219136);
-uint32_t* tHammer = (uint32_t*)(mallocStartAddr + 221184);
-uint32_t* tLightArrows = (uint32_t*)(mallocStartAddr + 223232);
-uint32_t* tNayru = (uint32_t*)(mallocStartAddr + 225280);
-uint32_t* tEmptyBottle = (uint32_t*)(mallocStartAddr + 227328);
-uint32_t* tFairyBottle = (uint32_t*)(mallocStartAddr + 229376);
-uint32_t* tRedBottle = (uint32_t*)(mallocStartAddr + 231424);
-uint32_t* tGreenBottle = (uint32_t*)(mallocStartAddr + 233472);
-uint32_t* tBlueBottle = (uint32_t*)(mallocStartAddr + 235520);
-uint32_t* tMilkBottle = (uint32_t*)(mallocStartAddr + 237568);
-uint32_t* tFishBottle = (uint32_t*)(mallocStartAddr + 239616);
+#define NUM_TEXTURES 461
+#define NUM_RESIDENT_TEXTURES 34 // TEX_ ids below this are resident
+#define NO_TLUT 0xFFFF
+#define ICON_NONE 0xFFFF
+#define NUM_TLUT_TINTS 3 // An atlas TLUT's tinted variants follow it
+#define TLUT_TINT_NORMAL 0
+#define TLUT_TINT_GREYED 1
+#define TLUT_TINT_HIGHLIGHTED 2
+#define ALL_TEXTURES_SIZE 0x1CBA8
+#define RESIDENT_TEXTURES_SIZE 0x39F8 // Leading part of AllTextures, embedded below
+#define TEXTURES_PACK_VERSION 1 // texturePack.h format of AllTextures
 
-#endif
-
-void writeTexture(uint32_t* addr, uint32_t size, uint32_t* data) {
-	for (int o = 0; o < size; o++) {
-		addr[o] = data[o];
-	}
-}
-
-// Either crashes or textures don't seem to load correctly
-// We initialize too many temp vars here and run into a similar issue to simply having the textures loaded in the hardware way
-void loadTextures() {
-    #ifndef hardware
-    uint32_t tBig[] = dBiggoron;
-    writeTexture(tBiggoron, 512, tBig); 
-
-    uint32_t tHov[] = dHoverBoots;
-    writeTexture(tHoverBoots, 512, tHov);
-
-    uint32_t tHyl[] = dHylianShield;
-    writeTexture(tHylianShield, 512, tHyl);
-
-    uint32_t tIro[] = dIronBoots;
-    writeTexture(tIronBoots, 512, tIro);
-
-    uint32_t tKbo[] = dKokiriBoots;
-    writeTexture(tKokiriBoots, 512, tKbo);
-
-    uint32_t tKsd[] = dKokiriSword;
-    writeTexture(tKokiriSword, 512, tKsd);
-
-    uint32_t tMsd[] = dMasterSword;
-    writeTexture(tMasterSword, 512, tMsd);
-
-    uint32_t tMid[] = dMirrorShield;
-    writeTexture(tMirrorShield, 512, tMsd);
-
-    uint32_t tOot[] = dOcarinaTime;
-    writeTexture(tOcarinaTime, 512, tOot);
-
-    uint32_t tZot[] = dZoraTunic;
-    writeTexture(tZoraTunic, 512, tZot);
-
-    writeTexture(tRedBox, 512, tHyl);
-    writeTexture(tLongBlackBox, 512, tHyl);
-    writeTexture(tDpad3, 512, tHyl);
-    writeTexture(tDpad2, 512, tHyl);
-    writeTexture(tDpad1, 512, tHyl);
-    writeTexture(tDpad0, 512, tHyl);
-    writeTexture(tBlackBox, 512, tHyl);
-
-    //volatile uint32_t tRbx[] = dRedBox;
-    //writeTexture(tRedBox, 512, tRbx);
-    //writeTexture(tRedBox + (512 * 4), 512, tRbx);
-
-    /*uint32_t tLbb[] = dLongBlackBox;
-    writeTexture(tLongBlackBox, 512, tLbb);
-    writeTexture(&tLongBlackBox[512], 512, tLbb);
-
-    uint32_t tDp3[] = dDpad3;
-    writeTexture(tDpad3, 512, tDp3);
-    writeTexture(&tDpad3[512], 512, tDp3);
-
-    uint32_t tDp2[] = dDpad2;
-    writeTexture(tDpad2, 512, tDp2);
-    writeTexture(&tDpad2[512], 512, tDp2);
-
-    uint32_t tDp1[] = dDpad1;
-    writeTexture(tDpad1, 512, tDp1);
-    writeTexture(&tDpad1[512], 512, tDp1);
+const textureInfo_t textureInfo[NUM_TEXTURES] = {
+	{ 0x00020, 64, 32, 2, 0, TEX_DPAD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dpad.tex
+	{ 0x00420, 64, 32, 2, 0, TEX_DPAD_BASE_BOTTOM_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dpad_base_bottom.tex
+	{ 0x00820, 64, 32, 2, 0, TEX_DPAD_BASE_TOP_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dpad_base_top.tex
+	{ 0x00C20, 64, 32, 2, 0, TEX_DPAD_TOP_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dpad_top.tex
+	{ 0x01020, 64, 16, 3, 1, NO_TLUT, { 0x00, 0x00, 0x00 }, TEXTURE_SOURCE_PACK }, // IA8 longblac.tex
+	{ 0x01420, 32, 32, 3, 1, NO_TLUT, { 0xFF, 0x00, 0x00 }, TEXTURE_SOURCE_PACK }, // IA8 red.tex
+	{ 0x01820, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 dpad.tlut
+	{ 0x01840, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 dpad_base_bottom.tlut
+	{ 0x01860, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 dpad_base_top.tlut
+	{ 0x01880, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 dpad_top.tlut
+	{ 0x018A0, 64, 32, 2, 0, TEX_ATLAS_PROJECTILE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 atlas/ATLAS_PROJECTILE_0.tex
+	{ 0x01CA0, 128, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_PROJECTILE_TLUT.tlut
+	{ 0x01DA0, 128, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_PROJECTILE_TLUT_GREYED.tlut
+	{ 0x01EA0, 128, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_PROJECTILE_TLUT_HIGHLIGHTED.tlut
+	{ 0x01FA0, 64, 32, 2, 0, TEX_ATLAS_WEAPON_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 atlas/ATLAS_WEAPON_0.tex
+	{ 0x023A0, 96, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_WEAPON_TLUT.tlut
+	{ 0x02460, 96, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_WEAPON_TLUT_GREYED.tlut
+	{ 0x02520, 96, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_WEAPON_TLUT_HIGHLIGHTED.tlut
+	{ 0x025E0, 64, 32, 2, 0, TEX_ATLAS_ARMOR_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 atlas/ATLAS_ARMOR_0.tex
+	{ 0x029E0, 96, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_ARMOR_TLUT.tlut
+	{ 0x02AA0, 96, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_ARMOR_TLUT_GREYED.tlut
+	{ 0x02B60, 96, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_ARMOR_TLUT_HIGHLIGHTED.tlut
+	{ 0x02C20, 64, 32, 2, 0, TEX_ATLAS_HAND_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 atlas/ATLAS_HAND_0.tex
+	{ 0x03020, 80, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_HAND_TLUT.tlut
+	{ 0x030C0, 80, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_HAND_TLUT_GREYED.tlut
+	{ 0x03160, 80, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_HAND_TLUT_HIGHLIGHTED.tlut
+	{ 0x03200, 64, 16, 2, 0, TEX_ATLAS_MAGIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 atlas/ATLAS_MAGIC_0.tex
+	{ 0x03400, 48, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_MAGIC_TLUT.tlut
+	{ 0x03460, 48, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_MAGIC_TLUT_GREYED.tlut
+	{ 0x034C0, 48, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_MAGIC_TLUT_HIGHLIGHTED.tlut
+	{ 0x03520, 64, 16, 2, 1, TEX_ATLAS_BOTTLE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 atlas/ATLAS_BOTTLE_0.tex
+	{ 0x03920, 33, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_BOTTLE_TLUT.tlut
+	{ 0x03968, 33, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_BOTTLE_TLUT_GREYED.tlut
+	{ 0x039B0, 33, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 atlas/ATLAS_BOTTLE_TLUT_HIGHLIGHTED.tlut
+	{ 0x039F8, 32, 32, 2, 0, TEX_BLUE_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Blue Potion.tex
+	{ 0x03BF8, 32, 32, 2, 0, TEX_BOMB_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bomb.tex
+	{ 0x03DF8, 32, 32, 2, 0, TEX_BOMBCHU_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bombchu.tex
+	{ 0x03FF8, 32, 32, 2, 0, TEX_BOOMERANG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Boomerang.tex
+	{ 0x041F8, 32, 32, 2, 0, TEX_BOTTLED_FAIRY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottled Fairy.tex
+	{ 0x043F8, 32, 32, 2, 0, TEX_BOTTLES_BIG_POE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Big Poe.tex
+	{ 0x045F8, 32, 32, 2, 0, TEX_BOTTLES_BLUE_FIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Blue Fire.tex
+	{ 0x039F8, 32, 32, 2, 0, TEX_BOTTLES_BLUE_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Blue Potion.tex, data of Blue Potion.tex
+	{ 0x041F8, 32, 32, 2, 0, TEX_BOTTLES_BOTTLED_FAIRY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Bottled Fairy.tex, data of Bottled Fairy.tex
+	{ 0x047F8, 32, 32, 2, 0, TEX_BOTTLES_BUG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Bug.tex
+	{ 0x049F8, 32, 32, 2, 1, TEX_BOTTLES_EMPTY_BOTTLE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 Bottles/Empty Bottle.tex
+	{ 0x04DF8, 32, 32, 2, 0, TEX_BOTTLES_FISH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Fish.tex
+	{ 0x04FF8, 32, 32, 2, 0, TEX_BOTTLES_GREEN_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Green Potion.tex
+	{ 0x051F8, 32, 32, 2, 0, TEX_BOTTLES_MILK_FULL_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Milk (full).tex
+	{ 0x053F8, 32, 32, 2, 0, TEX_BOTTLES_MILK_HALF_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Milk (half).tex
+	{ 0x055F8, 32, 32, 2, 0, TEX_BOTTLES_POE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Poe.tex
+	{ 0x057F8, 32, 32, 2, 0, TEX_BOTTLES_RED_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Red Potion.tex
+	{ 0x059F8, 32, 32, 2, 0, TEX_BOTTLES_RUTOS_LETTER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Ruto's Letter.tex
+	{ 0x05BF8, 32, 32, 2, 0, TEX_CLOTHING_GORON_TUNIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Goron Tunic.tex
+	{ 0x05DF8, 32, 32, 2, 0, TEX_CLOTHING_HOVER_BOOTS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Hover Boots.tex
+	{ 0x05FF8, 32, 32, 2, 0, TEX_CLOTHING_IRON_BOOTS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Iron Boots.tex
+	{ 0x061F8, 32, 32, 2, 0, TEX_CLOTHING_KOKIRI_BOOTS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Kokiri Boots.tex
+	{ 0x063F8, 32, 32, 2, 0, TEX_CLOTHING_KOKIRI_TUNIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Kokiri Tunic.tex
+	{ 0x065F8, 32, 32, 2, 0, TEX_CLOTHING_ZORA_TUNIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Zora Tunic.tex
+	{ 0x067F8, 32, 32, 2, 0, TEX_DEKU_NUT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Deku Nut.tex
+	{ 0x069F8, 32, 32, 2, 0, TEX_DINS_FIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Din's Fire.tex
+	{ 0x06BF8, 32, 32, 2, 0, TEX_DUNGEON_BOSS_KEY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Boss Key.tex
+	{ 0x06DF8, 32, 32, 2, 0, TEX_DUNGEON_COMPASS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Compass.tex
+	{ 0x06FF8, 32, 32, 2, 0, TEX_DUNGEON_DUNGEON_MAP_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Dungeon Map.tex
+	{ 0x071F8, 32, 32, 2, 0, TEX_DUNGEON_SMALL_KEY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Small Key.tex
+	{ 0x049F8, 32, 32, 2, 1, TEX_EMPTY_BOTTLE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 Empty Bottle.tex, data of Bottles/Empty Bottle.tex
+	{ 0x073F8, 32, 32, 2, 0, TEX_EQUIPMENT_BIGGORON_SWORD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Biggoron Sword.tex
+	{ 0x075F8, 32, 32, 2, 0, TEX_EQUIPMENT_DEKU_SHIELD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Deku Shield.tex
+	{ 0x077F8, 32, 32, 2, 0, TEX_EQUIPMENT_GIANTS_KNIFE_BROKEN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Giant's Knife (broken).tex
+	{ 0x079F8, 32, 32, 2, 0, TEX_EQUIPMENT_HYLIAN_SHIELD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Hylian Shield.tex
+	{ 0x07BF8, 32, 32, 2, 0, TEX_EQUIPMENT_KOKIRI_SWORD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Kokiri Sword.tex
+	{ 0x07DF8, 32, 32, 2, 0, TEX_EQUIPMENT_MASTER_SWORD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Master Sword.tex
+	{ 0x07FF8, 32, 32, 2, 0, TEX_EQUIPMENT_MIRROR_SHIELD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Mirror Shield.tex
+	{ 0x081F8, 32, 32, 2, 0, TEX_FAIRY_BOW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fairy Bow.tex
+	{ 0x083F8, 32, 32, 2, 0, TEX_FAIRY_SLINGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fairy Slingshot.tex
+	{ 0x085F8, 32, 32, 2, 0, TEX_FARORES_WIND_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Farore's Wind.tex
+	{ 0x087F8, 32, 32, 2, 0, TEX_FIRE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fire Arrow.tex
+	{ 0x04DF8, 32, 32, 2, 0, TEX_FISH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fish.tex, data of Bottles/Fish.tex
+	{ 0x04FF8, 32, 32, 2, 0, TEX_GREEN_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Green Potion.tex, data of Bottles/Green Potion.tex
+	{ 0x03BF8, 32, 32, 2, 0, TEX_HAND_BOMB_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Bomb.tex, data of Bomb.tex
+	{ 0x03DF8, 32, 32, 2, 0, TEX_HAND_BOMBCHU_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Bombchu.tex, data of Bombchu.tex
+	{ 0x067F8, 32, 32, 2, 0, TEX_HAND_DEKU_NUT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Deku Nut.tex, data of Deku Nut.tex
+	{ 0x089F8, 32, 32, 2, 0, TEX_HAND_MEGATON_HAMMER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Megaton Hammer.tex
+	{ 0x08BF8, 32, 32, 2, 0, TEX_HAND_DEKUSTICK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/dekustick.tex
+	{ 0x08DF8, 32, 32, 2, 0, TEX_HOOKSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hookshot.tex
+	{ 0x08FF8, 32, 32, 2, 0, TEX_ICE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Ice Arrow.tex
+	{ 0x091F8, 64, 16, 2, 1, TEX_ITEM_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 Item.tex
+	{ 0x095F8, 32, 32, 2, 0, TEX_LIGHT_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Light Arrow.tex
+	{ 0x097F8, 32, 32, 2, 0, TEX_LONGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Longshot.tex
+	{ 0x069F8, 32, 32, 2, 0, TEX_MAGIC_DINS_FIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Magic/Din's Fire.tex, data of Din's Fire.tex
+	{ 0x085F8, 32, 32, 2, 0, TEX_MAGIC_FARORES_WIND_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Magic/Farore's Wind.tex, data of Farore's Wind.tex
+	{ 0x099F8, 32, 32, 2, 0, TEX_MAGIC_NAYRUS_LOVE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Magic/Nayru's Love.tex
+	{ 0x089F8, 32, 32, 2, 0, TEX_MEGATON_HAMMER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Megaton Hammer.tex, data of Hand/Megaton Hammer.tex
+	{ 0x051F8, 32, 32, 2, 0, TEX_MILK_FULL_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Milk (full).tex, data of Bottles/Milk (full).tex
+	{ 0x099F8, 32, 32, 2, 0, TEX_NAYRUS_LOVE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Nayru's Love.tex, data of Magic/Nayru's Love.tex
+	{ 0x09BF8, 32, 32, 2, 0, TEX_OTHER_BUNNY_HOOD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Bunny Hood.tex
+	{ 0x09DF8, 32, 32, 2, 0, TEX_OTHER_CLAIM_CHECK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Claim Check.tex
+	{ 0x09FF8, 32, 32, 2, 0, TEX_OTHER_COJIRO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Cojiro.tex
+	{ 0x0A1F8, 32, 32, 2, 0, TEX_OTHER_CUCCO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Cucco.tex
+	{ 0x0A3F8, 32, 32, 2, 0, TEX_OTHER_EYE_BALL_FROG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Eye Ball Frog.tex
+	{ 0x0A5F8, 32, 32, 2, 0, TEX_OTHER_EYE_DROPS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Eye Drops.tex
+	{ 0x0A7F8, 32, 32, 2, 0, TEX_OTHER_FAIRY_OCARINA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Fairy Ocarina.tex
+	{ 0x0A9F8, 32, 32, 2, 0, TEX_OTHER_GERUDO_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Gerudo Mask.tex
+	{ 0x0ABF8, 32, 32, 2, 0, TEX_OTHER_GORON_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Goron Mask.tex
+	{ 0x0ADF8, 32, 32, 2, 0, TEX_OTHER_GORONS_SWORD_BROKEN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Goron's Sword (broken).tex
+	{ 0x0AFF8, 32, 32, 2, 0, TEX_OTHER_KEATON_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Keaton Mask.tex
+	{ 0x0B1F8, 32, 32, 2, 0, TEX_OTHER_LENS_OF_TRUTH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Lens of Truth.tex
+	{ 0x0B3F8, 32, 32, 2, 0, TEX_OTHER_MAGIC_BEANS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Magic Beans.tex
+	{ 0x0B5F8, 32, 32, 2, 0, TEX_OTHER_MASK_OF_TRUTH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Mask of Truth.tex
+	{ 0x0B7F8, 32, 32, 2, 0, TEX_OTHER_OCARINA_OF_TIME_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Ocarina of Time.tex
+	{ 0x0B9F8, 32, 32, 2, 0, TEX_OTHER_ODD_MUSHROOM_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Odd Mushroom.tex
+	{ 0x0BBF8, 32, 32, 2, 0, TEX_OTHER_ODD_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Odd Potion.tex
+	{ 0x0BDF8, 32, 32, 2, 0, TEX_OTHER_POACHERS_SAW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Poacher's Saw.tex
+	{ 0x0A1F8, 32, 32, 2, 0, TEX_OTHER_POCKET_CUCCO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Pocket Cucco.tex, data of Other/Cucco.tex
+	{ 0x0BFF8, 32, 32, 2, 0, TEX_OTHER_POCKET_EGG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Pocket Egg.tex
+	{ 0x0C1F8, 32, 32, 2, 0, TEX_OTHER_PRESCRIPTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Prescription.tex
+	{ 0x0C3F8, 32, 32, 2, 0, TEX_OTHER_SOLD_OUT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/SOLD OUT.tex
+	{ 0x0C5F8, 32, 32, 2, 0, TEX_OTHER_SKULL_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Skull Mask.tex
+	{ 0x0C7F8, 32, 32, 2, 0, TEX_OTHER_SPOOKY_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Spooky Mask.tex
+	{ 0x0BFF8, 32, 32, 2, 0, TEX_OTHER_WEIRD_EGG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Weird Egg.tex, data of Other/Pocket Egg.tex
+	{ 0x0C9F8, 32, 32, 2, 0, TEX_OTHER_ZELDAS_LETTER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Zelda's Letter.tex
+	{ 0x0CBF8, 32, 32, 2, 0, TEX_OTHER_ZORA_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Zora Mask.tex
+	{ 0x03FF8, 32, 32, 2, 0, TEX_PROJECTILE_BOOMERANG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Boomerang.tex, data of Boomerang.tex
+	{ 0x081F8, 32, 32, 2, 0, TEX_PROJECTILE_FAIRY_BOW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Fairy Bow.tex, data of Fairy Bow.tex
+	{ 0x083F8, 32, 32, 2, 0, TEX_PROJECTILE_FAIRY_SLINGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Fairy Slingshot.tex, data of Fairy Slingshot.tex
+	{ 0x087F8, 32, 32, 2, 0, TEX_PROJECTILE_FIRE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Fire Arrow.tex, data of Fire Arrow.tex
+	{ 0x08DF8, 32, 32, 2, 0, TEX_PROJECTILE_HOOKSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Hookshot.tex, data of Hookshot.tex
+	{ 0x08FF8, 32, 32, 2, 0, TEX_PROJECTILE_ICE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Ice Arrow.tex, data of Ice Arrow.tex
+	{ 0x095F8, 32, 32, 2, 0, TEX_PROJECTILE_LIGHT_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Light Arrow.tex, data of Light Arrow.tex
+	{ 0x097F8, 32, 32, 2, 0, TEX_PROJECTILE_LONGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Longshot.tex, data of Longshot.tex
+	{ 0x0CDF8, 32, 32, 2, 0, TEX_QUEST_FIRE_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Fire Medallion.tex
+	{ 0x0CFF8, 32, 32, 2, 0, TEX_QUEST_FOREST_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Forest Medallion.tex
+	{ 0x0D1F8, 32, 32, 2, 0, TEX_QUEST_GERUDOS_CARD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Gerudo's Card.tex
+	{ 0x0D3F8, 32, 32, 2, 0, TEX_QUEST_GOLD_SKULLTULA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Gold Skulltula.tex
+	{ 0x0D5F8, 32, 32, 2, 0, TEX_QUEST_GORONS_RUBY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Goron's Ruby.tex
+	{ 0x0D7F8, 32, 32, 2, 0, TEX_QUEST_HEART_CONTAINER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Heart Container.tex
+	{ 0x0D9F8, 32, 32, 2, 0, TEX_QUEST_KOKIRIS_EMERALD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Kokiri's Emerald.tex
+	{ 0x0DBF8, 32, 32, 2, 0, TEX_QUEST_LIGHT_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Light Medallion.tex
+	{ 0x0DDF8, 32, 32, 2, 0, TEX_QUEST_PIECE_OF_HEART_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Piece of Heart.tex
+	{ 0x0DFF8, 32, 32, 2, 0, TEX_QUEST_SHADOW_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Shadow Medallion.tex
+	{ 0x0E1F8, 32, 32, 2, 0, TEX_QUEST_SPIRIT_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Spirit Medallion.tex
+	{ 0x0E3F8, 32, 32, 2, 0, TEX_QUEST_STONE_OF_AGONY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Stone of Agony.tex
+	{ 0x0E5F8, 32, 32, 2, 0, TEX_QUEST_WATER_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Water Medallion.tex
+	{ 0x0E7F8, 32, 32, 2, 0, TEX_QUEST_ZORAS_SAPPHIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Zora's Sapphire.tex
+	{ 0x057F8, 32, 32, 2, 0, TEX_RED_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Red Potion.tex, data of Bottles/Red Potion.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_BOLERO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Bolero.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_MINUET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Minuet.tex, data of Songs/Bolero.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_PRELUDE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Prelude.tex, data of Songs/Bolero.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_SERENADE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Serenade.tex, data of Songs/Bolero.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_SHADOW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Shadow.tex, data of Songs/Bolero.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_SPIRIT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Spirit.tex, data of Songs/Bolero.tex
+	{ 0x0EBF8, 32, 32, 2, 0, TEX_SONGS_ZELDATILE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/ZeldaTile.tex
+	{ 0x0E9F8, 32, 32, 2, 0, TEX_SONGS_TILE146_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tile146.tex, data of Songs/Bolero.tex
+	{ 0x0EDF8, 32, 32, 2, 0, TEX_SONGS_TILEEPONA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileEpona.tex
+	{ 0x0EFF8, 32, 32, 2, 0, TEX_SONGS_TILESARIA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileSaria.tex
+	{ 0x0F1F8, 32, 32, 2, 0, TEX_SONGS_TILESTORMS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileStorms.tex
+	{ 0x0F3F8, 32, 32, 2, 0, TEX_SONGS_TILESUN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileSun.tex
+	{ 0x0F5F8, 32, 32, 2, 0, TEX_SONGS_TILETIME_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileTime.tex
+	{ 0x0F7F8, 32, 32, 2, 0, TEX_UPGRADES_ADULTS_WALLET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Adult's Wallet.tex
+	{ 0x0F9F8, 32, 32, 2, 0, TEX_UPGRADES_BOMB_BAG_20_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bomb Bag (20).tex
+	{ 0x0FBF8, 32, 32, 2, 0, TEX_UPGRADES_BOMB_BAG_30_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bomb Bag (30).tex
+	{ 0x0FDF8, 32, 32, 2, 0, TEX_UPGRADES_BOMB_BAG_40_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bomb Bag (40).tex
+	{ 0x0FFF8, 32, 32, 2, 0, TEX_UPGRADES_BULLET_BAG_30_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bullet Bag (30).tex
+	{ 0x101F8, 32, 32, 2, 0, TEX_UPGRADES_BULLET_BAG_40_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bullet Bag (40).tex
+	{ 0x103F8, 32, 32, 2, 0, TEX_UPGRADES_BULLET_BAG_50_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bullet Bag (50).tex
+	{ 0x105F8, 32, 32, 2, 0, TEX_UPGRADES_GIANTS_WALLET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Giant's Wallet.tex
+	{ 0x107F8, 32, 32, 2, 0, TEX_UPGRADES_GOLDEN_GAUNTLETS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Golden Gauntlets.tex
+	{ 0x109F8, 32, 32, 2, 0, TEX_UPGRADES_GOLDEN_SCALE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Golden Scale.tex
+	{ 0x10BF8, 32, 32, 2, 0, TEX_UPGRADES_GORONS_BRACELET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Goron's Bracelet.tex
+	{ 0x10DF8, 32, 32, 2, 0, TEX_UPGRADES_QUIVER_30_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Quiver (30).tex
+	{ 0x10FF8, 32, 32, 2, 0, TEX_UPGRADES_QUIVER_40_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Quiver (40).tex
+	{ 0x111F8, 32, 32, 2, 0, TEX_UPGRADES_QUIVER_50_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Quiver (50).tex
+	{ 0x113F8, 32, 32, 2, 0, TEX_UPGRADES_SILVER_GAUNTLETS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Silver Gauntlets.tex
+	{ 0x115F8, 32, 32, 2, 0, TEX_UPGRADES_SILVER_SCALE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Silver Scale.tex
+	{ 0x117F8, 32, 32, 4, 0, NO_TLUT, { 0x00, 0x00, 0x00 }, TEXTURE_SOURCE_PACK }, // I4 black.tex
+	{ 0x08BF8, 32, 32, 2, 0, TEX_DEKUSTICK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dekustick.tex, data of Hand/dekustick.tex
+	{ 0x00C20, 64, 32, 2, 0, TEX_DPAD_BOTTOM_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dpad_bottom.tex, data of dpad_top.tex
+	{ 0x119F8, 64, 16, 2, 1, TEX_OPEN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 open.tex
+	{ 0x11DF8, 32, 32, 4, 0, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // I4 white.tex
+	{ 0x11FF8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Blue Potion.tlut
+	{ 0x12018, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bomb.tlut
+	{ 0x12038, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bombchu.tlut
+	{ 0x12058, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Boomerang.tlut
+	{ 0x12078, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottled Fairy.tlut
+	{ 0x12098, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Big Poe.tlut
+	{ 0x120B8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Blue Fire.tlut
+	{ 0x11FF8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Blue Potion.tlut, data of Blue Potion.tlut
+	{ 0x12078, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Bottled Fairy.tlut, data of Bottled Fairy.tlut
+	{ 0x120D8, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Bug.tlut
+	{ 0x120F8, 79, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Empty Bottle.tlut
+	{ 0x12198, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Fish.tlut
+	{ 0x121B8, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Green Potion.tlut
+	{ 0x121D8, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Milk (full).tlut
+	{ 0x121F8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Milk (half).tlut
+	{ 0x12218, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Poe.tlut
+	{ 0x12238, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Red Potion.tlut
+	{ 0x12258, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Bottles/Ruto's Letter.tlut
+	{ 0x12278, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Clothing/Goron Tunic.tlut
+	{ 0x12298, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Clothing/Hover Boots.tlut
+	{ 0x122B8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Clothing/Iron Boots.tlut
+	{ 0x122D8, 12, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Clothing/Kokiri Boots.tlut
+	{ 0x122F0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Clothing/Kokiri Tunic.tlut
+	{ 0x12310, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Clothing/Zora Tunic.tlut
+	{ 0x12330, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Deku Nut.tlut
+	{ 0x12350, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Din's Fire.tlut
+	{ 0x12370, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Dungeon/Boss Key.tlut
+	{ 0x12390, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Dungeon/Compass.tlut
+	{ 0x123B0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Dungeon/Dungeon Map.tlut
+	{ 0x123D0, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Dungeon/Small Key.tlut
+	{ 0x120F8, 79, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Empty Bottle.tlut, data of Bottles/Empty Bottle.tlut
+	{ 0x123F0, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Biggoron Sword.tlut
+	{ 0x12410, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Deku Shield.tlut
+	{ 0x12430, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Giant's Knife (broken).tlut
+	{ 0x12450, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Hylian Shield.tlut
+	{ 0x12470, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Kokiri Sword.tlut
+	{ 0x12490, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Master Sword.tlut
+	{ 0x124B0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Equipment/Mirror Shield.tlut
+	{ 0x124D0, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Fairy Bow.tlut
+	{ 0x124F0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Fairy Slingshot.tlut
+	{ 0x12510, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Farore's Wind.tlut
+	{ 0x12530, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Fire Arrow.tlut
+	{ 0x12198, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Fish.tlut, data of Bottles/Fish.tlut
+	{ 0x121B8, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Green Potion.tlut, data of Bottles/Green Potion.tlut
+	{ 0x12018, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Hand/Bomb.tlut, data of Bomb.tlut
+	{ 0x12038, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Hand/Bombchu.tlut, data of Bombchu.tlut
+	{ 0x12330, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Hand/Deku Nut.tlut, data of Deku Nut.tlut
+	{ 0x12550, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Hand/Megaton Hammer.tlut
+	{ 0x12570, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Hand/dekustick.tlut
+	{ 0x12590, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Hookshot.tlut
+	{ 0x125B0, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Ice Arrow.tlut
+	{ 0x125D0, 18, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Item.tlut
+	{ 0x125F8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Light Arrow.tlut
+	{ 0x12618, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Longshot.tlut
+	{ 0x12350, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Magic/Din's Fire.tlut, data of Din's Fire.tlut
+	{ 0x12510, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Magic/Farore's Wind.tlut, data of Farore's Wind.tlut
+	{ 0x12638, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Magic/Nayru's Love.tlut
+	{ 0x12550, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Megaton Hammer.tlut, data of Hand/Megaton Hammer.tlut
+	{ 0x121D8, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Milk (full).tlut, data of Bottles/Milk (full).tlut
+	{ 0x12638, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Nayru's Love.tlut, data of Magic/Nayru's Love.tlut
+	{ 0x12658, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Bunny Hood.tlut
+	{ 0x12678, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Claim Check.tlut
+	{ 0x12698, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Cojiro.tlut
+	{ 0x126B8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Cucco.tlut
+	{ 0x126D8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Eye Ball Frog.tlut
+	{ 0x126F8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Eye Drops.tlut
+	{ 0x12718, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Fairy Ocarina.tlut
+	{ 0x12738, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Gerudo Mask.tlut
+	{ 0x12758, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Goron Mask.tlut
+	{ 0x12778, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Goron's Sword (broken).tlut
+	{ 0x12798, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Keaton Mask.tlut
+	{ 0x127B8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Lens of Truth.tlut
+	{ 0x127D8, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Magic Beans.tlut
+	{ 0x127F8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Mask of Truth.tlut
+	{ 0x12818, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Ocarina of Time.tlut
+	{ 0x12838, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Odd Mushroom.tlut
+	{ 0x12858, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Odd Potion.tlut
+	{ 0x12878, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Poacher's Saw.tlut
+	{ 0x126B8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Pocket Cucco.tlut, data of Other/Cucco.tlut
+	{ 0x12898, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Pocket Egg.tlut
+	{ 0x128B8, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Prescription.tlut
+	{ 0x128D8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/SOLD OUT.tlut
+	{ 0x128F8, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Skull Mask.tlut
+	{ 0x12918, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Spooky Mask.tlut
+	{ 0x12898, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Weird Egg.tlut, data of Other/Pocket Egg.tlut
+	{ 0x12938, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Zelda's Letter.tlut
+	{ 0x12958, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Other/Zora Mask.tlut
+	{ 0x12058, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Boomerang.tlut, data of Boomerang.tlut
+	{ 0x124D0, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Fairy Bow.tlut, data of Fairy Bow.tlut
+	{ 0x124F0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Fairy Slingshot.tlut, data of Fairy Slingshot.tlut
+	{ 0x12530, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Fire Arrow.tlut, data of Fire Arrow.tlut
+	{ 0x12590, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Hookshot.tlut, data of Hookshot.tlut
+	{ 0x125B0, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Ice Arrow.tlut, data of Ice Arrow.tlut
+	{ 0x125F8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Light Arrow.tlut, data of Light Arrow.tlut
+	{ 0x12618, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Projectile/Longshot.tlut, data of Longshot.tlut
+	{ 0x12978, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Fire Medallion.tlut
+	{ 0x12998, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Forest Medallion.tlut
+	{ 0x129B8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Gerudo's Card.tlut
+	{ 0x129D8, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Gold Skulltula.tlut
+	{ 0x129F8, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Goron's Ruby.tlut
+	{ 0x12A18, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Heart Container.tlut
+	{ 0x12A38, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Kokiri's Emerald.tlut
+	{ 0x12A58, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Light Medallion.tlut
+	{ 0x12A78, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Piece of Heart.tlut
+	{ 0x12A98, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Shadow Medallion.tlut
+	{ 0x12AB8, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Spirit Medallion.tlut
+	{ 0x12AD8, 13, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Stone of Agony.tlut
+	{ 0x12AF8, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Water Medallion.tlut
+	{ 0x12B18, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Quest/Zora's Sapphire.tlut
+	{ 0x12238, 16, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Red Potion.tlut, data of Bottles/Red Potion.tlut
+	{ 0x12B38, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/Bolero.tlut
+	{ 0x12B48, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/Minuet.tlut
+	{ 0x12B58, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/Prelude.tlut
+	{ 0x12B68, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/Serenade.tlut
+	{ 0x12B78, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/Shadow.tlut
+	{ 0x12B88, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/Spirit.tlut
+	{ 0x12B98, 12, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/ZeldaTile.tlut
+	{ 0x12BB0, 5, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/tile146.tlut
+	{ 0x12BC0, 9, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/tileEpona.tlut
+	{ 0x12BD8, 12, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/tileSaria.tlut
+	{ 0x12BF0, 7, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/tileStorms.tlut
+	{ 0x12C00, 7, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/tileSun.tlut
+	{ 0x12C10, 12, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Songs/tileTime.tlut
+	{ 0x12C28, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Adult's Wallet.tlut
+	{ 0x12C48, 12, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Bomb Bag (20).tlut
+	{ 0x12C60, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Bomb Bag (30).tlut
+	{ 0x12C80, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Bomb Bag (40).tlut
+	{ 0x12CA0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Bullet Bag (30).tlut
+	{ 0x12CC0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Bullet Bag (40).tlut
+	{ 0x12CE0, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Bullet Bag (50).tlut
+	{ 0x12D00, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Giant's Wallet.tlut
+	{ 0x12D20, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Golden Gauntlets.tlut
+	{ 0x12D40, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Golden Scale.tlut
+	{ 0x12D60, 12, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Goron's Bracelet.tlut
+	{ 0x12D78, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Quiver (30).tlut
+	{ 0x12D98, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Quiver (40).tlut
+	{ 0x12DB8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Quiver (50).tlut
+	{ 0x12DD8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Silver Gauntlets.tlut
+	{ 0x12DF8, 15, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 Upgrades/Silver Scale.tlut
+	{ 0x12570, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 dekustick.tlut, data of Hand/dekustick.tlut
+	{ 0x01880, 14, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 dpad_bottom.tlut, data of dpad_top.tlut
+	{ 0x12E18, 18, 1, 0, 2, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // RGBA16 open.tlut
+	{ 0x12E40, 16, 16, 2, 0, TEX_BLUE_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Blue Potion_16.tex
+	{ 0x12EC0, 16, 16, 2, 0, TEX_BOMB_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bomb_16.tex
+	{ 0x12F40, 16, 16, 2, 0, TEX_BOMBCHU_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bombchu_16.tex
+	{ 0x12FC0, 16, 16, 2, 0, TEX_BOOMERANG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Boomerang_16.tex
+	{ 0x13040, 16, 16, 2, 0, TEX_BOTTLED_FAIRY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottled Fairy_16.tex
+	{ 0x130C0, 16, 16, 2, 0, TEX_BOTTLES_BIG_POE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Big Poe_16.tex
+	{ 0x13140, 16, 16, 2, 0, TEX_BOTTLES_BLUE_FIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Blue Fire_16.tex
+	{ 0x12E40, 16, 16, 2, 0, TEX_BOTTLES_BLUE_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Blue Potion_16.tex, data of Blue Potion_16.tex
+	{ 0x13040, 16, 16, 2, 0, TEX_BOTTLES_BOTTLED_FAIRY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Bottled Fairy_16.tex, data of Bottled Fairy_16.tex
+	{ 0x131C0, 16, 16, 2, 0, TEX_BOTTLES_BUG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Bug_16.tex
+	{ 0x13240, 16, 16, 2, 1, TEX_BOTTLES_EMPTY_BOTTLE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 Bottles/Empty Bottle_16.tex
+	{ 0x13340, 16, 16, 2, 0, TEX_BOTTLES_FISH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Fish_16.tex
+	{ 0x133C0, 16, 16, 2, 0, TEX_BOTTLES_GREEN_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Green Potion_16.tex
+	{ 0x13440, 16, 16, 2, 0, TEX_BOTTLES_MILK_FULL_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Milk (full)_16.tex
+	{ 0x134C0, 16, 16, 2, 0, TEX_BOTTLES_MILK_HALF_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Milk (half)_16.tex
+	{ 0x13540, 16, 16, 2, 0, TEX_BOTTLES_POE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Poe_16.tex
+	{ 0x135C0, 16, 16, 2, 0, TEX_BOTTLES_RED_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Red Potion_16.tex
+	{ 0x13640, 16, 16, 2, 0, TEX_BOTTLES_RUTOS_LETTER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Bottles/Ruto's Letter_16.tex
+	{ 0x136C0, 16, 16, 2, 0, TEX_CLOTHING_GORON_TUNIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Goron Tunic_16.tex
+	{ 0x13740, 16, 16, 2, 0, TEX_CLOTHING_HOVER_BOOTS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Hover Boots_16.tex
+	{ 0x137C0, 16, 16, 2, 0, TEX_CLOTHING_IRON_BOOTS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Iron Boots_16.tex
+	{ 0x13840, 16, 16, 2, 0, TEX_CLOTHING_KOKIRI_BOOTS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Kokiri Boots_16.tex
+	{ 0x138C0, 16, 16, 2, 0, TEX_CLOTHING_KOKIRI_TUNIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Kokiri Tunic_16.tex
+	{ 0x13940, 16, 16, 2, 0, TEX_CLOTHING_ZORA_TUNIC_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Clothing/Zora Tunic_16.tex
+	{ 0x139C0, 16, 16, 2, 0, TEX_DEKU_NUT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Deku Nut_16.tex
+	{ 0x13A40, 16, 16, 2, 0, TEX_DINS_FIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Din's Fire_16.tex
+	{ 0x13AC0, 16, 16, 2, 0, TEX_DUNGEON_BOSS_KEY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Boss Key_16.tex
+	{ 0x13B40, 16, 16, 2, 0, TEX_DUNGEON_COMPASS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Compass_16.tex
+	{ 0x13BC0, 16, 16, 2, 0, TEX_DUNGEON_DUNGEON_MAP_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Dungeon Map_16.tex
+	{ 0x13C40, 16, 16, 2, 0, TEX_DUNGEON_SMALL_KEY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Dungeon/Small Key_16.tex
+	{ 0x13240, 16, 16, 2, 1, TEX_EMPTY_BOTTLE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI8 Empty Bottle_16.tex, data of Bottles/Empty Bottle_16.tex
+	{ 0x13CC0, 16, 16, 2, 0, TEX_EQUIPMENT_BIGGORON_SWORD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Biggoron Sword_16.tex
+	{ 0x13D40, 16, 16, 2, 0, TEX_EQUIPMENT_DEKU_SHIELD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Deku Shield_16.tex
+	{ 0x13DC0, 16, 16, 2, 0, TEX_EQUIPMENT_GIANTS_KNIFE_BROKEN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Giant's Knife (broken)_16.tex
+	{ 0x13E40, 16, 16, 2, 0, TEX_EQUIPMENT_HYLIAN_SHIELD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Hylian Shield_16.tex
+	{ 0x13EC0, 16, 16, 2, 0, TEX_EQUIPMENT_KOKIRI_SWORD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Kokiri Sword_16.tex
+	{ 0x13F40, 16, 16, 2, 0, TEX_EQUIPMENT_MASTER_SWORD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Master Sword_16.tex
+	{ 0x13FC0, 16, 16, 2, 0, TEX_EQUIPMENT_MIRROR_SHIELD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Equipment/Mirror Shield_16.tex
+	{ 0x14040, 16, 16, 2, 0, TEX_FAIRY_BOW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fairy Bow_16.tex
+	{ 0x140C0, 16, 16, 2, 0, TEX_FAIRY_SLINGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fairy Slingshot_16.tex
+	{ 0x14140, 16, 16, 2, 0, TEX_FARORES_WIND_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Farore's Wind_16.tex
+	{ 0x141C0, 16, 16, 2, 0, TEX_FIRE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fire Arrow_16.tex
+	{ 0x13340, 16, 16, 2, 0, TEX_FISH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Fish_16.tex, data of Bottles/Fish_16.tex
+	{ 0x133C0, 16, 16, 2, 0, TEX_GREEN_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Green Potion_16.tex, data of Bottles/Green Potion_16.tex
+	{ 0x12EC0, 16, 16, 2, 0, TEX_HAND_BOMB_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Bomb_16.tex, data of Bomb_16.tex
+	{ 0x12F40, 16, 16, 2, 0, TEX_HAND_BOMBCHU_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Bombchu_16.tex, data of Bombchu_16.tex
+	{ 0x139C0, 16, 16, 2, 0, TEX_HAND_DEKU_NUT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Deku Nut_16.tex, data of Deku Nut_16.tex
+	{ 0x14240, 16, 16, 2, 0, TEX_HAND_MEGATON_HAMMER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/Megaton Hammer_16.tex
+	{ 0x142C0, 16, 16, 2, 0, TEX_HAND_DEKUSTICK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hand/dekustick_16.tex
+	{ 0x14340, 16, 16, 2, 0, TEX_HOOKSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Hookshot_16.tex
+	{ 0x143C0, 16, 16, 2, 0, TEX_ICE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Ice Arrow_16.tex
+	{ 0x14440, 16, 16, 2, 0, TEX_LIGHT_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Light Arrow_16.tex
+	{ 0x144C0, 16, 16, 2, 0, TEX_LONGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Longshot_16.tex
+	{ 0x13A40, 16, 16, 2, 0, TEX_MAGIC_DINS_FIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Magic/Din's Fire_16.tex, data of Din's Fire_16.tex
+	{ 0x14140, 16, 16, 2, 0, TEX_MAGIC_FARORES_WIND_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Magic/Farore's Wind_16.tex, data of Farore's Wind_16.tex
+	{ 0x14540, 16, 16, 2, 0, TEX_MAGIC_NAYRUS_LOVE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Magic/Nayru's Love_16.tex
+	{ 0x14240, 16, 16, 2, 0, TEX_MEGATON_HAMMER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Megaton Hammer_16.tex, data of Hand/Megaton Hammer_16.tex
+	{ 0x13440, 16, 16, 2, 0, TEX_MILK_FULL_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Milk (full)_16.tex, data of Bottles/Milk (full)_16.tex
+	{ 0x14540, 16, 16, 2, 0, TEX_NAYRUS_LOVE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Nayru's Love_16.tex, data of Magic/Nayru's Love_16.tex
+	{ 0x145C0, 16, 16, 2, 0, TEX_OTHER_BUNNY_HOOD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Bunny Hood_16.tex
+	{ 0x14640, 16, 16, 2, 0, TEX_OTHER_CLAIM_CHECK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Claim Check_16.tex
+	{ 0x146C0, 16, 16, 2, 0, TEX_OTHER_COJIRO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Cojiro_16.tex
+	{ 0x14740, 16, 16, 2, 0, TEX_OTHER_CUCCO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Cucco_16.tex
+	{ 0x147C0, 16, 16, 2, 0, TEX_OTHER_EYE_BALL_FROG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Eye Ball Frog_16.tex
+	{ 0x14840, 16, 16, 2, 0, TEX_OTHER_EYE_DROPS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Eye Drops_16.tex
+	{ 0x148C0, 16, 16, 2, 0, TEX_OTHER_FAIRY_OCARINA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Fairy Ocarina_16.tex
+	{ 0x14940, 16, 16, 2, 0, TEX_OTHER_GERUDO_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Gerudo Mask_16.tex
+	{ 0x149C0, 16, 16, 2, 0, TEX_OTHER_GORON_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Goron Mask_16.tex
+	{ 0x14A40, 16, 16, 2, 0, TEX_OTHER_GORONS_SWORD_BROKEN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Goron's Sword (broken)_16.tex
+	{ 0x14AC0, 16, 16, 2, 0, TEX_OTHER_KEATON_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Keaton Mask_16.tex
+	{ 0x14B40, 16, 16, 2, 0, TEX_OTHER_LENS_OF_TRUTH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Lens of Truth_16.tex
+	{ 0x14BC0, 16, 16, 2, 0, TEX_OTHER_MAGIC_BEANS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Magic Beans_16.tex
+	{ 0x14C40, 16, 16, 2, 0, TEX_OTHER_MASK_OF_TRUTH_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Mask of Truth_16.tex
+	{ 0x14CC0, 16, 16, 2, 0, TEX_OTHER_OCARINA_OF_TIME_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Ocarina of Time_16.tex
+	{ 0x14D40, 16, 16, 2, 0, TEX_OTHER_ODD_MUSHROOM_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Odd Mushroom_16.tex
+	{ 0x14DC0, 16, 16, 2, 0, TEX_OTHER_ODD_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Odd Potion_16.tex
+	{ 0x14E40, 16, 16, 2, 0, TEX_OTHER_POACHERS_SAW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Poacher's Saw_16.tex
+	{ 0x14740, 16, 16, 2, 0, TEX_OTHER_POCKET_CUCCO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Pocket Cucco_16.tex, data of Other/Cucco_16.tex
+	{ 0x14EC0, 16, 16, 2, 0, TEX_OTHER_POCKET_EGG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Pocket Egg_16.tex
+	{ 0x14F40, 16, 16, 2, 0, TEX_OTHER_PRESCRIPTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Prescription_16.tex
+	{ 0x14FC0, 16, 16, 2, 0, TEX_OTHER_SOLD_OUT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/SOLD OUT_16.tex
+	{ 0x15040, 16, 16, 2, 0, TEX_OTHER_SKULL_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Skull Mask_16.tex
+	{ 0x150C0, 16, 16, 2, 0, TEX_OTHER_SPOOKY_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Spooky Mask_16.tex
+	{ 0x14EC0, 16, 16, 2, 0, TEX_OTHER_WEIRD_EGG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Weird Egg_16.tex, data of Other/Pocket Egg_16.tex
+	{ 0x15140, 16, 16, 2, 0, TEX_OTHER_ZELDAS_LETTER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Zelda's Letter_16.tex
+	{ 0x151C0, 16, 16, 2, 0, TEX_OTHER_ZORA_MASK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Other/Zora Mask_16.tex
+	{ 0x12FC0, 16, 16, 2, 0, TEX_PROJECTILE_BOOMERANG_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Boomerang_16.tex, data of Boomerang_16.tex
+	{ 0x14040, 16, 16, 2, 0, TEX_PROJECTILE_FAIRY_BOW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Fairy Bow_16.tex, data of Fairy Bow_16.tex
+	{ 0x140C0, 16, 16, 2, 0, TEX_PROJECTILE_FAIRY_SLINGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Fairy Slingshot_16.tex, data of Fairy Slingshot_16.tex
+	{ 0x141C0, 16, 16, 2, 0, TEX_PROJECTILE_FIRE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Fire Arrow_16.tex, data of Fire Arrow_16.tex
+	{ 0x14340, 16, 16, 2, 0, TEX_PROJECTILE_HOOKSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Hookshot_16.tex, data of Hookshot_16.tex
+	{ 0x143C0, 16, 16, 2, 0, TEX_PROJECTILE_ICE_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Ice Arrow_16.tex, data of Ice Arrow_16.tex
+	{ 0x14440, 16, 16, 2, 0, TEX_PROJECTILE_LIGHT_ARROW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Light Arrow_16.tex, data of Light Arrow_16.tex
+	{ 0x144C0, 16, 16, 2, 0, TEX_PROJECTILE_LONGSHOT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Projectile/Longshot_16.tex, data of Longshot_16.tex
+	{ 0x15240, 16, 16, 2, 0, TEX_QUEST_FIRE_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Fire Medallion_16.tex
+	{ 0x152C0, 16, 16, 2, 0, TEX_QUEST_FOREST_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Forest Medallion_16.tex
+	{ 0x15340, 16, 16, 2, 0, TEX_QUEST_GERUDOS_CARD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Gerudo's Card_16.tex
+	{ 0x153C0, 16, 16, 2, 0, TEX_QUEST_GOLD_SKULLTULA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Gold Skulltula_16.tex
+	{ 0x15440, 16, 16, 2, 0, TEX_QUEST_GORONS_RUBY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Goron's Ruby_16.tex
+	{ 0x154C0, 16, 16, 2, 0, TEX_QUEST_HEART_CONTAINER_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Heart Container_16.tex
+	{ 0x15540, 16, 16, 2, 0, TEX_QUEST_KOKIRIS_EMERALD_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Kokiri's Emerald_16.tex
+	{ 0x155C0, 16, 16, 2, 0, TEX_QUEST_LIGHT_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Light Medallion_16.tex
+	{ 0x15640, 16, 16, 2, 0, TEX_QUEST_PIECE_OF_HEART_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Piece of Heart_16.tex
+	{ 0x156C0, 16, 16, 2, 0, TEX_QUEST_SHADOW_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Shadow Medallion_16.tex
+	{ 0x15740, 16, 16, 2, 0, TEX_QUEST_SPIRIT_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Spirit Medallion_16.tex
+	{ 0x157C0, 16, 16, 2, 0, TEX_QUEST_STONE_OF_AGONY_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Stone of Agony_16.tex
+	{ 0x15840, 16, 16, 2, 0, TEX_QUEST_WATER_MEDALLION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Water Medallion_16.tex
+	{ 0x158C0, 16, 16, 2, 0, TEX_QUEST_ZORAS_SAPPHIRE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Quest/Zora's Sapphire_16.tex
+	{ 0x135C0, 16, 16, 2, 0, TEX_RED_POTION_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Red Potion_16.tex, data of Bottles/Red Potion_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_BOLERO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Bolero_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_MINUET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Minuet_16.tex, data of Songs/Bolero_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_PRELUDE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Prelude_16.tex, data of Songs/Bolero_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_SERENADE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Serenade_16.tex, data of Songs/Bolero_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_SHADOW_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Shadow_16.tex, data of Songs/Bolero_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_SPIRIT_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/Spirit_16.tex, data of Songs/Bolero_16.tex
+	{ 0x159C0, 16, 16, 2, 0, TEX_SONGS_ZELDATILE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/ZeldaTile_16.tex
+	{ 0x15940, 16, 16, 2, 0, TEX_SONGS_TILE146_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tile146_16.tex, data of Songs/Bolero_16.tex
+	{ 0x15A40, 16, 16, 2, 0, TEX_SONGS_TILEEPONA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileEpona_16.tex
+	{ 0x15AC0, 16, 16, 2, 0, TEX_SONGS_TILESARIA_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileSaria_16.tex
+	{ 0x15B40, 16, 16, 2, 0, TEX_SONGS_TILESTORMS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileStorms_16.tex
+	{ 0x15BC0, 16, 16, 2, 0, TEX_SONGS_TILESUN_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileSun_16.tex
+	{ 0x15C40, 16, 16, 2, 0, TEX_SONGS_TILETIME_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Songs/tileTime_16.tex
+	{ 0x15CC0, 16, 16, 2, 0, TEX_UPGRADES_ADULTS_WALLET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Adult's Wallet_16.tex
+	{ 0x15D40, 16, 16, 2, 0, TEX_UPGRADES_BOMB_BAG_20_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bomb Bag (20)_16.tex
+	{ 0x15DC0, 16, 16, 2, 0, TEX_UPGRADES_BOMB_BAG_30_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bomb Bag (30)_16.tex
+	{ 0x15E40, 16, 16, 2, 0, TEX_UPGRADES_BOMB_BAG_40_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bomb Bag (40)_16.tex
+	{ 0x15EC0, 16, 16, 2, 0, TEX_UPGRADES_BULLET_BAG_30_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bullet Bag (30)_16.tex
+	{ 0x15F40, 16, 16, 2, 0, TEX_UPGRADES_BULLET_BAG_40_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bullet Bag (40)_16.tex
+	{ 0x15FC0, 16, 16, 2, 0, TEX_UPGRADES_BULLET_BAG_50_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Bullet Bag (50)_16.tex
+	{ 0x16040, 16, 16, 2, 0, TEX_UPGRADES_GIANTS_WALLET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Giant's Wallet_16.tex
+	{ 0x160C0, 16, 16, 2, 0, TEX_UPGRADES_GOLDEN_GAUNTLETS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Golden Gauntlets_16.tex
+	{ 0x16140, 16, 16, 2, 0, TEX_UPGRADES_GOLDEN_SCALE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Golden Scale_16.tex
+	{ 0x161C0, 16, 16, 2, 0, TEX_UPGRADES_GORONS_BRACELET_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Goron's Bracelet_16.tex
+	{ 0x16240, 16, 16, 2, 0, TEX_UPGRADES_QUIVER_30_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Quiver (30)_16.tex
+	{ 0x162C0, 16, 16, 2, 0, TEX_UPGRADES_QUIVER_40_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Quiver (40)_16.tex
+	{ 0x16340, 16, 16, 2, 0, TEX_UPGRADES_QUIVER_50_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Quiver (50)_16.tex
+	{ 0x163C0, 16, 16, 2, 0, TEX_UPGRADES_SILVER_GAUNTLETS_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Silver Gauntlets_16.tex
+	{ 0x16440, 16, 16, 2, 0, TEX_UPGRADES_SILVER_SCALE_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 Upgrades/Silver Scale_16.tex
+	{ 0x164C0, 16, 16, 4, 0, NO_TLUT, { 0x00, 0x00, 0x00 }, TEXTURE_SOURCE_PACK }, // I4 black_16.tex
+	{ 0x142C0, 16, 16, 2, 0, TEX_DEKUSTICK_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // CI4 dekustick_16.tex, data of Hand/dekustick_16.tex
+	{ 0x16540, 16, 16, 4, 0, NO_TLUT, { 0xFF, 0xFF, 0xFF }, TEXTURE_SOURCE_PACK }, // I4 white_16.tex
+};
 
-    uint32_t tDp0[] = dDpad0;
-    writeTexture(tDpad0, 512, tDp0);
-    writeTexture(&tDpad0[512], 512, tDp0);
+#define ATLAS_CELL_SIZE 16
+#define NUM_ATLAS_CELLS 32
 
-    uint32_t tBlx[] = dBlackBox;
-    writeTexture(tBlackBox, 512, tBlx);
-    writeTexture(&tBlackBox[512], 512, tBlx);*/
+// Page texture, s, t, CI4 palette and game item ID for each entry of menu_t.items
+const uint16_t atlasCells[NUM_ATLAS_CELLS][5] = {
+	{ TEX_ATLAS_PROJECTILE_0, 0, 0, 0, 0x03 }, // Projectile/Fairy Bow.png
+	{ TEX_ATLAS_PROJECTILE_0, 16, 0, 1, 0x04 }, // Projectile/Fire Arrow.png
+	{ TEX_ATLAS_PROJECTILE_0, 32, 0, 2, 0x0C }, // Projectile/Ice Arrow.png
+	{ TEX_ATLAS_PROJECTILE_0, 48, 0, 3, 0x12 }, // Projectile/Light Arrow.png
+	{ TEX_ATLAS_PROJECTILE_0, 0, 16, 4, 0x0A }, // Projectile/Hookshot.png
+	{ TEX_ATLAS_PROJECTILE_0, 16, 16, 5, 0x0B }, // Projectile/Longshot.png
+	{ TEX_ATLAS_PROJECTILE_0, 32, 16, 6, 0x06 }, // Projectile/Fairy Slingshot.png
+	{ TEX_ATLAS_PROJECTILE_0, 48, 16, 7, 0x0E }, // Projectile/Boomerang.png
+	{ TEX_ATLAS_WEAPON_0, 0, 0, 0, 0x3B }, // Equipment/Kokiri Sword.png
+	{ TEX_ATLAS_WEAPON_0, 16, 0, 1, 0x3C }, // Equipment/Master Sword.png
+	{ TEX_ATLAS_WEAPON_0, 32, 0, 2, 0x3D }, // Equipment/Biggoron Sword.png
+	{ TEX_ATLAS_WEAPON_0, 48, 0, 3, 0x3E }, // Equipment/Deku Shield.png
+	{ TEX_ATLAS_WEAPON_0, 0, 16, 4, 0x3F }, // Equipment/Hylian Shield.png
+	{ TEX_ATLAS_WEAPON_0, 16, 16, 5, 0x40 }, // Equipment/Mirror Shield.png
+	{ TEX_ATLAS_ARMOR_0, 0, 0, 0, 0x41 }, // Clothing/Kokiri Tunic.png
+	{ TEX_ATLAS_ARMOR_0, 16, 0, 1, 0x42 }, // Clothing/Goron Tunic.png
+	{ TEX_ATLAS_ARMOR_0, 32, 0, 2, 0x43 }, // Clothing/Zora Tunic.png
+	{ TEX_ATLAS_ARMOR_0, 48, 0, 3, 0x44 }, // Clothing/Kokiri Boots.png
+	{ TEX_ATLAS_ARMOR_0, 0, 16, 4, 0x45 }, // Clothing/Iron Boots.png
+	{ TEX_ATLAS_ARMOR_0, 16, 16, 5, 0x46 }, // Clothing/Hover Boots.png
+	{ TEX_ATLAS_HAND_0, 0, 0, 0, 0x11 }, // Hand/Megaton Hammer.png
+	{ TEX_ATLAS_HAND_0, 16, 0, 1, 0x02 }, // Hand/Bomb.png
+	{ TEX_ATLAS_HAND_0, 32, 0, 2, 0x09 }, // Hand/Bombchu.png
+	{ TEX_ATLAS_HAND_0, 48, 0, 3, 0x00 }, // Hand/dekustick.png
+	{ TEX_ATLAS_HAND_0, 0, 16, 4, 0x01 }, // Hand/Deku Nut.png
+	{ TEX_ATLAS_MAGIC_0, 0, 0, 0, 0x13 }, // Magic/Nayru's Love.png
+	{ TEX_ATLAS_MAGIC_0, 16, 0, 1, 0x05 }, // Magic/Din's Fire.png
+	{ TEX_ATLAS_MAGIC_0, 32, 0, 2, 0x0D }, // Magic/Farore's Wind.png
+	{ TEX_ATLAS_BOTTLE_0, 0, 0, 0, 0x14 }, // Bottles/Empty Bottle.png
+	{ TEX_ATLAS_BOTTLE_0, 0, 0, 0, 0x14 }, // Bottles/Empty Bottle.png
+	{ TEX_ATLAS_BOTTLE_0, 0, 0, 0, 0x14 }, // Bottles/Empty Bottle.png
+	{ TEX_ATLAS_BOTTLE_0, 0, 0, 0, 0x14 }, // Bottles/Empty Bottle.png
+};
 
-    uint32_t tDsk[] = dDekuStick;
-    writeTexture(tDekuStick, 512, tDsk);
-
-    uint32_t tDnt[] = dDekuNuts;
-    writeTexture(tDekuNuts, 512, tDnt);
-
-    uint32_t tBmb[] = dBombs;
-    writeTexture(tBombs, 512, tBmb);
-
-    uint32_t tBna[] = dBow;
-    writeTexture(tBow, 512, tBna);
-
-    uint32_t tFia[] = dFireArrow;
-    writeTexture(tFireArrow, 512, tFia);
-
-    uint32_t tMdi[] = dDin;
-    writeTexture(tDin, 512, tMdi);
-
-    uint32_t tSls[] = dSlingshot;
-    writeTexture(tSlingshot, 512, tSls);
-
-    uint32_t tBch[] = dBombchu;
-    writeTexture(tBombchu, 512, tBch);
-
-    uint32_t tHks[] = dHookshot;
-    writeTexture(tHookshot, 512, tHks);
-
-    uint32_t tLks[] = dLongshot;
-    writeTexture(tLongshot, 512, tLks);
-
-    uint32_t tIca[] = dIceArrow;
-    writeTexture(tIceArrow, 512, tIca);
-
-    uint32_t tFar[] = dFarore;
-    writeTexture(tFarore, 512, tFar);
-
-    uint32_t tBmr[] = dBoomerang;
-    writeTexture(tBoomerang, 512, tBmr);
-
-    uint32_t tHam[] = dHammer;
-    writeTexture(tHammer, 512, tHam);
-
-    uint32_t tLia[] = dLightArrows;
-    writeTexture(tLightArrows, 512, tLia);
-
-    uint32_t tNay[] = dNayru;
-    writeTexture(tNayru, 512, tNay);
-
-    uint32_t tEpb[] = dEmptyBottle;
-    writeTexture(tEmptyBottle, 512, tEpb);
-
-    #endif
-}
+uint32_t tResidentTextures[RESIDENT_TEXTURES_SIZE / 4] __attribute__((aligned(8))) = {
+	// Pack header
+	0x4C4D5450,0x000101CD,0x0001CBA8,0x000039F8,0x000165C0,0x00019F60,0x00000400,0x0001A760,
+	// TEX_DPAD
+	0x00011122,0x22334516,0x7589A247,0xB4B72B22,0x22B47B4C,0xB45AA837,0x61545322,0x25444000,0x00099912,0x11113542,0x7D81914D,0x64B7226B,0xB2B4DB4B,0xB42A14D6,0x34532212,0x25444000,0x00019191,0x919A1124,0x3389AA55,0x34825833,0x84543545,0x549A9855,0x42112122,0x38444000,0x00091991,0x99AAAAA9,0x11ADDDA9,0x29121913,0x19211191,0x199AA912,0x19911123,0x54444000,0x00012222,0x2211AAAD,0xDDDDDDDD,0xDDDDDDDD,0xDAAAAAAA,0xAAAA9999,0x99111125,0x84444000,0x00005888,0x88444488,0x55555521,0xADDDDDDA,0xAAAAAA12,0x34548884,0x44444484,0x44440000,0x00004444,0x44444444,0x44444443,0x9DDDADAA,0xDAAAA928,0x44444444,0x44444444,0x44440000,0x00000444,0x44444444,0x44444443,0x9DDDDAAA,0xAAAAA954,0x44444444,0x44444444,0x44400000,0x00000004,0x44444444,0x44444482,0xADDDAAAA,0xAAAAA944,0x44444444,0x44444444,0x40000000,0x00000000,0x00000000,0x0000001A,0xDDDDAAAA,0xAAAAA184,0x44000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000000D,0xDDDAAAAA,0xAA9A9154,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000000D,0xDDAAAAAA,0xAA9AA184,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000000D,0xDAAAAAAA,0x999A9284,0x40000000,0x00000000,0x00000000,0x00000000,0x44444440,0x0000000D,0xDDAAAA11,0x19999144,0x40000000,0x04444004,0x00000000,0x00000004,0x44DDA444,0x0044440A,0xDAAAA925,0x53999284,0x40000000,0x44444444,0x44000000,0x00000044,0x7C67C644,0x44477442,0x32913354,0x48522344,0x40004000,0x41BC4446,0x74000000,0x0000044D,0xBA444944,0x44466444,0x44444444,0x44444444,0x44444400,0x446BA44C,0x34000000,0x0000044C,0xC44444A7,0x667BC6A6,0x674D6677,0x16662777,0x67447440,0x44DB64D6,0x44000000,0x0000044B,0x64404467,0xAB7662C7,0x2B7B71C6,0xC646C6B7,0x6B1A6440,0x048CC26D,0x40000000,0x0000044B,0xC4404427,0x6B76CDBC,0x6BBB246B,0xBA47BB64,0x1B76D440,0x0447B7C4,0x40000000,0x00000446,0xB14444C6,0x2B766DB7,0x447BD2CB,0xB747BC68,0x46BC4400,0x0042BC64,0x40000000,0x00000041,0xBCA27CBC,0x7B67BDCC,0xD67CC6B6,0xC626C664,0x41B74400,0x00446B94,0x00000000,0x00000044,0x37667DD6,0x77787727,0x6744D2B7,0x27673774,0x42C24000,0x00049644,0x00000000,0x00000004,0x44444444,0x44444444,0x4447D7B3,0x44444441,0x76D44000,0x00044440,0x00000000,0x00000000,0x00444004,0x04004002,0x32477794,0x53555444,0xDA440000,0x00000400,0x00000000,0x00000000,0x00000000,0x00000009,0x12444448,0x33358444,0x84400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x58844488,0x88444444,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00444444,0x44444400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00044444,0x44444000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	// TEX_DPAD_BASE_BOTTOM
+	0x00112314,0x51166782,0x911A7751,0xB2111261,0x92B29271,0xA7112311,0x111666B2,0x32941000,0x0011B2C1,0x111CCA82,0x918CA751,0xB2111261,0x92B29291,0x5A51B2C1,0x11166662,0x92B11000,0x0001C337,0x863114C2,0x6998A754,0xB2999329,0x32B2C267,0x1A81C337,0x86311162,0x992B1000,0x0005186B,0xB69181C6,0x6698A9C1,0x6666676B,0x6666176C,0x1775186B,0xB6915196,0xA49B1000,0x000C5111,0x11147411,0x115A9971,0x11111111,0x11111114,0x577A5111,0x1114C411,0x11111000,0x000C8854,0x458CCCC8,0x888AAA7A,0xACCCCA88,0xC8C8AC8C,0xAACCC854,0x44585554,0x11111000,0x00004114,0x44111111,0x4444448C,0x79997997,0x777777C8,0x51411441,0x11114111,0x11110000,0x00001111,0x11111111,0x11111115,0xA9999977,0x77777A81,0x11111111,0x11111111,0x11110000,0x00000111,0x11111111,0x11111115,0xA9997777,0x77777A41,0x11111111,0x11111111,0x11100000,0x00000001,0x11111111,0x11111148,0x79997779,0x77777C41,0x11111111,0x11111111,0x10000000,0x00000000,0x00000000,0x000000C7,0x99997777,0xA7777C41,0x11000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000009,0x99977777,0x777A7C41,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000009,0x99CAA777,0x77A77C11,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000007,0x84111587,0xC5154111,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x11997115,0x48411111,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000011,0x63663B11,0x8C3BB2B8,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000119,0x29141A11,0x5CBA1C3B,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000113,0x31484111,0x5CBC116B,0xA0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000112,0xB157C111,0x483C1172,0xA0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000113,0x314C8166,0x9C3C1193,0xA0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000011B,0x2C111197,0xAC2C51B3,0xC0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000001C,0x23786314,0x5C267B29,0xC0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000011,0x56BB6914,0x1A6666C1,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000005,0x1111114C,0x41111111,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000007,0xA85488AC,0xC8544111,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000000A,0xC8885858,0x55544111,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x44114444,0x44111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11111111,0x11111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00111111,0x11111100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00011111,0x11111000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	// TEX_DPAD_BASE_TOP
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01222322,0x22222220,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22232232,0x22222345,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000002,0x22236663,0x33322657,0x70000000,0x00000000,0x00000000,0x00000000,0x07777770,0x00000002,0x22646636,0x65774677,0x77000000,0x00000000,0x00000000,0x00000000,0x77688377,0x00000003,0x33644466,0x57837477,0x77700000,0x00000000,0x00000000,0x00000007,0x79A99A97,0x77777075,0x44555544,0x78AB7579,0xA9777707,0x07707007,0x00000000,0x00000077,0x9A1778A9,0x77777777,0x77777777,0x78AA677C,0xA9777777,0x77777777,0x77000000,0x00000077,0xCC7777CC,0x9B9B879B,0xB19B9B87,0x78BA978C,0xA91BB93B,0x9BB1B13B,0x17000000,0x00000077,0xAB7777BA,0xBA8BABC6,0x9ABC8AC7,0x789CB7B9,0xA9A96ABA,0x9BABA88A,0x87000000,0x00000077,0xAC7777BA,0xBB58AACB,0xCAAB59A7,0x7898A8C8,0xABACBAAA,0x84ABA88A,0x87000000,0x00000077,0x9A3777AB,0xCB78AAA7,0x77BB79A7,0x7896AA88,0xABA9778A,0x87ABA18A,0x87000000,0x00000007,0x2AC36BC1,0xBC3BA8AB,0x9CCB79A7,0x7897BA68,0xA9CC8BBA,0x87ABACBA,0x87000000,0x00000007,0x769BB937,0xBC99178B,0x91897897,0x73852873,0x9869B939,0x37989989,0x37000000,0x00000000,0x77777777,0xBB777777,0x77777777,0x55577777,0x77777777,0x77777777,0x77000000,0x00000000,0x00777777,0xB9770004,0x66663663,0x23311357,0x70077007,0x00700707,0x00000000,0x00000000,0x00000007,0x77700002,0x22232222,0x11188257,0x70000000,0x00000000,0x00000000,0x00000000,0x00000000,0x77000002,0x22323221,0x11188257,0x70000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x12232221,0x21188257,0x70000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000011,0x12222211,0x11188257,0x76000000,0x00000000,0x00000000,0x00000002,0x23222222,0x22211181,0x12222212,0x11118164,0x62888888,0x88811111,0x10000000,0x00000222,0x22232222,0x21111111,0x12222111,0x11188112,0x11888181,0x81118118,0x12600000,0x00001123,0x36322222,0x22222111,0x22232111,0x26288888,0x88888182,0x22111111,0x13240000,0x00003457,0x77546657,0x56222226,0x47777416,0x77743318,0x88812657,0x77461113,0x63380000,0x00067778,0x81774757,0x75332367,0x77681737,0x69377774,0x88127778,0x81776771,0x88267000,0x000579C9,0x9CB7553A,0x87332257,0xBA9B9767,0x8ABB3917,0x111579C9,0x9CB7479C,0xBCC87000,0x00778A87,0x7727556A,0x87322247,0xBA777777,0x8A998A87,0x42678A87,0x7727479A,0x17CC7000,0x0077CC77,0x5777753A,0x87722247,0xBA77769B,0xBA9BCAC1,0x7147CC77,0x7777579A,0x87CC7000,0x0077AB75,0x4777756A,0x87722247,0xBABC8BC6,0x9ABA8A87,0x4177AB77,0x7777779A,0xBBA87000,
+	// TEX_DPAD_TOP
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01223222,0x22222220,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22232323,0x22222345,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000002,0x22236663,0x33222657,0x70000000,0x00000000,0x00000000,0x00000000,0x77777770,0x00000002,0x23666666,0x33322657,0x70000000,0x00007000,0x00000000,0x00000007,0x77881777,0x00777703,0x23644436,0x63332657,0x70000000,0x00077770,0x00000000,0x00000077,0x9AB9AB77,0x77799774,0x54CCCCCC,0x4CC66477,0x70007000,0x0077B170,0x00000000,0x00000778,0xD1777277,0x777BB777,0x77777777,0x77777777,0x77777700,0x0071DB77,0x00000000,0x0000077A,0xA7777719,0xBB9DAB1B,0xB978BB99,0x3BBB6999,0xB9779770,0x077BAD67,0x00000000,0x0000077D,0xB77077B9,0x1D9BB6A9,0x6D9D93AB,0xAB7BABD9,0xBD31B770,0x077A9D97,0x70000000,0x0000077D,0xA7707769,0xBD9BA8DA,0xBDDD67BD,0xD179DDB7,0x3D9B8770,0x078B4AA7,0x70000000,0x0000077B,0xD37777AB,0x6D9BB8D9,0x779D86AD,0xD979DAB5,0x7BDA7700,0x77B87BD8,0x77000000,0x00000073,0xDA169ADA,0x9DB9D8AA,0x8B9AABDB,0xAB6BABB7,0x73D97700,0x76D771DB,0x77000000,0x00000077,0x49BB988B,0x99959969,0xB97786D9,0x69B94997,0x76A67000,0x58B777AD,0x37000000,0x00000007,0x77777777,0x77777777,0x777989D4,0x77777773,0x9B877000,0x75777777,0x77000000,0x00000000,0x00777007,0x07007006,0xC6799927,0xC4431677,0x81770000,0x00700777,0x70000000,0x00000000,0x00000000,0x00000002,0x2377777C,0x321812C7,0x57700000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000002,0x22366631,0x111882C7,0x70000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000002,0x22323221,0x211882C7,0x70000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x12222221,0x21188257,0x70000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000011,0x12232211,0x111882C7,0x76000000,0x00000000,0x00000000,0x00000002,0x23222222,0x22211181,0x12222211,0x11188164,0x62888888,0x88811111,0x10000000,0x00000222,0x22111122,0x21111111,0x12122111,0x11181812,0x11888181,0x81118118,0x12600000,0x00001122,0x23331111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x13C70000,0x00002226,0x66632222,0x22222134,0x7C632111,0x11888888,0x88888181,0x11111112,0x24570000,0x00032266,0x44666333,0x33222374,0x67CC5211,0x11111888,0x88811111,0x11111123,0x36777000,0x00033644,0x46666336,0x44623459,0xD7B976C5,0x66C6466C,0x61111236,0x31112222,0x34777000,0x00063664,0x44446347,0x66732679,0xD6DB34DD,0x443DDCDD,0xC5111566,0x76222223,0x64777000,0x00033344,0x4C754572,0xB1732679,0xDDDD9D66,0xD6DDD9BD,0x9761271B,0x27C66333,0x64777000,0x00033366,0x47777C1B,0x95C22679,0xD5D96DDD,0xD6D2BD2D,0xD7411CC9,0xB8C5C433,0x64777000,
+	// TEX_LONGBLAC
+	0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F6,0xFAFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFA,0xF6F0F0F0,0xF0F0F6FB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBF6F0F0,0xF0F0FAFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFAF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBF0F0,0xF0F0FAFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFAF0F0,0xF0F0F6FB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBF6F0F0,0xF0F0F0F6,0xFAFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFB,0xFBFBFBFA,0xF6F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,
+	// TEX_RED
+	0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF0F0F0F0,0xF0F0F0F0,0xFAFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCF0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xFCF1F0F0,0xF0F0F0F0,0xFCF1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xF1F1F1F1,0xFCF1F0F0,0xF0F0F0F0,0xF9FCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFCFCFCFC,0xFAF0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,0xF0F0F0F0,
+	// TEX_DPAD_TLUT
+	0x000039CF,0x294B18C7,0x00011085,0xCE739CE7,0x08434A53,0x5AD7FFFF,0xEF7B6B5B,0x00000000,
+	// TEX_DPAD_BASE_BOTTOM_TLUT
+	0x00000001,0xFFFFEF7B,0x084318C7,0xA5295AD7,0x294B6B5B,0x4A53CE73,0x39CF0000,0x00000000,
+	// TEX_DPAD_BASE_TOP_TLUT
+	0x00005AD7,0x4A5339CF,0x18C70843,0x294B0001,0x6B5BA529,0xFFFFCE73,0xEF7B0000,0x00000000,
+	// TEX_DPAD_TOP_TLUT
+	0x00005AD7,0x4A5339CF,0x18C70843,0x294B0001,0x6B5B9CE7,0xEF7BCE73,0x1085FFFF,0x00000000,
+	// TEX_ATLAS_PROJECTILE_0
+	0x01111111,0x11112342,0x01111111,0x11121110,0x01111111,0x11121110,0x01111111,0x11121110,0x56111167,0x76624386,0x11111111,0x11345111,0x11111111,0x11344111,0x11111111,0x11334111,0x9533ABBB,0xBCD34441,0x11111111,0x11566711,0x11111111,0x15677311,0x11111111,0x15678911,0x7E43AA77,0xC3EF2671,0x11111111,0x14885311,0x11111111,0x13776311,0x11111111,0x16776311,0x1232711D,0xDE4BDD11,0x11111111,0x16862111,0x11111111,0x16763111,0x11111111,0x18789111,0x11646111,0x64B4C611,0x11177722,0x26421111,0x11188995,0x26331111,0x11133AA2,0x973A1111,0x11174611,0x46DC2611,0x11299777,0x82111111,0x115A8888,0x73111111,0x11A64334,0x72111111,0x11117464,0x616AA611,0x11999956,0xA9111111,0x11AA8AAB,0xB8111111,0x11644467,0x84111111,0x111112F2,0x111AA611,0x17BBC6DD,0xBB111111,0x18CCCCDE,0xCC111111,0x148777BB,0x87111111,0x11162474,0x611BA111,0x19CCE8AC,0xBC111111,0x1ACFEEBE,0xCF111111,0x167CB77C,0x77111111,0x11634217,0x466B7111,0x19C9DABE,0xCC111111,0x1ACAEACF,0xCF111111,0x1676B677,0x7C111111,0x17B4B211,0x64233111,0x199464AB,0xCC111111,0x1A8AB8AC,0xCF111111,0x16468467,0x7C111111,0x113BB111,0x16443611,0x1997777B,0xBB111111,0x18A8888C,0xCC111111,0x14433337,0x88111111,0x11176111,0x112BA611,0x11777277,0x71111111,0x11999998,0x85111111,0x11999994,0x35111111,0x11111111,0x1117A511,0x11122777,0x11111111,0x11159999,0x11111111,0x1115A393,0x11111111,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11111210,0x01111111,0x11234450,0x01234444,0x44444440,0x01111111,0x11111110,0x11111111,0x12345611,0x11111111,0x36666321,0x15566744,0x44444444,0x23343535,0x44436711,0x11111111,0x67773811,0x11111111,0x74884571,0x32568884,0x44444444,0x72638459,0x999AA311,0x11111118,0x93746811,0x11111115,0x32944311,0x47694487,0x3AA44444,0x11BBC2D6,0x634A4311,0x11111113,0xA4646111,0x11111119,0x66534511,0x44967486,0xBC514444,0x111111E7,0x76443211,0x111119BB,0x44B38111,0x111112A3,0x44B14711,0x447697CB,0x22214444,0x11111111,0x1E334611,0x11112C57,0xBB421111,0x11117AC8,0x3B477111,0x44468B86,0x918B3444,0x11111111,0x11634611,0x112339C5,0xB9211111,0x115432CC,0xC5511111,0x44466683,0x4449B744,0x11111111,0x11733D11,0x1232129C,0xC2111111,0x1395722A,0xA7111111,0x44DA69C4,0x4444DB74,0x11111111,0x11188611,0x18321126,0x21111111,0x39111222,0x71111111,0x4DC66884,0x44444784,0x11111111,0x11163D11,0x118D1186,0x11111111,0x29511123,0x11111111,0x49A669B4,0x4D44D384,0x11111111,0x111D8211,0x1116D238,0x11111111,0x15D51147,0x11111111,0x48A674B8,0x4996AC74,0x11111111,0x11173611,0x11118431,0x11111111,0x11545331,0x11111111,0x9C66D448,0xB6CCCC44,0x11111111,0x11113611,0x11111211,0x11111111,0x11124471,0x11111111,0x36694444,0x39CCA344,0x11111111,0x11112211,0x11111111,0x11111111,0x11117711,0x11111111,0xD7744444,0x43799444,0x11111111,0x1111B111,0x01111111,0x11111110,0x01111111,0x11111110,0x04444444,0x44444440,0x01111111,0x11111110,
+	// TEX_ATLAS_PROJECTILE_TLUT
+	0x00000001,0x41CD6AD3,0x941F8041,0x108338C3,0xFFFFE843,0x59857A47,0x12B708D7,0xD38BD629,0x00000001,0x20433149,0x61477309,0x93534043,0xBC596843,0x9189A8C5,0xE109E569,0xDB9F0000,0x00000001,0x18832949,0x69870045,0x7B09B49B,0x095708CF,0x1A5D739B,0x1B6BFFFF,0x9DB52CF9,0x00000001,0x184139C3,0x52850841,0x7307B50B,0x8BCD2943,0x18C1D625,0xEF070000,0x00000000,0x00000001,0x108952D7,0x741F8C33,0x3A0FAD6B,0x29492113,0x5DFD3AED,0x299F8C51,0x00000000,0x00000001,0x208D4213,0x7421294D,0x8CF10887,0xC6736355,0x491923AD,0x69E1BDD7,0x00000000,0x00005041,0x98831843,0x0001D8C3,0x61C72905,0x62914985,0x82C5AC5B,0x93510841,0x00000000,0x00000001,0x49059A89,0xD38F3D8B,0x71C72083,0x1B03E59D,0xF0831041,0x08C109C1,0x00810000,
+	// TEX_ATLAS_PROJECTILE_TLUT_GREYED
+	0x00000001,0x210939CF,0x529518C7,0x08431085,0x9CE7294B,0x2109318D,0x294B1085,0x52957BDF,0x00000001,0x084318C7,0x210939CF,0x42110843,0x5AD71085,0x294B294B,0x39CF739D,0x5AD70000,0x00000001,0x084318C7,0x21090001,0x39CF5AD7,0x10850843,0x21094211,0x318D9CE7,0x6B5B4A53,0x00000001,0x000118C7,0x294B0001,0x39CF5AD7,0x4A531085,0x0843739D,0x7BDF0000,0x00000000,0x00000001,0x0843318D,0x4A535295,0x21096B5B,0x18C71085,0x6319318D,0x21094A53,0x00000000,0x00000001,0x0843294B,0x4A5318C7,0x5AD70843,0x7BDF39CF,0x210939CF,0x318D6B5B,0x00000000,0x00001085,0x21090843,0x0001318D,0x294B1085,0x318D2109,0x39CF5AD7,0x42110001,0x00000000,0x00000001,0x18C739CF,0x52954A53,0x294B0843,0x294B739D,0x318D0001,0x08431085,0x00010000,
+	// TEX_ATLAS_PROJECTILE_TLUT_HIGHLIGHTED
+	0x52945295,0x7BDD9C61,0xB569AAD5,0x5AD77B17,0xFFFFEAD7,0x8B97A419,0x5C795B23,0xDCDBDEAF,0x52945295,0x6AD7735B,0x93599C9B,0xB4E17AD7,0xCD659AD7,0xB39BC317,0xEB5BEE2F,0xE4E95294,0x52945295,0x62D76B5B,0x9B9952D7,0xA49BCDA7,0x5B635B1F,0x64279CE7,0x64F1FFFF,0xBE776DFB,0x52945295,0x62D57BD7,0x8C575AD5,0x9C99CDDB,0xAD1D6B57,0x6315DEAD,0xEF595294,0x52945294,0x52945295,0x5ADB8C63,0x9D69AD77,0x7BDFC631,0x6B5B6B61,0x8E7D7C73,0x6BA9AD5F,0x52945294,0x52945295,0x6ADD7BE1,0x9D6B6B5D,0xADF55AD9,0xD6F794E3,0x83656CF3,0x9BEBCE63,0x52945294,0x52948AD5,0xBAD762D7,0x5295E317,0x93D96B57,0x945F8397,0xAC57C567,0xB4DF5AD5,0x52945294,0x52945295,0x8357BC5B,0xDCDF7E5B,0x9BD96AD7,0x6497EE67,0xF2D75AD5,0x5B155BD5,0x52D55294,
+	// TEX_ATLAS_WEAPON_0
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001210,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001200,0x00000000,0x00034510,0x00000012,0x00000000,0x00000000,0x00000000,0x00000000,0x00034510,0x00000000,0x00342300,0x00000234,0x43000000,0x00000000,0x00011000,0x00000000,0x00543670,0x00000000,0x02453600,0x00005164,0x47860000,0x00000000,0x02341000,0x00000000,0x03445200,0x00000000,0x24237000,0x00096611,0x43385000,0x00000000,0x13450000,0x00000000,0x35452000,0x00000005,0x42360000,0x009433AB,0xA3386000,0x00000677,0x44210000,0x00010005,0x53520000,0x00000054,0x53700000,0x00443AB3,0x466C3000,0x00000869,0x92A00000,0x00038014,0x33200000,0x00006545,0x37000000,0x06464A34,0xAB33C500,0x000008B9,0x27000000,0x00032944,0x36000000,0x08869423,0x70000000,0x0CC34AA1,0x44A14320,0x00000BB8,0xC7000000,0x00026456,0x7A000000,0x03AA9537,0x00000000,0x0C8333AA,0x3A311220,0x0000CB86,0xC7000000,0x000AB539,0x00000000,0x00825370,0x00000000,0x04D4ABAA,0xBA121200,0x0008BD00,0x00000000,0x00035882,0x20000000,0x00232B00,0x00000000,0x0173643A,0x42115000,0x000C6000,0x00000000,0x003B2A12,0x27000000,0x03378B80,0x00000000,0x00686446,0x11190000,0x00000000,0x00000000,0x07620000,0x00000000,0x3B70C1C0,0x00000000,0x00014411,0x11000000,0x00000000,0x00000000,0x00700000,0x00000000,0x8C000000,0x00000000,0x00000559,0x50000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000120,0x00000000,0x00000001,0x23000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00002314,0x12500000,0x00000322,0x22230000,0x00000000,0x00000000,0x00000000,0x00000000,0x00026477,0x14441000,0x00001224,0x56222000,0x00000000,0x00000000,0x00000000,0x00000000,0x00063869,0x97446200,0x00322654,0x54788200,0x00000000,0x00000000,0x00000000,0x00000000,0x00133668,0x87463100,0x01224947,0x6A048800,0x00000000,0x00000000,0x00000000,0x00000000,0x05347791,0x21AA3600,0x38859977,0x67657B10,0x00000000,0x00000000,0x00000000,0x00000000,0x01679B1C,0x141A8D00,0x1B449C44,0xA67DDBB0,0x00000000,0x00000000,0x00000000,0x00000000,0x06367E2A,0x414A7D10,0x1E945D0A,0x55595820,0x00000000,0x00000000,0x00000000,0x00000000,0x0D3372B2,0x12447340,0x8E94D500,0x46598800,0x00000000,0x00000000,0x00000000,0x00000000,0x0D6A7BBE,0xEA787430,0x8E944945,0x95578100,0x00000000,0x00000000,0x00000000,0x00000000,0x0D39C1A2,0x29661450,0x8E947647,0x59482000,0x00000000,0x00000000,0x00000000,0x00000000,0x06661A14,0xA7411500,0x8E506666,0x75880000,0x00000000,0x00000000,0x00000000,0x00000000,0x04444741,0x71120000,0xBB744777,0x78830000,0x00000000,0x00000000,0x00000000,0x00000000,0x02111111,0x12500000,0x88111111,0x12200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00055555,0x00000000,0x11133111,0x33000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	// TEX_ATLAS_WEAPON_TLUT
+	0x0001210B,0x52DDFFFF,0xBE357425,0x39451043,0x6A09952F,0x1087B289,0x51452883,0x00000000,0x0001210F,0x3199735F,0xBDAF8C6D,0x52A51089,0x3A210845,0x0843D37D,0x00000000,0x00000000,0x00012991,0x6BA34ADD,0xFFFFA527,0x084518C9,0x0963C679,0x257F1237,0x008B0000,0x00000000,0x00012883,0x20436189,0x49051041,0x38C5C45D,0xA3550801,0xA143E9C1,0x724FE629,0x00000000,0x00015299,0x314FCE33,0x7BE11087,0x94ED31E7,0x4B330929,0x089B68D3,0xD689FFFF,0xC90D0000,0x00013843,0x50852001,0x6B5F8467,0x41D15A97,0x70859D2F,0x18C9A085,0xFFFFC675,0xF0C70000,
+	// TEX_ATLAS_WEAPON_TLUT_GREYED
+	0x00011085,0x318D9CE7,0x739D4A53,0x18C70001,0x294B6319,0x08434211,0x18C70843,0x00000000,0x00011085,0x21094211,0x739D5295,0x318D0843,0x294B0001,0x00015AD7,0x00000000,0x00000000,0x000118C7,0x4211318D,0x9CE76319,0x00010843,0x18C77BDF,0x5295294B,0x08430000,0x00000000,0x00010843,0x08432109,0x18C70001,0x10855AD7,0x4A530001,0x294B4211,0x318D7BDF,0x00000000,0x0001318D,0x18C77BDF,0x4A530843,0x5AD7294B,0x39CF18C7,0x08432109,0x739D9CE7,0x318D0000,0x00010843,0x10850001,0x42115295,0x2109318D,0x18C76319,0x08432109,0x9CE77BDF,0x318D0000,
+	// TEX_ATLAS_WEAPON_TLUT_HIGHLIGHTED
+	0x52956B5B,0x8C67FFFF,0xCEB79D6D,0x7B575AD7,0x9BDBB5F3,0x5AD9CC5B,0x8B576AD7,0x52945294,0x52956B5F,0x73A59CE9,0xCE73AD73,0x8C6D5ADB,0x7BEB5AD7,0x5AD7DCFD,0x52945294,0x52945294,0x52956B9F,0x9CEB8467,0xFFFFBDEF,0x5AD7631B,0x5B6BD6FB,0x6E3F5BF9,0x52DB5294,0x52945294,0x52956AD7,0x6AD7939B,0x83575AD5,0x7B17D567,0xBCE35A95,0xBB57EBD5,0x9C1FEEAF,0x52945294,0x52958C65,0x735FDEB7,0xA52B5AD9,0xB5F373EF,0x84B75B6F,0x5AE79B21,0xDEDBFFFF,0xDB5D5294,0x52957AD7,0x8AD76A95,0x9CE9AD6F,0x7BDF8C63,0x9AD7BDF3,0x631BBAD7,0xFFFFD6F7,0xF3195294,
+	// TEX_ATLAS_ARMOR_0
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001234,0x44333400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001533,0x36777200,0x00000123,0x41000000,0x00000122,0x34000000,0x00000122,0x30000000,0x00000588,0x55667900,0x00005633,0x44700000,0x00001522,0x53400000,0x00004122,0x35400000,0x00000566,0x28A77200,0x00788822,0x19987000,0x00678732,0x59976000,0x00678832,0x17976000,0x00000922,0x43555000,0x79998884,0x89999970,0x69998773,0x79979980,0x69998783,0x79999980,0x00000958,0x42585000,0x5999889A,0xB9988970,0x4997883A,0xB9777740,0x4999885A,0xB9777760,0x00000455,0x45663000,0x58887892,0xB9977870,0x18776873,0xB7788840,0x48776873,0xB9788860,0x00000285,0x33685000,0x0000789A,0xB9970500,0x0111483A,0xB7741400,0x0444685C,0xB7744400,0x00003665,0x35855000,0x0000584B,0xB9900000,0x00004832,0x27700000,0x0000485B,0xB9700000,0x00036755,0x86783000,0x000064CD,0xD3310000,0x000053CD,0xD2240000,0x000013AD,0xD2210000,0x00056558,0x67685000,0x0000789B,0x49800000,0x00006832,0x39300000,0x0000485B,0xB7740000,0x00038536,0xA6866000,0x00007898,0x99950000,0x00008778,0x99940000,0x00008778,0x99940000,0x00001148,0x66764000,0x00007898,0x99950000,0x00006778,0x79940000,0x00006778,0x79940000,0x00000046,0x76210000,0x00000555,0x55000000,0x00000144,0x14000000,0x00000444,0x44000000,0x00000001,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000122,0x12333100,0x00000112,0x11233400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000423,0x25665100,0x00005322,0x26666400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000344,0x34556000,0x00000377,0x37866500,0x00000000,0x00000000,0x00000000,0x00000000,0x00000354,0x24766100,0x00000267,0x27966400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000122,0x13433000,0x00000412,0x12332005,0x00000000,0x00000000,0x00000000,0x00000000,0x00000134,0x12342000,0x0000043A,0x41232084,0x00000000,0x00000000,0x00000000,0x00000000,0x00000143,0x13542000,0x00000473,0x13771BC5,0x00000000,0x00000000,0x00000000,0x00000000,0x00001443,0x13543000,0x00054772,0x33773980,0x00000000,0x00000000,0x00000000,0x00000000,0x00189533,0x35433000,0x004CC93A,0x77738C50,0x00000000,0x00000000,0x00000000,0x00000000,0x008AB839,0x85548100,0x009DD939,0x9679C800,0x00000000,0x00000000,0x00000000,0x00000000,0x019BA999,0xB844A100,0x019D8A8D,0xDC79C100,0x00000000,0x00000000,0x00000000,0x00000000,0x0199A98C,0xA899AD00,0x0B99A89E,0xDC999100,0x00000000,0x00000000,0x00000000,0x00000000,0x0001199C,0xAAAAD000,0x001118DE,0xDCCCB000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000999,0xAAA80000,0x000058CD,0x8CC80000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000001A,0x8D100000,0x00000B99,0x98A00000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000005,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	// TEX_ATLAS_ARMOR_TLUT
+	0x00012081,0x72438A81,0x51810081,0x39010101,0x01C10281,0xAD654B0F,0x94C9EF4F,0x00000000,0x00011001,0x8A416141,0x200138C1,0x30016001,0x48017001,0xB525724F,0xAC89EF4F,0x00000000,0x000130C1,0x8A435983,0x004B2957,0x009300E3,0x009B012D,0x94914A9B,0xAD29EF4F,0x00000000,0x00010841,0x28C33903,0x20835185,0x724792C7,0x61C51081,0xAC130000,0x00000000,0x00000000,0x00011883,0x31034945,0x61C57A47,0x92C7C40D,0x3A114A99,0x5B5F7C69,0xB677214B,0x00000000,0x000128C3,0x41035185,0x18830841,0x92C76A05,0x72CF9C13,0x520B3989,0xC519F6E3,0xFFFF0000,
+	// TEX_ATLAS_ARMOR_TLUT_GREYED
+	0x00010843,0x294B318D,0x21090001,0x10850843,0x108518C7,0x6319318D,0x52958421,0x00000000,0x00010001,0x318D2109,0x00011085,0x08431085,0x08431085,0x6319318D,0x52958421,0x00000000,0x00011085,0x318D2109,0x000118C7,0x08431085,0x084318C7,0x5295318D,0x63198421,0x00000000,0x00010001,0x10851085,0x08432109,0x318D39CF,0x21090843,0x52950000,0x00000000,0x00000000,0x00010843,0x108518C7,0x2109318D,0x39CF5295,0x2109318D,0x39CF5295,0x7BDF1085,0x00000000,0x00011085,0x18C72109,0x08430001,0x39CF294B,0x39CF5295,0x294B18C7,0x63198421,0x9CE70000,
+	// TEX_ATLAS_ARMOR_TLUT_HIGHLIGHTED
+	0x52956AD5,0x9C17AC55,0x8B9552D5,0x7B555355,0x53D55455,0xC62D849F,0xB5DBEF5F,0x52945294,0x52955A95,0xAC159355,0x6A957B15,0x72959295,0x82959A95,0xCDED9C1F,0xC59BEF5F,0x52945294,0x52957315,0xAC178B97,0x52DB6B63,0x52E1532B,0x52E75373,0xB59F8467,0xC5EFEF5F,0x52945294,0x52955AD5,0x6B177B57,0x6AD78B97,0x9C19B459,0x93D75AD5,0xC5615294,0x52945294,0x52945294,0x529562D7,0x73578357,0x93D7A419,0xB459D55D,0x7BDF8465,0x8CE9A56F,0xCEF96B5B,0x52945294,0x52956B17,0x7B578B97,0x62D75AD5,0xB4599BD7,0x9C5FBD61,0x8BDB7B9B,0xD5E5F72B,0xFFFF5294,
+	// TEX_ATLAS_HAND_0
+	0x01111111,0x23134310,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11112310,0x11113546,0x66177611,0x11111112,0x31111111,0x11111111,0x11111111,0x11111114,0x41156711,0x11116888,0x67675511,0x11111134,0x43511111,0x11111231,0x11132231,0x11111115,0x71168211,0x11115774,0x68745591,0x11111677,0x73611111,0x11112435,0x52466211,0x11111114,0x75667111,0x11115654,0x78776672,0x11118273,0x33981111,0x11136789,0x66444311,0x11111111,0x69678741,0x11119436,0x66777776,0x11182ABB,0xA2C98111,0x1116699A,0x64442111,0x11111118,0x9872AA11,0x11111367,0x47888874,0x1112ABDB,0xA2C9E111,0x113BA9B6,0x44423C51,0x11111169,0x7351ABC1,0x11111474,0x38767731,0x1182ABBA,0x2CC9E811,0x116BDDA4,0x44225C11,0x11111697,0x3111CA11,0x1111ABC1,0x36446211,0x11E22AA2,0xCC9EE811,0x157BB744,0x4223C511,0x11146678,0x32111111,0x111DBC11,0x15442111,0x11EC222C,0xC99EE811,0x157B9954,0x4225EE11,0x11496733,0x37411111,0x11DBC111,0x19521111,0x118CCCC9,0x999EE811,0x14AAEC44,0x443CEC11,0x11667311,0x11111111,0x1DBC1111,0x11111111,0x11F99999,0x999EEF11,0x57C7BB66,0x233C1111,0x18673111,0x11111111,0xBBC91111,0x11111111,0x1118EEEE,0xE9EE8111,0x1157BB63,0x11111111,0x26831111,0x11111111,0x23911111,0x11111111,0x11118EEE,0xEEEE1111,0x11115151,0x11111111,0x78311111,0x11111111,0x11111111,0x11111111,0x11111F88,0x88F11111,0x11111111,0x11111111,0x13411111,0x11111111,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11111110,0x01111111,0x11111110,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11111111,0x11111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11111111,0x11111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11111123,0x43567111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11118399,0xA4434811,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x111149BB,0xCA494D11,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1112ACB9,0xAAA92811,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1114A99A,0x99E32111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1174444A,0xCEA56111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11735349,0xE4221111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x117544EA,0x55281111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1167AA32,0x27811111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11166676,0xD1111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11111111,0x11111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11111111,0x11111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01111111,0x11111110,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	// TEX_ATLAS_HAND_TLUT
+	0x00000001,0x1885210B,0x525539CF,0x6B5F84A9,0xA5B10843,0x720B8A8D,0x49476189,0x00000000,0x00000001,0x4AA96B43,0xAD1F0841,0x18C1BD85,0x08492117,0x73B5A57D,0x319FFFFF,0x18D10003,0x00000001,0x08CF0847,0x111520C3,0x19594A0F,0xF743B449,0x2A655BAF,0x51C395FB,0x8AC10000,0x00000001,0x188330C3,0x08411041,0x6A494145,0x598782CF,0x01C10301,0x00810000,0x00000000,0x00000001,0x4907718B,0x81CD5949,0x20433085,0x1043B315,0x9A51FE2D,0xD45F0801,0xDB8F0000,
+	// TEX_ATLAS_HAND_TLUT_GREYED
+	0x00000001,0x08431085,0x294B2109,0x42115AD7,0x6B5B0001,0x294B39CF,0x18C72109,0x00000000,0x00000001,0x318D39CF,0x63190001,0x08436319,0x00011085,0x4A536B5B,0x21099CE7,0x10850001,0x00000001,0x08430001,0x10850843,0x18C7294B,0x84215295,0x294B4211,0x21096B5B,0x39CF0000,0x00000001,0x08431085,0x00010001,0x318D18C7,0x210939CF,0x10852109,0x00010000,0x00000000,0x00000001,0x18C7294B,0x294B2109,0x08431085,0x00014A53,0x39CF8421,0x63190001,0x52950000,
+	// TEX_ATLAS_HAND_TLUT_HIGHLIGHTED
+	0x52945295,0x62D76B5B,0x8C237BDF,0x9CE9ADAF,0xBE755AD7,0x9BDBAC5D,0x8359939B,0x52945294,0x52945295,0x846F9CD7,0xC5E95AD5,0x6315CE57,0x5ADB6B63,0x9CF7BE3D,0x73A9FFFF,0x631F5297,0x52945295,0x5B1F5AD9,0x5B636B17,0x636583DF,0xF757CD5B,0x6C2D8CF3,0x8BD7B67B,0xAC555294,0x52945295,0x62D77317,0x5AD55AD5,0x9C1B7B57,0x8B99AC5F,0x53D55495,0x52D55294,0x52945294,0x52945295,0x83599B9B,0xABDD8B5B,0x6AD772D7,0x5AD7CCA3,0xBC1FFEB3,0xDD695A95,0xE4DF5294,
+	// TEX_ATLAS_MAGIC_0
+	0x01111121,0x11132110,0x01111111,0x11123110,0x01111111,0x11232110,0x00000000,0x00000000,0x11111122,0x45443111,0x11111113,0x45554111,0x11111112,0x45553111,0x00000000,0x00000000,0x11116477,0x85543111,0x11113467,0x86654111,0x11112467,0x76653211,0x00000000,0x00000000,0x11657799,0x88553111,0x11267789,0x67664111,0x11367888,0x77654211,0x00000000,0x00000000,0x11877999,0x98553111,0x11977988,0x98664111,0x11978998,0x8A664211,0x00000000,0x00000000,0x12A999B9,0x98893111,0x11A999BC,0x88894111,0x12B9999C,0xDAA84211,0x00000000,0x00000000,0x16AA9BBC,0xD99D3111,0x12AA9BBC,0xC9994111,0x13BB99CC,0xC9893211,0x00000000,0x00000000,0x64AACBCC,0xCDDDE611,0x12AAABBB,0xCDD92111,0x14BBECCC,0xCEEE3211,0x00000000,0x00000000,0x68AAABCC,0xCDDDE611,0x15AAABBB,0xDDD91111,0x15BBBCCC,0xCEEE2211,0x00000000,0x00000000,0x15AA99BD,0xDD9D2211,0x16AADBBB,0xDD991111,0x16BBEDCC,0xCE99F211,0x00000000,0x00000000,0x18AD79B7,0x79991111,0x18AD6CC6,0x69991111,0x1ABEADDA,0xA8992211,0x00000000,0x00000000,0x18A759D7,0x77751111,0x18A85888,0x67781111,0x18B86888,0x6676F111,0x00000000,0x00000000,0x18D58997,0x54211111,0x19D66866,0x54311111,0x19E66876,0x54322111,0x00000000,0x00000000,0x18545F7E,0x22111111,0x18656543,0x11111111,0x1A656543,0xFF221111,0x00000000,0x00000000,0x16332EFE,0x11111111,0x12223111,0x11111111,0x1343FFFF,0x21111111,0x00000000,0x00000000,0x01111662,0x11111110,0x01111111,0x11111110,0x01122211,0x11111110,0x00000000,0x00000000,
+	// TEX_ATLAS_MAGIC_TLUT
+	0x00000001,0x000318CB,0x295739E1,0x00493A7B,0x52AB63FF,0xFFFF577F,0x9FBF957D,0x00970129,0x00000001,0x10870843,0x20CD3191,0x41D739E5,0x629F7BAD,0xFFFFFE0B,0xC415B52F,0x00000000,0x00000001,0x004110C7,0x214D31D1,0x3A5942E5,0x5BE57CE9,0x4B55FFFF,0x7FD94D57,0x9E6B0081,
+	// TEX_ATLAS_MAGIC_TLUT_GREYED
+	0x00000001,0x00011085,0x18C7294B,0x0001318D,0x39CF4A53,0x9CE7739D,0x84216B5B,0x08431085,0x00000001,0x08430001,0x108518C7,0x2109294B,0x318D4A53,0x9CE7739D,0x5AD76B5B,0x00000000,0x00000001,0x00010843,0x18C72109,0x294B318D,0x42115AD7,0x39CF9CE7,0x7BDF5295,0x739D0001,
+	// TEX_ATLAS_MAGIC_TLUT_HIGHLIGHTED
+	0x52945295,0x5297631B,0x6B637BEB,0x52DB7C3B,0x8C71953F,0xFFFF8F7F,0xBFBFB63D,0x52E3536F,0x52945295,0x5AD95AD7,0x6B1D739F,0x7BE37BED,0x9469A4F3,0xFFFFFE9B,0xD563CDF3,0x52945294,0x52945295,0x52D55B19,0x6B5D73DF,0x7C257C6D,0x8D2DA5EF,0x84E3FFFF,0xA7E58623,0xBEF152D5,
+	// TEX_ATLAS_BOTTLE_0
+	0x00010101,0x01020304,0x05060201,0x01010100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010101,0x01010708,0x09040A01,0x01010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010101,0x0B0C0D0E,0x0F10110B,0x02010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010101,0x120B1314,0x15160C0B,0x02010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010101,0x01120B0B,0x0B0B1701,0x01010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010101,0x17181918,0x1A1A0B02,0x01010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010112,0x0C1B1C1D,0x1A0B0B0B,0x0A010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010111,0x0C1E1F20,0x0B0B0B0B,0x17010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010211,0x19201D1A,0x0B0B0B0B,0x0B020101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010A11,0x111A1A0B,0x0B0B0B0B,0x0B0A0101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010211,0x1A0B0B0B,0x0B0B0B0B,0x0B0A0101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0101021A,0x0B0B0B0B,0x0B0B0B0B,0x0B0A0101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0101010B,0x0B0B0B0B,0x1A0C191A,0x0B020101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0101010B,0x1A1A1111,0x110C1618,0x0B020101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01010112,0x0B0B0B1A,0x11201C0C,0x0B010101,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010101,0x01010101,0x01010101,0x01010100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	// TEX_ATLAS_BOTTLE_TLUT
+	0x00000001,0x08437289,0x7B0B6247,0x4987938F,0x9C15834F,0x10832109,0x4A538421,0x7B536AD1,0x520D318D,0x1085318B,0x41CB41CD,0x529518C7,0x421139CF,0x294B7BDF,0x94A55AD7,0xBDEFC631,0x63190000,0x00000000,
+	// TEX_ATLAS_BOTTLE_TLUT_GREYED
+	0x00000001,0x0001318D,0x39CF294B,0x21094A53,0x52954211,0x08431085,0x294B5295,0x421139CF,0x294B18C7,0x084318C7,0x21092109,0x318D0843,0x294B2109,0x18C74A53,0x5AD7318D,0x739D7BDF,0x39CF0000,0x00000000,
+	// TEX_ATLAS_BOTTLE_TLUT_HIGHLIGHTED
+	0x52945295,0x5AD79C5B,0xA49B9419,0x8399B4DF,0xBD63ACDF,0x5AD76B5B,0x8421AD6B,0xA4E19C5F,0x8BDD739D,0x5AD7739B,0x7BDB7BDD,0x8C636319,0x7BDF7BDF,0x6B5BA529,0xB5AD8C63,0xCE73D6B5,0x94A50000,0x00000000,
+};
 
+#endif
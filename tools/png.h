@@ -0,0 +1,153 @@
+#ifndef TOOLS_PNG_H
+#define TOOLS_PNG_H
+
+// Minimal PNG reader for the asset tools: 8-bit greyscale, RGB, palette,
+// grey+alpha and RGBA, non-interlaced. Decodes to 8-bit RGBA. Needs zlib.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+typedef struct {
+	uint32_t width;
+	uint32_t height;
+	uint8_t* rgba; // width * height * 4
+} image_t;
+
+static uint32_t pngRead32(const uint8_t* in) {
+	return ((uint32_t)in[0] << 24) | (in[1] << 16) | (in[2] << 8) | in[3];
+}
+
+static uint8_t pngPaeth(int a, int b, int c) {
+	int p = a + b - c;
+	int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+	if (pa <= pb && pa <= pc) return a;
+	return pb <= pc ? b : c;
+}
+
+// Returns 0 on success and fills image; the caller frees image->rgba
+static int loadPng(const char* path, image_t* image) {
+	static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	static const int channelsForType[7] = { 1, 0, 3, 1, 2, 0, 4 };
+
+	FILE* f = fopen(path, "rb");
+	if (!f) return -1;
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8_t* file = malloc(size);
+	if (fread(file, 1, size, f) != (size_t)size) size = 0;
+	fclose(f);
+
+	if (size < 8 || memcmp(file, signature, 8)) {
+		free(file);
+		return -1;
+	}
+
+	uint32_t width = 0, height = 0;
+	int colorType = -1, depth = 0, interlace = 0;
+	uint8_t palette[256][4];
+	memset(palette, 0xFF, sizeof(palette));
+
+	uint8_t* idat = 0;
+	uint32_t idatSize = 0;
+
+	for (long offset = 8; offset + 12 <= size;) {
+		uint32_t length = pngRead32(&file[offset]);
+		const uint8_t* type = &file[offset + 4];
+		const uint8_t* data = &file[offset + 8];
+		if (offset + 12 + (long)length > size) break;
+
+		if (!memcmp(type, "IHDR", 4)) {
+			width = pngRead32(data);
+			height = pngRead32(data + 4);
+			depth = data[8];
+			colorType = data[9];
+			interlace = data[12];
+		}
+		else if (!memcmp(type, "PLTE", 4)) {
+			for (uint32_t i = 0; i < length / 3 && i < 256; i++) {
+				palette[i][0] = data[i * 3];
+				palette[i][1] = data[i * 3 + 1];
+				palette[i][2] = data[i * 3 + 2];
+			}
+		}
+		else if (!memcmp(type, "tRNS", 4) && colorType == 3) {
+			for (uint32_t i = 0; i < length && i < 256; i++) palette[i][3] = data[i];
+		}
+		else if (!memcmp(type, "IDAT", 4)) {
+			idat = realloc(idat, idatSize + length);
+			memcpy(idat + idatSize, data, length);
+			idatSize += length;
+		}
+		else if (!memcmp(type, "IEND", 4)) break;
+
+		offset += 12 + length;
+	}
+	free(file);
+
+	if (depth != 8 || interlace || colorType < 0 || colorType > 6 || !channelsForType[colorType] || !width || !height) {
+		free(idat);
+		return -1;
+	}
+
+	int channels = channelsForType[colorType];
+	uint32_t stride = width * channels;
+	uLongf rawSize = (stride + 1) * height;
+	uint8_t* raw = malloc(rawSize);
+	if (uncompress(raw, &rawSize, idat, idatSize) != Z_OK || rawSize != (stride + 1) * height) {
+		free(idat);
+		free(raw);
+		return -1;
+	}
+	free(idat);
+
+	// Undo scanline filters in place
+	uint8_t* previous = 0;
+	for (uint32_t y = 0; y < height; y++) {
+		uint8_t* line = &raw[y * (stride + 1)];
+		uint8_t filter = line[0];
+		uint8_t* px = line + 1;
+
+		for (uint32_t x = 0; x < stride; x++) {
+			int a = x >= (uint32_t)channels ? px[x - channels] : 0;
+			int b = previous ? previous[x] : 0;
+			int c = previous && x >= (uint32_t)channels ? previous[x - channels] : 0;
+
+			switch (filter) {
+				case 1: px[x] += a; break;
+				case 2: px[x] += b; break;
+				case 3: px[x] += (a + b) / 2; break;
+				case 4: px[x] += pngPaeth(a, b, c); break;
+			}
+		}
+		previous = px;
+	}
+
+	image->width = width;
+	image->height = height;
+	image->rgba = malloc(width * height * 4);
+
+	for (uint32_t y = 0; y < height; y++) {
+		uint8_t* px = &raw[y * (stride + 1) + 1];
+		for (uint32_t x = 0; x < width; x++) {
+			uint8_t* out = &image->rgba[(y * width + x) * 4];
+			uint8_t* in = &px[x * channels];
+
+			switch (colorType) {
+				case 0: out[0] = out[1] = out[2] = in[0]; out[3] = 0xFF; break;
+				case 2: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = 0xFF; break;
+				case 3: memcpy(out, palette[in[0]], 4); break;
+				case 4: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+				case 6: memcpy(out, in, 4); break;
+			}
+		}
+	}
+
+	free(raw);
+	return 0;
+}
+
+#endif
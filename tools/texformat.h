@@ -0,0 +1,310 @@
+#ifndef TOOLS_TEXFORMAT_H
+#define TOOLS_TEXFORMAT_H
+
+// N64 texture formats for the asset tools. Encodes RGBA8 images to the RDP's
+// I, IA, CI and RGBA formats, decodes them back, and picks the smallest format
+// that stays within MAX_ERROR of the reference image.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define G_IM_FMT_RGBA 0
+#define G_IM_FMT_CI 2
+#define G_IM_FMT_IA 3
+#define G_IM_FMT_I 4
+#define G_IM_SIZ_4b 0
+#define G_IM_SIZ_8b 1
+#define G_IM_SIZ_16b 2
+#define G_IM_SIZ_32b 3
+
+#define MAX_ERROR 8 // Per 8-bit channel, about one RGBA16 step
+#define MAX_PALETTE 256
+
+typedef struct {
+	uint8_t fmt;
+	uint8_t bitsiz;
+	uint8_t tint[3]; // Prim color that I and IA texels are multiplied by
+	uint16_t palette[MAX_PALETTE]; // RGBA5551 TLUT for CI
+	int paletteSize;
+	uint8_t* data;
+	uint32_t size;
+} encoded_t;
+
+static const char* formatNames[5][4] = {
+	{ "RGBA4", "RGBA8", "RGBA16", "RGBA32" },
+	{ "YUV4", "YUV8", "YUV16", "YUV32" },
+	{ "CI4", "CI8", "CI16", "CI32" },
+	{ "IA4", "IA8", "IA16", "IA32" },
+	{ "I4", "I8", "I16", "I32" },
+};
+
+static int texelBits(uint8_t bitsiz) {
+	return 4 << bitsiz;
+}
+
+static uint32_t textureSize(int width, int height, uint8_t bitsiz) {
+	return (width * height * texelBits(bitsiz) + 7) / 8;
+}
+
+///
+/// TEXELS
+///
+
+static uint8_t quantize(uint8_t v, int bits) {
+	int max = (1 << bits) - 1;
+	return (v * max + 127) / 255;
+}
+
+static uint8_t expand(uint8_t v, int bits) {
+	switch (bits) {
+		case 1: return v ? 0xFF : 0;
+		case 3: return (v << 5) | (v << 2) | (v >> 1);
+		case 4: return v * 17;
+		case 5: return (v << 3) | (v >> 2);
+	}
+	return v;
+}
+
+// Fully transparent texels all map to 0 so they share one palette entry
+static uint16_t packRgba5551(const uint8_t* px) {
+	if (px[3] < 0x80) return 0;
+	return (quantize(px[0], 5) << 11) | (quantize(px[1], 5) << 6) | (quantize(px[2], 5) << 1) | 1;
+}
+
+static void unpackRgba5551(uint16_t texel, uint8_t* out) {
+	out[0] = expand((texel >> 11) & 0x1F, 5);
+	out[1] = expand((texel >> 6) & 0x1F, 5);
+	out[2] = expand((texel >> 1) & 0x1F, 5);
+	out[3] = expand(texel & 1, 1);
+}
+
+// Reduce an image to what RGBA16 can hold, for sources that were authored
+// for it
+static void quantizeRgba16(uint8_t* rgba, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) unpackRgba5551(packRgba5551(&rgba[i * 4]), &rgba[i * 4]);
+}
+
+static void putTexel(uint8_t* data, uint32_t index, uint8_t bitsiz, uint32_t value) {
+	switch (bitsiz) {
+		case G_IM_SIZ_4b:
+			data[index / 2] |= (index & 1) ? value & 0xF : (value & 0xF) << 4;
+			break;
+		case G_IM_SIZ_8b:
+			data[index] = value;
+			break;
+		case G_IM_SIZ_16b:
+			data[index * 2] = value >> 8;
+			data[index * 2 + 1] = value;
+			break;
+		case G_IM_SIZ_32b:
+			data[index * 4] = value >> 24;
+			data[index * 4 + 1] = value >> 16;
+			data[index * 4 + 2] = value >> 8;
+			data[index * 4 + 3] = value;
+			break;
+	}
+}
+
+static uint32_t getTexel(const uint8_t* data, uint32_t index, uint8_t bitsiz) {
+	switch (bitsiz) {
+		case G_IM_SIZ_4b: return (index & 1) ? data[index / 2] & 0xF : data[index / 2] >> 4;
+		case G_IM_SIZ_8b: return data[index];
+		case G_IM_SIZ_16b: return (data[index * 2] << 8) | data[index * 2 + 1];
+	}
+	return ((uint32_t)data[index * 4] << 24) | (data[index * 4 + 1] << 16) | (data[index * 4 + 2] << 8) | data[index * 4 + 3];
+}
+
+///
+/// PALETTES
+///
+
+static int findColor(const uint16_t* palette, int size, uint16_t color) {
+	for (int i = 0; i < size; i++) {
+		if (palette[i] == color) return i;
+	}
+	return -1;
+}
+
+// Add the image's colors to the palette; -1 if they do not fit in max entries
+static int buildPalette(uint16_t* palette, int* size, int max, const uint8_t* rgba, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint16_t color = packRgba5551(&rgba[i * 4]);
+		if (findColor(palette, *size, color) >= 0) continue;
+		if (*size == max) return -1;
+		palette[(*size)++] = color;
+	}
+	return 0;
+}
+
+///
+/// ENCODING
+///
+
+// I and IA texels only carry intensity, so a texture qualifies if its visible
+// texels are all one color (drawn with that color as the tint) or all grey
+static int findTint(const uint8_t* rgba, uint32_t count, uint8_t* tint) {
+	int single = 1, grey = 1, first = -1;
+
+	for (uint32_t i = 0; i < count; i++) {
+		const uint8_t* px = &rgba[i * 4];
+		if (!px[3]) continue;
+		if (first < 0) first = i;
+		if (memcmp(px, &rgba[first * 4], 3)) single = 0;
+		if (px[0] != px[1] || px[1] != px[2]) grey = 0;
+	}
+
+	if (single && first >= 0) {
+		memcpy(tint, &rgba[first * 4], 3);
+		return 1;
+	}
+	memset(tint, 0xFF, 3);
+	return grey;
+}
+
+// Encode CI texels against an existing palette
+static void encodeIndexed(encoded_t* out, const uint8_t* rgba, int width, int height, uint8_t bitsiz, const uint16_t* palette, int paletteSize) {
+	out->fmt = G_IM_FMT_CI;
+	out->bitsiz = bitsiz;
+	memset(out->tint, 0xFF, 3);
+	out->size = textureSize(width, height, bitsiz);
+	out->data = calloc(out->size, 1);
+
+	for (int i = 0; i < width * height; i++) {
+		putTexel(out->data, i, bitsiz, findColor(palette, paletteSize, packRgba5551(&rgba[i * 4])));
+	}
+}
+
+// Returns -1 if the image cannot be put in this format at all
+static int encodeTexture(encoded_t* out, const uint8_t* rgba, int width, int height, uint8_t fmt, uint8_t bitsiz) {
+	uint32_t count = width * height;
+	memset(out, 0, sizeof(*out));
+
+	if (fmt == G_IM_FMT_CI) {
+		if (buildPalette(out->palette, &out->paletteSize, 1 << texelBits(bitsiz), rgba, count)) return -1;
+		encodeIndexed(out, rgba, width, height, bitsiz, out->palette, out->paletteSize);
+		return 0;
+	}
+
+	out->fmt = fmt;
+	out->bitsiz = bitsiz;
+	memset(out->tint, 0xFF, 3);
+
+	int single = 0;
+	if (fmt == G_IM_FMT_I || fmt == G_IM_FMT_IA) {
+		single = findTint(rgba, count, out->tint);
+		if (!single) return -1;
+		single = single == 1;
+	}
+
+	out->size = textureSize(width, height, bitsiz);
+	out->data = calloc(out->size, 1);
+
+	for (uint32_t i = 0; i < count; i++) {
+		const uint8_t* px = &rgba[i * 4];
+		uint8_t intensity = single ? 0xFF : px[0];
+		uint32_t texel = 0;
+
+		if (fmt == G_IM_FMT_I) {
+			// Intensity doubles as alpha
+			if (px[3]) texel = bitsiz == G_IM_SIZ_4b ? quantize(intensity, 4) : intensity;
+		}
+		else if (fmt == G_IM_FMT_IA) {
+			if (bitsiz == G_IM_SIZ_4b) texel = (quantize(intensity, 3) << 1) | (px[3] >= 0x80);
+			else if (bitsiz == G_IM_SIZ_8b) texel = (quantize(intensity, 4) << 4) | quantize(px[3], 4);
+			else texel = (intensity << 8) | px[3];
+		}
+		else if (bitsiz == G_IM_SIZ_16b) texel = packRgba5551(px);
+		else texel = ((uint32_t)px[0] << 24) | (px[1] << 16) | (px[2] << 8) | px[3];
+
+		putTexel(out->data, i, bitsiz, texel);
+	}
+	return 0;
+}
+
+static void decodeTexture(const encoded_t* in, int width, int height, uint8_t* rgba) {
+	for (int i = 0; i < width * height; i++) {
+		uint32_t texel = getTexel(in->data, i, in->bitsiz);
+		uint8_t* out = &rgba[i * 4];
+		uint8_t intensity = 0;
+
+		switch (in->fmt) {
+			case G_IM_FMT_CI:
+				unpackRgba5551(in->palette[texel], out);
+				continue;
+			case G_IM_FMT_RGBA:
+				if (in->bitsiz == G_IM_SIZ_16b) unpackRgba5551(texel, out);
+				else for (int c = 0; c < 4; c++) out[c] = texel >> (24 - c * 8);
+				continue;
+			case G_IM_FMT_I:
+				intensity = in->bitsiz == G_IM_SIZ_4b ? expand(texel, 4) : texel;
+				out[3] = intensity;
+				break;
+			case G_IM_FMT_IA:
+				if (in->bitsiz == G_IM_SIZ_4b) {
+					intensity = expand(texel >> 1, 3);
+					out[3] = expand(texel & 1, 1);
+				}
+				else if (in->bitsiz == G_IM_SIZ_8b) {
+					intensity = expand(texel >> 4, 4);
+					out[3] = expand(texel & 0xF, 4);
+				}
+				else {
+					intensity = texel >> 8;
+					out[3] = texel;
+				}
+				break;
+		}
+		for (int c = 0; c < 3; c++) out[c] = (intensity * in->tint[c] + 127) / 255;
+	}
+}
+
+// Invisible texels only need to stay invisible
+static int withinError(const uint8_t* reference, const uint8_t* decoded, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		const uint8_t* a = &reference[i * 4];
+		const uint8_t* b = &decoded[i * 4];
+		if (!a[3] && !b[3]) continue;
+		if (abs(a[3] - b[3]) > MAX_ERROR) return 0;
+		for (int c = 0; c < 3; c++) {
+			if (abs(a[c] - b[c]) > MAX_ERROR) return 0;
+		}
+	}
+	return 1;
+}
+
+static uint32_t encodedCost(const encoded_t* encoded) {
+	return encoded->size + encoded->paletteSize * 2;
+}
+
+// Smallest encoding (texels plus TLUT) that reproduces the reference within
+// MAX_ERROR. RGBA32 is only considered when allowed, RGBA16 always fits an
+// RGBA16 reference.
+static void chooseFormat(encoded_t* best, const uint8_t* rgba, int width, int height, int allowRgba32) {
+	static const uint8_t candidates[][2] = {
+		{ G_IM_FMT_I, G_IM_SIZ_4b }, { G_IM_FMT_IA, G_IM_SIZ_4b }, { G_IM_FMT_CI, G_IM_SIZ_4b },
+		{ G_IM_FMT_I, G_IM_SIZ_8b }, { G_IM_FMT_IA, G_IM_SIZ_8b }, { G_IM_FMT_CI, G_IM_SIZ_8b },
+		{ G_IM_FMT_IA, G_IM_SIZ_16b }, { G_IM_FMT_RGBA, G_IM_SIZ_16b }, { G_IM_FMT_RGBA, G_IM_SIZ_32b },
+	};
+	int numCandidates = sizeof(candidates) / sizeof(candidates[0]) - !allowRgba32;
+	uint32_t count = width * height;
+	uint8_t* decoded = malloc(count * 4);
+
+	best->data = 0;
+	for (int i = 0; i < numCandidates; i++) {
+		encoded_t encoded;
+		if (encodeTexture(&encoded, rgba, width, height, candidates[i][0], candidates[i][1])) continue;
+
+		decodeTexture(&encoded, width, height, decoded);
+		int fits = i == numCandidates - 1 || withinError(rgba, decoded, count);
+		if (fits && (!best->data || encodedCost(&encoded) < encodedCost(best))) {
+			free(best->data);
+			*best = encoded;
+		}
+		else free(encoded.data);
+	}
+
+	free(decoded);
+}
+
+#endif
@@ -0,0 +1,1169 @@
+// Offline texture pipeline for the menu.
+// Converts every PNG under the source directory to the smallest N64 format
+// that holds it (see texformat.h), packs the icons listed in atlas.txt into
+// per-category atlas pages sized to fit TMEM, and writes the .tex blobs, the
+// AllTextures pack (laid out as texturePack.h describes) and the generated
+// textures.h.
+//
+// Build: cc -O2 -o texpack tools/texpack.c -lz -lpthread
+// Usage: texpack [--rom-icons] [--icon-segment <file>] [--jobs <n>] [--cache <dir> | --no-cache]
+//                <png dir> <tex dir> <header>
+//        texpack textures_png textures textures.h
+//
+// Decoding and encoding run on --jobs threads, all cores by default. Every
+// encoded texture, variant and atlas is cached in .texpack-cache (--cache)
+// under a hash of its pixels and settings, and outputs that did not change
+// are not rewritten. Per-stage times and cache hits are printed at the end.
+//
+// --rom-icons leaves out the atlases whose every icon has a game item ID in
+// atlas.txt; their pages are RGBA16 and built at runtime from the game's
+// icon_item_static (iconProvider.h). --icon-segment writes a stand-in for that
+// segment from the bundled icons, for testing the provider on the host.
+//
+// <png dir>/textures.txt sets per-texture options, one "<png path> [option...]"
+// per line:
+//   rgba32    compare against the full 8-bit source and allow RGBA32;
+//             otherwise the source is taken as authored for RGBA16
+//   resident  embed in the overlay; atlas pages always are
+//
+// CI textures get a TLUT entry of their own in the table. Resident textures
+// are placed first in AllTextures so the overlay embeds exactly that prefix of
+// the pack.
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "png.h"
+#include "texformat.h"
+#include "../texturePack.h"
+
+#define TMEM_SIZE 4096
+#define TMEM_TLUT 2048 // CI textures keep their TLUT in the upper half
+#define ICON_SIZE 32 // Source icons get a variant at CELL_SIZE
+#define CELL_SIZE 16 // Size the menu draws icons at; atlases hold these variants
+#define MAX_TEXTURES 1024
+#define MAX_ATLAS_ENTRIES 64
+#define PACK_ALIGN TEXTURE_PACK_ALIGN
+
+typedef struct {
+	char path[256]; // Source png, empty for generated textures
+	char file[256]; // Output, relative to the tex dir
+	char name[64]; // TEX_ identifier suffix
+	uint16_t width;
+	uint16_t height;
+	uint8_t truecolor;
+	uint8_t resident;
+	uint8_t* rgba; // Reference the encoding is checked against
+	encoded_t encoded;
+	int tlut; // Texture index of the TLUT, -1 if none
+	int source; // Texture a downsampled variant was made from, -1 if none
+	uint8_t romIcons; // Atlas page built at runtime from icon_item_static, no data
+	uint32_t offset;
+	int shares; // Texture whose identical data this one's offset points at, -1 if none
+	uint32_t hash; // texturePackHash of the encoded data, set by layoutPack
+} texture_t;
+
+typedef struct {
+	char atlas[32];
+	char path[256];
+	int page; // Texture index of the page
+	int s;
+	int t;
+	int palette; // CI4 palette of the icon within the atlas TLUT
+	int item; // Game item ID of the icon in icon_item_static, -1 for custom art
+} atlasEntry_t;
+
+static texture_t textures[MAX_TEXTURES];
+static int numTextures;
+static atlasEntry_t atlasEntries[MAX_ATLAS_ENTRIES];
+static int numAtlasEntries;
+static int romIcons; // --rom-icons
+
+// "Magic/Din's Fire.png" -> "MAGIC_DINS_FIRE"
+static void makeName(char* out, int size, const char* path) {
+	int n = 0;
+	int gap = 0;
+	for (const char* c = path; *c && strcmp(c, ".png") && n < size - 2; c++) {
+		if (*c == '\'') continue;
+		if ((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9')) {
+			if (gap && n) out[n++] = '_';
+			out[n++] = *c >= 'a' && *c <= 'z' ? *c - 32 : *c;
+			gap = 0;
+		}
+		else gap = 1;
+	}
+	out[n] = 0;
+}
+
+static texture_t* addTexture(void) {
+	if (numTextures == MAX_TEXTURES) {
+		fprintf(stderr, "texpack: more than %d textures\n", MAX_TEXTURES);
+		exit(1);
+	}
+	texture_t* texture = &textures[numTextures++];
+	memset(texture, 0, sizeof(*texture));
+	texture->tlut = -1;
+	texture->source = -1;
+	texture->shares = -1;
+	return texture;
+}
+
+// TLUTs are RGBA16 textures one texel high, named and stored after their owner
+static void addTlut(int owner, const uint16_t* palette, int size) {
+	texture_t* tlut = addTexture();
+	texture_t* texture = &textures[owner];
+
+	snprintf(tlut->name, sizeof(tlut->name), "%.58s_TLUT", texture->name);
+	snprintf(tlut->file, sizeof(tlut->file), "%.*s.tlut", (int)strlen(texture->file) - 4, texture->file);
+	tlut->width = size;
+	tlut->height = 1;
+	tlut->resident = texture->resident;
+	tlut->encoded.fmt = G_IM_FMT_RGBA;
+	tlut->encoded.bitsiz = G_IM_SIZ_16b;
+	memset(tlut->encoded.tint, 0xFF, 3);
+	tlut->encoded.size = size * 2;
+	tlut->encoded.data = malloc(size * 2);
+	for (int i = 0; i < size; i++) putTexel(tlut->encoded.data, i, G_IM_SIZ_16b, palette[i]);
+
+	texture->tlut = tlut - textures;
+}
+
+///
+/// CACHE
+///
+
+// Encoded outputs are cached under a hash of everything they are made from:
+// the pixels, the settings and CACHE_VERSION, which has to be bumped whenever
+// an encoder's output changes. A one-icon edit then only re-encodes that icon,
+// its variant and its atlas.
+#define CACHE_VERSION 1
+#define CACHE_TEXTURE 0
+#define CACHE_VARIANT 1
+#define CACHE_ATLAS 2
+#define CACHE_KINDS 3
+
+static const char* cacheKindNames[CACHE_KINDS] = { "textures", "variants", "atlases" };
+static const char* cacheDir = ".texpack-cache"; // 0 with --no-cache
+static int cacheLookups[CACHE_KINDS];
+static int cacheHits[CACHE_KINDS];
+
+// FNV-1a, 64 bit so distinct outputs do not collide
+static uint64_t cacheHash(uint64_t hash, const void* data, uint32_t size) {
+	const uint8_t* in = (const uint8_t*)data;
+	for (uint32_t i = 0; i < size; i++) hash = (hash ^ in[i]) * 0x100000001B3ull;
+	return hash;
+}
+
+// Start of a key: the kind of output and its settings
+static uint64_t cacheKey(int kind, const int* settings, int numSettings) {
+	int header[2] = { CACHE_VERSION, kind };
+	uint64_t hash = cacheHash(0xCBF29CE484222325ull, header, sizeof(header));
+	return cacheHash(hash, settings, numSettings * sizeof(int));
+}
+
+static void cachePath(char* out, int size, int kind, uint64_t key) {
+	snprintf(out, size, "%.511s/%s/%016llx", cacheDir, cacheKindNames[kind], (unsigned long long)key);
+}
+
+static int writeFile(const char* path, const uint8_t* data, uint32_t size);
+
+// An entry is the encoded_t header, the palette and the data
+static int cacheLoad(int kind, uint64_t key, encoded_t* out) {
+	__sync_fetch_and_add(&cacheLookups[kind], 1);
+	if (!cacheDir) return 0;
+
+	char path[600];
+	cachePath(path, sizeof(path), kind, key);
+	FILE* f = fopen(path, "rb");
+	if (!f) return 0;
+
+	encoded_t entry;
+	int ok = fread(&entry, sizeof(entry), 1, f) == 1 && entry.paletteSize >= 0 && entry.paletteSize <= MAX_PALETTE;
+	if (ok) {
+		entry.data = malloc(entry.size + 1);
+		ok = fread(entry.data, 1, entry.size, f) == entry.size;
+		if (!ok) free(entry.data);
+	}
+	fclose(f);
+	if (!ok) return 0;
+
+	*out = entry;
+	__sync_fetch_and_add(&cacheHits[kind], 1);
+	return 1;
+}
+
+// Written to a file of the job's own and renamed, so concurrent builds never
+// read a partial entry
+static void cacheStore(int kind, uint64_t key, const encoded_t* encoded) {
+	if (!cacheDir) return;
+	char path[600], temp[640];
+	cachePath(path, sizeof(path), kind, key);
+	snprintf(temp, sizeof(temp), "%s.%d.%lx", path, (int)getpid(), (unsigned long)pthread_self());
+
+	uint32_t size = sizeof(encoded_t) + encoded->size;
+	uint8_t* entry = malloc(size);
+	memcpy(entry, encoded, sizeof(encoded_t));
+	((encoded_t*)entry)->data = 0;
+	memcpy(entry + sizeof(encoded_t), encoded->data, encoded->size);
+	if (!writeFile(temp, entry, size)) rename(temp, path);
+	else remove(temp);
+	free(entry);
+}
+
+///
+/// JOBS
+///
+
+// Every core pulls indices off a shared counter until the stage runs out
+static int numThreads; // --jobs, all cores by default
+static int (*jobFunction)(int index);
+static int jobEnd;
+static int nextJob;
+static int jobFailures;
+
+static void* jobWorker(void* unused) {
+	for (int index; (index = __sync_fetch_and_add(&nextJob, 1)) < jobEnd;) {
+		if (jobFunction(index)) __sync_fetch_and_add(&jobFailures, 1);
+	}
+	return unused;
+}
+
+// Run function on the texture indices first..end-1; returns the number that
+// failed
+static int runJobs(int (*function)(int index), int first, int end) {
+	pthread_t threads[64];
+	int spawned = 0;
+	jobFunction = function;
+	jobEnd = end;
+	nextJob = first;
+	jobFailures = 0;
+
+	for (; spawned < numThreads - 1 && spawned < end - first - 1 && spawned < 64; spawned++) {
+		if (pthread_create(&threads[spawned], 0, jobWorker, 0)) break;
+	}
+	jobWorker(0);
+	for (int i = 0; i < spawned; i++) pthread_join(threads[i], 0);
+	return jobFailures;
+}
+
+static double clockMs(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+///
+/// INPUTS
+///
+
+static int comparePaths(const void* a, const void* b) {
+	return strcmp(((const texture_t*)a)->path, ((const texture_t*)b)->path);
+}
+
+static int scanPngs(const char* root, const char* relative) {
+	char dirPath[512];
+	snprintf(dirPath, sizeof(dirPath), "%s/%s", root, relative);
+	DIR* dir = opendir(dirPath);
+	if (!dir) return -1;
+
+	struct dirent* entry;
+	while ((entry = readdir(dir))) {
+		if (entry->d_name[0] == '.') continue;
+
+		char path[256];
+		snprintf(path, sizeof(path), "%.127s%s%.127s", relative, *relative ? "/" : "", entry->d_name);
+
+		char full[800];
+		struct stat st;
+		snprintf(full, sizeof(full), "%s/%s", root, path);
+		if (stat(full, &st)) continue;
+
+		if (S_ISDIR(st.st_mode)) {
+			if (scanPngs(root, path)) {
+				closedir(dir);
+				return -1;
+			}
+		}
+		else if (strlen(path) > 4 && !strcmp(path + strlen(path) - 4, ".png")) {
+			texture_t* texture = addTexture();
+			snprintf(texture->path, sizeof(texture->path), "%s", path);
+			snprintf(texture->file, sizeof(texture->file), "%.*s.tex", (int)strlen(path) - 4, path);
+			makeName(texture->name, sizeof(texture->name), path);
+		}
+	}
+
+	closedir(dir);
+	return 0;
+}
+
+static texture_t* findTexture(const char* path) {
+	for (int i = 0; i < numTextures; i++) {
+		if (!strcmp(textures[i].path, path)) return &textures[i];
+	}
+	return 0;
+}
+
+// Paths contain spaces, so options are taken from the end of the line
+static int readOptions(const char* pngDir) {
+	char manifest[512];
+	snprintf(manifest, sizeof(manifest), "%s/textures.txt", pngDir);
+	FILE* f = fopen(manifest, "r");
+	if (!f) return 0;
+
+	char line[512];
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\r\n")] = 0;
+		if (!line[0] || line[0] == '#') continue;
+
+		uint8_t rgba32 = 0, resident = 0;
+		for (char* space; (space = strrchr(line, ' '));) {
+			if (!strcmp(space + 1, "rgba32")) rgba32 = 1;
+			else if (!strcmp(space + 1, "resident")) resident = 1;
+			else break;
+			*space = 0;
+		}
+
+		texture_t* texture = findTexture(line);
+		if (!texture) {
+			fprintf(stderr, "texpack: %s: no texture %s\n", manifest, line);
+			fclose(f);
+			return -1;
+		}
+		texture->truecolor = rgba32;
+		texture->resident = resident;
+	}
+
+	fclose(f);
+	return 0;
+}
+
+static int readAtlases(const char* pngDir) {
+	char manifest[512];
+	snprintf(manifest, sizeof(manifest), "%s/atlas.txt", pngDir);
+	FILE* f = fopen(manifest, "r");
+	if (!f) return 0;
+
+	char line[512];
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\r\n")] = 0;
+		if (!line[0] || line[0] == '#') continue;
+
+		char* space = strchr(line, ' ');
+		char* path = space ? strchr(space + 1, ' ') : 0;
+		if (!path || numAtlasEntries == MAX_ATLAS_ENTRIES) {
+			fclose(f);
+			return -1;
+		}
+		*space = 0;
+		*path++ = 0;
+
+		atlasEntry_t* entry = &atlasEntries[numAtlasEntries++];
+		snprintf(entry->atlas, sizeof(entry->atlas), "%.31s", line);
+		snprintf(entry->path, sizeof(entry->path), "%s", path);
+		entry->item = strcmp(space + 1, "-") ? (int)strtol(space + 1, 0, 0) : -1;
+		entry->page = -1;
+
+		if (!findTexture(entry->path)) {
+			fprintf(stderr, "texpack: %s: no texture %s\n", manifest, entry->path);
+			fclose(f);
+			return -1;
+		}
+	}
+
+	fclose(f);
+	return 0;
+}
+
+static int loadReference(const char* pngDir, texture_t* texture) {
+	char path[800];
+	image_t image;
+	snprintf(path, sizeof(path), "%.511s/%.255s", pngDir, texture->path);
+	if (loadPng(path, &image)) {
+		fprintf(stderr, "texpack: cannot read %s\n", path);
+		return -1;
+	}
+
+	texture->width = image.width;
+	texture->height = image.height;
+	texture->rgba = image.rgba;
+	if (!texture->truecolor) quantizeRgba16(texture->rgba, image.width * image.height);
+	return 0;
+}
+
+static const char* pngRoot;
+
+static int decodeJob(int index) {
+	return loadReference(pngRoot, &textures[index]);
+}
+
+// The TLUT is added afterwards, in texture order, as the table is shared
+static int encodeJob(int index) {
+	texture_t* texture = &textures[index];
+	int settings[3] = { texture->width, texture->height, texture->truecolor };
+	uint64_t key = cacheHash(cacheKey(CACHE_TEXTURE, settings, 3), texture->rgba, texture->width * texture->height * 4);
+	if (cacheLoad(CACHE_TEXTURE, key, &texture->encoded)) return 0;
+
+	chooseFormat(&texture->encoded, texture->rgba, texture->width, texture->height, texture->truecolor);
+	cacheStore(CACHE_TEXTURE, key, &texture->encoded);
+	return 0;
+}
+
+static void addEncodedTlut(int index) {
+	texture_t* texture = &textures[index];
+	if (texture->encoded.paletteSize && texture->tlut < 0) addTlut(index, texture->encoded.palette, texture->encoded.paletteSize);
+}
+
+///
+/// VARIANTS
+///
+
+// Box filter by an integer factor. Colors are weighted by alpha so
+// transparent texels do not darken the edges.
+static uint8_t* downsample(const uint8_t* rgba, int width, int height, int factor) {
+	int outWidth = width / factor;
+	int outHeight = height / factor;
+	uint8_t* out = malloc(outWidth * outHeight * 4);
+
+	for (int y = 0; y < outHeight; y++) {
+		for (int x = 0; x < outWidth; x++) {
+			uint32_t sum[4] = { 0 };
+			for (int v = 0; v < factor; v++) {
+				for (int u = 0; u < factor; u++) {
+					const uint8_t* px = &rgba[((y * factor + v) * width + x * factor + u) * 4];
+					for (int c = 0; c < 3; c++) sum[c] += px[c] * px[3];
+					sum[3] += px[3];
+				}
+			}
+
+			uint8_t* px = &out[(y * outWidth + x) * 4];
+			for (int c = 0; c < 3; c++) px[c] = sum[3] ? (sum[c] + sum[3] / 2) / sum[3] : 0;
+			px[3] = (sum[3] + factor * factor / 2) / (factor * factor);
+		}
+	}
+	return out;
+}
+
+// Snap filtered texels back onto the source palette, keeping the art's colors
+// and letting the variant share the source's TLUT
+static void remapToPalette(uint8_t* rgba, uint32_t count, const uint16_t* palette, int paletteSize) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint8_t* px = &rgba[i * 4];
+		int best = -1;
+		int bestDistance = 0;
+
+		for (int j = 0; j < paletteSize; j++) {
+			uint8_t color[4];
+			unpackRgba5551(palette[j], color);
+
+			int distance = abs(color[3] - px[3]) * 4;
+			if (px[3] >= 0x80) {
+				for (int c = 0; c < 3; c++) distance += (color[c] - px[c]) * (color[c] - px[c]);
+			}
+			if (best < 0 || distance < bestDistance) {
+				best = j;
+				bestDistance = distance;
+			}
+		}
+		unpackRgba5551(palette[best], px);
+	}
+}
+
+// "Projectile/Fairy Bow.png" -> "Projectile/Fairy Bow_16.tex", TEX_PROJECTILE_FAIRY_BOW_16
+// Table slot for a variant, filled in by variantJob
+static int addVariant(int source, int size) {
+	texture_t* variant = addTexture();
+	texture_t* texture = &textures[source];
+
+	snprintf(variant->name, sizeof(variant->name), "%.58s_%d", texture->name, size);
+	snprintf(variant->file, sizeof(variant->file), "%.*s_%d.tex", (int)strlen(texture->file) - 4, texture->file, size);
+	variant->source = source;
+	variant->width = size;
+	variant->height = size;
+	variant->resident = texture->resident;
+	return variant - textures;
+}
+
+static int variantJob(int index) {
+	texture_t* variant = &textures[index];
+	texture_t* texture = &textures[variant->source];
+	int size = variant->width;
+	variant->rgba = downsample(texture->rgba, texture->width, texture->height, texture->width / size);
+
+	encoded_t* encoded = &texture->encoded;
+	int settings[4] = { size, encoded->fmt, encoded->bitsiz, encoded->paletteSize };
+	uint64_t key = cacheHash(cacheKey(CACHE_VARIANT, settings, 4), encoded->palette, encoded->paletteSize * 2);
+	key = cacheHash(key, variant->rgba, size * size * 4);
+
+	if (encoded->fmt == G_IM_FMT_CI) {
+		// The atlases read the remapped pixels, so this runs on a hit too
+		remapToPalette(variant->rgba, size * size, encoded->palette, encoded->paletteSize);
+		variant->tlut = texture->tlut;
+		if (cacheLoad(CACHE_VARIANT, key, &variant->encoded)) return 0;
+		encodeIndexed(&variant->encoded, variant->rgba, size, size, encoded->bitsiz, encoded->palette, encoded->paletteSize);
+		cacheStore(CACHE_VARIANT, key, &variant->encoded);
+		return 0;
+	}
+
+	quantizeRgba16(variant->rgba, size * size);
+	if (cacheLoad(CACHE_VARIANT, key, &variant->encoded)) return 0;
+	chooseFormat(&variant->encoded, variant->rgba, size, size, 0);
+	cacheStore(CACHE_VARIANT, key, &variant->encoded);
+	return 0;
+}
+
+///
+/// ATLASES
+///
+
+// The icon at the size the menu draws it: the png itself or its variant
+static texture_t* atlasIcon(const char* path) {
+	texture_t* icon = findTexture(path);
+	for (int i = 0; i < numTextures; i++) {
+		texture_t* texture = &textures[i];
+		if ((texture == icon || texture->source == icon - textures) && !texture->truecolor && texture->width == CELL_SIZE && texture->height == CELL_SIZE) {
+			return texture;
+		}
+	}
+	return 0;
+}
+
+// Atlas icons share one TLUT load per atlas. If every icon fits 16 colors
+// the pages are CI4 with one 16-entry palette per icon, else CI8 with a
+// palette shared by the whole atlas, else RGBA16.
+typedef struct {
+	const char* name;
+	int entries[MAX_ATLAS_ENTRIES]; // Unique icons, in manifest order
+	int numIcons;
+	uint8_t bitsiz;
+	uint8_t fmt;
+	uint16_t palette[MAX_PALETTE];
+	int paletteSize;
+	uint8_t romIcons; // Every icon comes from icon_item_static
+} atlas_t;
+
+static void chooseAtlasFormat(atlas_t* atlas) {
+	atlas->fmt = G_IM_FMT_CI;
+	atlas->bitsiz = G_IM_SIZ_4b;
+	atlas->paletteSize = 0;
+
+	// Icons taken from the game are full color
+	if (atlas->romIcons) {
+		atlas->fmt = G_IM_FMT_RGBA;
+		atlas->bitsiz = G_IM_SIZ_16b;
+		return;
+	}
+
+	for (int i = 0; i < atlas->numIcons && atlas->bitsiz == G_IM_SIZ_4b; i++) {
+		texture_t* icon = atlasIcon(atlasEntries[atlas->entries[i]].path);
+		int size = 0;
+		if (atlas->numIcons > MAX_PALETTE / 16 || buildPalette(&atlas->palette[i * 16], &size, 16, icon->rgba, CELL_SIZE * CELL_SIZE)) {
+			atlas->bitsiz = G_IM_SIZ_8b;
+		}
+		else {
+			for (; size < 16; size++) atlas->palette[i * 16 + size] = 0;
+			atlas->paletteSize = (i + 1) * 16;
+		}
+	}
+	if (atlas->bitsiz == G_IM_SIZ_4b) return;
+
+	atlas->paletteSize = 0;
+	for (int i = 0; i < atlas->numIcons; i++) {
+		texture_t* icon = atlasIcon(atlasEntries[atlas->entries[i]].path);
+		if (buildPalette(atlas->palette, &atlas->paletteSize, MAX_PALETTE, icon->rgba, CELL_SIZE * CELL_SIZE)) {
+			atlas->fmt = G_IM_FMT_RGBA;
+			atlas->bitsiz = G_IM_SIZ_16b;
+			atlas->paletteSize = 0;
+			return;
+		}
+	}
+}
+
+// Atlas TLUTs come in TLUT_TINTS variants with consecutive TEX_ ids, so an
+// icon changes state by loading another palette instead of another texture
+#define TLUT_TINTS 3
+static const char* tintNames[TLUT_TINTS] = { "NORMAL", "GREYED", "HIGHLIGHTED" };
+static const char* tintSuffixes[TLUT_TINTS] = { "", "_GREYED", "_HIGHLIGHTED" };
+
+// Greyed is desaturated and dimmed; highlighted is a third of the way to white
+static uint16_t tintTexel(uint16_t texel, int tint) {
+	int r = (texel >> 11) & 0x1F, g = (texel >> 6) & 0x1F, b = (texel >> 1) & 0x1F;
+	if (tint == 1) r = g = b = (r * 77 + g * 150 + b * 29) * 5 / (256 * 8);
+	if (tint == 2) {
+		r += (31 - r) / 3;
+		g += (31 - g) / 3;
+		b += (31 - b) / 3;
+	}
+	return (r << 11) | (g << 6) | (b << 1) | (texel & 1);
+}
+
+// "projectile" -> "ATLAS_PROJECTILE"
+static void atlasName(char* out, int size, const char* atlas) {
+	snprintf(out, size, "ATLAS_%.31s", atlas);
+	for (char* c = out; *c; c++) {
+		if (*c >= 'a' && *c <= 'z') *c -= 32;
+	}
+}
+
+static int addAtlasPage(atlas_t* atlas, int index, int width, int height) {
+	texture_t* page = addTexture();
+	char name[48];
+	atlasName(name, sizeof(name), atlas->name);
+	snprintf(page->name, sizeof(page->name), "%s_%d", name, index);
+	snprintf(page->file, sizeof(page->file), "atlas/%s.tex", page->name);
+
+	page->width = width;
+	page->height = height;
+	page->resident = !atlas->romIcons;
+	page->romIcons = atlas->romIcons;
+	page->encoded.fmt = atlas->fmt;
+	page->encoded.bitsiz = atlas->bitsiz;
+	memset(page->encoded.tint, 0xFF, 3);
+	page->encoded.size = atlas->romIcons ? 0 : textureSize(width, height, atlas->bitsiz);
+	page->encoded.data = calloc(page->encoded.size + 1, 1);
+	return page - textures;
+}
+
+static void blitIcon(atlas_t* atlas, atlasEntry_t* entry, texture_t* icon) {
+	encoded_t encoded;
+	if (atlas->fmt == G_IM_FMT_CI) {
+		int base = atlas->bitsiz == G_IM_SIZ_4b ? entry->palette * 16 : 0;
+		int size = atlas->bitsiz == G_IM_SIZ_4b ? 16 : atlas->paletteSize;
+		encodeIndexed(&encoded, icon->rgba, CELL_SIZE, CELL_SIZE, atlas->bitsiz, &atlas->palette[base], size);
+	}
+	else encodeTexture(&encoded, icon->rgba, CELL_SIZE, CELL_SIZE, G_IM_FMT_RGBA, G_IM_SIZ_16b);
+
+	texture_t* page = &textures[entry->page];
+	int bits = texelBits(atlas->bitsiz);
+	for (int y = 0; y < CELL_SIZE; y++) {
+		memcpy(&page->encoded.data[((entry->t + y) * page->width + entry->s) * bits / 8], &encoded.data[y * CELL_SIZE * bits / 8], CELL_SIZE * bits / 8);
+	}
+	free(encoded.data);
+}
+
+// Pack each atlas's unique icons into pages in manifest order. Entries that
+// repeat a path share the first one's cell.
+static int packAtlases(void) {
+	for (int first = 0; first < numAtlasEntries; first++) {
+		if (atlasEntries[first].page >= 0) continue;
+
+		atlas_t atlas;
+		atlas.name = atlasEntries[first].atlas;
+		atlas.numIcons = 0;
+		atlas.romIcons = romIcons;
+
+		for (int i = first; i < numAtlasEntries; i++) {
+			atlasEntry_t* entry = &atlasEntries[i];
+			if (strcmp(entry->atlas, atlas.name)) continue;
+
+			int shared = 0;
+			for (int j = 0; j < atlas.numIcons; j++) {
+				if (!strcmp(atlasEntries[atlas.entries[j]].path, entry->path)) shared = 1;
+			}
+			if (shared) continue;
+
+			if (!atlasIcon(entry->path)) {
+				fprintf(stderr, "texpack: atlas icon %s must be %dx%d or %dx%d RGBA16\n", entry->path, CELL_SIZE, CELL_SIZE, ICON_SIZE, ICON_SIZE);
+				return -1;
+			}
+			atlas.entries[atlas.numIcons++] = i;
+			if (entry->item < 0) atlas.romIcons = 0;
+		}
+
+		// Cached by the pixels of its icons, in order
+		int settings[2] = { atlas.numIcons, atlas.romIcons };
+		uint64_t key = cacheKey(CACHE_ATLAS, settings, 2);
+		for (int i = 0; i < atlas.numIcons; i++) key = cacheHash(key, atlasIcon(atlasEntries[atlas.entries[i]].path)->rgba, CELL_SIZE * CELL_SIZE * 4);
+		encoded_t cached;
+		int hit = !atlas.romIcons && cacheLoad(CACHE_ATLAS, key, &cached);
+		if (hit) {
+			atlas.fmt = cached.fmt;
+			atlas.bitsiz = cached.bitsiz;
+			atlas.paletteSize = cached.paletteSize;
+			memcpy(atlas.palette, cached.palette, sizeof(atlas.palette));
+		}
+		else chooseAtlasFormat(&atlas);
+
+		int budget = atlas.fmt == G_IM_FMT_CI ? TMEM_TLUT : TMEM_SIZE;
+		int cellsPerPage = budget / textureSize(CELL_SIZE, CELL_SIZE, atlas.bitsiz);
+		int columns = cellsPerPage < 4 ? cellsPerPage : 4;
+		int firstPage = numTextures;
+
+		for (int cell = 0; cell < atlas.numIcons; cell++) {
+			atlasEntry_t* entry = &atlasEntries[atlas.entries[cell]];
+			// Pages only get as many rows as they have icons for
+			if (cell % cellsPerPage == 0) {
+				int cells = atlas.numIcons - cell < cellsPerPage ? atlas.numIcons - cell : cellsPerPage;
+				addAtlasPage(&atlas, cell / cellsPerPage, columns * CELL_SIZE, ((cells + columns - 1) / columns) * CELL_SIZE);
+			}
+
+			int slot = cell % cellsPerPage;
+			entry->page = numTextures - 1;
+			entry->s = (slot % columns) * CELL_SIZE;
+			entry->t = (slot / columns) * CELL_SIZE;
+			entry->palette = atlas.bitsiz == G_IM_SIZ_4b ? cell : 0;
+			if (!atlas.romIcons && !hit) blitIcon(&atlas, entry, atlasIcon(entry->path));
+		}
+
+		// A cache entry holds every page's data back to back
+		if (!atlas.romIcons) {
+			uint32_t offset = 0;
+			if (!hit) {
+				for (int page = firstPage; page < numTextures; page++) offset += textures[page].encoded.size;
+				memset(&cached, 0, sizeof(cached));
+				cached.fmt = atlas.fmt;
+				cached.bitsiz = atlas.bitsiz;
+				cached.paletteSize = atlas.paletteSize;
+				memcpy(cached.palette, atlas.palette, sizeof(atlas.palette));
+				cached.size = offset;
+				cached.data = malloc(offset + 1);
+				offset = 0;
+			}
+			for (int page = firstPage; page < numTextures; page++) {
+				encoded_t* encoded = &textures[page].encoded;
+				if (hit && offset + encoded->size <= cached.size) memcpy(encoded->data, &cached.data[offset], encoded->size);
+				else if (!hit) memcpy(&cached.data[offset], encoded->data, encoded->size);
+				offset += encoded->size;
+			}
+			if (!hit) cacheStore(CACHE_ATLAS, key, &cached);
+			free(cached.data);
+		}
+
+		// One TLUT serves every page of the atlas, followed by its tints
+		if (atlas.paletteSize) {
+			int lastPage = numTextures - 1;
+			int first = numTextures;
+			char name[48];
+			atlasName(name, sizeof(name), atlas.name);
+			for (int tint = 0; tint < TLUT_TINTS; tint++) {
+				uint16_t palette[MAX_PALETTE];
+				for (int i = 0; i < atlas.paletteSize; i++) palette[i] = tintTexel(atlas.palette[i], tint);
+				addTlut(firstPage, palette, atlas.paletteSize);
+				texture_t* tlut = &textures[numTextures - 1];
+				snprintf(tlut->name, sizeof(tlut->name), "%s_TLUT%s", name, tintSuffixes[tint]);
+				snprintf(tlut->file, sizeof(tlut->file), "atlas/%s_TLUT%s.tlut", name, tintSuffixes[tint]);
+			}
+			for (int page = firstPage; page <= lastPage; page++) textures[page].tlut = first;
+		}
+
+		// Repeated entries point at their icon's cell
+		for (int i = first; i < numAtlasEntries; i++) {
+			atlasEntry_t* entry = &atlasEntries[i];
+			if (strcmp(entry->atlas, atlas.name) || entry->page >= 0) continue;
+			for (int j = 0; j < atlas.numIcons; j++) {
+				atlasEntry_t* icon = &atlasEntries[atlas.entries[j]];
+				if (strcmp(icon->path, entry->path)) continue;
+				entry->page = icon->page;
+				entry->s = icon->s;
+				entry->t = icon->t;
+				entry->palette = icon->palette;
+			}
+		}
+	}
+	return 0;
+}
+
+///
+/// OUTPUTS
+///
+
+static int order[MAX_TEXTURES]; // Pack order: resident first, otherwise by path
+static int position[MAX_TEXTURES]; // Inverse of order, the TEX_ id
+static uint32_t residentSize; // Header and resident payload
+static uint32_t payloadSize; // Header and payload
+static uint32_t packSize; // With the index
+static uint8_t* pack;
+static uint32_t sharedSize; // Payload bytes saved by deduplication
+static int numShared;
+
+static uint32_t alignedSize(uint32_t size) {
+	return (size + PACK_ALIGN - 1) & ~(PACK_ALIGN - 1);
+}
+
+// Earlier texture in pack order with the same data, -1 if none. Format and
+// size have to match too, so a CI index block is only shared by textures that
+// read it the same way; their TLUTs are deduplicated on their own.
+static int findShared(int index, int n) {
+	encoded_t* encoded = &textures[index].encoded;
+	for (int i = 0; i < n; i++) {
+		texture_t* other = &textures[order[i]];
+		if (other->shares >= 0 || other->hash != textures[index].hash || other->encoded.size != encoded->size || other->encoded.fmt != encoded->fmt
+			|| other->encoded.bitsiz != encoded->bitsiz || other->width != textures[index].width) continue;
+		if (!memcmp(other->encoded.data, encoded->data, encoded->size)) return order[i];
+	}
+	return -1;
+}
+
+static void layoutPack(void) {
+	int n = 0;
+	packSize = TEXTURE_PACK_HEADER_SIZE;
+	for (int i = 0; i < numTextures; i++) textures[i].hash = texturePackHash(textures[i].encoded.data, textures[i].encoded.size);
+	for (int i = 0; i < numTextures; i++) {
+		if (textures[i].resident && textures[i].tlut >= 0) textures[textures[i].tlut].resident = 1;
+	}
+
+	for (int resident = 1; resident >= 0; resident--) {
+		for (int i = 0; i < numTextures; i++) {
+			if (textures[i].resident != resident) continue;
+			// Resident textures are placed first, so data any of them
+			// uses stays in the embedded prefix
+			textures[i].shares = textures[i].encoded.size ? findShared(i, n) : -1;
+			position[i] = n;
+			order[n++] = i;
+			if (textures[i].shares >= 0) {
+				textures[i].offset = textures[textures[i].shares].offset;
+				sharedSize += alignedSize(textures[i].encoded.size);
+				numShared++;
+				continue;
+			}
+			textures[i].offset = packSize;
+			packSize += alignedSize(textures[i].encoded.size);
+		}
+		if (resident) residentSize = packSize;
+	}
+	payloadSize = packSize;
+}
+
+static void put16(uint8_t* out, uint32_t value) {
+	out[0] = value >> 8;
+	out[1] = value;
+}
+
+static void put32(uint8_t* out, uint32_t value) {
+	put16(out, value >> 16);
+	put16(out + 2, value);
+}
+
+// Lay the header, payload and index out in texturePack.h's format
+static void buildPack(void) {
+	uint32_t numSlots = 1;
+	while (numSlots < (uint32_t)numTextures * 2) numSlots <<= 1;
+	uint32_t namesSize = 0;
+	for (int i = 0; i < numTextures; i++) namesSize += strlen(textures[i].name) + 1;
+
+	uint32_t entriesOffset = payloadSize;
+	uint32_t slotsOffset = entriesOffset + numTextures * TEXTURE_PACK_ENTRY_SIZE;
+	uint32_t namesOffset = slotsOffset + numSlots * 2;
+	packSize = alignedSize(namesOffset + namesSize);
+	pack = calloc(packSize, 1);
+
+	put32(pack, TEXTURE_PACK_MAGIC);
+	put16(pack + 4, TEXTURE_PACK_VERSION);
+	put16(pack + 6, numTextures);
+	put32(pack + 8, packSize);
+	put32(pack + 12, residentSize);
+	put32(pack + 16, entriesOffset);
+	put32(pack + 20, slotsOffset);
+	put32(pack + 24, numSlots);
+	put32(pack + 28, namesOffset);
+
+	uint32_t name = 0;
+	for (int id = 0; id < numTextures; id++) {
+		texture_t* texture = &textures[order[id]];
+		encoded_t* encoded = &texture->encoded;
+		memcpy(&pack[texture->offset], encoded->data, encoded->size);
+
+		uint32_t hash = texturePackHash(texture->name, strlen(texture->name));
+		uint8_t* entry = &pack[entriesOffset + id * TEXTURE_PACK_ENTRY_SIZE];
+		put32(entry, hash);
+		put32(entry + 4, texture->offset);
+		put32(entry + 8, encoded->size);
+		put32(entry + 12, texture->hash);
+		put32(entry + 16, name);
+		put16(entry + 20, texture->width);
+		put16(entry + 22, texture->height);
+		put16(entry + 24, texture->tlut >= 0 ? position[texture->tlut] : 0xFFFF);
+		entry[26] = encoded->fmt;
+		entry[27] = encoded->bitsiz;
+		memcpy(entry + 28, encoded->tint, 3);
+		entry[31] = texture->romIcons ? 1 : 0;
+
+		strcpy((char*)&pack[namesOffset + name], texture->name);
+		name += strlen(texture->name) + 1;
+
+		uint32_t slot = hash & (numSlots - 1);
+		while (texturePackRead16(&pack[slotsOffset + slot * 2])) slot = (slot + 1) & (numSlots - 1);
+		put16(&pack[slotsOffset + slot * 2], id + 1);
+	}
+}
+
+static int filesChecked;
+static int filesWritten;
+
+// Whether path already holds exactly data, so an unchanged output keeps its
+// timestamp and dependent builds stay up to date
+static int fileMatches(const char* path, const uint8_t* data, uint32_t size) {
+	FILE* f = fopen(path, "rb");
+	if (!f) return 0;
+	uint8_t* existing = malloc(size + 1);
+	int matches = fread(existing, 1, size + 1, f) == size && !memcmp(existing, data, size);
+	free(existing);
+	fclose(f);
+	return matches;
+}
+
+static int writeOutput(const char* path, const uint8_t* data, uint32_t size) {
+	filesChecked++;
+	if (fileMatches(path, data, size)) return 0;
+	filesWritten++;
+	return writeFile(path, data, size);
+}
+
+static int writeFile(const char* path, const uint8_t* data, uint32_t size) {
+	char dir[800];
+	snprintf(dir, sizeof(dir), "%s", path);
+	for (char* c = dir + 1; *c; c++) {
+		if (*c != '/') continue;
+		*c = 0;
+		mkdir(dir, 0755);
+		*c = '/';
+	}
+
+	FILE* f = fopen(path, "wb");
+	if (!f) return -1;
+	int written = fwrite(data, 1, size, f) == size;
+	return fclose(f) || !written ? -1 : 0;
+}
+
+static int writeTexFiles(const char* texDir) {
+	for (int i = 0; i < numTextures; i++) {
+		if (textures[i].romIcons) continue;
+		char path[800];
+		snprintf(path, sizeof(path), "%.511s/%s", texDir, textures[i].file);
+		if (writeOutput(path, textures[i].encoded.data, textures[i].encoded.size)) {
+			fprintf(stderr, "texpack: cannot write %s\n", path);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int writePack(const char* texDir) {
+	char path[800];
+	snprintf(path, sizeof(path), "%.511s/AllTextures", texDir);
+	int result = writeOutput(path, pack, packSize);
+	if (result) fprintf(stderr, "texpack: cannot write %s\n", path);
+	return result;
+}
+
+// Formatted into memory first so an unchanged header goes through
+// writeOutput and keeps its timestamp like the other outputs
+static int writeHeader(const char* path, const char* pngDir) {
+	char* text = 0;
+	size_t textSize = 0;
+	FILE* f = open_memstream(&text, &textSize);
+	if (!f) return -1;
+
+	fprintf(f, "#ifndef TEXTURES_H\n#define TEXTURES_H\n\n");
+	fprintf(f, "// Generated by tools/texpack from %s. Do not edit.\n\n", pngDir);
+
+	fprintf(f, "typedef struct {\n");
+	fprintf(f, "\tuint32_t offset; // Into AllTextures, from the start of its header\n");
+	fprintf(f, "\tuint16_t width;\n\tuint16_t height;\n\tuint8_t fmt;\n\tuint8_t bitsiz;\n");
+	fprintf(f, "\tuint16_t tlut; // Texture holding the TLUT of a CI texture, NO_TLUT otherwise\n");
+	fprintf(f, "\tuint8_t tint[3]; // Prim color for I and IA textures\n");
+	fprintf(f, "\tuint8_t source; // TEXTURE_SOURCE_\n");
+	fprintf(f, "} textureInfo_t;\n\n");
+	fprintf(f, "#define TEXTURE_SOURCE_PACK 0\n");
+	fprintf(f, "#define TEXTURE_SOURCE_ROM_ICONS 1 // Atlas page built from icon_item_static, not in AllTextures\n\n");
+
+	for (int i = 0; i < numTextures; i++) fprintf(f, "#define TEX_%s %d\n", textures[order[i]].name, i);
+	int numResident = 0;
+	while (numResident < numTextures && textures[order[numResident]].resident) numResident++;
+	fprintf(f, "\n#define NUM_TEXTURES %d\n", numTextures);
+	fprintf(f, "#define NUM_RESIDENT_TEXTURES %d // TEX_ ids below this are resident\n", numResident);
+	fprintf(f, "#define NO_TLUT 0xFFFF\n");
+	fprintf(f, "#define ICON_NONE 0xFFFF\n");
+	fprintf(f, "#define NUM_TLUT_TINTS %d // An atlas TLUT's tinted variants follow it\n", TLUT_TINTS);
+	for (int tint = 0; tint < TLUT_TINTS; tint++) fprintf(f, "#define TLUT_TINT_%s %d\n", tintNames[tint], tint);
+	for (int i = 0; i < numTextures; i++) {
+		if (!textures[i].romIcons) continue;
+		fprintf(f, "#define ROM_ICON_PAGES\n");
+		break;
+	}
+	fprintf(f, "#define ALL_TEXTURES_SIZE 0x%X\n", packSize);
+	fprintf(f, "#define RESIDENT_TEXTURES_SIZE 0x%X // Leading part of AllTextures, embedded below\n", residentSize);
+	fprintf(f, "#define TEXTURES_PACK_VERSION %d // texturePack.h format of AllTextures\n\n", TEXTURE_PACK_VERSION);
+
+	fprintf(f, "const textureInfo_t textureInfo[NUM_TEXTURES] = {\n");
+	for (int i = 0; i < numTextures; i++) {
+		texture_t* texture = &textures[order[i]];
+		encoded_t* encoded = &texture->encoded;
+		char tlut[80] = "NO_TLUT";
+		if (texture->tlut >= 0) snprintf(tlut, sizeof(tlut), "TEX_%s", textures[texture->tlut].name);
+
+		char shares[300] = "";
+		if (texture->shares >= 0) snprintf(shares, sizeof(shares), ", data of %s", textures[texture->shares].file);
+		fprintf(f, "\t{ 0x%05X, %d, %d, %d, %d, %s, { 0x%02X, 0x%02X, 0x%02X }, %s }, // %s %s%s\n", texture->offset,
+			texture->width, texture->height, encoded->fmt, encoded->bitsiz, tlut, encoded->tint[0], encoded->tint[1],
+			encoded->tint[2], texture->romIcons ? "TEXTURE_SOURCE_ROM_ICONS" : "TEXTURE_SOURCE_PACK",
+			formatNames[encoded->fmt][encoded->bitsiz], texture->romIcons ? "icon_item_static" : texture->file, shares);
+	}
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "#define ATLAS_CELL_SIZE %d\n", CELL_SIZE);
+	fprintf(f, "#define NUM_ATLAS_CELLS %d\n\n", numAtlasEntries);
+	fprintf(f, "// Page texture, s, t, CI4 palette and game item ID for each entry of menu_t.items\n");
+	fprintf(f, "const uint16_t atlasCells[NUM_ATLAS_CELLS][5] = {\n");
+	for (int i = 0; i < numAtlasEntries; i++) {
+		atlasEntry_t* entry = &atlasEntries[i];
+		char item[16] = "ICON_NONE";
+		if (entry->item >= 0) snprintf(item, sizeof(item), "0x%02X", entry->item);
+		fprintf(f, "\t{ TEX_%s, %d, %d, %d, %s }, // %s\n", textures[entry->page].name, entry->s, entry->t, entry->palette, item, entry->path);
+	}
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "uint32_t tResidentTextures[RESIDENT_TEXTURES_SIZE / 4] __attribute__((aligned(8))) = {\n");
+	fprintf(f, "\t// Pack header\n\t");
+	for (uint32_t w = 0; w < TEXTURE_PACK_HEADER_SIZE / 4; w++) fprintf(f, "0x%08X,", texturePackRead32(&pack[w * 4]));
+	fprintf(f, "\n");
+	for (int i = 0; i < numTextures && textures[order[i]].resident; i++) {
+		texture_t* texture = &textures[order[i]];
+		if (texture->shares >= 0) continue;
+		fprintf(f, "\t// TEX_%s\n\t", texture->name);
+		for (uint32_t w = 0; w < alignedSize(texture->encoded.size) / 4; w++) fprintf(f, "0x%08X,", texturePackRead32(&pack[texture->offset + w * 4]));
+		fprintf(f, "\n");
+	}
+	fprintf(f, "};\n\n#endif\n");
+
+	int result = fclose(f) ? -1 : writeOutput(path, (const uint8_t*)text, textSize);
+	free(text);
+	return result;
+}
+
+// Stand-in for icon_item_static: each item's source icon as 32x32 RGBA32 at
+// item * ICON_ITEM_SIZE, the layout iconProvider.h reads
+#define ICON_ITEM_SIZE (ICON_SIZE * ICON_SIZE * 4)
+
+static int writeIconSegment(const char* path) {
+	int maxItem = -1;
+	for (int i = 0; i < numAtlasEntries; i++) {
+		if (atlasEntries[i].item > maxItem) maxItem = atlasEntries[i].item;
+	}
+	uint32_t size = (maxItem + 1) * ICON_ITEM_SIZE;
+	uint8_t* segment = calloc(size + 1, 1);
+
+	for (int i = 0; i < numAtlasEntries; i++) {
+		texture_t* icon = findTexture(atlasEntries[i].path);
+		if (atlasEntries[i].item < 0) continue;
+		if (icon->width != ICON_SIZE || icon->height != ICON_SIZE) {
+			fprintf(stderr, "texpack: %s: game icons are %dx%d\n", icon->path, ICON_SIZE, ICON_SIZE);
+			free(segment);
+			return -1;
+		}
+		memcpy(&segment[atlasEntries[i].item * ICON_ITEM_SIZE], icon->rgba, ICON_ITEM_SIZE);
+	}
+
+	int error = writeFile(path, segment, size);
+	free(segment);
+	return error;
+}
+
+int main(int argc, char** argv) {
+	const char* iconSegment = 0;
+	int arg = 1;
+	for (; arg < argc && argv[arg][0] == '-'; arg++) {
+		if (!strcmp(argv[arg], "--rom-icons")) romIcons = 1;
+		else if (!strcmp(argv[arg], "--icon-segment") && arg + 1 < argc) iconSegment = argv[++arg];
+		else if (!strcmp(argv[arg], "--jobs") && arg + 1 < argc) numThreads = atoi(argv[++arg]);
+		else if (!strcmp(argv[arg], "--cache") && arg + 1 < argc) cacheDir = argv[++arg];
+		else if (!strcmp(argv[arg], "--no-cache")) cacheDir = 0;
+		else break;
+	}
+	if (argc - arg != 3) {
+		fprintf(stderr, "usage: %s [--rom-icons] [--icon-segment <file>] [--jobs <n>] [--cache <dir> | --no-cache] <png dir> <tex dir> <header>\n", argv[0]);
+		return 2;
+	}
+	if (numThreads <= 0) numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (numThreads <= 0) numThreads = 1;
+	const char* pngDir = argv[arg];
+	const char* texDir = argv[arg + 1];
+	const char* header = argv[arg + 2];
+	pngRoot = pngDir;
+
+	#define STAGES 7
+	static const char* stageNames[STAGES] = { "scan", "decode", "encode", "variants", "atlases", "pack", "write" };
+	double stageTimes[STAGES + 1];
+	int stage = 0;
+	stageTimes[stage++] = clockMs();
+
+	if (scanPngs(pngDir, "")) {
+		fprintf(stderr, "texpack: cannot scan %s\n", pngDir);
+		return 1;
+	}
+	qsort(textures, numTextures, sizeof(texture_t), comparePaths);
+	int numPngs = numTextures;
+
+	if (readOptions(pngDir) || readAtlases(pngDir)) return 1;
+	stageTimes[stage++] = clockMs();
+
+	if (runJobs(decodeJob, 0, numPngs)) return 1;
+	stageTimes[stage++] = clockMs();
+
+	runJobs(encodeJob, 0, numPngs);
+	uint32_t rgba16Size = 0;
+	for (int i = 0; i < numPngs; i++) {
+		texture_t* texture = &textures[i];
+		addEncodedTlut(i);
+		rgba16Size += textureSize(texture->width, texture->height, texture->truecolor ? G_IM_SIZ_32b : G_IM_SIZ_16b);
+	}
+	stageTimes[stage++] = clockMs();
+
+	// Icons authored for RGBA16 also get the size the menu draws them at
+	int firstVariant = numTextures;
+	for (int i = 0; i < numPngs; i++) {
+		texture_t* texture = &textures[i];
+		if (texture->width == ICON_SIZE && texture->height == ICON_SIZE && !texture->truecolor) addVariant(i, CELL_SIZE);
+	}
+	int endVariant = numTextures;
+	runJobs(variantJob, firstVariant, endVariant);
+	for (int i = firstVariant; i < endVariant; i++) addEncodedTlut(i);
+	stageTimes[stage++] = clockMs();
+
+	if (packAtlases()) return 1;
+	stageTimes[stage++] = clockMs();
+	layoutPack();
+	buildPack();
+	stageTimes[stage++] = clockMs();
+
+	if (writeTexFiles(texDir) || writePack(texDir)) return 1;
+	if (writeHeader(header, pngDir)) {
+		fprintf(stderr, "texpack: cannot write %s\n", header);
+		return 1;
+	}
+	if (iconSegment && writeIconSegment(iconSegment)) return 1;
+	stageTimes[stage++] = clockMs();
+
+	int formats[5][4] = { 0 };
+	for (int i = 0; i < numTextures; i++) {
+		if (textures[i].rgba) formats[textures[i].encoded.fmt][textures[i].encoded.bitsiz]++;
+	}
+
+	printf("texpack: %d textures, AllTextures %u bytes (%u before TLUTs and atlases as RGBA, %u index), %u resident\n",
+		numTextures, packSize, rgba16Size, packSize - payloadSize, residentSize);
+	printf("texpack:");
+	for (int fmt = 0; fmt < 5; fmt++) {
+		for (int siz = 0; siz < 4; siz++) {
+			if (formats[fmt][siz]) printf(" %s %d", formatNames[fmt][siz], formats[fmt][siz]);
+		}
+	}
+	printf("\n");
+
+	int romPages = 0;
+	uint32_t romSize = 0;
+	for (int i = 0; i < numTextures; i++) {
+		if (!textures[i].romIcons) continue;
+		romPages++;
+		romSize += textureSize(textures[i].width, textures[i].height, textures[i].encoded.bitsiz);
+	}
+	if (numShared) printf("texpack: %d textures share identical data, %u bytes saved\n", numShared, sharedSize);
+	if (romPages) printf("texpack: %d atlas pages (%u bytes) left to build from icon_item_static\n", romPages, romSize);
+
+	printf("texpack: %.1f ms on %d threads:", stageTimes[STAGES] - stageTimes[0], numThreads);
+	for (int i = 0; i < STAGES; i++) printf(" %s %.1f", stageNames[i], stageTimes[i + 1] - stageTimes[i]);
+	printf("\ntexpack: cache %s:", cacheDir ? cacheDir : "off");
+	for (int kind = 0; kind < CACHE_KINDS; kind++) printf(" %s %d/%d", cacheKindNames[kind], cacheHits[kind], cacheLookups[kind]);
+	printf(" hits, %d of %d files rewritten\n", filesWritten, filesChecked);
+	return 0;
+}
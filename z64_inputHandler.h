@@ -1,133 +1,113 @@
 #ifndef Z64INPUT_H
 #define Z64INPUT_H
 
-#define STATE_UP 0
-#define STATE_PRESSED 1
-#define STATE_DOWN 2
+#include "mathUtils.h"
+
+// Button masks in the controller's 16-bit button word
+#define BUTTON_A 0x8000
+#define BUTTON_B 0x4000
+#define BUTTON_Z 0x2000
+#define BUTTON_S 0x1000
+#define BUTTON_DU 0x0800
+#define BUTTON_DD 0x0400
+#define BUTTON_DL 0x0200
+#define BUTTON_DR 0x0100
+#define BUTTON_L 0x0020
+#define BUTTON_R 0x0010
+#define BUTTON_CU 0x0008
+#define BUTTON_CD 0x0004
+#define BUTTON_CL 0x0002
+#define BUTTON_CR 0x0001
+#define BUTTON_ALL 0xFF3F // Everything but the two reserved bits
+#define NUM_BUTTONS 16
+#define INPUT_TIME_SLACK 0.001 // Seconds by which a hold has to pass a delay, so a tie whole frames apart waits whatever rounding made of it
 
 typedef struct {
-	uint8_t buttonOffset;
-	uint8_t buttonState;
-	float invokeTime;
-} button_t;
+	scalar_t delay; // Hold time before the first repeat
+	scalar_t rate; // Interval of the first repeat
+	scalar_t accel; // Each repeat shortens the interval by this much
+	scalar_t floor; // Shortest interval
+} buttonRepeat_t; // Auto-repeat curve for a held button
 
 typedef struct {
 	z64_controller_t* controller;
-	button_t a;
-	button_t b;
-	button_t z;
-	button_t s;
-	button_t du;
-	button_t dd;
-	button_t dl;
-	button_t dr;
-	button_t pad[2];
-	button_t l;
-	button_t r;
-	button_t cu;
-	button_t cd;
-	button_t cl;
-	button_t cr;
+	uint16_t held; // Down this frame
+	uint16_t pressed; // Went down this frame
+	uint16_t down; // Down this frame and the last
+	uint16_t released; // Went up this frame
+	uint16_t repeat; // Went down this frame, or held long enough to fire again
+	uint16_t repeatMask; // Buttons with a repeat curve
+	scalar_t invokeTime[NUM_BUTTONS]; // Time each button went down, 0 while up. Indexed by bit position
+	scalar_t lastRepeat[NUM_BUTTONS];
+	scalar_t repeatInterval[NUM_BUTTONS];
+	buttonRepeat_t repeatCurve[NUM_BUTTONS];
 } z64_inputHandler_t;
 
-void construct_button_t(button_t* button, uint8_t buttonOffset) {
-	button->buttonOffset = buttonOffset;
-	button->buttonState = STATE_UP;
-	button->invokeTime = 0;
-}
-
 void construct_z64_inputHandler_t(z64_inputHandler_t* inputHandler, z64_controller_t* controller) {
 	inputHandler->controller = controller;
-	construct_button_t(&inputHandler->a, 0);
-	construct_button_t(&inputHandler->b, 1);
-	construct_button_t(&inputHandler->z, 2);
-	construct_button_t(&inputHandler->s, 3);
-	construct_button_t(&inputHandler->du, 4);
-	construct_button_t(&inputHandler->dd, 5);
-	construct_button_t(&inputHandler->dl, 6);
-	construct_button_t(&inputHandler->dr, 7);
-	construct_button_t(&inputHandler->l, 10);
-	construct_button_t(&inputHandler->r, 11);
-	construct_button_t(&inputHandler->cu, 12);
-	construct_button_t(&inputHandler->cd, 13);
-	construct_button_t(&inputHandler->cl, 14);
-	construct_button_t(&inputHandler->cr, 15);
+	inputHandler->held = 0;
+	inputHandler->pressed = 0;
+	inputHandler->down = 0;
+	inputHandler->released = 0;
+	inputHandler->repeat = 0;
+	inputHandler->repeatMask = 0;
+	for (int i = 0; i < NUM_BUTTONS; i++) {
+		inputHandler->invokeTime[i] = 0;
+		inputHandler->lastRepeat[i] = 0;
+		inputHandler->repeatInterval[i] = 0;
+		inputHandler->repeatCurve[i].delay = 0;
+		inputHandler->repeatCurve[i].rate = 0;
+		inputHandler->repeatCurve[i].accel = 0;
+		inputHandler->repeatCurve[i].floor = 0;
+	}
 }
 
-inline void updateButton(button_t* thisButton, uint8_t buttonDown, float currentTime) {
-	switch (thisButton->buttonState) 
-	{
-		case(STATE_UP):
-			if (buttonDown) {
-				thisButton->buttonState = STATE_PRESSED;
-				thisButton->invokeTime = currentTime;
-			}
-			break;
+// Give every button in the mask the same repeat curve
+void setButtonRepeat(z64_inputHandler_t* inputHandler, uint16_t buttons, scalar_t delay, scalar_t rate, scalar_t accel, scalar_t floor) {
+	inputHandler->repeatMask |= buttons;
+	for (uint16_t bits = buttons; bits; bits &= bits - 1) {
+		buttonRepeat_t* curve = &inputHandler->repeatCurve[__builtin_ctz(bits)];
+		curve->delay = delay;
+		curve->rate = rate;
+		curve->accel = accel;
+		curve->floor = floor;
+	}
+}
 
-		case(STATE_PRESSED):
-			if (buttonDown) thisButton->buttonState = STATE_DOWN;
-			else {
-				thisButton->buttonState = STATE_UP;
-				thisButton->invokeTime = 0;
-			}
-			break;
+// Read the button word once and derive every edge from it
+void update_z64_inputHandler_t(z64_inputHandler_t* inputHandler, scalar_t currentTime) {
+	uint16_t previous = inputHandler->held;
+	uint16_t held = *(uint16_t*)inputHandler->controller & BUTTON_ALL;
+	uint16_t changed = held ^ previous;
 
-		case(STATE_DOWN):
-			if (!buttonDown) {
-				thisButton->buttonState = STATE_UP;
-				thisButton->invokeTime = 0;
-			}
-			break;
+	inputHandler->held = held;
+	inputHandler->pressed = changed & held;
+	inputHandler->down = held & previous;
+	inputHandler->released = changed & previous;
+
+	for (uint16_t bits = changed; bits; bits &= bits - 1) {
+		int i = __builtin_ctz(bits);
+		inputHandler->invokeTime[i] = (held >> i) & 1 ? currentTime : 0;
+		inputHandler->lastRepeat[i] = inputHandler->invokeTime[i];
+		inputHandler->repeatInterval[i] = inputHandler->repeatCurve[i].rate;
 	}
-}
 
-void update_z64_inputHandler_t(z64_inputHandler_t* inputHandler, float currentTime) {
-	uint8_t buttonDown = inputHandler->controller->a;
-	updateButton(&inputHandler->a, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->b;
-	updateButton(&inputHandler->b, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->z;
-	updateButton(&inputHandler->z, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->s;
-	updateButton(&inputHandler->b, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->b;
-	updateButton(&inputHandler->s, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->du;
-	updateButton(&inputHandler->du, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->dd;
-	updateButton(&inputHandler->dd, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->dl;
-	updateButton(&inputHandler->dl, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->dr;
-	updateButton(&inputHandler->dr, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->l;
-	updateButton(&inputHandler->l, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->r;
-	updateButton(&inputHandler->r, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->cu;
-	updateButton(&inputHandler->cu, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->cd;
-	updateButton(&inputHandler->cd, buttonDown, currentTime);
-	
-	buttonDown = inputHandler->controller->cl;
-	updateButton(&inputHandler->cl, buttonDown, currentTime);
+	// Presses always fire; held buttons fire again once past the start delay and
+	// the current interval, which tightens toward the floor with every repeat
+	inputHandler->repeat = inputHandler->pressed;
+	for (uint16_t bits = inputHandler->down & inputHandler->repeatMask; bits; bits &= bits - 1) {
+		int i = __builtin_ctz(bits);
+		buttonRepeat_t* curve = &inputHandler->repeatCurve[i];
 
-	buttonDown = inputHandler->controller->cr;
-	updateButton(&inputHandler->cr, buttonDown, currentTime);
+		scalar_t heldFor = timeSince(currentTime, inputHandler->invokeTime[i]) - SCALAR(INPUT_TIME_SLACK);
+		scalar_t sinceRepeat = timeSince(currentTime, inputHandler->lastRepeat[i]) - SCALAR(INPUT_TIME_SLACK);
+		if (heldFor > curve->delay && sinceRepeat > inputHandler->repeatInterval[i]) {
+			inputHandler->repeat |= 1 << i;
+			inputHandler->lastRepeat[i] = currentTime;
+			inputHandler->repeatInterval[i] -= curve->accel;
+			if (inputHandler->repeatInterval[i] < curve->floor) inputHandler->repeatInterval[i] = curve->floor;
+		}
+	}
 }
 
 #endif
-
-